@@ -11,13 +11,14 @@
  * - Output in various formats (binary, JSON)
  *
  * Usage:
- *   nmc <input.nms> [-o output] [--ast] [--tokens] [--validate-only] [--verbose]
+ *   nmc <input.nms> [-o output] [--ast] [--tokens] [--validate-only] [--no-optimize] [--strip-debug] [--verbose]
  */
 
 #include "NovelMind/scripting/lexer.hpp"
 #include "NovelMind/scripting/parser.hpp"
 #include "NovelMind/scripting/validator.hpp"
 #include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/bytecode_file.hpp"
 #include "NovelMind/scripting/script_error.hpp"
 #include "NovelMind/core/logger.hpp"
 
@@ -59,6 +60,8 @@ struct CompilerOptions {
     bool showAst = false;
     bool showIr = false;
     bool validateOnly = false;
+    bool noOptimize = false;
+    bool stripDebug = false;
     bool verbose = false;
     bool noColor = false;
     bool help = false;
@@ -82,6 +85,8 @@ void printUsage(const char* programName) {
     std::cout << "  --ast                 Show parsed AST\n";
     std::cout << "  --ir                  Show intermediate representation\n";
     std::cout << "  --validate-only       Only validate, don't compile\n";
+    std::cout << "  --no-optimize         Skip bytecode optimization\n";
+    std::cout << "  --strip-debug         Omit source mappings from the output\n";
     std::cout << "  -v, --verbose         Verbose output\n";
     std::cout << "  --no-color            Disable colored output\n";
     std::cout << "  -h, --help            Show this help message\n";
@@ -117,6 +122,10 @@ CompilerOptions parseArgs(int argc, char* argv[]) {
             opts.showIr = true;
         } else if (arg == "--validate-only") {
             opts.validateOnly = true;
+        } else if (arg == "--no-optimize") {
+            opts.noOptimize = true;
+        } else if (arg == "--strip-debug") {
+            opts.stripDebug = true;
         } else if (arg == "-v" || arg == "--verbose") {
             opts.verbose = true;
         } else if (arg == "--no-color") {
@@ -246,74 +255,8 @@ void printErrors(const NovelMind::scripting::ErrorList& errors, bool useColor) {
 }
 
 bool writeCompiledScript(const NovelMind::scripting::CompiledScript& script,
-                         const std::string& path) {
-    std::ofstream file(path, std::ios::binary);
-    if (!file.is_open()) {
-        return false;
-    }
-
-    // Write magic number
-    const char magic[] = "NMC1";
-    file.write(magic, 4);
-
-    // Write version
-    NovelMind::u32 version = (NOVELMIND_VERSION_MAJOR << 16) |
-                             (NOVELMIND_VERSION_MINOR << 8) |
-                              NOVELMIND_VERSION_PATCH;
-    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-
-    // Write instruction count and instructions
-    NovelMind::u32 instrCount = static_cast<NovelMind::u32>(script.instructions.size());
-    file.write(reinterpret_cast<const char*>(&instrCount), sizeof(instrCount));
-
-    for (const auto& instr : script.instructions) {
-        file.write(reinterpret_cast<const char*>(&instr.opcode), sizeof(instr.opcode));
-        file.write(reinterpret_cast<const char*>(&instr.operand), sizeof(instr.operand));
-    }
-
-    // Write string table
-    NovelMind::u32 strCount = static_cast<NovelMind::u32>(script.stringTable.size());
-    file.write(reinterpret_cast<const char*>(&strCount), sizeof(strCount));
-
-    for (const auto& str : script.stringTable) {
-        NovelMind::u32 len = static_cast<NovelMind::u32>(str.length());
-        file.write(reinterpret_cast<const char*>(&len), sizeof(len));
-        file.write(str.data(), static_cast<std::streamsize>(len));
-    }
-
-    // Write scene entry points
-    NovelMind::u32 sceneCount = static_cast<NovelMind::u32>(script.sceneEntryPoints.size());
-    file.write(reinterpret_cast<const char*>(&sceneCount), sizeof(sceneCount));
-
-    for (const auto& [name, index] : script.sceneEntryPoints) {
-        NovelMind::u32 nameLen = static_cast<NovelMind::u32>(name.length());
-        file.write(reinterpret_cast<const char*>(&nameLen), sizeof(nameLen));
-        file.write(name.data(), static_cast<std::streamsize>(nameLen));
-        file.write(reinterpret_cast<const char*>(&index), sizeof(index));
-    }
-
-    // Write characters
-    NovelMind::u32 charCount = static_cast<NovelMind::u32>(script.characters.size());
-    file.write(reinterpret_cast<const char*>(&charCount), sizeof(charCount));
-
-    for (const auto& [id, ch] : script.characters) {
-        // ID
-        NovelMind::u32 idLen = static_cast<NovelMind::u32>(id.length());
-        file.write(reinterpret_cast<const char*>(&idLen), sizeof(idLen));
-        file.write(id.data(), static_cast<std::streamsize>(idLen));
-
-        // Display name
-        NovelMind::u32 nameLen = static_cast<NovelMind::u32>(ch.displayName.length());
-        file.write(reinterpret_cast<const char*>(&nameLen), sizeof(nameLen));
-        file.write(ch.displayName.data(), static_cast<std::streamsize>(nameLen));
-
-        // Color
-        NovelMind::u32 colorLen = static_cast<NovelMind::u32>(ch.color.length());
-        file.write(reinterpret_cast<const char*>(&colorLen), sizeof(colorLen));
-        file.write(ch.color.data(), static_cast<std::streamsize>(colorLen));
-    }
-
-    return file.good();
+                         const std::string& path, bool includeDebugInfo) {
+    return NovelMind::scripting::writeBytecodeFile(script, path, includeDebugInfo).isOk();
 }
 
 int main(int argc, char* argv[]) {
@@ -454,7 +397,8 @@ int main(int argc, char* argv[]) {
         }
 
         NovelMind::scripting::Compiler compiler;
-        auto compileResult = compiler.compile(program);
+        compiler.setOptimizationEnabled(!opts.noOptimize);
+        auto compileResult = compiler.compile(program, opts.inputFile);
 
         if (!compileResult.isOk()) {
             std::cerr << red << "Compile error: " << reset
@@ -481,7 +425,7 @@ int main(int argc, char* argv[]) {
             std::cout << "Writing " << opts.outputFile << "...\n";
         }
 
-        if (!writeCompiledScript(compiledScript, opts.outputFile)) {
+        if (!writeCompiledScript(compiledScript, opts.outputFile, !opts.stripDebug)) {
             std::cerr << red << "Error: " << reset
                       << "Failed to write output file: " << opts.outputFile << "\n";
             return 1;
@@ -10,15 +10,20 @@
  * - Executable generation
  * - Multi-platform support (Windows, Linux, macOS)
  * - Build logging and progress reporting
+ * - Parallel, incremental builds backed by a content-addressed cache
  */
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/secure_memory.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/core/worker_pool.hpp"
+#include "NovelMind/vfs/pack_layout.hpp"
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -149,6 +154,16 @@ struct BuildConfig {
   bool deterministicBuild = true; // Enable deterministic ordering
   u64 fixedBuildTimestamp = 0;    // If non-zero, use this instead of current time
   u32 fixedRandomSeed = 0;        // If non-zero, use for any randomization
+
+  // Incremental builds - unchanged inputs are served from the build cache
+  bool incrementalBuild = true;
+  std::string buildCachePath;                         // Empty: <project>/.novelmind/build_cache
+  u64 buildCacheMaxBytes = 2ULL * 1024 * 1024 * 1024; // Pruned after each build (0 = no limit)
+  u32 maxParallelJobs = 0;                            // Build workers (0 = one per core)
+
+  // Pack layout - write pack data in first-use order instead of file order
+  bool optimizePackLayout = false;
+  std::string layoutTracePath; // Recorded play trace, one asset ID per line (optional)
 };
 
 /**
@@ -214,6 +229,18 @@ struct BuildResult {
   i64 compressedSize = 0;
   f64 buildTimeMs = 0.0;
 
+  // Incremental build statistics
+  i32 cacheHits = 0;
+  i32 cacheMisses = 0;
+
+  // Share of first-use reads that continue forward in the pack (1.0 = fully
+  // sequential), for the layout that was written and for file order
+  f64 packLocalityScore = 1.0;
+  f64 packLocalityBaseline = 1.0;
+
+  // Pipeline steps in execution order, with their durations
+  std::vector<BuildStep> steps;
+
   // Output files
   std::vector<std::string> outputFiles;
   std::vector<std::string> warnings;
@@ -240,10 +267,114 @@ struct ScriptCompileResult {
   std::vector<std::string> errors;
   std::vector<std::string> warnings;
   i32 bytecodeSize = 0;
+  std::vector<u8> bytecode; // Serialized .nmc image
+  bool fromCache = false;
 };
 
+/**
+ * @brief Content-addressed store for build outputs
+ *
+ * Each output is stored under a key that is the SHA-256 of everything it
+ * depends on: the input bytes plus a settings string describing how they
+ * were processed. Identical inputs built with identical settings therefore
+ * map to the same object, no matter which file they came from.
+ *
+ * A file index remembers the content hash of every source file together
+ * with its size and modification time, so unchanged files are not re-read
+ * on the next build. Entries whose mtime is too recent to be trusted are
+ * not recorded. All methods may be called from several build workers.
+ */
+class BuildCache {
+public:
+  using Digest = std::array<u8, 32>;
+
+  /// Bump to invalidate every cache created by an older pipeline
+  static constexpr u32 FORMAT_VERSION = 1;
+
+  BuildCache() = default;
+  ~BuildCache() = default;
+
+  BuildCache(const BuildCache&) = delete;
+  BuildCache& operator=(const BuildCache&) = delete;
+
+  /**
+   * @brief Open (creating if needed) the cache rooted at a directory
+   */
+  Result<void> open(const std::string& directory);
+
+  /**
+   * @brief Persist the file index and close the cache
+   */
+  Result<void> close();
+
+  [[nodiscard]] bool isOpen() const { return !m_root.empty(); }
+  [[nodiscard]] const std::string& getDirectory() const { return m_root; }
+
+  /**
+   * @brief SHA-256 of a file's contents, reusing the index when the size
+   *        and modification time are unchanged
+   */
+  Result<Digest> hashFile(const std::string& path);
+
+  /**
+   * @brief Derive a cache key from an input digest and processing settings
+   */
+  [[nodiscard]] static std::string makeKey(const Digest& input, const std::string& settings);
+  [[nodiscard]] static std::string toHex(const u8* data, usize size);
+
+  [[nodiscard]] bool contains(const std::string& key) const;
+  Result<std::vector<u8>> load(const std::string& key);
+  Result<void> store(const std::string& key, const std::vector<u8>& data);
+
+  /**
+   * @brief Copy a cached object to a destination file
+   */
+  Result<void> restore(const std::string& key, const std::string& destinationPath);
+
+  /**
+   * @brief Store the contents of a file under a key
+   */
+  Result<void> storeFile(const std::string& key, const std::string& sourcePath);
+
+  /**
+   * @brief Delete least recently used objects until the store fits
+   * @return Number of bytes removed
+   */
+  Result<u64> prune(u64 maxBytes);
+
+  [[nodiscard]] i32 getHits() const { return m_hits.load(); }
+  [[nodiscard]] i32 getMisses() const { return m_misses.load(); }
+  void recordHit() { ++m_hits; }
+  void recordMiss() { ++m_misses; }
+
+private:
+  struct IndexEntry {
+    u64 size = 0;
+    i64 mtime = 0;
+    Digest digest{};
+  };
+
+  [[nodiscard]] std::string objectPath(const std::string& key) const;
+  void loadIndex();
+  Result<void> saveIndex();
+
+  std::string m_root;
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, IndexEntry> m_index;
+  bool m_indexDirty = false;
+  std::atomic<i32> m_hits{0};
+  std::atomic<i32> m_misses{0};
+};
+
+class BuildTaskGroup;
+
 /**
  * @brief Build System - Main build coordinator
+ *
+ * Per-file work (script compilation, asset processing, pack compression)
+ * fans out over a worker pool. Asset processing does not depend on the
+ * scripts, so it is started before the Compile step and joined by the
+ * Index step. Packing waits for both.
  */
 class BuildSystem {
 public:
@@ -358,6 +489,43 @@ private:
   ScriptCompileResult compileScript(const std::string& scriptPath);
   Result<void> compileBytecode(const std::string& outputPath);
 
+  // Parallel execution and incremental build cache
+  core::WorkerPool& workers();
+
+  /**
+   * @brief Run task(i) for every i < count on the build workers and wait
+   * @return Per index, "<labelOf(i)>: <what>" if task(i) threw, else empty
+   */
+  std::vector<std::string> parallelFor(usize count, const std::function<void(usize)>& task,
+                                       const std::function<std::string(usize)>& labelOf,
+                                       const std::function<void(usize, usize)>& onProgress = {});
+  void openBuildCache();
+  void closeBuildCache();
+  void scheduleAssetProcessing();
+
+  /**
+   * @brief Outcome of processing one asset on a build worker
+   */
+  struct AssetBuildRecord {
+    std::string sourcePath;
+    std::string vfsPath;
+    std::string error; // Fatal for the build (e.g. path traversal)
+    AssetProcessResult result{};
+    BuildCache::Digest digest{};
+    u64 sourceSize = 0;
+    bool hashed = false;
+    bool fromCache = false;
+    std::string bundleSourcePath; // Set when a compiled string bundle was staged
+    std::string warning;
+  };
+  void processAssetRecord(AssetBuildRecord& record, const std::string& assetsDir);
+  void compileLocaleBundle(AssetBuildRecord& record, const std::string& outputPath);
+
+  /**
+   * @brief Collect first-use order from the layout trace and compiled scripts
+   */
+  void planPackLayout();
+
   // Asset processing
   AssetProcessResult processImage(const std::string& sourcePath, const std::string& outputPath);
   AssetProcessResult processAudio(const std::string& sourcePath, const std::string& outputPath);
@@ -398,6 +566,18 @@ private:
   std::vector<std::string> m_scriptFiles;
   std::vector<std::string> m_assetFiles;
   std::unordered_map<std::string, std::string> m_assetMapping;
+  std::vector<ScriptCompileResult> m_compiledScripts;
+  std::vector<AssetBuildRecord> m_assetRecords;
+  vfs::PackLayoutPlanner m_layoutPlanner;
+  vfs::LayoutLocality m_layoutLocality;
+  vfs::LayoutLocality m_layoutBaseline;
+
+  // Parallel and incremental build state (tasks are joined before the
+  // pool and the cache they use are destroyed)
+  BuildCache m_cache;
+  std::unique_ptr<core::WorkerPool> m_workers;
+  std::unique_ptr<BuildTaskGroup> m_assetTasks;
+  std::chrono::steady_clock::time_point m_stepStart;
 };
 
 /**
@@ -495,6 +675,11 @@ public:
    */
   void setCompressionLevel(CompressionLevel level);
 
+  /**
+   * @brief Write entries in the planner's first-use order on finalize
+   */
+  void setLayoutPlanner(vfs::PackLayoutPlanner planner);
+
   /**
    * @brief Get pack statistics
    */
@@ -513,6 +698,7 @@ private:
   std::string m_outputPath;
   Core::SecureVector<u8> m_encryptionKey; // Secure storage, zeroed on destruction
   CompressionLevel m_compressionLevel = CompressionLevel::Balanced;
+  vfs::PackLayoutPlanner m_layoutPlanner;
 
   struct PackEntry {
     std::string path;
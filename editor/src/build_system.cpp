@@ -12,19 +12,27 @@
  */
 
 #include "NovelMind/editor/build_system.hpp"
+#include "NovelMind/core/checksum.hpp"
+#include "NovelMind/localization/localization_reader.hpp"
+#include "NovelMind/localization/string_bundle.hpp"
 
+#include "NovelMind/scripting/bytecode_file.hpp"
 #include "NovelMind/scripting/compiler.hpp"
 #include "NovelMind/scripting/lexer.hpp"
 #include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/prefetch_planner.hpp"
 #include "NovelMind/scripting/validator.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iomanip>
+#include <limits>
 #include <map>
 #include <random>
 #include <set>
@@ -207,47 +215,8 @@ Result<void> createDirectories(const std::string& path) {
 // CRC32, SHA-256, Compression, Encryption Static Helpers
 // ============================================================================
 
-// CRC32 lookup table (IEEE 802.3 polynomial)
-static constexpr u32 CRC32_TABLE[256] = {
-    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD706B3, 0x54DE5729, 0x23D967BF,
-    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D};
-
 u32 BuildSystem::calculateCrc32(const u8* data, usize size) {
-  u32 crc = 0xFFFFFFFF;
-  for (usize i = 0; i < size; ++i) {
-    crc = CRC32_TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
-  }
-  return crc ^ 0xFFFFFFFF;
+  return core::crc32(data, size);
 }
 
 std::array<u8, 32> BuildSystem::calculateSha256(const u8* data, usize size) {
@@ -628,7 +597,7 @@ ResourceType BuildSystem::getResourceTypeFromExtension(const std::string& path)
   }
 
   // Localization types
-  if (ext == ".loc" || ext == ".nmloc" || ext == ".po" || ext == ".pot") {
+  if (ext == ".loc" || ext == ".nmloc" || ext == ".nmlb" || ext == ".po" || ext == ".pot") {
     return ResourceType::Localization;
   }
 
@@ -640,6 +609,478 @@ ResourceType BuildSystem::getResourceTypeFromExtension(const std::string& path)
   return ResourceType::Unknown;
 }
 
+// ============================================================================
+// Parallel Build Helpers
+// ============================================================================
+
+/**
+ * @brief Jobs on the build pool that are joined as a unit
+ *
+ * Unlike WorkerPool::waitIdle(), waiting on a group ignores unrelated jobs,
+ * so independent stages can share one pool.
+ */
+class BuildTaskGroup {
+public:
+  explicit BuildTaskGroup(core::WorkerPool& pool) : m_pool(pool) {}
+  ~BuildTaskGroup() { wait(); }
+
+  BuildTaskGroup(const BuildTaskGroup&) = delete;
+  BuildTaskGroup& operator=(const BuildTaskGroup&) = delete;
+
+  /**
+   * @brief Queue @p task on the pool
+   *
+   * An exception escaping the task is written to @p failure as
+   * "<label>: <what>", for the caller to report as a build error.
+   * @p failure must stay alive until wait() returns.
+   */
+  void run(std::function<void()> task, std::string& failure, std::string label) {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ++m_submitted;
+    }
+    m_pool.submit([this, task = std::move(task), &failure, label = std::move(label)]() {
+      try {
+        task();
+      } catch (const std::exception& e) {
+        failure = label + ": " + e.what();
+      } catch (...) {
+        failure = label + ": unknown exception";
+      }
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ++m_completed;
+      m_done.notify_all();
+    });
+  }
+
+  /**
+   * @brief Block until every task has finished
+   * @param onProgress Called periodically with (completed, submitted)
+   */
+  void wait(const std::function<void(usize, usize)>& onProgress = {}) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_completed < m_submitted) {
+      m_done.wait_for(lock, std::chrono::milliseconds(100));
+      if (onProgress) {
+        const usize completed = m_completed;
+        const usize submitted = m_submitted;
+        lock.unlock();
+        onProgress(completed, submitted);
+        lock.lock();
+      }
+    }
+  }
+
+private:
+  core::WorkerPool& m_pool;
+  std::mutex m_mutex;
+  std::condition_variable m_done;
+  usize m_submitted = 0;
+  usize m_completed = 0;
+};
+
+namespace {
+
+constexpr const char* kBuildCacheIndexFile = "index.txt";
+constexpr const char* kBuildCacheIndexMagic = "NMBC-INDEX";
+
+// Index entries for files modified this recently are not trusted: a write
+// within the filesystem's mtime granularity would go unnoticed
+constexpr auto kStableFileAge = std::chrono::seconds(2);
+
+Result<std::vector<u8>> readBinaryFile(const fs::path& path) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    return Result<std::vector<u8>>::error("Cannot read file: " + path.string());
+  }
+  const auto size = file.tellg();
+  file.seekg(0, std::ios::beg);
+  std::vector<u8> data(static_cast<usize>(size));
+  file.read(reinterpret_cast<char*>(data.data()), size);
+  if (!file) {
+    return Result<std::vector<u8>>::error("Failed to read file: " + path.string());
+  }
+  return Result<std::vector<u8>>::ok(std::move(data));
+}
+
+/// Unique sibling path for write-then-rename
+fs::path temporaryPathFor(const fs::path& path) {
+  static std::atomic<u64> counter{0};
+  return fs::path(path.string() + ".tmp" + std::to_string(counter.fetch_add(1)));
+}
+
+/// Replace @p path with @p temporary; a concurrent writer of the same
+/// content-addressed object may already have won, which is fine
+void commitTemporary(const fs::path& temporary, const fs::path& path) {
+  std::error_code ec;
+  fs::rename(temporary, path, ec);
+  if (ec) {
+    fs::remove(temporary, ec);
+  }
+}
+
+bool parseHexDigest(const std::string& hex, BuildCache::Digest& out) {
+  if (hex.size() != out.size() * 2) {
+    return false;
+  }
+  for (usize i = 0; i < out.size(); ++i) {
+    u32 byte = 0;
+    for (usize j = 0; j < 2; ++j) {
+      const char c = hex[i * 2 + j];
+      u32 nibble = 0;
+      if (c >= '0' && c <= '9') {
+        nibble = static_cast<u32>(c - '0');
+      } else if (c >= 'a' && c <= 'f') {
+        nibble = static_cast<u32>(c - 'a' + 10);
+      } else {
+        return false;
+      }
+      byte = (byte << 4) | nibble;
+    }
+    out[i] = static_cast<u8>(byte);
+  }
+  return true;
+}
+
+void appendU32(std::vector<u8>& out, u32 value) {
+  for (i32 i = 0; i < 4; ++i) {
+    out.push_back(static_cast<u8>(value >> (i * 8)));
+  }
+}
+
+bool readU32(const std::vector<u8>& in, usize& offset, u32& value) {
+  if (offset + 4 > in.size()) {
+    return false;
+  }
+  value = 0;
+  for (usize i = 0; i < 4; ++i) {
+    value |= static_cast<u32>(in[offset + i]) << (i * 8);
+  }
+  offset += 4;
+  return true;
+}
+
+// Cached script objects keep the compiler warnings next to the bytecode so
+// a cache hit reports the same diagnostics as a fresh compile:
+// [u32 warningCount] ([u32 length] [bytes])* [bytecode]
+std::vector<u8> encodeCompiledScript(const ScriptCompileResult& result) {
+  std::vector<u8> out;
+  appendU32(out, static_cast<u32>(result.warnings.size()));
+  for (const auto& warning : result.warnings) {
+    appendU32(out, static_cast<u32>(warning.size()));
+    out.insert(out.end(), warning.begin(), warning.end());
+  }
+  out.insert(out.end(), result.bytecode.begin(), result.bytecode.end());
+  return out;
+}
+
+bool decodeCompiledScript(const std::vector<u8>& in, ScriptCompileResult& result) {
+  usize offset = 0;
+  u32 count = 0;
+  if (!readU32(in, offset, count)) {
+    return false;
+  }
+  std::vector<std::string> warnings;
+  for (u32 i = 0; i < count; ++i) {
+    u32 length = 0;
+    if (!readU32(in, offset, length) || offset + length > in.size()) {
+      return false;
+    }
+    warnings.emplace_back(reinterpret_cast<const char*>(in.data() + offset), length);
+    offset += length;
+  }
+  result.warnings = std::move(warnings);
+  result.bytecode.assign(in.begin() + static_cast<std::ptrdiff_t>(offset), in.end());
+  result.bytecodeSize = static_cast<i32>(result.bytecode.size());
+  return true;
+}
+
+} // namespace
+
+// ============================================================================
+// BuildCache Implementation
+// ============================================================================
+
+Result<void> BuildCache::open(const std::string& directory) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::error_code ec;
+  fs::create_directories(fs::path(directory) / "objects", ec);
+  if (ec) {
+    return Result<void>::error("Cannot create build cache at " + directory + ": " + ec.message());
+  }
+
+  m_root = directory;
+  m_index.clear();
+  m_indexDirty = false;
+  m_hits = 0;
+  m_misses = 0;
+  loadIndex();
+  return Result<void>::ok();
+}
+
+Result<void> BuildCache::close() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_root.empty()) {
+    return Result<void>::ok();
+  }
+  auto result = saveIndex();
+  m_root.clear();
+  m_index.clear();
+  m_hits = 0;
+  m_misses = 0;
+  return result;
+}
+
+Result<BuildCache::Digest> BuildCache::hashFile(const std::string& path) {
+  std::error_code ec;
+  const u64 size = static_cast<u64>(fs::file_size(path, ec));
+  if (ec) {
+    return Result<Digest>::error("Cannot stat " + path + ": " + ec.message());
+  }
+  const auto writeTime = fs::last_write_time(path, ec);
+  if (ec) {
+    return Result<Digest>::error("Cannot stat " + path + ": " + ec.message());
+  }
+  const i64 mtime = static_cast<i64>(writeTime.time_since_epoch().count());
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto it = m_index.find(path);
+    if (it != m_index.end() && it->second.size == size && it->second.mtime == mtime) {
+      return Result<Digest>::ok(it->second.digest);
+    }
+  }
+
+  auto data = readBinaryFile(path);
+  if (data.isError()) {
+    return Result<Digest>::error(data.error());
+  }
+  const Digest digest = BuildSystem::calculateSha256(data.value().data(), data.value().size());
+
+  if (fs::file_time_type::clock::now() - writeTime > kStableFileAge) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index[path] = IndexEntry{size, mtime, digest};
+    m_indexDirty = true;
+  }
+  return Result<Digest>::ok(digest);
+}
+
+std::string BuildCache::makeKey(const Digest& input, const std::string& settings) {
+  std::vector<u8> material;
+  material.reserve(8 + input.size() + settings.size());
+  appendU32(material, FORMAT_VERSION);
+  material.insert(material.end(), input.begin(), input.end());
+  material.insert(material.end(), settings.begin(), settings.end());
+  const auto key = BuildSystem::calculateSha256(material.data(), material.size());
+  return toHex(key.data(), key.size());
+}
+
+std::string BuildCache::toHex(const u8* data, usize size) {
+  static constexpr char kDigits[] = "0123456789abcdef";
+  std::string hex;
+  hex.reserve(size * 2);
+  for (usize i = 0; i < size; ++i) {
+    hex.push_back(kDigits[data[i] >> 4]);
+    hex.push_back(kDigits[data[i] & 0x0F]);
+  }
+  return hex;
+}
+
+bool BuildCache::contains(const std::string& key) const {
+  if (!isOpen()) {
+    return false;
+  }
+  std::error_code ec;
+  return fs::exists(objectPath(key), ec);
+}
+
+Result<std::vector<u8>> BuildCache::load(const std::string& key) {
+  if (!isOpen()) {
+    return Result<std::vector<u8>>::error("Build cache is not open");
+  }
+  const fs::path path = objectPath(key);
+  auto data = readBinaryFile(path);
+  if (data.isOk()) {
+    // Touch the object so prune() treats it as recently used
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  }
+  return data;
+}
+
+Result<void> BuildCache::store(const std::string& key, const std::vector<u8>& data) {
+  if (!isOpen()) {
+    return Result<void>::error("Build cache is not open");
+  }
+  const fs::path path = objectPath(key);
+  std::error_code ec;
+  fs::create_directories(path.parent_path(), ec);
+
+  const fs::path temporary = temporaryPathFor(path);
+  {
+    std::ofstream file(temporary, std::ios::binary);
+    if (!file.is_open()) {
+      return Result<void>::error("Cannot write build cache object: " + temporary.string());
+    }
+    file.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+    if (!file) {
+      file.close();
+      fs::remove(temporary, ec);
+      return Result<void>::error("Failed to write build cache object: " + temporary.string());
+    }
+  }
+  commitTemporary(temporary, path);
+  return Result<void>::ok();
+}
+
+Result<void> BuildCache::restore(const std::string& key, const std::string& destinationPath) {
+  if (!isOpen()) {
+    return Result<void>::error("Build cache is not open");
+  }
+  const fs::path path = objectPath(key);
+  std::error_code ec;
+  fs::copy_file(path, destinationPath, fs::copy_options::overwrite_existing, ec);
+  if (ec) {
+    return Result<void>::error("Cannot restore cached object " + key + ": " + ec.message());
+  }
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  return Result<void>::ok();
+}
+
+Result<void> BuildCache::storeFile(const std::string& key, const std::string& sourcePath) {
+  if (!isOpen()) {
+    return Result<void>::error("Build cache is not open");
+  }
+  if (contains(key)) {
+    return Result<void>::ok();
+  }
+  const fs::path path = objectPath(key);
+  std::error_code ec;
+  fs::create_directories(path.parent_path(), ec);
+
+  const fs::path temporary = temporaryPathFor(path);
+  fs::copy_file(sourcePath, temporary, fs::copy_options::overwrite_existing, ec);
+  if (ec) {
+    fs::remove(temporary, ec);
+    return Result<void>::error("Cannot store " + sourcePath + " in build cache: " + ec.message());
+  }
+  commitTemporary(temporary, path);
+  return Result<void>::ok();
+}
+
+Result<u64> BuildCache::prune(u64 maxBytes) {
+  if (!isOpen() || maxBytes == 0) {
+    return Result<u64>::ok(0);
+  }
+
+  struct ObjectInfo {
+    fs::file_time_type lastUsed;
+    u64 size;
+    fs::path path;
+  };
+  std::vector<ObjectInfo> objects;
+  u64 totalBytes = 0;
+
+  std::error_code ec;
+  for (auto it = fs::recursive_directory_iterator(fs::path(m_root) / "objects", ec);
+       !ec && it != fs::recursive_directory_iterator(); it.increment(ec)) {
+    std::error_code entryEc;
+    if (!it->is_regular_file(entryEc)) {
+      continue;
+    }
+    const u64 size = static_cast<u64>(it->file_size(entryEc));
+    const auto lastUsed = it->last_write_time(entryEc);
+    if (entryEc) {
+      continue;
+    }
+    objects.push_back({lastUsed, size, it->path()});
+    totalBytes += size;
+  }
+  if (ec) {
+    return Result<u64>::error("Cannot scan build cache: " + ec.message());
+  }
+  if (totalBytes <= maxBytes) {
+    return Result<u64>::ok(0);
+  }
+
+  std::sort(objects.begin(), objects.end(),
+            [](const ObjectInfo& a, const ObjectInfo& b) { return a.lastUsed < b.lastUsed; });
+
+  u64 removed = 0;
+  for (const auto& object : objects) {
+    if (totalBytes - removed <= maxBytes) {
+      break;
+    }
+    if (fs::remove(object.path, ec)) {
+      removed += object.size;
+    }
+  }
+  return Result<u64>::ok(removed);
+}
+
+std::string BuildCache::objectPath(const std::string& key) const {
+  return (fs::path(m_root) / "objects" / key.substr(0, 2) / key).string();
+}
+
+void BuildCache::loadIndex() {
+  std::ifstream file(fs::path(m_root) / kBuildCacheIndexFile);
+  if (!file.is_open()) {
+    return;
+  }
+
+  std::string magic;
+  u32 version = 0;
+  file >> magic >> version;
+  if (magic != kBuildCacheIndexMagic || version != FORMAT_VERSION) {
+    return;
+  }
+
+  std::string line;
+  std::getline(file, line);
+  while (std::getline(file, line)) {
+    std::istringstream row(line);
+    IndexEntry entry;
+    std::string hex;
+    if (!(row >> entry.size >> entry.mtime >> hex) || !parseHexDigest(hex, entry.digest)) {
+      continue;
+    }
+    std::string path;
+    std::getline(row >> std::ws, path);
+    if (!path.empty()) {
+      m_index[path] = entry;
+    }
+  }
+}
+
+Result<void> BuildCache::saveIndex() {
+  if (!m_indexDirty) {
+    return Result<void>::ok();
+  }
+
+  const fs::path path = fs::path(m_root) / kBuildCacheIndexFile;
+  const fs::path temporary = temporaryPathFor(path);
+  {
+    std::ofstream file(temporary);
+    if (!file.is_open()) {
+      return Result<void>::error("Cannot write build cache index: " + temporary.string());
+    }
+    file << kBuildCacheIndexMagic << ' ' << FORMAT_VERSION << '\n';
+    std::error_code ec;
+    for (const auto& [source, entry] : m_index) {
+      // Forget files that were deleted from the project
+      if (!fs::exists(source, ec)) {
+        continue;
+      }
+      file << entry.size << ' ' << entry.mtime << ' '
+           << toHex(entry.digest.data(), entry.digest.size()) << ' ' << source << '\n';
+    }
+  }
+  commitTemporary(temporary, path);
+  m_indexDirty = false;
+  return Result<void>::ok();
+}
+
 // ============================================================================
 // BuildSystem Implementation
 // ============================================================================
@@ -651,6 +1092,8 @@ BuildSystem::~BuildSystem() {
   if (m_buildThread && m_buildThread->joinable()) {
     m_buildThread->join();
   }
+  m_assetTasks.reset();
+  m_workers.reset();
 }
 
 void BuildSystem::configure(const BuildConfig& config) {
@@ -691,6 +1134,15 @@ Result<void> BuildSystem::startBuild(const BuildConfig& config) {
                       {"Bundle", "Bundling runtime", 0.25f, false, true, "", 0.0},
                       {"Verify", "Verifying build", 0.10f, false, true, "", 0.0}};
 
+  // Reap the previous build thread; it has finished once m_buildInProgress
+  // was cleared
+  if (m_buildThread && m_buildThread->joinable()) {
+    m_buildThread->join();
+  }
+
+  // Recreate the pool so a changed maxParallelJobs takes effect
+  m_workers.reset();
+
   // Start build thread
   m_buildThread = std::make_unique<std::thread>([this]() { runBuildPipeline(); });
 
@@ -799,6 +1251,8 @@ void BuildSystem::runBuildPipeline() {
     }
     fs::create_directories(stagingDir);
 
+    openBuildCache();
+
     // Stage 0: Preflight
     if (!m_cancelRequested) {
       auto result = prepareOutputDirectory();
@@ -808,6 +1262,12 @@ void BuildSystem::runBuildPipeline() {
       }
     }
 
+    // Assets do not depend on the scripts: process them on the pool while
+    // the Compile step runs, and join them in the Index step
+    if (success && !m_cancelRequested) {
+      scheduleAssetProcessing();
+    }
+
     // Stage 1: Compile Scripts
     if (success && !m_cancelRequested) {
       auto result = compileScripts();
@@ -862,9 +1322,14 @@ void BuildSystem::runBuildPipeline() {
         fs::create_directories(finalOutput.parent_path());
       }
 
-      // Remove existing output if present
-      if (fs::exists(finalOutput) && finalOutput != stagingDir) {
-        fs::remove_all(finalOutput);
+      // Remove the previous output, which contains the staging directory
+      // itself
+      if (fs::exists(finalOutput)) {
+        for (const auto& entry : fs::directory_iterator(finalOutput)) {
+          if (entry.path() != stagingDir) {
+            fs::remove_all(entry.path());
+          }
+        }
       }
 
       // Move staging contents to final location
@@ -885,6 +1350,13 @@ void BuildSystem::runBuildPipeline() {
     errorMessage = std::string("Build exception: ") + e.what();
   }
 
+  // Join asset work that an early failure or cancellation left behind
+  m_assetTasks.reset();
+
+  const i32 cacheHits = m_cache.getHits();
+  const i32 cacheMisses = m_cache.getMisses();
+  closeBuildCache();
+
   // Cleanup on failure
   auto cleanupResult = cleanup();
   if (cleanupResult.isError()) {
@@ -905,6 +1377,11 @@ void BuildSystem::runBuildPipeline() {
   m_lastResult.assetsProcessed = static_cast<i32>(m_assetFiles.size());
   m_lastResult.warnings =
       std::vector<std::string>(m_progress.warnings.begin(), m_progress.warnings.end());
+  m_lastResult.cacheHits = cacheHits;
+  m_lastResult.cacheMisses = cacheMisses;
+  m_lastResult.packLocalityScore = m_layoutLocality.score();
+  m_lastResult.packLocalityBaseline = m_layoutBaseline.score();
+  m_lastResult.steps = m_progress.steps;
 
   // Calculate output size
   if (success && fs::exists(m_config.outputPath)) {
@@ -926,6 +1403,196 @@ void BuildSystem::runBuildPipeline() {
   m_buildInProgress = false;
 }
 
+core::WorkerPool& BuildSystem::workers() {
+  if (!m_workers) {
+    usize threadCount = m_config.maxParallelJobs;
+    if (threadCount == 0) {
+      threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    m_workers = std::make_unique<core::WorkerPool>(threadCount);
+  }
+  return *m_workers;
+}
+
+std::vector<std::string>
+BuildSystem::parallelFor(usize count, const std::function<void(usize)>& task,
+                         const std::function<std::string(usize)>& labelOf,
+                         const std::function<void(usize, usize)>& onProgress) {
+  std::vector<std::string> failures(count);
+  if (count == 0) {
+    return failures;
+  }
+  BuildTaskGroup group(workers());
+  for (usize i = 0; i < count; ++i) {
+    group.run([&task, i]() { task(i); }, failures[i], labelOf(i));
+  }
+  group.wait(onProgress);
+  return failures;
+}
+
+void BuildSystem::openBuildCache() {
+  if (!m_config.incrementalBuild) {
+    return;
+  }
+
+  const std::string directory =
+      m_config.buildCachePath.empty()
+          ? (fs::path(m_config.projectPath) / ".novelmind" / "build_cache").string()
+          : m_config.buildCachePath;
+  auto result = m_cache.open(directory);
+  if (result.isError()) {
+    m_progress.warnings.push_back("Incremental build disabled: " + result.error());
+  }
+}
+
+void BuildSystem::closeBuildCache() {
+  if (!m_cache.isOpen()) {
+    return;
+  }
+
+  auto pruned = m_cache.prune(m_config.buildCacheMaxBytes);
+  if (pruned.isError()) {
+    m_progress.warnings.push_back(pruned.error());
+  } else if (pruned.value() > 0) {
+    logMessage("Pruned " + BuildUtils::formatFileSize(static_cast<i64>(pruned.value())) +
+                   " from the build cache",
+               false);
+  }
+
+  auto closed = m_cache.close();
+  if (closed.isError()) {
+    m_progress.warnings.push_back(closed.error());
+  }
+}
+
+void BuildSystem::scheduleAssetProcessing() {
+  fs::path assetsDir = fs::path(m_config.outputPath) / ".staging" / "assets";
+  fs::create_directories(assetsDir);
+
+  m_assetRecords.assign(m_assetFiles.size(), AssetBuildRecord{});
+  m_assetTasks = std::make_unique<BuildTaskGroup>(workers());
+  for (usize i = 0; i < m_assetFiles.size(); ++i) {
+    m_assetRecords[i].sourcePath = m_assetFiles[i];
+    m_assetTasks->run(
+        [this, i, dir = assetsDir.string()]() {
+          if (!m_cancelRequested) {
+            processAssetRecord(m_assetRecords[i], dir);
+          }
+        },
+        m_assetRecords[i].error, "Asset processing failed for " + m_assetFiles[i]);
+  }
+}
+
+void BuildSystem::processAssetRecord(AssetBuildRecord& record, const std::string& assetsDir) {
+  const std::string& assetPath = record.sourcePath;
+
+  // Determine asset type and process accordingly
+  std::string ext = fs::path(assetPath).extension().string();
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+  fs::path relativePath = fs::relative(assetPath, fs::path(m_config.projectPath) / "assets");
+  record.vfsPath = normalizeVfsPath(relativePath.string());
+
+  // Security: Validate output path to prevent path traversal attacks
+  auto sanitizedPathResult = sanitizeOutputPath(assetsDir, relativePath.string());
+  if (sanitizedPathResult.isError()) {
+    record.error = sanitizedPathResult.error();
+    return;
+  }
+  fs::path outputPath = sanitizedPathResult.value();
+
+  // Create output directory
+  std::error_code ec;
+  fs::create_directories(outputPath.parent_path(), ec);
+
+  // The content hash feeds both the cache key and the resource manifest
+  auto digest = m_cache.hashFile(assetPath);
+  if (digest.isOk()) {
+    record.digest = digest.value();
+    record.sourceSize = static_cast<u64>(fs::file_size(assetPath, ec));
+    record.hashed = true;
+  }
+
+  // Processing currently depends only on the file type; settings that
+  // start to affect it must be added to this key
+  std::string cacheKey;
+  if (record.hashed && m_cache.isOpen()) {
+    cacheKey = BuildCache::makeKey(record.digest, "asset|" + ext);
+    if (m_cache.contains(cacheKey) && m_cache.restore(cacheKey, outputPath.string()).isOk()) {
+      record.result.sourcePath = assetPath;
+      record.result.outputPath = outputPath.string();
+      record.result.originalSize = static_cast<i64>(record.sourceSize);
+      record.result.processedSize = static_cast<i64>(fs::file_size(outputPath, ec));
+      record.result.success = true;
+      record.fromCache = true;
+      m_cache.recordHit();
+      compileLocaleBundle(record, outputPath.string());
+      return;
+    }
+    m_cache.recordMiss();
+  }
+
+  if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp") {
+    record.result = processImage(assetPath, outputPath.string());
+  } else if (ext == ".ogg" || ext == ".wav" || ext == ".mp3") {
+    record.result = processAudio(assetPath, outputPath.string());
+  } else if (ext == ".ttf" || ext == ".otf") {
+    record.result = processFont(assetPath, outputPath.string());
+  } else {
+    record.result = processData(assetPath, outputPath.string());
+  }
+
+  if (record.result.success && !cacheKey.empty()) {
+    // A failed cache write only costs a reprocess next time
+    (void)m_cache.storeFile(cacheKey, outputPath.string());
+  }
+  if (record.result.success) {
+    compileLocaleBundle(record, outputPath.string());
+  }
+}
+
+void BuildSystem::compileLocaleBundle(AssetBuildRecord& record, const std::string& outputPath) {
+  // String tables under locales/ also ship as a compiled bundle
+  // (locales/<locale>.nmlb) that the runtime maps without parsing
+  if (record.vfsPath.rfind("locales/", 0) != 0) {
+    return;
+  }
+  const fs::path sourcePath(record.sourcePath);
+  std::string ext = sourcePath.extension().string();
+  std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  if (ext != ".json" && ext != ".csv" && ext != ".po") {
+    return;
+  }
+
+  std::ifstream file(sourcePath, std::ios::binary);
+  if (!file.is_open()) {
+    record.warning = "Cannot read string table: " + record.sourcePath;
+    return;
+  }
+  std::ostringstream content;
+  content << file.rdbuf();
+  const std::string text = content.str();
+
+  localization::StringTable table(
+      localization::LocaleId::fromString(sourcePath.stem().string()));
+  Result<void> parsed = ext == ".json"  ? localization::readJSON(text, table)
+                        : ext == ".csv" ? localization::readCSV(text, table)
+                                        : localization::readPO(text, table);
+  if (parsed.isError()) {
+    record.warning = "String table " + record.sourcePath + ": " + parsed.error();
+    return;
+  }
+
+  const std::string bundlePath = fs::path(outputPath).replace_extension(".nmlb").string();
+  auto written = localization::StringBundle::compileToFile(table, bundlePath);
+  if (written.isError()) {
+    record.warning = "Failed to compile string bundle for " + record.sourcePath + ": " +
+                     written.error();
+    return;
+  }
+  record.bundleSourcePath = fs::path(record.sourcePath).replace_extension(".nmlb").string();
+}
+
 Result<void> BuildSystem::prepareOutputDirectory() {
   beginStep("Preflight", "Validating project and preparing output");
 
@@ -1022,44 +1689,56 @@ Result<void> BuildSystem::compileScripts() {
   fs::path compiledDir = stagingDir / "compiled";
   fs::create_directories(compiledDir);
 
-  i32 compiled = 0;
-  std::vector<ScriptCompileResult> results;
-
-  for (const auto& scriptPath : m_scriptFiles) {
-    if (m_cancelRequested) {
-      endStep(false, "Cancelled");
-      return Result<void>::error("Build cancelled");
-    }
-
-    f32 progress = static_cast<f32>(compiled) / static_cast<f32>(m_scriptFiles.size());
-    updateProgress(progress, "Compiling: " + fs::path(scriptPath).filename().string());
+  // Scripts compile independently; results keep m_scriptFiles order so the
+  // bundle stays deterministic
+  m_compiledScripts.assign(m_scriptFiles.size(), ScriptCompileResult{});
+  const auto failures = parallelFor(
+      m_scriptFiles.size(),
+      [this](usize index) {
+        if (!m_cancelRequested) {
+          m_compiledScripts[index] = compileScript(m_scriptFiles[index]);
+        }
+      },
+      [this](usize index) { return m_scriptFiles[index]; },
+      [this](usize done, usize total) {
+        updateProgress(static_cast<f32>(done) / static_cast<f32>(total),
+                       "Compiling scripts (" + std::to_string(done) + "/" +
+                           std::to_string(total) + ")");
+      });
 
-    auto result = compileScript(scriptPath);
-    results.push_back(result);
+  if (m_cancelRequested) {
+    endStep(false, "Cancelled");
+    return Result<void>::error("Build cancelled");
+  }
 
+  i32 compiled = 0;
+  i32 cached = 0;
+  bool hasErrors = false;
+  for (const auto& failure : failures) {
+    if (!failure.empty()) {
+      hasErrors = true;
+      m_progress.errors.push_back(failure);
+    }
+  }
+  for (const auto& result : m_compiledScripts) {
     if (!result.success) {
+      hasErrors = true;
       for (const auto& err : result.errors) {
-        m_progress.errors.push_back(scriptPath + ": " + err);
+        m_progress.errors.push_back(result.sourcePath + ": " + err);
       }
     }
 
     for (const auto& warn : result.warnings) {
-      m_progress.warnings.push_back(scriptPath + ": " + warn);
+      m_progress.warnings.push_back(result.sourcePath + ": " + warn);
     }
 
+    if (result.fromCache) {
+      cached++;
+    }
     compiled++;
     m_progress.filesProcessed++;
   }
 
-  // Check for compilation errors
-  bool hasErrors = false;
-  for (const auto& result : results) {
-    if (!result.success) {
-      hasErrors = true;
-      break;
-    }
-  }
-
   if (hasErrors) {
     endStep(false, "Script compilation failed");
     return Result<void>::error("One or more scripts failed to compile");
@@ -1072,7 +1751,9 @@ Result<void> BuildSystem::compileScripts() {
     return bundleResult;
   }
 
-  logMessage("Compiled " + std::to_string(compiled) + " scripts successfully", false);
+  logMessage("Compiled " + std::to_string(compiled) + " scripts successfully (" +
+                 std::to_string(cached) + " from build cache)",
+             false);
   endStep(true);
   return Result<void>::ok();
 }
@@ -1087,62 +1768,58 @@ Result<void> BuildSystem::processAssets() {
   }
 
   fs::path stagingDir = fs::path(m_config.outputPath) / ".staging";
-  fs::path assetsDir = stagingDir / "assets";
-  fs::create_directories(assetsDir);
 
-  i32 processed = 0;
-  m_assetMapping.clear();
-
-  for (const auto& assetPath : m_assetFiles) {
-    if (m_cancelRequested) {
-      endStep(false, "Cancelled");
-      return Result<void>::error("Build cancelled");
-    }
-
-    f32 progress = static_cast<f32>(processed) / static_cast<f32>(m_assetFiles.size());
-    updateProgress(progress, "Processing: " + fs::path(assetPath).filename().string());
+  // Normally started right after Preflight; schedule here if not
+  if (!m_assetTasks) {
+    scheduleAssetProcessing();
+  }
+  m_assetTasks->wait([this](usize done, usize total) {
+    updateProgress(static_cast<f32>(done) / static_cast<f32>(total),
+                   "Processing assets (" + std::to_string(done) + "/" +
+                       std::to_string(total) + ")");
+  });
+  m_assetTasks.reset();
 
-    // Determine asset type and process accordingly
-    std::string ext = fs::path(assetPath).extension().string();
-    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+  if (m_cancelRequested) {
+    endStep(false, "Cancelled");
+    return Result<void>::error("Build cancelled");
+  }
 
-    fs::path relativePath = fs::relative(assetPath, fs::path(m_config.projectPath) / "assets");
+  i32 processed = 0;
+  i32 cached = 0;
+  m_assetMapping.clear();
+  std::unordered_map<std::string, const AssetBuildRecord*> recordsBySource;
 
-    // Security: Validate output path to prevent path traversal attacks
-    auto sanitizedPathResult = sanitizeOutputPath(assetsDir.string(), relativePath.string());
-    if (sanitizedPathResult.isError()) {
-      endStep(false, sanitizedPathResult.error());
-      return Result<void>::error(sanitizedPathResult.error());
+  for (const auto& record : m_assetRecords) {
+    if (!record.error.empty()) {
+      endStep(false, record.error);
+      return Result<void>::error(record.error);
     }
-    fs::path outputPath = sanitizedPathResult.value();
-
-    // Create output directory
-    fs::create_directories(outputPath.parent_path());
 
-    AssetProcessResult result;
-
-    if (ext == ".png" || ext == ".jpg" || ext == ".jpeg" || ext == ".bmp") {
-      result = processImage(assetPath, outputPath.string());
-    } else if (ext == ".ogg" || ext == ".wav" || ext == ".mp3") {
-      result = processAudio(assetPath, outputPath.string());
-    } else if (ext == ".ttf" || ext == ".otf") {
-      result = processFont(assetPath, outputPath.string());
-    } else {
-      result = processData(assetPath, outputPath.string());
+    if (!record.result.success) {
+      m_progress.warnings.push_back("Asset processing warning: " + record.sourcePath + " - " +
+                                    record.result.errorMessage);
     }
 
-    if (!result.success) {
-      m_progress.warnings.push_back("Asset processing warning: " + assetPath + " - " +
-                                    result.errorMessage);
+    if (!record.warning.empty()) {
+      m_progress.warnings.push_back(record.warning);
     }
 
     // Map original path to normalized VFS path (lowercase, forward slashes)
-    std::string vfsPath = normalizeVfsPath(relativePath.string());
-    m_assetMapping[assetPath] = vfsPath;
+    m_assetMapping[record.sourcePath] = record.vfsPath;
+    recordsBySource[record.sourcePath] = &record;
+    if (!record.bundleSourcePath.empty()) {
+      // Staged beside the table, so packing finds it like any other asset
+      m_assetMapping[record.bundleSourcePath] =
+          fs::path(record.vfsPath).replace_extension(".nmlb").generic_string();
+    }
 
+    if (record.fromCache) {
+      cached++;
+    }
     processed++;
     m_progress.filesProcessed++;
-    m_progress.bytesProcessed += result.processedSize;
+    m_progress.bytesProcessed += record.result.processedSize;
   }
 
   // Generate enhanced resource manifest with hashing and complete metadata
@@ -1216,28 +1893,14 @@ Result<void> BuildSystem::processAssets() {
         break;
       }
 
-      // Read file and calculate hash
+      // Size and content hash were computed by the asset workers
       u64 fileSize = 0;
       std::string hashHex = "0000000000000000"; // First 16 bytes of SHA-256
-      try {
-        std::ifstream file(sourcePath, std::ios::binary | std::ios::ate);
-        if (file.is_open()) {
-          fileSize = static_cast<u64>(file.tellg());
-          file.seekg(0, std::ios::beg);
-          std::vector<u8> data(fileSize);
-          file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(fileSize));
-          file.close();
-
-          auto hash = calculateSha256(data.data(), data.size());
-          std::ostringstream oss;
-          oss << std::hex << std::setfill('0');
-          for (size_t i = 0; i < 16; ++i) {
-            oss << std::setw(2) << static_cast<int>(hash[i]);
-          }
-          hashHex = oss.str();
-        }
-      } catch (...) {
-        // Hash calculation failed, use placeholder
+      const auto recordIt = recordsBySource.find(sourcePath);
+      if (recordIt != recordsBySource.end() && recordIt->second->hashed) {
+        const AssetBuildRecord& record = *recordIt->second;
+        fileSize = record.sourceSize;
+        hashHex = BuildCache::toHex(record.digest.data(), 16);
       }
 
       // Detect locale from path (e.g., "en/voice/line1.ogg" -> "en")
@@ -1315,7 +1978,9 @@ Result<void> BuildSystem::processAssets() {
     manifestFile.close();
   }
 
-  logMessage("Processed " + std::to_string(processed) + " assets", false);
+  logMessage("Processed " + std::to_string(processed) + " assets (" + std::to_string(cached) +
+                 " from build cache)",
+             false);
   endStep(true);
   return Result<void>::ok();
 }
@@ -1334,6 +1999,8 @@ Result<void> BuildSystem::packResources() {
     return Result<void>::ok();
   }
 
+  planPackLayout();
+
   updateProgress(0.1f, "Building Base pack...");
 
   // Build base pack
@@ -1517,10 +2184,64 @@ Result<void> BuildSystem::packResources() {
   }
 
   logMessage("Created Base pack and " + std::to_string(langPacksBuilt) + " language packs", false);
+  if (!m_layoutPlanner.empty()) {
+    logMessage("Pack layout locality: " +
+                   std::to_string(static_cast<i32>(m_layoutLocality.score() * 100.0)) +
+                   "% sequential first-use reads (file order: " +
+                   std::to_string(static_cast<i32>(m_layoutBaseline.score() * 100.0)) + "%)",
+               false);
+  }
   endStep(true);
   return Result<void>::ok();
 }
 
+void BuildSystem::planPackLayout() {
+  m_layoutPlanner.clear();
+  m_layoutLocality = {};
+  m_layoutBaseline = {};
+
+  // A recorded trace is real play order, so it comes first; script control
+  // flow then fills in the assets the trace never reached
+  if (!m_config.layoutTracePath.empty()) {
+    auto trace = m_layoutPlanner.loadTrace(m_config.layoutTracePath);
+    if (trace.isError()) {
+      m_progress.warnings.push_back(trace.error());
+    } else {
+      logMessage("Layout trace: " + std::to_string(trace.value()) + " assets", false);
+    }
+  }
+
+  // Walk each script from its start, then from scene entries that start
+  // does not reach, in program order
+  scripting::PrefetchPlanner planner;
+  planner.setLookahead(std::numeric_limits<u32>::max());
+  for (const auto& compiled : m_compiledScripts) {
+    if (!compiled.success || compiled.bytecode.empty()) {
+      continue;
+    }
+    auto image = scripting::BytecodeImage::fromMemory(compiled.bytecode);
+    if (image.isError()) {
+      continue;
+    }
+    const auto script = image.value().metadata();
+    const auto program = image.value().instructions();
+
+    std::vector<u32> starts;
+    starts.reserve(script.sceneEntryPoints.size());
+    for (const auto& [scene, ip] : script.sceneEntryPoints) {
+      starts.push_back(ip);
+    }
+    std::sort(starts.begin(), starts.end());
+    starts.insert(starts.begin(), 0);
+
+    for (u32 ip : starts) {
+      for (const auto& asset : planner.plan(program, script.stringTable, script.characters, ip)) {
+        m_layoutPlanner.addAccess(asset.id);
+      }
+    }
+  }
+}
+
 Result<void> BuildSystem::generateExecutable() {
   beginStep("Bundle", "Creating runtime bundle");
 
@@ -1864,6 +2585,7 @@ void BuildSystem::beginStep(const std::string& name, const std::string& descript
     }
   }
 
+  m_stepStart = std::chrono::steady_clock::now();
   logMessage("Starting: " + name + " - " + description, false);
   updateProgress(0.0f, description);
 }
@@ -1875,6 +2597,9 @@ void BuildSystem::endStep(bool success, const std::string& errorMessage) {
     step.completed = true;
     step.success = success;
     step.errorMessage = errorMessage;
+    step.durationMs =
+        std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - m_stepStart)
+            .count();
 
     if (m_onStepComplete) {
       m_onStepComplete(step);
@@ -1891,6 +2616,28 @@ ScriptCompileResult BuildSystem::compileScript(const std::string& scriptPath) {
   result.sourcePath = scriptPath;
   result.success = true;
 
+  // Debug mappings are dropped for distribution builds, and the source path
+  // is embedded in them, so both are part of the cache key
+  const bool includeDebugInfo = m_config.buildType != BuildType::Distribution;
+  std::string cacheKey;
+  if (m_cache.isOpen()) {
+    auto digest = m_cache.hashFile(scriptPath);
+    if (digest.isOk()) {
+      cacheKey = BuildCache::makeKey(digest.value(), std::string("script|debug=") +
+                                                         (includeDebugInfo ? "1" : "0") +
+                                                         "|source=" + scriptPath);
+      if (m_cache.contains(cacheKey)) {
+        auto cached = m_cache.load(cacheKey);
+        if (cached.isOk() && decodeCompiledScript(cached.value(), result)) {
+          result.fromCache = true;
+          m_cache.recordHit();
+          return result;
+        }
+      }
+      m_cache.recordMiss();
+    }
+  }
+
   try {
     // Read script file
     std::ifstream file(scriptPath);
@@ -1977,7 +2724,7 @@ ScriptCompileResult BuildSystem::compileScript(const std::string& scriptPath) {
 
     // Step 4: Compilation to bytecode
     scripting::Compiler compiler;
-    auto compileResult = compiler.compile(program);
+    auto compileResult = compiler.compile(program, scriptPath);
     if (!compileResult.isOk()) {
       result.success = false;
       result.errors.push_back("Compile error: " + compileResult.error());
@@ -1995,18 +2742,14 @@ ScriptCompileResult BuildSystem::compileScript(const std::string& scriptPath) {
       return result;
     }
 
-    auto compiledScript = compileResult.value();
+    // Each script is stored as a .nmc image (see scripting/bytecode_file.hpp)
+    result.bytecode = scripting::serializeBytecode(compileResult.value(), includeDebugInfo);
+    result.bytecodeSize = static_cast<i32>(result.bytecode.size());
 
-    // Calculate bytecode size: instructions + string table + metadata
-    i32 bytecodeSize = 0;
-    bytecodeSize += static_cast<i32>(compiledScript.instructions.size() * sizeof(u32) * 2);
-    for (const auto& str : compiledScript.stringTable) {
-      bytecodeSize += static_cast<i32>(sizeof(u32) + str.size());
+    if (!cacheKey.empty()) {
+      // A failed cache write only costs a recompile next time
+      (void)m_cache.store(cacheKey, encodeCompiledScript(result));
     }
-    bytecodeSize += static_cast<i32>(compiledScript.sceneEntryPoints.size() * sizeof(u32));
-    bytecodeSize += static_cast<i32>(compiledScript.characters.size() * sizeof(u32));
-
-    result.bytecodeSize = bytecodeSize;
 
   } catch (const std::exception& e) {
     result.success = false;
@@ -2018,7 +2761,7 @@ ScriptCompileResult BuildSystem::compileScript(const std::string& scriptPath) {
 
 Result<void> BuildSystem::compileBytecode(const std::string& outputPath) {
   try {
-    // Create the combined bytecode file with real compiled bytecode
+    // Bundle the bytecode produced by compileScripts()
     std::ofstream output(outputPath, std::ios::binary);
     if (!output.is_open()) {
       return Result<void>::error("Cannot create bytecode file: " + outputPath);
@@ -2028,193 +2771,45 @@ Result<void> BuildSystem::compileBytecode(const std::string& outputPath) {
     const char magic[] = "NMC1";
     output.write(magic, 4);
 
-    // Write version (format: major << 16 | minor << 8 | patch)
-    u32 version = 1;
+    // Write bundle version (2: entries are .nmc images)
+    u32 version = 2;
     output.write(reinterpret_cast<const char*>(&version), sizeof(version));
 
-    // Write script count
-    u32 scriptCount = static_cast<u32>(m_scriptFiles.size());
+    // Write script count (empty scripts produce no entry)
+    u32 scriptCount = static_cast<u32>(
+        std::count_if(m_compiledScripts.begin(), m_compiledScripts.end(),
+                      [](const ScriptCompileResult& script) {
+                        return script.success && !script.bytecode.empty();
+                      }));
     output.write(reinterpret_cast<const char*>(&scriptCount), sizeof(scriptCount));
 
     // Prepare script map entries for source mapping (debug builds)
     std::vector<std::tuple<u64, std::string, u32, u32>> scriptMapEntries;
     u64 currentOffset = 12; // After header (4 + 4 + 4)
 
-    // Compile and write bytecode for each script
-    for (const auto& scriptPath : m_scriptFiles) {
-      std::ifstream file(scriptPath);
-      if (!file.is_open()) {
-        logMessage("Cannot open script file: " + scriptPath, true);
-        continue;
-      }
-
-      std::stringstream buffer;
-      buffer << file.rdbuf();
-      std::string source = buffer.str();
-      file.close();
-
-      if (source.empty()) {
-        logMessage("Skipping empty script: " + scriptPath, false);
-        continue;
-      }
-
-      // Step 1: Lexical analysis
-      scripting::Lexer lexer;
-      auto tokenResult = lexer.tokenize(source);
-      if (!tokenResult.isOk()) {
-        logMessage("Lexer error in " + scriptPath + ": " + tokenResult.error(), true);
-        continue;
-      }
-
-      auto tokens = tokenResult.value();
-
-      if (!lexer.getErrors().empty()) {
-        for (const auto& err : lexer.getErrors()) {
-          logMessage("Lexer error in " + scriptPath + " at line " +
-                         std::to_string(err.location.line) + ": " + err.message,
-                     true);
-        }
-        continue;
-      }
-
-      // Step 2: Parsing
-      scripting::Parser parser;
-      auto parseResult = parser.parse(tokens);
-      if (!parseResult.isOk()) {
-        logMessage("Parse error in " + scriptPath + ": " + parseResult.error(), true);
-        continue;
-      }
-
-      auto program = std::move(parseResult).value();
-
-      if (!parser.getErrors().empty()) {
-        for (const auto& err : parser.getErrors()) {
-          logMessage("Parse error in " + scriptPath + " at line " +
-                         std::to_string(err.location.line) + ": " + err.message,
-                     true);
-        }
+    for (const auto& compiledScript : m_compiledScripts) {
+      if (!compiledScript.success) {
         continue;
       }
-
-      // Step 3: Validation (optional, but recommended for production)
-      scripting::Validator validator;
-      auto validationResult = validator.validate(program);
-
-      if (!validationResult.isValid) {
-        for (const auto& err : validationResult.errors.all()) {
-          if (err.severity == scripting::Severity::Error) {
-            logMessage("Validation error in " + scriptPath + " at line " +
-                           std::to_string(err.span.start.line) + ": " + err.message,
-                       true);
-          }
-        }
+      if (compiledScript.bytecode.empty()) {
+        logMessage("Skipping empty script: " + compiledScript.sourcePath, false);
         continue;
       }
 
-      // Step 4: Compile to bytecode
-      scripting::Compiler compiler;
-      auto compileResult = compiler.compile(program);
-      if (!compileResult.isOk()) {
-        logMessage("Compile error in " + scriptPath + ": " + compileResult.error(), true);
-        continue;
-      }
-
-      auto compiledScript = compileResult.value();
-
       // Record mapping for source map (before writing bytecode)
-      fs::path relativePath = fs::relative(scriptPath, m_config.projectPath);
+      fs::path relativePath = fs::relative(compiledScript.sourcePath, m_config.projectPath);
       scriptMapEntries.emplace_back(currentOffset, relativePath.string(), 1, 0);
 
-      // Write compiled bytecode for this script
-      // Format:
-      // [size:u32][instruction_count:u32][instructions...][string_count:u32][strings...][scene_count:u32][scenes...][char_count:u32][chars...]
-
-      // Calculate total size for this script's bytecode
-      std::vector<u8> scriptBytecode;
-
-      // Write instruction count and instructions
-      u32 instrCount = static_cast<u32>(compiledScript.instructions.size());
-
-      // Reserve space and build bytecode buffer
-      scriptBytecode.reserve(1024); // Initial reservation
-
-      // Add instruction count
-      const u8* instrCountPtr = reinterpret_cast<const u8*>(&instrCount);
-      scriptBytecode.insert(scriptBytecode.end(), instrCountPtr,
-                            instrCountPtr + sizeof(instrCount));
-
-      // Add instructions (opcode + operand pairs)
-      for (const auto& instr : compiledScript.instructions) {
-        const u8* opcodePtr = reinterpret_cast<const u8*>(&instr.opcode);
-        scriptBytecode.insert(scriptBytecode.end(), opcodePtr, opcodePtr + sizeof(instr.opcode));
-        const u8* operandPtr = reinterpret_cast<const u8*>(&instr.operand);
-        scriptBytecode.insert(scriptBytecode.end(), operandPtr, operandPtr + sizeof(instr.operand));
-      }
-
-      // Write string table
-      u32 strCount = static_cast<u32>(compiledScript.stringTable.size());
-      const u8* strCountPtr = reinterpret_cast<const u8*>(&strCount);
-      scriptBytecode.insert(scriptBytecode.end(), strCountPtr, strCountPtr + sizeof(strCount));
-
-      for (const auto& str : compiledScript.stringTable) {
-        u32 len = static_cast<u32>(str.length());
-        const u8* lenPtr = reinterpret_cast<const u8*>(&len);
-        scriptBytecode.insert(scriptBytecode.end(), lenPtr, lenPtr + sizeof(len));
-        scriptBytecode.insert(scriptBytecode.end(), str.begin(), str.end());
-      }
-
-      // Write scene entry points
-      u32 sceneCount = static_cast<u32>(compiledScript.sceneEntryPoints.size());
-      const u8* sceneCountPtr = reinterpret_cast<const u8*>(&sceneCount);
-      scriptBytecode.insert(scriptBytecode.end(), sceneCountPtr,
-                            sceneCountPtr + sizeof(sceneCount));
-
-      for (const auto& [name, index] : compiledScript.sceneEntryPoints) {
-        u32 nameLen = static_cast<u32>(name.length());
-        const u8* nameLenPtr = reinterpret_cast<const u8*>(&nameLen);
-        scriptBytecode.insert(scriptBytecode.end(), nameLenPtr, nameLenPtr + sizeof(nameLen));
-        scriptBytecode.insert(scriptBytecode.end(), name.begin(), name.end());
-        const u8* indexPtr = reinterpret_cast<const u8*>(&index);
-        scriptBytecode.insert(scriptBytecode.end(), indexPtr, indexPtr + sizeof(index));
-      }
-
-      // Write characters
-      u32 charCount = static_cast<u32>(compiledScript.characters.size());
-      const u8* charCountPtr = reinterpret_cast<const u8*>(&charCount);
-      scriptBytecode.insert(scriptBytecode.end(), charCountPtr, charCountPtr + sizeof(charCount));
-
-      for (const auto& [id, ch] : compiledScript.characters) {
-        // ID
-        u32 idLen = static_cast<u32>(id.length());
-        const u8* idLenPtr = reinterpret_cast<const u8*>(&idLen);
-        scriptBytecode.insert(scriptBytecode.end(), idLenPtr, idLenPtr + sizeof(idLen));
-        scriptBytecode.insert(scriptBytecode.end(), id.begin(), id.end());
-
-        // Display name
-        u32 displayNameLen = static_cast<u32>(ch.displayName.length());
-        const u8* displayNameLenPtr = reinterpret_cast<const u8*>(&displayNameLen);
-        scriptBytecode.insert(scriptBytecode.end(), displayNameLenPtr,
-                              displayNameLenPtr + sizeof(displayNameLen));
-        scriptBytecode.insert(scriptBytecode.end(), ch.displayName.begin(), ch.displayName.end());
-
-        // Color
-        u32 colorLen = static_cast<u32>(ch.color.length());
-        const u8* colorLenPtr = reinterpret_cast<const u8*>(&colorLen);
-        scriptBytecode.insert(scriptBytecode.end(), colorLenPtr, colorLenPtr + sizeof(colorLen));
-        scriptBytecode.insert(scriptBytecode.end(), ch.color.begin(), ch.color.end());
-      }
-
       // Write size prefix and bytecode to output file
-      u32 bytecodeSize = static_cast<u32>(scriptBytecode.size());
+      u32 bytecodeSize = static_cast<u32>(compiledScript.bytecode.size());
       output.write(reinterpret_cast<const char*>(&bytecodeSize), sizeof(bytecodeSize));
-      output.write(reinterpret_cast<const char*>(scriptBytecode.data()),
-                   static_cast<std::streamsize>(scriptBytecode.size()));
+      output.write(reinterpret_cast<const char*>(compiledScript.bytecode.data()),
+                   static_cast<std::streamsize>(compiledScript.bytecode.size()));
 
       currentOffset += sizeof(bytecodeSize) + bytecodeSize;
 
-      logMessage("Compiled " + relativePath.string() + " (" +
-                     std::to_string(compiledScript.instructions.size()) + " instructions, " +
-                     std::to_string(compiledScript.stringTable.size()) + " strings)",
+      logMessage("Compiled " + relativePath.string() + " (" + std::to_string(bytecodeSize) +
+                     " bytes" + (compiledScript.fromCache ? ", cached" : "") + ")",
                  false);
     }
 
@@ -2228,7 +2823,7 @@ Result<void> BuildSystem::compileBytecode(const std::string& outputPath) {
         mapFile << "{\n";
         mapFile << "  \"version\": \"1.0\",\n";
         mapFile << "  \"bytecode_file\": \"compiled_scripts.bin\",\n";
-        mapFile << "  \"format\": \"NMC1\",\n";
+        mapFile << "  \"format\": \"NMBC\",\n";
         mapFile << "  \"entries\": [\n";
 
         bool first = true;
@@ -2427,13 +3022,17 @@ Result<void> BuildSystem::buildPack(const std::string& outputPath,
       std::array<u8, 12> iv; // 12 bytes for AES-256-GCM, store first 8 in table
     };
 
-    std::vector<ResourceEntry> entries;
-    entries.reserve(files.size());
-
     CompressionLevel compressionLevel = compress ? m_config.compression : CompressionLevel::None;
 
-    for (const auto& file : files) {
-      ResourceEntry entry;
+    // Resources are read, checksummed, compressed and encrypted
+    // independently, so this fans out over the build workers
+    std::vector<ResourceEntry> entries(files.size());
+    std::vector<std::string> entryErrors(files.size());
+    std::vector<std::string> entryWarnings(files.size());
+
+    const auto failures = parallelFor(files.size(), [&](usize index) {
+      const std::string& file = files[index];
+      ResourceEntry& entry = entries[index];
       entry.sourcePath = file;
 
       // Generate VFS-style resource ID
@@ -2445,15 +3044,12 @@ Result<void> BuildSystem::buildPack(const std::string& outputPath,
       entry.type = getResourceTypeFromExtension(file);
 
       // Read file data
-      std::ifstream input(file, std::ios::binary | std::ios::ate);
-      if (!input.is_open()) {
-        return Result<void>::error("Cannot read file: " + file);
+      auto readResult = readBinaryFile(file);
+      if (readResult.isError()) {
+        entryErrors[index] = "Cannot read file: " + file;
+        return;
       }
-      auto fileSize = input.tellg();
-      input.seekg(0, std::ios::beg);
-      std::vector<u8> rawData(static_cast<usize>(fileSize));
-      input.read(reinterpret_cast<char*>(rawData.data()), fileSize);
-      input.close();
+      std::vector<u8> rawData = std::move(readResult).value();
 
       entry.uncompressedSize = rawData.size();
 
@@ -2469,13 +3065,40 @@ Result<void> BuildSystem::buildPack(const std::string& outputPath,
         entry.flags |= static_cast<u32>(ResourceFlags::Preload);
       }
 
-      // Compress data
-      std::vector<u8> processedData = rawData;
+      // Compress data. zlib output is deterministic, so compressed payloads
+      // are reused from the build cache by content
+      std::vector<u8> processedData;
+      bool compressed = false;
       if (compress && compressionLevel != CompressionLevel::None) {
-        auto compressResult = compressData(rawData, compressionLevel);
-        if (compressResult.isOk()) {
-          processedData = compressResult.value();
+        std::string cacheKey;
+        if (m_cache.isOpen()) {
+          const auto digest = calculateSha256(rawData.data(), rawData.size());
+          cacheKey = BuildCache::makeKey(
+              digest, "zlib|level=" + std::to_string(static_cast<i32>(compressionLevel)));
+          if (m_cache.contains(cacheKey)) {
+            auto cached = m_cache.load(cacheKey);
+            if (cached.isOk()) {
+              processedData = std::move(cached).value();
+              compressed = true;
+              m_cache.recordHit();
+            }
+          }
         }
+
+        if (!compressed) {
+          auto compressResult = compressData(rawData, compressionLevel);
+          if (compressResult.isOk()) {
+            processedData = std::move(compressResult).value();
+            compressed = true;
+            if (!cacheKey.empty()) {
+              m_cache.recordMiss();
+              (void)m_cache.store(cacheKey, processedData);
+            }
+          }
+        }
+      }
+      if (!compressed) {
+        processedData = std::move(rawData);
       }
 
       // Encrypt data if requested
@@ -2486,9 +3109,9 @@ Result<void> BuildSystem::buildPack(const std::string& outputPath,
           processedData = encryptResult.value();
           entry.iv = iv;
         } else {
-          // Log warning but continue without encryption
-          logMessage("Warning: Encryption failed for " + file + ": " + encryptResult.error(),
-                     false);
+          // Warn but continue without encryption
+          entryWarnings[index] =
+              "Warning: Encryption failed for " + file + ": " + encryptResult.error();
           entry.iv = {};
         }
       } else {
@@ -2497,14 +3120,75 @@ Result<void> BuildSystem::buildPack(const std::string& outputPath,
 
       entry.data = std::move(processedData);
       entry.compressedSize = entry.data.size();
-      entries.push_back(std::move(entry));
+    }, [&](usize index) { return files[index]; });
+
+    for (usize i = 0; i < files.size(); ++i) {
+      if (!failures[i].empty()) {
+        return Result<void>::error(failures[i]);
+      }
+      if (!entryErrors[i].empty()) {
+        return Result<void>::error(entryErrors[i]);
+      }
+      if (!entryWarnings[i].empty()) {
+        logMessage(entryWarnings[i], false);
+      }
     }
 
-    // Calculate total data size and apply alignment
     // Per spec: resources > 4KB align to 4KB, smaller align to 16 bytes
     constexpr u64 LARGE_ALIGNMENT = 4096;
     constexpr u64 SMALL_ALIGNMENT = 16;
 
+    // Score the layout against the planned first-use order and, when
+    // enabled, write data in that order instead of file order
+    if (!m_layoutPlanner.empty()) {
+      std::vector<std::string> ids;
+      std::vector<bool> preload;
+      std::vector<u64> sizes;
+      for (const auto& entry : entries) {
+        ids.push_back(entry.resourceId);
+        preload.push_back((entry.flags & static_cast<u32>(ResourceFlags::Preload)) != 0);
+        sizes.push_back(entry.compressedSize);
+      }
+
+      auto offsetsFor = [&entries](const std::vector<usize>& order) {
+        std::vector<u64> offsets(entries.size());
+        u64 cursor = 0;
+        for (usize index : order) {
+          const u64 alignment =
+              entries[index].compressedSize > 4096 ? LARGE_ALIGNMENT : SMALL_ALIGNMENT;
+          cursor = ((cursor + alignment - 1) / alignment) * alignment;
+          offsets[index] = cursor;
+          cursor += entries[index].compressedSize;
+        }
+        return offsets;
+      };
+
+      const auto firstUse = m_layoutPlanner.resolve(ids);
+      std::vector<usize> fileOrder(entries.size());
+      for (usize i = 0; i < fileOrder.size(); ++i) {
+        fileOrder[i] = i;
+      }
+      const auto baseline = vfs::PackLayoutPlanner::measure(
+          firstUse, offsetsFor(fileOrder), sizes, vfs::PackReader::BATCH_MAX_GAP);
+      m_layoutBaseline += baseline;
+
+      if (m_config.optimizePackLayout) {
+        const auto order = m_layoutPlanner.order(ids, preload);
+        m_layoutLocality += vfs::PackLayoutPlanner::measure(
+            firstUse, offsetsFor(order), sizes, vfs::PackReader::BATCH_MAX_GAP);
+
+        std::vector<ResourceEntry> reordered;
+        reordered.reserve(entries.size());
+        for (usize index : order) {
+          reordered.push_back(std::move(entries[index]));
+        }
+        entries = std::move(reordered);
+      } else {
+        m_layoutLocality += baseline;
+      }
+    }
+
+    // Data offsets follow the entry order above, i.e. planPackLayout's order
     u64 currentDataOffset = 0;
     std::vector<u64> dataOffsets;
     dataOffsets.reserve(entries.size());
@@ -3347,8 +4031,14 @@ Result<void> PackBuilder::finalizePack() {
     u32 entryCount = static_cast<u32>(m_entries.size());
     output.write(reinterpret_cast<const char*>(&entryCount), sizeof(entryCount));
 
-    // Write entries
+    // Write entries, in first-use order when a layout was planned
+    std::vector<std::string> paths;
+    paths.reserve(m_entries.size());
     for (const auto& entry : m_entries) {
+      paths.push_back(entry.path);
+    }
+    for (usize index : m_layoutPlanner.order(paths)) {
+      const auto& entry = m_entries[index];
       // Write path length and path
       u32 pathLen = static_cast<u32>(entry.path.size());
       output.write(reinterpret_cast<const char*>(&pathLen), sizeof(pathLen));
@@ -3395,6 +4085,10 @@ void PackBuilder::setCompressionLevel(CompressionLevel level) {
   m_compressionLevel = level;
 }
 
+void PackBuilder::setLayoutPlanner(vfs::PackLayoutPlanner planner) {
+  m_layoutPlanner = std::move(planner);
+}
+
 PackBuilder::PackStats PackBuilder::getStats() const {
   PackStats stats;
   stats.fileCount = static_cast<i32>(m_entries.size());
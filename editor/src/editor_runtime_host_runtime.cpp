@@ -1104,11 +1104,12 @@ Result<void> EditorRuntimeHost::initializeRuntime() {
 
   // Create audio manager (dev mode - unencrypted)
   m_audioManager = std::make_unique<audio::AudioManager>();
-  m_audioManager->setDataProvider([this](const std::string& id) {
+  m_audioManager->setStreamProvider([this](const std::string& id) {
     if (!m_resourceManager) {
-      return Result<std::vector<u8>>::error("Resource manager unavailable");
+      return Result<std::unique_ptr<VFS::IFileHandle>>::error(
+          "Resource manager unavailable");
     }
-    return m_resourceManager->readData(id);
+    return m_resourceManager->openStream(id);
   });
   m_audioManager->initialize();
 
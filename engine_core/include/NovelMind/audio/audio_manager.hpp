@@ -5,7 +5,8 @@
  * @brief Audio System 2.0 - Full-featured audio management
  *
  * Provides:
- * - Music playback with streaming
+ * - Music playback with streaming (tracks are paged in through a
+ *   StreamProvider instead of being loaded whole)
  * - Sound effects with pooling
  * - Voice playback for VN dialogue
  * - Volume groups and master control
@@ -16,9 +17,13 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/core/worker_pool.hpp"
+#include "NovelMind/vfs/file_handle.hpp"
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
 #include <string>
@@ -27,13 +32,14 @@
 
 struct ma_engine;
 struct ma_sound;
-struct ma_decoder;
 
 namespace NovelMind::audio {
 
 // Forward declarations
 class AudioSource;
 class AudioBuffer;
+struct AudioStreamVfs;
+struct PooledSound;
 
 /**
  * @brief Custom deleter for ma_engine to ensure proper cleanup
@@ -43,16 +49,7 @@ struct MaEngineDeleter {
   void operator()(ma_engine* engine) const;
 };
 
-/**
- * @brief Custom deleter for ma_decoder to ensure proper cleanup
- * Implementation in audio_manager.cpp to avoid incomplete type issues
- */
-struct MaDecoderDeleter {
-  void operator()(ma_decoder* decoder) const;
-};
-
 using MaEnginePtr = std::unique_ptr<ma_engine, MaEngineDeleter>;
-using MaDecoderPtr = std::unique_ptr<ma_decoder, MaDecoderDeleter>;
 
 /**
  * @brief Audio channel types for volume control
@@ -156,6 +153,30 @@ struct AudioEvent {
 
 using AudioCallback = std::function<void(const AudioEvent &)>;
 
+/**
+ * @brief Start-up latency of sources on one channel
+ *
+ * "Call" time is how long play*() blocked the caller; "ready" time runs
+ * from the call until the first audio was decoded and the mixer could
+ * start the source. Compare ready times against
+ * AudioManager::getAudioPeriodMs().
+ */
+struct AudioLatencyStats {
+  u64 requests = 0;    // Sources created
+  u64 ready = 0;       // Sources that finished loading
+  u64 failed = 0;      // Sources whose track could not be loaded
+  u64 pooledStarts = 0; // Sound effects started from the warm pool
+  f64 lastCallMs = 0.0;
+  f64 maxCallMs = 0.0;
+  f64 lastReadyMs = 0.0;
+  f64 maxReadyMs = 0.0;
+  f64 totalReadyMs = 0.0;
+
+  [[nodiscard]] f64 averageReadyMs() const {
+    return ready > 0 ? totalReadyMs / static_cast<f64>(ready) : 0.0;
+  }
+};
+
 /**
  * @brief Internal audio source representation
  */
@@ -180,6 +201,8 @@ public:
   [[nodiscard]] PlaybackState getState() const { return m_state; }
   [[nodiscard]] f32 getPlaybackPosition() const { return m_position; }
   [[nodiscard]] f32 getDuration() const { return m_duration; }
+  /// True until the track has been opened and its first audio decoded
+  [[nodiscard]] bool isLoading() const { return m_loading; }
   [[nodiscard]] bool isPlaying() const {
     return m_state == PlaybackState::Playing ||
            m_state == PlaybackState::FadingIn ||
@@ -195,11 +218,12 @@ private:
   friend class AudioManager;
 
   std::atomic<PlaybackState> m_state{PlaybackState::Stopped};
-  f32 m_volume = 1.0f;
+  // Read by the loader thread when it hands over a freshly loaded sound
+  std::atomic<f32> m_volume{1.0f};
   f32 m_targetVolume = 1.0f;
-  f32 m_pitch = 1.0f;
-  f32 m_pan = 0.0f;
-  bool m_loop = false;
+  std::atomic<f32> m_pitch{1.0f};
+  std::atomic<f32> m_pan{0.0f};
+  std::atomic<bool> m_loop{false};
 
   f32 m_position = 0.0f;
   f32 m_duration = 0.0f;
@@ -210,11 +234,11 @@ private:
   f32 m_fadeTargetVolume = 0.0f;
   bool m_stopAfterFade = false;
 
+  // m_sound is installed by the loader thread before m_soundReady is set
   std::unique_ptr<ma_sound> m_sound;
-  bool m_soundReady = false;
-  std::vector<u8> m_memoryData;
-  MaDecoderPtr m_decoder;
-  bool m_decoderReady = false;
+  std::atomic<bool> m_soundReady{false};
+  std::atomic<bool> m_loading{false};
+  bool m_failed = false; // Protected by AudioManager::m_sourcesMutex
 };
 
 /**
@@ -224,6 +248,9 @@ class AudioManager {
 public:
   using DataProvider =
       std::function<Result<std::vector<u8>>(const std::string &id)>;
+  using StreamProvider =
+      std::function<Result<std::unique_ptr<VFS::IFileHandle>>(
+          const std::string &id)>;
   AudioManager();
   ~AudioManager();
 
@@ -442,8 +469,66 @@ public:
    */
   void setEventCallback(AudioCallback callback);
 
+  /**
+   * @brief Supply whole tracks as byte buffers
+   *
+   * Only consulted when no stream provider is set or it cannot open a
+   * track; prefer setStreamProvider().
+   */
   void setDataProvider(DataProvider provider);
 
+  // =========================================================================
+  // Loading
+  // =========================================================================
+  //
+  // play*() never waits for track I/O or decoding. It returns a valid
+  // handle straight away and the source starts producing audio once the
+  // manager's own loader pool (m_loader) has loaded it. Tracks that turn
+  // out to be missing are reported through an Error event from update()
+  // and their handle becomes invalid.
+
+  /**
+   * @brief Supply tracks as seekable handles
+   *
+   * Music, voice and ambient tracks are decoded a page at a time: the
+   * first pages on the manager's loader pool, later ones as playback
+   * reaches them. Only a bounded window of each track is read and the
+   * first page is available without reading the whole file.
+   * Handles may be read from any thread but only one at a time.
+   */
+  void setStreamProvider(StreamProvider provider);
+
+  /**
+   * @brief Decode a sound effect into the warm pool ahead of time
+   *
+   * Sound and UI effects are decoded once and kept in a small LRU pool, so
+   * later plays share the decoded samples instead of opening and decoding
+   * the track again. Returns immediately; decoding happens in the
+   * background.
+   */
+  Result<void> warmSound(const std::string &id);
+
+  /**
+   * @brief Set how many decoded sound effects the warm pool keeps
+   *
+   * 0 disables pooling.
+   */
+  void setSoundPoolSize(size_t size);
+  [[nodiscard]] size_t getSoundPoolSize() const;
+  [[nodiscard]] size_t getPooledSoundCount() const;
+
+  /**
+   * @brief Start-up latency of sources created on @p channel
+   */
+  [[nodiscard]] AudioLatencyStats
+  getLatencyStats(AudioChannel channel) const;
+  void resetLatencyStats();
+
+  /**
+   * @brief Length of one playback device period in milliseconds
+   */
+  [[nodiscard]] f64 getAudioPeriodMs() const;
+
   // =========================================================================
   // Configuration
   // =========================================================================
@@ -464,15 +549,36 @@ public:
   void setDuckingParams(f32 duckVolume, f32 fadeDuration);
 
 private:
-  AudioHandle createSource(const std::string &trackId, AudioChannel channel);
+  AudioHandle createSource(const std::string &trackId, AudioChannel channel,
+                           f32 startTime = 0.0f);
+  /// Open, decode and hand over a source's track; runs on m_loader
+  void loadSource(AudioHandle handle, const std::string &trackId,
+                  AudioChannel channel, u64 startFrame,
+                  std::chrono::steady_clock::time_point requestTime);
+  /// Initialise @p sound from the pooled effect, if there is one
+  bool copyPooledSound(const std::string &trackId, ma_sound &sound);
+  bool copyPooledSoundLocked(PooledSound &entry, ma_sound *sound);
+  /// Decode @p trackId into the pool and, if @p copyTo is set, initialise it
+  /// from the entry before the pool lock is released; blocks, so call it from
+  /// m_loader
+  bool loadPooledSound(const std::string &trackId, ma_sound *copyTo = nullptr);
+  void evictPooledSoundLocked();
+  void recordCall(AudioChannel channel, f64 callMs, bool pooled);
+  void recordLoad(AudioChannel channel, bool loaded, f64 readyMs);
   void releaseSource(AudioHandle handle);
+  friend struct AudioStreamVfs;
+  /// Resolve a track through the stream provider, data provider or disk
+  Result<std::unique_ptr<VFS::IFileHandle>>
+  openStream(const std::string &trackId);
   void fireEvent(AudioEvent::Type type, AudioHandle handle,
                  const std::string &trackId = "");
 
   void updateDucking(f64 deltaTime);
-  f32 calculateEffectiveVolume(const AudioSource &source) const;
+  f32 calculateEffectiveVolume(AudioChannel channel) const;
 
   bool m_initialized = false;
+  // Declared before m_engine so it outlives the engine's resource manager
+  std::unique_ptr<AudioStreamVfs> m_streamVfs;
   MaEnginePtr m_engine;
   bool m_engineInitialized = false;
 
@@ -514,6 +620,20 @@ private:
   // Callback (protected by m_stateMutex)
   AudioCallback m_eventCallback;
   DataProvider m_dataProvider;
+  StreamProvider m_streamProvider;
+
+  // Warm pool of decoded sound effects, keyed by track id
+  mutable std::mutex m_poolMutex;
+  std::unordered_map<std::string, std::unique_ptr<PooledSound>> m_soundPool;
+  u64 m_poolClock = 0;
+  std::atomic<size_t> m_soundPoolSize{16};
+
+  // Loads sources off the caller's thread; reset first on shutdown
+  std::unique_ptr<core::WorkerPool> m_loader;
+
+  // Latency metrics (protected by m_statsMutex)
+  mutable std::mutex m_statsMutex;
+  std::unordered_map<AudioChannel, AudioLatencyStats> m_latencyStats;
 };
 
 } // namespace NovelMind::audio
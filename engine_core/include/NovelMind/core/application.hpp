@@ -16,6 +16,12 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
+
+namespace NovelMind::scripting {
+class ScriptRuntime;
+} // namespace NovelMind::scripting
 
 namespace NovelMind::core {
 
@@ -55,6 +61,21 @@ public:
   [[nodiscard]] save::SaveManager *getSaveManager();
   [[nodiscard]] localization::LocalizationManager *getLocalization();
 
+  /**
+   * @brief Drive a script runtime from the main loop
+   *
+   * The runtime is updated every frame and rendered after the scene graph,
+   * so its transitions draw over the scene. Pass nullptr to detach it.
+   */
+  void setScriptRuntime(scripting::ScriptRuntime *runtime);
+
+  /**
+   * @brief Save @p data to @p slot once the current frame has been drawn
+   *
+   * The save carries a thumbnail of that frame. Failures are logged.
+   */
+  void saveGame(i32 slot, save::SaveData data);
+
 protected:
   virtual void onInitialize();
   virtual void onShutdown();
@@ -63,6 +84,7 @@ protected:
 
 private:
   void mainLoop();
+  void writePendingSaves();
 
   std::atomic<bool> m_running{false};
   EngineConfig m_config;
@@ -77,6 +99,8 @@ private:
   std::unique_ptr<audio::AudioManager> m_audio;
   std::unique_ptr<save::SaveManager> m_saveManager;
   std::unique_ptr<localization::LocalizationManager> m_localization;
+  scripting::ScriptRuntime *m_scriptRuntime = nullptr;
+  std::vector<std::pair<i32, save::SaveData>> m_pendingSaves;
   Timer m_timer;
 };
 
@@ -0,0 +1,50 @@
+#pragma once
+
+/**
+ * @file checksum.hpp
+ * @brief CRC-32 shared by the pack builder and the runtime pack checks
+ *
+ * Standard CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320), the same
+ * value zlib's crc32() produces. The kernel is picked once at startup from
+ * what the CPU supports: carry-less multiply folding (PCLMULQDQ) on x86,
+ * the CRC32 instructions on ARMv8, and slicing-by-16 tables everywhere
+ * else. All kernels produce identical results.
+ */
+
+#include "NovelMind/core/types.hpp"
+
+namespace NovelMind::core {
+
+enum class Crc32Kernel : u8 {
+  Bytewise,  ///< One table lookup per byte (reference)
+  Slicing16, ///< 16 table lookups per 16 bytes, portable
+  Pclmul,    ///< x86 PCLMULQDQ folding, 64 bytes per iteration
+  ArmCrc     ///< ARMv8 CRC32 instructions, 8 bytes per instruction
+};
+
+/**
+ * @brief CRC-32 of @p size bytes, continuing from @p crc
+ *
+ * Pass the previous result to checksum data in pieces:
+ * crc32(b, nb, crc32(a, na)) equals the CRC of a followed by b.
+ */
+[[nodiscard]] u32 crc32(const void *data, usize size, u32 crc = 0);
+
+/**
+ * @brief Same as crc32() with a specific kernel (tests and benchmarks)
+ *
+ * Unsupported kernels fall back to Slicing16.
+ */
+[[nodiscard]] u32 crc32With(Crc32Kernel kernel, const void *data, usize size,
+                            u32 crc = 0);
+
+[[nodiscard]] bool isCrc32KernelSupported(Crc32Kernel kernel);
+
+/**
+ * @brief Kernel crc32() dispatches to on this machine
+ */
+[[nodiscard]] Crc32Kernel activeCrc32Kernel();
+
+[[nodiscard]] const char *crc32KernelName(Crc32Kernel kernel);
+
+} // namespace NovelMind::core
@@ -1,6 +1,21 @@
 #pragma once
 
+/**
+ * @file logger.hpp
+ * @brief Asynchronous engine logger
+ *
+ * Log calls never touch the console or the log file. Each thread pushes
+ * records into its own lock-free ring buffer, and a background writer
+ * drains all rings, formats the lines and writes them in batches. The
+ * NOVELMIND_LOG_* macros check the level before evaluating their
+ * arguments, so filtered messages cost one atomic load.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <ctime>
 #include <format>
 #include <fstream>
 #include <functional>
@@ -8,12 +23,15 @@
 #include <mutex>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 namespace NovelMind::core {
 
 enum class LogLevel { Trace, Debug, Info, Warning, Error, Fatal, Off };
 
+struct LogRing;
+
 class Logger {
 public:
   static Logger& instance();
@@ -24,15 +42,37 @@ public:
   void setLevel(LogLevel level);
   [[nodiscard]] LogLevel getLevel() const;
 
+  /**
+   * @brief Whether a message at @p level would be logged
+   */
+  [[nodiscard]] bool isEnabled(LogLevel level) const {
+    const LogLevel current = m_level.load(std::memory_order_relaxed);
+    return level >= current && current != LogLevel::Off;
+  }
+
   void setOutputFile(const std::string& path);
   void closeOutputFile();
 
+  /// Enable or disable stdout/stderr output (the file and callbacks still get messages)
+  void setConsoleOutput(bool enabled);
+
+  /// Callbacks run on the writer thread (or inside flush())
   using LogCallback = std::function<void(LogLevel, const std::string&)>;
   void addLogCallback(LogCallback callback);
   void clearLogCallbacks();
 
+  /**
+   * @brief Queue a message for the writer thread
+   *
+   * Fatal messages are flushed before the call returns.
+   */
   void log(LogLevel level, std::string_view message);
 
+  /**
+   * @brief Write every message this thread has queued so far
+   */
+  void flush();
+
   void trace(std::string_view message);
   void debug(std::string_view message);
   void info(std::string_view message);
@@ -42,27 +82,39 @@ public:
 
   // Template overloads for format strings with variadic arguments
   template <typename... Args> void trace(std::format_string<Args...> fmt, Args&&... args) {
-    trace(std::format(fmt, std::forward<Args>(args)...));
+    if (isEnabled(LogLevel::Trace)) {
+      trace(std::format(fmt, std::forward<Args>(args)...));
+    }
   }
 
   template <typename... Args> void debug(std::format_string<Args...> fmt, Args&&... args) {
-    debug(std::format(fmt, std::forward<Args>(args)...));
+    if (isEnabled(LogLevel::Debug)) {
+      debug(std::format(fmt, std::forward<Args>(args)...));
+    }
   }
 
   template <typename... Args> void info(std::format_string<Args...> fmt, Args&&... args) {
-    info(std::format(fmt, std::forward<Args>(args)...));
+    if (isEnabled(LogLevel::Info)) {
+      info(std::format(fmt, std::forward<Args>(args)...));
+    }
   }
 
   template <typename... Args> void warning(std::format_string<Args...> fmt, Args&&... args) {
-    warning(std::format(fmt, std::forward<Args>(args)...));
+    if (isEnabled(LogLevel::Warning)) {
+      warning(std::format(fmt, std::forward<Args>(args)...));
+    }
   }
 
   template <typename... Args> void error(std::format_string<Args...> fmt, Args&&... args) {
-    error(std::format(fmt, std::forward<Args>(args)...));
+    if (isEnabled(LogLevel::Error)) {
+      error(std::format(fmt, std::forward<Args>(args)...));
+    }
   }
 
   template <typename... Args> void fatal(std::format_string<Args...> fmt, Args&&... args) {
-    fatal(std::format(fmt, std::forward<Args>(args)...));
+    if (isEnabled(LogLevel::Fatal)) {
+      fatal(std::format(fmt, std::forward<Args>(args)...));
+    }
   }
 
 private:
@@ -70,20 +122,48 @@ private:
   ~Logger();
 
   [[nodiscard]] const char* levelToString(LogLevel level) const;
-  [[nodiscard]] std::string getCurrentTimestamp() const;
+  [[nodiscard]] std::string formatTimestamp(std::chrono::system_clock::time_point time);
 
-  LogLevel m_level;
-  std::ofstream m_fileStream;
-  mutable std::mutex m_mutex;
+  /// Ring of the calling thread, registered on first use
+  LogRing* threadRing();
+  void wakeWriter();
+  void writerLoop();
+
+  /// Drain all rings and write the records; m_writeMutex must be held
+  void drainLocked();
+
+  std::atomic<LogLevel> m_level;
   bool m_useColors;
+  bool m_consoleOutput = true;
+
+  // Guards the sinks, the timestamp cache and draining (single consumer)
+  std::mutex m_writeMutex;
+  std::ofstream m_fileStream;
   std::vector<LogCallback> m_callbacks;
+  std::time_t m_cachedSecond = 0;
+  std::string m_cachedTimestamp;
+
+  std::mutex m_ringsMutex;
+  std::vector<std::shared_ptr<LogRing>> m_rings;
+
+  std::mutex m_wakeMutex;
+  std::condition_variable m_wakeCondition;
+  std::atomic<bool> m_wakeRequested{false};
+  std::atomic<bool> m_running{false};
+  std::thread m_writer;
 };
 
 } // namespace NovelMind::core
 
-#define NOVELMIND_LOG_TRACE(...) ::NovelMind::core::Logger::instance().trace(__VA_ARGS__)
-#define NOVELMIND_LOG_DEBUG(...) ::NovelMind::core::Logger::instance().debug(__VA_ARGS__)
-#define NOVELMIND_LOG_INFO(...) ::NovelMind::core::Logger::instance().info(__VA_ARGS__)
-#define NOVELMIND_LOG_WARN(...) ::NovelMind::core::Logger::instance().warning(__VA_ARGS__)
-#define NOVELMIND_LOG_ERROR(...) ::NovelMind::core::Logger::instance().error(__VA_ARGS__)
-#define NOVELMIND_LOG_FATAL(...) ::NovelMind::core::Logger::instance().fatal(__VA_ARGS__)
+// Arguments are only evaluated when the level is enabled
+#define NOVELMIND_LOG_AT(level, method, ...)                                                      \
+  (::NovelMind::core::Logger::instance().isEnabled(level)                                         \
+       ? ::NovelMind::core::Logger::instance().method(__VA_ARGS__)                                \
+       : void())
+
+#define NOVELMIND_LOG_TRACE(...) NOVELMIND_LOG_AT(::NovelMind::core::LogLevel::Trace, trace, __VA_ARGS__)
+#define NOVELMIND_LOG_DEBUG(...) NOVELMIND_LOG_AT(::NovelMind::core::LogLevel::Debug, debug, __VA_ARGS__)
+#define NOVELMIND_LOG_INFO(...) NOVELMIND_LOG_AT(::NovelMind::core::LogLevel::Info, info, __VA_ARGS__)
+#define NOVELMIND_LOG_WARN(...) NOVELMIND_LOG_AT(::NovelMind::core::LogLevel::Warning, warning, __VA_ARGS__)
+#define NOVELMIND_LOG_ERROR(...) NOVELMIND_LOG_AT(::NovelMind::core::LogLevel::Error, error, __VA_ARGS__)
+#define NOVELMIND_LOG_FATAL(...) NOVELMIND_LOG_AT(::NovelMind::core::LogLevel::Fatal, fatal, __VA_ARGS__)
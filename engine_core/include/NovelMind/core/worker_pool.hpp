@@ -0,0 +1,100 @@
+#pragma once
+
+/**
+ * @file worker_pool.hpp
+ * @brief Fixed-size thread pool with a prioritised job queue
+ *
+ * Jobs are plain callables tagged with an integer priority. Workers always
+ * take the highest-priority job first and fall back to submission order for
+ * jobs of equal priority. Queued jobs can be cancelled or re-prioritised
+ * until a worker picks them up.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::core {
+
+class WorkerPool {
+public:
+  using Job = std::function<void()>;
+  using JobId = u64;
+
+  static constexpr JobId INVALID_JOB = 0;
+
+  /**
+   * @brief Start the pool
+   * @param threadCount Number of worker threads; 0 picks a default based on
+   *        the hardware concurrency
+   */
+  explicit WorkerPool(usize threadCount = 0);
+
+  /**
+   * @brief Drops queued jobs, waits for running jobs and joins the workers
+   */
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  /**
+   * @brief Queue a job
+   * @param job Callable run on a worker thread
+   * @param priority Higher values run first
+   * @return Id usable with cancel() and setPriority()
+   */
+  JobId submit(Job job, i32 priority = 0);
+
+  /**
+   * @brief Remove a job that has not started yet
+   * @return true if the job was still queued and will not run
+   */
+  bool cancel(JobId id);
+
+  /**
+   * @brief Change the priority of a job that has not started yet
+   * @return true if the job was still queued
+   */
+  bool setPriority(JobId id, i32 priority);
+
+  /**
+   * @brief Block until the queue is empty and no job is running
+   */
+  void waitIdle();
+
+  [[nodiscard]] usize getThreadCount() const { return m_threads.size(); }
+  [[nodiscard]] usize getQueuedCount() const;
+
+private:
+  /// Sorts by descending priority, then by ascending submission order
+  struct QueueKey {
+    i32 priority;
+    JobId id;
+    bool operator<(const QueueKey &other) const {
+      if (priority != other.priority) {
+        return priority > other.priority;
+      }
+      return id < other.id;
+    }
+  };
+
+  void workerLoop();
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_wakeWorkers;
+  std::condition_variable m_idle;
+  std::map<QueueKey, Job> m_queue;
+  std::unordered_map<JobId, i32> m_queuedPriorities;
+  std::vector<std::thread> m_threads;
+  JobId m_nextId = 1;
+  usize m_running = 0;
+  bool m_stopping = false;
+};
+
+} // namespace NovelMind::core
@@ -15,10 +15,13 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/localization/string_template.hpp"
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <variant>
@@ -88,11 +91,24 @@ struct LocalizedString {
   u32 lineNumber = 0;  // Source line number
 };
 
+/**
+ * @brief Hash for string IDs that also accepts string_view lookups
+ */
+struct StringIdHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view id) const {
+    return std::hash<std::string_view>{}(id);
+  }
+};
+
 /**
  * @brief String table for a single locale
  */
 class StringTable {
 public:
+  using StringMap = std::unordered_map<std::string, LocalizedString,
+                                       StringIdHash, std::equal_to<>>;
+
   StringTable() = default;
   explicit StringTable(const LocaleId &locale);
 
@@ -102,7 +118,7 @@ public:
   /**
    * @brief Add a string to the table
    */
-  void addString(const std::string &id, const std::string &value);
+  void addString(std::string id, std::string value);
 
   /**
    * @brief Add a string with plural forms
@@ -123,6 +139,19 @@ public:
   [[nodiscard]] std::optional<std::string>
   getPluralString(const std::string &id, i64 count) const;
 
+  /**
+   * @brief Find a string without copying it
+   * @return Pointer into the table (valid until the entry is changed), or
+   *         nullptr if missing
+   */
+  [[nodiscard]] const std::string *findString(std::string_view id) const;
+
+  /**
+   * @brief Find a plural form without copying it
+   */
+  [[nodiscard]] const std::string *findPluralString(std::string_view id,
+                                                    i64 count) const;
+
   /**
    * @brief Check if a string exists
    */
@@ -136,16 +165,18 @@ public:
   /**
    * @brief Get all localized strings
    */
-  [[nodiscard]] const std::unordered_map<std::string, LocalizedString> &
-  getStrings() const {
-    return m_strings;
-  }
+  [[nodiscard]] const StringMap &getStrings() const { return m_strings; }
 
   /**
    * @brief Get number of strings
    */
   [[nodiscard]] size_t size() const { return m_strings.size(); }
 
+  /**
+   * @brief Reserve room for @p count strings before a bulk load
+   */
+  void reserve(size_t count) { m_strings.reserve(count); }
+
   /**
    * @brief Clear all strings
    */
@@ -156,11 +187,19 @@ public:
    */
   void removeString(const std::string &id);
 
+  /**
+   * @brief Stamp that changes whenever a string is added, replaced or removed
+   */
+  [[nodiscard]] u64 getVersion() const { return m_version; }
+
 private:
   LocaleId m_locale;
-  std::unordered_map<std::string, LocalizedString> m_strings;
+  StringMap m_strings;
+  u64 m_version = 0;
 };
 
+class StringBundle;
+
 /**
  * @brief Import/export format for localization files
  */
@@ -301,6 +340,8 @@ public:
 
   /**
    * @brief Load strings from file
+   *
+   * The file is memory-mapped and parsed in place.
    * @param locale Target locale
    * @param filePath Path to localization file
    * @param format File format
@@ -317,7 +358,7 @@ public:
    * @return Success or error
    */
   Result<void> loadStringsFromMemory(const LocaleId &locale,
-                                     const std::string &data,
+                                     std::string_view data,
                                      LocalizationFormat format);
 
   /**
@@ -326,6 +367,27 @@ public:
   Result<void> mergeStrings(const LocaleId &locale, const std::string &filePath,
                             LocalizationFormat format);
 
+  /**
+   * @brief Load a compiled string bundle (see StringBundle)
+   *
+   * The file is memory-mapped. Bundles of several locales can stay loaded,
+   * so setCurrentLocale() switches between them without parsing anything.
+   * Strings in a StringTable of the same locale (e.g. editor edits) take
+   * precedence over the bundle.
+   */
+  Result<void> loadBundle(const LocaleId &locale, const std::string &filePath);
+
+  /**
+   * @brief Load a compiled string bundle from memory (e.g. a pack resource)
+   */
+  Result<void> loadBundleFromMemory(const LocaleId &locale,
+                                    std::vector<u8> data);
+
+  /**
+   * @brief Get the compiled bundle of a locale, if one is loaded
+   */
+  [[nodiscard]] const StringBundle *getBundle(const LocaleId &locale) const;
+
   /**
    * @brief Unload strings for a locale
    */
@@ -347,6 +409,21 @@ public:
    */
   [[nodiscard]] std::string get(const std::string &id) const;
 
+  /**
+   * @brief Get localized string without allocating
+   * @param id String ID
+   * @return View into the loaded strings, or @p id itself if not found.
+   *         The view is valid until the locale is edited, reloaded or
+   *         unloaded.
+   */
+  [[nodiscard]] std::string_view getView(std::string_view id) const;
+
+  /**
+   * @brief Get localized plural string without allocating
+   */
+  [[nodiscard]] std::string_view getPluralView(std::string_view id,
+                                               i64 count) const;
+
   /**
    * @brief Get localized string with variable interpolation
    * @param id String ID
@@ -372,6 +449,25 @@ public:
       const std::string &id, i64 count,
       const std::unordered_map<std::string, std::string> &variables) const;
 
+  /**
+   * @brief Append a localized string with variables substituted to @p out
+   *
+   * The string is parsed into a StringTemplate on first use and cached per
+   * ID, so repeated formatting is a single append pass. Reusing @p out
+   * across calls avoids allocating once it has grown.
+   */
+  void format(std::string &out, std::string_view id,
+              const std::unordered_map<std::string, std::string> &variables)
+      const;
+
+  /**
+   * @brief Append a localized plural string with variables to @p out
+   */
+  void
+  formatPlural(std::string &out, std::string_view id, i64 count,
+               const std::unordered_map<std::string, std::string> &variables)
+      const;
+
   /**
    * @brief Get string for specific locale (bypassing current locale)
    */
@@ -461,12 +557,17 @@ public:
       const std::string &text,
       const std::unordered_map<std::string, std::string> &variables) const;
 
+  /**
+   * @brief Number of cached string templates (for diagnostics)
+   */
+  [[nodiscard]] usize getTemplateCacheSize() const;
+
 private:
   // Internal helpers
-  Result<void> loadCSV(const LocaleId &locale, const std::string &content);
-  Result<void> loadJSON(const LocaleId &locale, const std::string &content);
-  Result<void> loadPO(const LocaleId &locale, const std::string &content);
-  Result<void> loadXLIFF(const LocaleId &locale, const std::string &content);
+  Result<void> loadCSV(const LocaleId &locale, std::string_view content);
+  Result<void> loadJSON(const LocaleId &locale, std::string_view content);
+  Result<void> loadPO(const LocaleId &locale, std::string_view content);
+  Result<void> loadXLIFF(const LocaleId &locale, std::string_view content);
 
   Result<void> exportCSV(const StringTable &table,
                          const std::string &path) const;
@@ -478,14 +579,60 @@ private:
                            const std::string &path) const;
 
   StringTable &getOrCreateTable(const LocaleId &locale);
-  void fireMissingString(const std::string &id, const LocaleId &locale) const;
+  void fireMissingString(std::string_view id, const LocaleId &locale) const;
+
+  /// Strings of one locale as seen by lookups: table first, then bundle
+  struct LocaleStrings {
+    const StringTable *table = nullptr;
+    const StringBundle *bundle = nullptr;
+  };
+
+  [[nodiscard]] LocaleStrings stringsFor(const LocaleId &locale) const;
+
+  /// Re-resolve m_current/m_fallback after locales or tables change
+  void refreshActiveStrings();
+
+  [[nodiscard]] static std::optional<std::string_view>
+  findIn(const LocaleStrings &strings, std::string_view id);
+  [[nodiscard]] std::optional<std::string_view>
+  findPluralIn(const LocaleStrings &strings, const LocaleId &locale,
+               std::string_view id, i64 count) const;
+
+  /// Cached template for @p text, the current text of @p id
+  [[nodiscard]] std::shared_ptr<const StringTemplate>
+  templateFor(std::string_view id, std::string_view text) const;
+
+  /// Changes whenever a string visible through m_current/m_fallback may have
+  [[nodiscard]] u64 stringsVersion() const;
 
   // Locale data
   LocaleId m_defaultLocale;
   LocaleId m_currentLocale;
   std::unordered_map<LocaleId, StringTable, LocaleIdHash> m_stringTables;
+  std::unordered_map<LocaleId, std::unique_ptr<StringBundle>, LocaleIdHash>
+      m_bundles;
   std::unordered_map<LocaleId, LocaleConfig, LocaleIdHash> m_localeConfigs;
 
+  // Resolved once per locale switch so lookups skip the locale maps
+  LocaleStrings m_current;
+  LocaleStrings m_fallback; // Empty when current == default
+
+  struct CachedTemplate {
+    std::shared_ptr<const StringTemplate> parsed;
+    const char *text = nullptr; ///< Table storage the template was parsed from
+    u64 version = 0;            ///< stringsVersion() it was last checked at
+  };
+
+  // Parsed templates per string ID, one per distinct text (plural forms).
+  // While the version stamp holds, the table text has not moved, so a hit
+  // is a pointer compare. Const lookups may run on several threads, hence
+  // the lock; changing strings or locales still needs outside sync.
+  mutable std::mutex m_templateMutex;
+  mutable std::unordered_map<std::string, std::vector<CachedTemplate>,
+                             StringIdHash, std::equal_to<>>
+      m_templates;
+  u64 m_generation = 0; ///< Bumped when m_current/m_fallback are re-resolved
+
   // Callbacks
   OnLanguageChanged m_onLanguageChanged;
   mutable OnStringMissing m_onStringMissing;
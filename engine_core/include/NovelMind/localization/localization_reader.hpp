@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file localization_reader.hpp
+ * @brief Single-pass readers for CSV, JSON and PO string tables
+ *
+ * The readers walk the input once and add entries to a StringTable as they
+ * go. Input is taken as a string_view, so callers can parse a memory-mapped
+ * file or a pack buffer in place. Strings without escapes are copied
+ * straight out of the input; scratch buffers are reused between entries.
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/localization/localization_manager.hpp"
+#include <string_view>
+
+namespace NovelMind::localization {
+
+/**
+ * @brief Read an "ID,Text[,...]" table (RFC 4180 quoting, header row skipped)
+ *
+ * When the header has only two columns, an unquoted text runs to the end
+ * of its line, commas included.
+ */
+Result<void> readCSV(std::string_view data, StringTable &table);
+
+/**
+ * @brief Read a JSON object of strings
+ *
+ * Nested objects are flattened into dotted IDs ("menu.start"). An object
+ * whose keys are all plural categories ("one", "few", "other", ...) becomes
+ * one plural string. Numbers, booleans, nulls and arrays are skipped.
+ * A top-level "strings" object is read without a prefix, so files in the
+ * {"language": ..., "strings": {...}} layout keep their flat IDs.
+ */
+Result<void> readJSON(std::string_view data, StringTable &table);
+
+/**
+ * @brief Read a GNU gettext PO catalog
+ *
+ * msgctxt is ignored; for plural entries msgstr[0] is used.
+ */
+Result<void> readPO(std::string_view data, StringTable &table);
+
+} // namespace NovelMind::localization
@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file string_bundle.hpp
+ * @brief Compiled, memory-mappable string tables
+ *
+ * A bundle is the build-time form of one locale's StringTable:
+ *
+ * - Header: magic "NMLB", version, counts and section offsets
+ * - Displacements: one i32 per bucket of a hash-and-displace perfect hash
+ * - Entries: key span, plural form mask and index of the first form
+ * - Forms: (offset, length) spans of each entry's forms, in category order
+ * - Blob: the locale name, keys and values as contiguous UTF-8
+ *
+ * Lookups hash the ID once, read one displacement and compare one key, and
+ * return views into the mapping, so they never allocate. All offsets are
+ * validated when a bundle is opened.
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/platform/mapped_file.hpp"
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NovelMind::localization {
+
+class StringBundle {
+public:
+  static constexpr u16 FORMAT_VERSION = 1;
+
+  StringBundle() = default;
+  ~StringBundle() = default;
+
+  StringBundle(const StringBundle &) = delete;
+  StringBundle &operator=(const StringBundle &) = delete;
+  StringBundle(StringBundle &&) noexcept = default;
+  StringBundle &operator=(StringBundle &&) noexcept = default;
+
+  /**
+   * @brief Compile a string table into bundle bytes
+   *
+   * Entries are written in ID order, so equal tables give identical bytes.
+   */
+  [[nodiscard]] static Result<std::vector<u8>> compile(const StringTable &table);
+
+  /**
+   * @brief Compile a string table and write it to @p path
+   */
+  static Result<void> compileToFile(const StringTable &table, const std::string &path);
+
+  /**
+   * @brief Memory-map a bundle file
+   */
+  [[nodiscard]] static Result<StringBundle> open(const std::string &path);
+
+  /**
+   * @brief Take ownership of bundle bytes (e.g. read from a pack)
+   */
+  [[nodiscard]] static Result<StringBundle> fromMemory(std::vector<u8> data);
+
+  /**
+   * @brief Look up a string: its Other form, or the first form it has
+   */
+  [[nodiscard]] std::optional<std::string_view> find(std::string_view id) const;
+
+  /**
+   * @brief Look up one plural form, falling back to Other
+   */
+  [[nodiscard]] std::optional<std::string_view> find(std::string_view id,
+                                                     PluralCategory category) const;
+
+  [[nodiscard]] bool contains(std::string_view id) const;
+  [[nodiscard]] usize size() const { return m_entryCount; }
+  [[nodiscard]] bool empty() const { return m_entryCount == 0; }
+  [[nodiscard]] const LocaleId &getLocale() const { return m_locale; }
+
+  /**
+   * @brief Expand the bundle back into an editable table
+   */
+  [[nodiscard]] StringTable toStringTable() const;
+
+private:
+  struct Entry {
+    u32 keyOffset;
+    u32 keyLength;
+    u32 firstForm;
+    u8 formMask;
+    u8 reserved[3];
+  };
+
+  static Result<StringBundle> attach(StringBundle bundle);
+
+  [[nodiscard]] const u8 *data() const;
+  [[nodiscard]] Entry entryAt(u32 index) const;
+  [[nodiscard]] std::string_view blobView(u32 offset, u32 length) const;
+  [[nodiscard]] std::optional<Entry> lookup(std::string_view id) const;
+  [[nodiscard]] std::string_view formView(const Entry &entry, PluralCategory category) const;
+
+  platform::MappedFile m_file;
+  std::vector<u8> m_buffer;
+  usize m_size = 0;
+
+  LocaleId m_locale;
+  u32 m_entryCount = 0;
+  u32 m_displaceOffset = 0;
+  u32 m_entriesOffset = 0;
+  u32 m_formsOffset = 0;
+  u32 m_blobOffset = 0;
+  u32 m_blobSize = 0;
+};
+
+} // namespace NovelMind::localization
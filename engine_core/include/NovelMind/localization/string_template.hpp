@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * @file string_template.hpp
+ * @brief Pre-parsed localized strings with {name} placeholders
+ *
+ * A template splits its text once into literal spans and placeholder slots,
+ * so formatting is a single pass that appends each piece to the caller's
+ * buffer. A placeholder is a '{' followed by a name and the next '}'; braces
+ * that do not form one, and placeholders without a matching variable, are
+ * copied through unchanged.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::localization {
+
+class StringTemplate {
+public:
+  StringTemplate() = default;
+
+  /**
+   * @brief Parse @p text; the template keeps its own copy
+   */
+  explicit StringTemplate(std::string_view text);
+
+  /**
+   * @brief Append the text with placeholders substituted to @p out
+   */
+  void formatTo(
+      std::string &out,
+      const std::unordered_map<std::string, std::string> &variables) const;
+
+  [[nodiscard]] std::string
+  format(const std::unordered_map<std::string, std::string> &variables) const;
+
+  /**
+   * @brief Append @p text with placeholders substituted, without caching
+   */
+  static void
+  formatTo(std::string &out, std::string_view text,
+           const std::unordered_map<std::string, std::string> &variables);
+
+  [[nodiscard]] const std::string &getSource() const { return m_source; }
+  [[nodiscard]] bool hasPlaceholders() const { return !m_placeholders.empty(); }
+
+private:
+  /// Literal text [offset, offset + length) of the source, then an optional
+  /// placeholder (index into m_placeholders, or NO_PLACEHOLDER)
+  struct Segment {
+    u32 offset;
+    u32 length;
+    u32 placeholder;
+  };
+  static constexpr u32 NO_PLACEHOLDER = ~u32{0};
+
+  std::string m_source;
+  std::vector<Segment> m_segments;
+  std::vector<std::string> m_placeholders; // Names, for map lookups by key
+};
+
+} // namespace NovelMind::localization
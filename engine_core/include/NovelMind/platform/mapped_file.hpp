@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * @file mapped_file.hpp
+ * @brief Read-only memory-mapped files
+ *
+ * Maps a whole file into the address space so loaders can parse it in place
+ * instead of copying it through a stream. Pages are faulted in on first
+ * access, which makes opening a large file nearly free.
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include <span>
+#include <string>
+
+namespace NovelMind::platform {
+
+/**
+ * @brief Move-only owner of a read-only file mapping
+ */
+class MappedFile {
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+
+  /**
+   * @brief Map an entire file read-only
+   * @param path File to map
+   * @return The mapping, or an error if the file cannot be opened or mapped
+   */
+  [[nodiscard]] static Result<MappedFile> open(const std::string &path);
+
+  [[nodiscard]] const u8 *data() const { return m_data; }
+  [[nodiscard]] usize size() const { return m_size; }
+  [[nodiscard]] std::span<const u8> bytes() const { return {m_data, m_size}; }
+  [[nodiscard]] bool isOpen() const { return m_open; }
+
+  /**
+   * @brief Unmap the file; the mapping becomes empty
+   */
+  void close();
+
+private:
+  const u8 *m_data = nullptr;
+  usize m_size = 0;
+  bool m_open = false;
+#ifdef _WIN32
+  void *m_fileHandle = nullptr;
+  void *m_mappingHandle = nullptr;
+#endif
+};
+
+/**
+ * @brief Fault in the pages backing @p range before they are needed
+ *
+ * Meant for views into a mapping, whose pages are otherwise read from disk
+ * by whoever touches them first. Blocks until the range is resident; on
+ * ordinary heap memory it only reads one byte per page.
+ */
+void prefetchPages(std::span<const u8> range);
+
+} // namespace NovelMind::platform
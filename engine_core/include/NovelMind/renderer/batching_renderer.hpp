@@ -0,0 +1,108 @@
+#pragma once
+
+/**
+ * @file batching_renderer.hpp
+ * @brief IRenderer base that records a frame into a SpriteBatch
+ */
+
+#include "NovelMind/renderer/glyph_cache.hpp"
+#include "NovelMind/renderer/renderer.hpp"
+#include "NovelMind/renderer/sprite_batch.hpp"
+#include <memory>
+#include <string>
+
+namespace NovelMind::renderer {
+
+/**
+ * @brief Records every draw of a frame into a SpriteBatch
+ *
+ * Backends submit the batched quads when a frame ends; nothing is drawn
+ * while the frame is being recorded, so textures passed to drawSprite()
+ * must stay alive until endFrame(). Text is drawn from a GlyphCache whose
+ * pending page writes are uploaded just before the batch is submitted.
+ */
+class BatchingRenderer : public IRenderer {
+public:
+  void setBlendMode(BlendMode mode) override { m_batch.setBlendMode(mode); }
+
+  // Defaults repeated from IRenderer for calls through derived types
+  void drawSprite(const Texture &texture, const Transform2D &transform,
+                  const Color &tint = Color::White) override;
+  void drawSprite(const Texture &texture, const Rect &sourceRect,
+                  const Transform2D &transform,
+                  const Color &tint = Color::White) override;
+
+  void drawRect(const Rect &rect, const Color &color) override {
+    m_batch.addOutline(rect, color);
+  }
+
+  void fillRect(const Rect &rect, const Color &color) override {
+    m_batch.addRect(rect, color);
+  }
+
+  void drawText(const Font &font, const std::string &text, f32 x, f32 y,
+                const Color &color = Color::White) override;
+
+  void setFade(f32 alpha, const Color &color = Color::Black) override;
+
+  Result<void> snapshot(Texture &target) override;
+  Result<DecodedImage> readPixels() override;
+
+  /// Saves the screen in a snapshot and redraws it when the target ends
+  Result<void> beginRenderTarget(Texture &target,
+                                 const Color &clearColor = Color::Transparent) override;
+  Result<void> endRenderTarget() override;
+
+  [[nodiscard]] i32 getWidth() const override { return m_width; }
+  [[nodiscard]] i32 getHeight() const override { return m_height; }
+
+  [[nodiscard]] BatchStats getBatchStats() const override {
+    return m_frameStats;
+  }
+
+  /// A null cache disables text
+  void setGlyphCache(std::shared_ptr<GlyphCache> cache) override {
+    m_glyphCache = std::move(cache);
+  }
+  [[nodiscard]] std::shared_ptr<GlyphCache> getGlyphCache() const override {
+    return m_glyphCache;
+  }
+
+protected:
+  /// Submit the recorded quads (vertices already grouped by batch)
+  virtual void submitBatch(const SpriteBatch &batch) = 0;
+
+  /// Identity of a texture inside the batch
+  [[nodiscard]] virtual SpriteBatch::TextureId
+  textureId(const Texture &texture) const {
+    return &texture;
+  }
+
+  /// Framebuffer as RGBA8, top row first; pending draws are already flushed
+  virtual Result<DecodedImage> readFramebuffer() {
+    return Result<DecodedImage>::error(
+        "Renderer does not support frame snapshots");
+  }
+
+  void flushBatch();
+
+  /// Drop recorded quads that a full-screen clear would overwrite anyway
+  void discardBatch() { m_batch.clear(); }
+
+  /// Flush and publish the frame's stats; ends a forgotten render target
+  /// and advances the glyph cache's LRU clock
+  void finishFrame();
+
+  i32 m_width = 0;
+  i32 m_height = 0;
+
+private:
+  SpriteBatch m_batch;
+  BatchStats m_pendingStats;
+  BatchStats m_frameStats;
+  std::shared_ptr<GlyphCache> m_glyphCache = std::make_shared<GlyphCache>();
+  Texture m_savedScreen;
+  Texture *m_renderTarget = nullptr;
+};
+
+} // namespace NovelMind::renderer
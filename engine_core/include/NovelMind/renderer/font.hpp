@@ -27,10 +27,21 @@ public:
   [[nodiscard]] i32 getSize() const;
   [[nodiscard]] void *getNativeHandle() const;
 
+  /**
+   * @brief Identity of the loaded face, unique for every successful load
+   *
+   * Caches key glyphs on it rather than on the Font address, which may be
+   * reused by a different font. 0 while nothing is loaded.
+   */
+  [[nodiscard]] u64 getId() const { return m_id; }
+
 private:
   void *m_handle;
   void *m_library = nullptr;
   i32 m_size;
+  u64 m_id = 0;
+  /// FreeType reads glyphs from this buffer for the lifetime of the face
+  std::vector<u8> m_data;
 };
 
 struct GlyphInfo {
@@ -0,0 +1,163 @@
+#pragma once
+
+/**
+ * @file glyph_cache.hpp
+ * @brief Glyph pages filled on first use from FreeType
+ *
+ * Unlike FontAtlas, which bakes a fixed charset up front, the cache
+ * rasterizes a glyph the first time it is drawn and shelf-packs it into
+ * fixed-size page textures, so any script the font covers (Cyrillic, CJK,
+ * ...) renders without pre-baking it. Pages are evicted least recently
+ * used once they exceed the memory budget; metrics stay cached, so layout
+ * never rasterizes. Page writes are staged on the CPU and uploaded by
+ * flushUploads(), once per frame.
+ *
+ * Not thread-safe: use it from the render thread.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/renderer/font.hpp"
+#include "NovelMind/renderer/texture.hpp"
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::renderer {
+
+/**
+ * @brief Decode the UTF-8 code point at @p pos and advance past it
+ *
+ * @p pos must be inside @p text. Malformed or truncated sequences decode
+ * to U+FFFD one byte at a time.
+ */
+[[nodiscard]] char32_t nextCodepoint(std::string_view text, usize &pos);
+
+/// Number of code points nextCodepoint() yields for @p text
+[[nodiscard]] usize countCodepoints(std::string_view text);
+
+/// A glyph placed on a cache page
+struct CachedGlyph {
+  GlyphInfo info;                ///< uv is normalized to the page
+  const Texture *page = nullptr; ///< Null for glyphs without a bitmap
+};
+
+struct GlyphCacheStats {
+  usize pages = 0;
+  usize residentGlyphs = 0; ///< Glyphs currently placed on a page
+  u64 rasterized = 0;       ///< Glyph bitmaps rendered since creation
+  u64 evictedPages = 0;
+  u64 uploads = 0; ///< Texture region updates issued by flushUploads()
+  u64 uploadedBytes = 0;
+};
+
+class GlyphCache {
+public:
+  static constexpr i32 DEFAULT_PAGE_SIZE = 1024;
+  /// Page texture memory before pages are evicted: four 1024x1024 pages
+  static constexpr usize DEFAULT_MEMORY_BUDGET = 16 * 1024 * 1024;
+
+  explicit GlyphCache(i32 pageSize = DEFAULT_PAGE_SIZE,
+                      usize memoryBudget = DEFAULT_MEMORY_BUDGET);
+  ~GlyphCache();
+
+  GlyphCache(const GlyphCache &) = delete;
+  GlyphCache &operator=(const GlyphCache &) = delete;
+
+  /**
+   * @brief Metrics of a glyph, for layout
+   *
+   * Loads the outline but neither rasterizes nor places the glyph.
+   * Returns nullptr when the font cannot provide it.
+   */
+  [[nodiscard]] const GlyphInfo *getMetrics(const Font &font,
+                                            char32_t codepoint);
+
+  /**
+   * @brief A glyph ready to draw, rasterized and packed on first use
+   *
+   * The page stays valid for the current frame; pages used since the last
+   * endFrame() are never evicted. Returns nullptr when the font cannot
+   * provide the glyph.
+   */
+  [[nodiscard]] const CachedGlyph *getGlyph(const Font &font,
+                                            char32_t codepoint);
+
+  [[nodiscard]] f32 getLineHeight(const Font &font);
+
+  /// Upload the page rows written since the last flush
+  void flushUploads();
+
+  /// Advance the LRU clock and trim pages allocated over budget
+  void endFrame();
+
+  /// Forget everything cached for a font that is being unloaded
+  void releaseFont(const Font &font);
+
+  void clear();
+
+  void setMemoryBudget(usize bytes);
+  [[nodiscard]] usize getMemoryBudget() const { return m_memoryBudget; }
+
+  /// Page texture bytes; the CPU staging copy adds a quarter on top
+  [[nodiscard]] usize getMemoryUsage() const;
+
+  [[nodiscard]] i32 getPageSize() const { return m_pageSize; }
+  [[nodiscard]] GlyphCacheStats getStats() const;
+
+private:
+  struct Page;
+
+  struct Entry {
+    CachedGlyph glyph;
+    u64 fontId = 0;
+    Page *page = nullptr;    ///< Null until drawn, and again once evicted
+    bool rasterized = false; ///< Metrics come from the bitmap, not the outline
+    bool missing = false;    ///< FreeType could not load the glyph
+    bool oversized = false;  ///< Larger than a page, drawn as blank space
+  };
+
+  struct Shelf {
+    i32 y = 0;
+    i32 height = 0;
+    i32 x = 0;
+  };
+
+  struct Page {
+    Texture texture;
+    std::vector<u8> coverage; ///< A8 staging copy of the page
+    std::vector<Shelf> shelves;
+    std::vector<Entry *> entries; ///< Glyphs to unplace on eviction
+    i32 nextShelfY = 0;
+    i32 dirtyMinY = 0;
+    i32 dirtyMaxY = 0; ///< Empty when not above dirtyMinY
+    u64 lastUsed = 0;
+  };
+
+  struct FontGlyphs {
+    f32 lineHeight = 0.0f;
+    std::unordered_map<char32_t, Entry> glyphs;
+  };
+
+  FontGlyphs &fontGlyphs(const Font &font);
+  Entry *findOrLoad(const Font &font, char32_t codepoint);
+  bool place(const Font &font, char32_t codepoint, Entry &entry);
+  Page *allocate(i32 width, i32 height, i32 &x, i32 &y);
+  bool pack(Page &page, i32 width, i32 height, i32 &x, i32 &y) const;
+  Page *newPage();
+  void evict(Page &page);
+  void destroyPage(usize index);
+  [[nodiscard]] usize maxPages() const;
+
+  i32 m_pageSize;
+  usize m_memoryBudget;
+  u64 m_frame = 1;
+  bool m_warnedOverBudget = false;
+
+  std::unordered_map<u64, FontGlyphs> m_fonts;
+  std::vector<std::unique_ptr<Page>> m_pages;
+  std::vector<u8> m_uploadRows; ///< RGBA8 expansion of dirty rows
+  GlyphCacheStats m_stats;
+};
+
+} // namespace NovelMind::renderer
@@ -14,6 +14,19 @@ namespace NovelMind::renderer {
 
 enum class BlendMode { None, Alpha, Additive, Multiply };
 
+class GlyphCache;
+
+/**
+ * @brief Submission counts of the last finished frame
+ */
+struct BatchStats {
+  u32 drawCalls = 0;       ///< Batches submitted
+  u32 quads = 0;           ///< Sprites, rectangles and glyphs recorded
+  u32 vertices = 0;
+  u32 textureSwitches = 0; ///< Batches whose texture differs from the last
+  u32 blendSwitches = 0;   ///< Batches whose blend mode differs from the last
+};
+
 class IRenderer {
 public:
   virtual ~IRenderer() = default;
@@ -47,10 +60,79 @@ public:
   // Screen effects
   virtual void setFade(f32 alpha, const Color &color = Color::Black) = 0;
 
+  // Frame snapshots and off-screen targets
+
+  /**
+   * @brief Copy what has been drawn so far this frame into @p target
+   *
+   * Pending draws are flushed first. @p target becomes a framebuffer-sized
+   * texture that can be drawn like any other, e.g. by a transition that
+   * composites the outgoing scene. Fails on renderers that cannot read
+   * back their framebuffer.
+   */
+  virtual Result<void> snapshot(Texture &target) {
+    (void)target;
+    return Result<void>::error("Renderer does not support frame snapshots");
+  }
+
+  /**
+   * @brief Read what has been drawn so far this frame as RGBA8, top row first
+   */
+  virtual Result<DecodedImage> readPixels() {
+    return Result<DecodedImage>::error(
+        "Renderer does not support frame snapshots");
+  }
+
+  /**
+   * @brief Draw into @p target instead of the screen until endRenderTarget()
+   *
+   * The target is framebuffer-sized and starts cleared to @p clearColor.
+   * What was on screen before is restored by endRenderTarget(). Targets do
+   * not nest.
+   */
+  virtual Result<void> beginRenderTarget(Texture &target,
+                                         const Color &clearColor = Color::Transparent) {
+    (void)target;
+    (void)clearColor;
+    return Result<void>::error("Renderer does not support render targets");
+  }
+
+  virtual Result<void> endRenderTarget() {
+    return Result<void>::error("Renderer does not support render targets");
+  }
+
   [[nodiscard]] virtual i32 getWidth() const = 0;
   [[nodiscard]] virtual i32 getHeight() const = 0;
+
+  /**
+   * @brief Batching statistics of the last endFrame()
+   *
+   * Renderers that do not batch report zeros.
+   */
+  [[nodiscard]] virtual BatchStats getBatchStats() const { return {}; }
+
+  /**
+   * @brief Glyph cache drawText() rasterizes into
+   *
+   * Share it with TextLayoutEngine::setGlyphCache() so layout metrics and
+   * drawn glyphs come from one cache. Renderers without one ignore it.
+   */
+  virtual void setGlyphCache(std::shared_ptr<GlyphCache> cache) {
+    (void)cache;
+  }
+  [[nodiscard]] virtual std::shared_ptr<GlyphCache> getGlyphCache() const {
+    return nullptr;
+  }
 };
 
 std::unique_ptr<IRenderer> createRenderer();
 
+/**
+ * @brief Renderer that records and batches draws without a GPU
+ *
+ * Used headless (tests, servers); getBatchStats() reports what a GPU
+ * renderer would have submitted.
+ */
+std::unique_ptr<IRenderer> createNullRenderer();
+
 } // namespace NovelMind::renderer
@@ -0,0 +1,70 @@
+#pragma once
+
+/**
+ * @file software_renderer.hpp
+ * @brief CPU rasterizer that renders frames into an RGBA8 framebuffer
+ *
+ * Needs no GPU or window, so frames can be rendered in CI, on render
+ * machines without graphics hardware, for screenshot comparisons and for
+ * save thumbnails. Draws are batched exactly like the GL renderer and
+ * rasterized at endFrame(); sprites are sampled bilinearly with clamped
+ * edges and blended the way the matching glBlendFunc would.
+ *
+ * Textures are sampled from Texture::getPixels(), which is only filled for
+ * textures created while no GL context is current.
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/renderer/batching_renderer.hpp"
+#include "NovelMind/renderer/texture.hpp"
+#include <string>
+#include <vector>
+
+namespace NovelMind::renderer {
+
+class SoftwareRenderer : public BatchingRenderer {
+public:
+  /// Sizes the framebuffer to the window; the window is not drawn to
+  Result<void> initialize(platform::IWindow &window) override;
+
+  /// Headless setup with an explicit framebuffer size
+  Result<void> initialize(i32 width, i32 height);
+
+  void shutdown() override;
+
+  /// Clears to the same color the GL renderer starts its frames with
+  void beginFrame() override;
+  void endFrame() override;
+  void clear(const Color &color) override;
+
+  /// RGBA8 framebuffer, row by row from the top
+  [[nodiscard]] const std::vector<u8> &getPixels() const { return m_pixels; }
+
+  [[nodiscard]] Color getPixel(i32 x, i32 y) const;
+
+  /// Write the framebuffer as a PNG file
+  Result<void> savePng(const std::string &path) const;
+
+protected:
+  void submitBatch(const SpriteBatch &batch) override;
+  Result<DecodedImage> readFramebuffer() override;
+
+private:
+  void drawQuad(const BatchVertex *quad, const Texture *texture,
+                BlendMode blend);
+
+  std::vector<u8> m_pixels;
+  std::vector<u8> m_span; ///< Sampled texels of the row being drawn
+  bool m_warnedGpuTexture = false;
+};
+
+/**
+ * @brief Encode RGBA8 pixels as a PNG
+ *
+ * Compressed with zlib when available, stored uncompressed otherwise.
+ */
+[[nodiscard]] Result<std::vector<u8>> encodePng(const u8 *rgba, i32 width,
+                                                i32 height);
+
+} // namespace NovelMind::renderer
@@ -0,0 +1,112 @@
+#pragma once
+
+/**
+ * @file sprite_batch.hpp
+ * @brief CPU-side draw list that groups quads into texture/blend batches
+ *
+ * Renderers record every sprite, rectangle and glyph of a frame as a quad
+ * and submit the list once at the end, one draw call per batch instead of
+ * one per quad. A quad joins an earlier batch with the same texture and
+ * blend mode when nothing recorded since that batch overlaps it, so the
+ * painter's order of overlapping quads is preserved.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/renderer/color.hpp"
+#include "NovelMind/renderer/renderer.hpp"
+#include "NovelMind/renderer/transform.hpp"
+#include <vector>
+
+namespace NovelMind::renderer {
+
+struct BatchVertex {
+  f32 x = 0.0f;
+  f32 y = 0.0f;
+  f32 u = 0.0f;
+  f32 v = 0.0f;
+  Color color;
+};
+
+/**
+ * @brief Contiguous range of vertices drawn with one texture and blend mode
+ */
+struct DrawBatch {
+  const void *texture = nullptr; ///< nullptr for untextured quads
+  BlendMode blend = BlendMode::Alpha;
+  u32 firstVertex = 0;
+  u32 vertexCount = 0;
+};
+
+class SpriteBatch {
+public:
+  /// Identifies a texture; the batch never dereferences it
+  using TextureId = const void *;
+
+  /// How many batches back a quad may be merged into
+  static constexpr usize MERGE_LOOKBACK = 16;
+
+  void clear();
+
+  /// Blend mode for quads added afterwards (kept across clear())
+  void setBlendMode(BlendMode mode) { m_blend = mode; }
+  [[nodiscard]] BlendMode getBlendMode() const { return m_blend; }
+
+  /**
+   * @brief Add a textured quad
+   *
+   * Transforms the same way the immediate-mode renderer did: the source
+   * rectangle's size is offset by the anchor, scaled, rotated (degrees)
+   * and then translated to the transform position.
+   */
+  void addSprite(TextureId texture, f32 textureWidth, f32 textureHeight,
+                 const Rect &sourceRect, const Transform2D &transform,
+                 const Color &tint);
+
+  /// Untextured filled rectangle
+  void addRect(const Rect &rect, const Color &color);
+
+  /// Untextured rectangle outline made of four quads
+  void addOutline(const Rect &rect, const Color &color, f32 thickness = 1.0f);
+
+  /**
+   * @brief Lay the recorded quads out batch by batch and update stats()
+   */
+  void build();
+
+  [[nodiscard]] bool empty() const { return m_quads.empty(); }
+  [[nodiscard]] usize quadCount() const { return m_quads.size(); }
+
+  /// Valid after build(): vertices grouped by batch, four per quad
+  [[nodiscard]] const std::vector<BatchVertex> &vertices() const {
+    return m_vertices;
+  }
+  [[nodiscard]] const std::vector<DrawBatch> &batches() const {
+    return m_batches;
+  }
+  [[nodiscard]] const BatchStats &stats() const { return m_stats; }
+
+private:
+  struct Quad {
+    BatchVertex corners[4];
+    u32 batch = 0;
+  };
+
+  struct Bounds {
+    f32 minX = 0.0f;
+    f32 minY = 0.0f;
+    f32 maxX = 0.0f;
+    f32 maxY = 0.0f;
+  };
+
+  void addQuad(TextureId texture, const BatchVertex (&corners)[4]);
+
+  std::vector<Quad> m_quads;
+  std::vector<DrawBatch> m_batches;
+  std::vector<Bounds> m_batchBounds;
+  std::vector<u32> m_batchCursor;
+  std::vector<BatchVertex> m_vertices;
+  BatchStats m_stats;
+  BlendMode m_blend = BlendMode::Alpha;
+};
+
+} // namespace NovelMind::renderer
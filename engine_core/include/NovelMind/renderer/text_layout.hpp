@@ -6,7 +6,7 @@
  *
  * This module provides comprehensive text layout functionality for
  * visual novels including:
- * - Auto-wrapping text to fit width
+ * - Auto-wrapping UTF-8 text to fit width, breaking between CJK ideographs
  * - RichText formatting (color, bold, italic)
  * - Inline commands ({w=0.2}, {color=#ff0000}, {speed=50})
  * - Text measurement and bounds calculation
@@ -16,6 +16,7 @@
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/renderer/color.hpp"
 #include "NovelMind/renderer/font.hpp"
+#include "NovelMind/renderer/glyph_cache.hpp"
 #include <functional>
 #include <optional>
 #include <regex>
@@ -202,6 +203,12 @@ public:
    */
   void setFontAtlas(std::shared_ptr<FontAtlas> atlas);
 
+  /**
+   * @brief Measure the font's glyphs through a cache shared with the
+   * renderer; takes precedence over the atlas
+   */
+  void setGlyphCache(std::shared_ptr<GlyphCache> cache);
+
   /**
    * @brief Set maximum width for text wrapping
    */
@@ -229,8 +236,8 @@ public:
 
   /**
    * @brief Layout text with automatic wrapping and rich text parsing
-   * @param text The text to layout (may contain inline commands)
-   * @return The laid-out text structure
+   * @param text The UTF-8 text to layout (may contain inline commands)
+   * @return The laid-out text structure; characters are code points
    */
   [[nodiscard]] TextLayout layout(const std::string &text) const;
 
@@ -239,6 +246,12 @@ public:
    */
   [[nodiscard]] std::pair<f32, f32> measureText(const std::string &text) const;
 
+  /**
+   * @brief Horizontal advance of one glyph, as used by layout()
+   */
+  [[nodiscard]] f32 measureGlyph(char32_t codepoint,
+                                 const TextStyle &style) const;
+
   /**
    * @brief Get character index at position
    * @param layout The text layout
@@ -268,7 +281,7 @@ private:
   /**
    * @brief Measure a single character
    */
-  [[nodiscard]] f32 measureChar(char c, const TextStyle &style) const;
+  [[nodiscard]] f32 measureChar(char32_t c, const TextStyle &style) const;
 
   /**
    * @brief Measure a word
@@ -277,6 +290,7 @@ private:
                                 const TextStyle &style) const;
 
   std::shared_ptr<FontAtlas> m_fontAtlas;
+  std::shared_ptr<GlyphCache> m_glyphCache;
   std::shared_ptr<Font> m_font;
   f32 m_maxWidth = 0.0f;
   f32 m_lineHeight = 1.2f;
@@ -2,10 +2,22 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include <span>
 #include <vector>
 
 namespace NovelMind::renderer {
 
+/**
+ * @brief CPU-side RGBA8 image produced by Texture::decode()
+ */
+struct DecodedImage {
+  std::vector<u8> pixels;
+  i32 width = 0;
+  i32 height = 0;
+
+  [[nodiscard]] usize sizeBytes() const { return pixels.size(); }
+};
+
 class Texture {
 public:
   Texture();
@@ -16,8 +28,24 @@ public:
   Texture(Texture &&other) noexcept;
   Texture &operator=(Texture &&other) noexcept;
 
-  Result<void> loadFromMemory(const std::vector<u8> &data);
+  /**
+   * @brief Decode an encoded image (PNG, JPEG, ...) to RGBA8
+   *
+   * Touches no GPU state, so it may run on a worker thread; the result is
+   * handed to loadFromRGBA() on the render thread.
+   */
+  [[nodiscard]] static Result<DecodedImage> decode(std::span<const u8> data);
+
+  Result<void> loadFromMemory(std::span<const u8> data);
   Result<void> loadFromRGBA(const u8 *pixels, i32 width, i32 height);
+
+  /**
+   * @brief Replace a rectangle of an existing texture
+   *
+   * @p pixels holds @p width x @p height tightly packed RGBA8 texels.
+   */
+  Result<void> updateRegion(const u8 *pixels, i32 x, i32 y, i32 width,
+                            i32 height);
   void destroy();
 
   [[nodiscard]] bool isValid() const;
@@ -25,10 +53,19 @@ public:
   [[nodiscard]] i32 getHeight() const;
   [[nodiscard]] void *getNativeHandle() const;
 
+  /**
+   * @brief RGBA8 pixels, row by row from the top
+   *
+   * Kept only when the texture was not uploaded to a GPU (no current GL
+   * context), so software rendering can sample it; empty otherwise.
+   */
+  [[nodiscard]] std::span<const u8> getPixels() const { return m_pixels; }
+
 private:
   void *m_handle;
   i32 m_width;
   i32 m_height;
+  std::vector<u8> m_pixels;
 };
 
 } // namespace NovelMind::renderer
@@ -0,0 +1,134 @@
+#pragma once
+
+/**
+ * @file async_load.hpp
+ * @brief Handles for resources loaded in the background
+ *
+ * ResourceManager::loadTextureAsync() and friends return a shared
+ * LoadRequest. Reading, decompressing and decoding happen on a worker
+ * pool; the request completes on the main thread when
+ * ResourceManager::processUploads() commits the result (for textures,
+ * after the GPU upload).
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include <atomic>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace NovelMind::resource {
+
+/**
+ * @brief Scheduling priority for background loads
+ *
+ * Both the worker queue and the upload queue serve higher priorities
+ * first; use Critical for assets of the scene being entered and Background
+ * for speculative prefetches.
+ */
+enum class LoadPriority : u8 {
+  Background = 0,
+  Normal = 1,
+  High = 2,
+  Critical = 3
+};
+
+enum class LoadState : u8 {
+  Queued,    ///< Waiting for a worker
+  Loading,   ///< Being read/decoded on a worker
+  Uploading, ///< Decoded, waiting for processUploads()
+  Ready,     ///< Completed successfully
+  Failed,    ///< Completed with an error
+  Cancelled  ///< Cancelled before it completed
+};
+
+/**
+ * @brief Shared state of a single background load
+ *
+ * The state may be polled from any thread. future() becomes ready on the
+ * main thread inside ResourceManager::processUploads(), so the main thread
+ * must keep pumping uploads rather than block on it.
+ */
+template <typename T> class LoadRequest {
+public:
+  explicit LoadRequest(std::string id, LoadPriority priority)
+      : m_id(std::move(id)), m_priority(priority),
+        m_future(m_promise.get_future().share()) {}
+
+  LoadRequest(const LoadRequest &) = delete;
+  LoadRequest &operator=(const LoadRequest &) = delete;
+
+  [[nodiscard]] const std::string &getId() const { return m_id; }
+  [[nodiscard]] LoadState getState() const {
+    return m_state.load(std::memory_order_acquire);
+  }
+  [[nodiscard]] LoadPriority getPriority() const {
+    return m_priority.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] bool isDone() const {
+    const LoadState state = getState();
+    return state == LoadState::Ready || state == LoadState::Failed ||
+           state == LoadState::Cancelled;
+  }
+  [[nodiscard]] bool isCancelled() const {
+    return getState() == LoadState::Cancelled;
+  }
+
+  /**
+   * @brief Result of the load; only meaningful once isDone()
+   */
+  [[nodiscard]] const std::shared_future<Result<T>> &future() const {
+    return m_future;
+  }
+
+  /**
+   * @brief Abandon the load
+   *
+   * Completes the request with an error immediately. Work already running
+   * on a worker is discarded when it finishes.
+   * @return false if the request had already completed
+   */
+  bool cancel() {
+    return complete(Result<T>::error("Load cancelled: " + m_id),
+                    LoadState::Cancelled);
+  }
+
+  /// @name Loader interface
+  /// @{
+  void setPriority(LoadPriority priority) {
+    m_priority.store(priority, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Move between the in-progress states; no-op once completed
+   */
+  bool advance(LoadState from, LoadState to) {
+    return m_state.compare_exchange_strong(from, to,
+                                           std::memory_order_acq_rel);
+  }
+
+  /**
+   * @brief Fulfil the future; only the first completion wins
+   */
+  bool complete(Result<T> result, LoadState finalState) {
+    if (m_completed.exchange(true, std::memory_order_acq_rel)) {
+      return false;
+    }
+    m_promise.set_value(std::move(result));
+    m_state.store(finalState, std::memory_order_release);
+    return true;
+  }
+  /// @}
+
+private:
+  std::string m_id;
+  std::atomic<LoadState> m_state{LoadState::Queued};
+  std::atomic<LoadPriority> m_priority;
+  std::atomic<bool> m_completed{false};
+  std::promise<Result<T>> m_promise;
+  std::shared_future<Result<T>> m_future;
+};
+
+} // namespace NovelMind::resource
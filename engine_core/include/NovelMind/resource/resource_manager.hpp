@@ -2,10 +2,16 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/core/worker_pool.hpp"
 #include "NovelMind/renderer/font.hpp"
+#include "NovelMind/renderer/glyph_cache.hpp"
 #include "NovelMind/renderer/texture.hpp"
+#include "NovelMind/resource/async_load.hpp"
+#include "NovelMind/vfs/file_handle.hpp"
 #include "NovelMind/vfs/virtual_fs.hpp"
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -16,8 +22,16 @@ using TextureHandle = std::shared_ptr<renderer::Texture>;
 using FontHandle = std::shared_ptr<renderer::Font>;
 using FontAtlasHandle = std::shared_ptr<renderer::FontAtlas>;
 
+using TextureRequest = std::shared_ptr<LoadRequest<TextureHandle>>;
+using FontRequest = std::shared_ptr<LoadRequest<FontHandle>>;
+/// Completes with the number of bytes read
+using DataRequest = std::shared_ptr<LoadRequest<usize>>;
+
 class ResourceManager {
 public:
+  /// Default bytes of decoded pixel data uploaded per processUploads() call
+  static constexpr usize DEFAULT_UPLOAD_BUDGET = 8 * 1024 * 1024;
+
   explicit ResourceManager(vfs::IVirtualFileSystem *vfs = nullptr);
   ~ResourceManager();
 
@@ -36,8 +50,105 @@ public:
   [[nodiscard]] Result<FontAtlasHandle>
   loadFontAtlas(const std::string &id, i32 size, const std::string &charset);
 
+  /**
+   * @brief Glyph cache for the loaded fonts, filled as text is drawn
+   *
+   * Hand it to the renderer and to TextLayoutEngine so both use the same
+   * glyphs; unloading a font releases its glyphs.
+   */
+  [[nodiscard]] std::shared_ptr<renderer::GlyphCache> getGlyphCache() const {
+    return m_glyphCache;
+  }
+
   [[nodiscard]] Result<std::vector<u8>> readData(const std::string &id) const;
 
+  /**
+   * @brief Open a resource for incremental reads
+   *
+   * Loose files are read from disk as the handle is consumed; packed
+   * resources are read out of the VFS view without another copy. Used for
+   * audio streams, which only need a page of data at a time.
+   */
+  [[nodiscard]] Result<std::unique_ptr<VFS::IFileHandle>>
+  openStream(const std::string &id) const;
+
+  /**
+   * @brief Load a texture in the background
+   *
+   * The resource is read and decoded on the loader pool; the GPU upload
+   * happens in a later processUploads() call on this thread. Requesting an
+   * id that is already cached returns a completed request, and requesting
+   * one that is already in flight returns the existing request (raising its
+   * priority if @p priority is higher).
+   *
+   * The VFS and base path must not change while loads are in flight.
+   */
+  [[nodiscard]] TextureRequest
+  loadTextureAsync(const std::string &id,
+                   LoadPriority priority = LoadPriority::Normal);
+
+  /**
+   * @brief Load a font face in the background
+   */
+  [[nodiscard]] FontRequest
+  loadFontAsync(const std::string &id, i32 size,
+                LoadPriority priority = LoadPriority::Normal);
+
+  /**
+   * @brief Read a resource on the loader pool and discard the bytes
+   *
+   * Warms the VFS cache for data consumed through readData(), such as
+   * audio streams.
+   */
+  [[nodiscard]] DataRequest
+  prefetchData(const std::string &id,
+               LoadPriority priority = LoadPriority::Background);
+
+  /**
+   * @brief Check whether a texture is cached and ready to draw
+   */
+  [[nodiscard]] bool isTextureCached(const std::string &id) const;
+
+  /**
+   * @brief Check whether a background texture load is in flight
+   */
+  [[nodiscard]] bool isTextureLoading(const std::string &id) const;
+
+  /**
+   * @brief Commit finished background loads; call once per frame
+   *
+   * Commits are taken highest priority first until @p byteBudget bytes of
+   * texture data have been uploaded. At least one commit is made per call so
+   * a texture larger than the budget still completes.
+   * @return Number of requests committed
+   */
+  usize processUploads(usize byteBudget = DEFAULT_UPLOAD_BUDGET);
+
+  /**
+   * @brief Block until every in-flight load has been committed
+   *
+   * Runs uploads without a budget; intended for loading screens and tools.
+   */
+  void finishPendingLoads();
+
+  /**
+   * @brief Cancel in-flight loads with a priority lower than @p keep
+   *
+   * Call with the new scene's priority on a scene change so stale
+   * prefetches stop competing with the assets that are needed now.
+   * @return Number of requests cancelled
+   */
+  usize cancelPendingLoads(LoadPriority keep = LoadPriority::Critical);
+
+  /**
+   * @brief Number of worker threads used for background loads
+   *
+   * Takes effect when the pool is first needed; 0 picks a default.
+   */
+  void setLoaderThreadCount(usize count);
+
+  [[nodiscard]] usize getPendingLoadCount() const;
+
   void clearCache();
 
   [[nodiscard]] size_t getTextureCount() const;
@@ -46,8 +157,32 @@ public:
 
 private:
   Result<std::vector<u8>> readResource(const std::string &id) const;
+  /// Like readResource(), but zero-copy when the VFS serves mapped packs
+  Result<vfs::ResourceView> readResourceView(const std::string &id) const;
   std::string resolvePath(const std::string &id) const;
 
+  /// Work handed from a loader thread back to the main thread
+  struct PendingCommit {
+    LoadPriority priority;
+    u64 sequence;
+    usize bytes;
+    std::function<void()> commit;
+  };
+
+  template <typename T> struct PendingLoad {
+    std::shared_ptr<LoadRequest<T>> request;
+    core::WorkerPool::JobId job = core::WorkerPool::INVALID_JOB;
+  };
+
+  core::WorkerPool &workers();
+  void postCommit(LoadPriority priority, usize bytes,
+                  std::function<void()> commit);
+  void commitTexture(const TextureRequest &request,
+                     Result<renderer::DecodedImage> decoded);
+  void commitFont(const FontRequest &request, i32 size,
+                  Result<FontHandle> font);
+  void commitData(const DataRequest &request, Result<usize> bytes);
+
   vfs::IVirtualFileSystem *m_vfs = nullptr;
   std::string m_basePath;
 
@@ -57,6 +192,19 @@ private:
       std::string,
       std::unordered_map<i32, std::unordered_map<std::string, FontAtlasHandle>>>
       m_fontAtlases;
+  std::shared_ptr<renderer::GlyphCache> m_glyphCache;
+
+  std::unique_ptr<core::WorkerPool> m_workers;
+  usize m_loaderThreadCount = 0;
+  std::unordered_map<std::string, PendingLoad<TextureHandle>> m_pendingTextures;
+  std::unordered_map<std::string,
+                     std::unordered_map<i32, PendingLoad<FontHandle>>>
+      m_pendingFonts;
+  std::unordered_map<std::string, PendingLoad<usize>> m_pendingData;
+
+  mutable std::mutex m_commitMutex;
+  std::vector<PendingCommit> m_commits;
+  u64 m_commitSequence = 0;
 };
 
 } // namespace NovelMind::resource
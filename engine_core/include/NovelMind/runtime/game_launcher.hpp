@@ -285,6 +285,12 @@ private:
   Result<void> loadPacksIndex();
   Result<void> loadCompiledScripts();
   Result<void> applyInputBindings();
+  Result<void> loadLocaleFromPacks(const std::string &locale);
+  /// Load several locales, reading their files from the packs in one batch
+  std::vector<Result<void>>
+  loadLocalesFromPacks(const std::vector<std::string> &locales);
+  Result<void> loadLocaleData(const std::string &locale, const std::string &file,
+                              std::vector<u8> data);
 
   // Main loop
   void mainLoop();
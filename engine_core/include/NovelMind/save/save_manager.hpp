@@ -23,6 +23,16 @@ struct SaveData {
   u32 checksum;
 };
 
+/**
+ * @brief Store a downscaled copy of a rendered frame as the save thumbnail
+ *
+ * @p rgba is a frame as returned by IRenderer::readPixels(). It is box
+ * filtered to fit within @p maxWidth x @p maxHeight, keeping its aspect
+ * ratio (never upscaled), and stored as RGBA8.
+ */
+void setThumbnail(SaveData &data, const u8 *rgba, i32 width, i32 height,
+                  i32 maxWidth = 256, i32 maxHeight = 144);
+
 struct SaveMetadata {
   u64 timestamp = 0;
   bool hasThumbnail = false;
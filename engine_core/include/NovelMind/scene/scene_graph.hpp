@@ -184,6 +184,8 @@ public:
   getProperties() const {
     return m_properties;
   }
+  /// Bumped whenever a property changes, for caching derived values
+  [[nodiscard]] u64 getPropertyRevision() const { return m_propertyRevision; }
 
   // Lifecycle
   virtual void update(f64 deltaTime);
@@ -228,6 +230,7 @@ private:
   std::vector<std::unique_ptr<SceneObjectBase>> m_children;
   std::vector<std::string> m_tags;
   std::unordered_map<std::string, std::string> m_properties;
+  u64 m_propertyRevision = 0;
 
   // Active animations
   std::vector<std::unique_ptr<Tween>> m_animations;
@@ -362,6 +365,7 @@ public:
 private:
   std::string m_speaker;
   std::string m_text;
+  usize m_textGlyphs = 0; ///< Code points in m_text
   renderer::Color m_speakerColor{255, 255, 255, 255};
   std::string m_backgroundTextureId;
 
@@ -370,6 +374,44 @@ private:
   f32 m_typewriterSpeed = 30.0f;
   f32 m_typewriterProgress = 0.0f;
   bool m_typewriterComplete = true;
+
+  /// One drawable segment of the laid-out text
+  struct GlyphRun {
+    std::string text;
+    renderer::Color color;
+    f32 x = 0.0f;         ///< Left edge relative to the box
+    f32 y = 0.0f;         ///< Baseline relative to the box
+    f32 width = 0.0f;
+    usize firstGlyph = 0; ///< Reveal index of the first glyph
+    usize glyphCount = 0; ///< Code points in text
+  };
+
+  /**
+   * @brief Text layout and resolved fonts, rebuilt only when the text,
+   * the properties, the resource manager or the text direction change
+   */
+  struct LayoutCache {
+    bool valid = false;
+    u64 propertyRevision = 0;
+    resource::ResourceManager *resources = nullptr;
+    bool localeRtl = false;
+
+    bool rtl = false;
+    f32 width = 0.0f;
+    f32 height = 0.0f;
+    f32 padding = 0.0f;
+    resource::FontHandle font;
+    std::vector<GlyphRun> runs;
+    std::vector<f32> advances; ///< Per glyph, in reveal order
+
+    resource::FontHandle speakerFont;
+    f32 speakerX = 0.0f;
+  };
+
+  void rebuildLayout(bool localeRtl);
+
+  LayoutCache m_layout;
+  std::string m_partialRun; ///< Reused for the run being typed out
 };
 
 /**
@@ -62,6 +62,18 @@ public:
    */
   virtual void render(renderer::IRenderer &renderer) = 0;
 
+  /**
+   * @brief Snapshot the outgoing frame before the scene changes
+   *
+   * Call once, after the outgoing scene has been drawn and before start().
+   * Transitions that composite the old frame over the new one keep the
+   * snapshot; the others ignore it.
+   * @param renderer The renderer the outgoing scene was drawn with
+   */
+  virtual void captureOutgoing(renderer::IRenderer &renderer) {
+    (void)renderer;
+  }
+
   /**
    * @brief Check if the transition is complete
    */
@@ -179,6 +191,10 @@ private:
 
 /**
  * @brief Slide transition (slide in from a direction)
+ *
+ * With a captured outgoing frame, render() slides the old frame off screen
+ * over the new scene. getOffset() is still available for scenes that
+ * move their own content in.
  */
 class SlideTransition : public ITransition {
 public:
@@ -191,6 +207,9 @@ public:
   void update(f64 deltaTime) override;
   void render(renderer::IRenderer &renderer) override;
 
+  /// Also takes the slide distance from the renderer's size
+  void captureOutgoing(renderer::IRenderer &renderer) override;
+
   [[nodiscard]] bool isComplete() const override;
   [[nodiscard]] f32 getProgress() const override;
   void setOnComplete(CompletionCallback callback) override;
@@ -216,14 +235,17 @@ private:
   f32 m_offset;
   f32 m_screenSize; // Width or height depending on direction
 
+  renderer::Texture m_outgoing;
+  bool m_hasOutgoing = false;
+
   CompletionCallback m_onComplete;
 };
 
 /**
  * @brief Dissolve transition (pixelated crossfade)
  *
- * Creates a dissolve effect where pixels transition
- * randomly from old to new content.
+ * Blends from the captured outgoing frame to the new scene by drawing
+ * the snapshot over it with fading alpha, one quad per frame.
  */
 class DissolveTransition : public ITransition {
 public:
@@ -233,6 +255,7 @@ public:
   void start(f32 duration) override;
   void update(f64 deltaTime) override;
   void render(renderer::IRenderer &renderer) override;
+  void captureOutgoing(renderer::IRenderer &renderer) override;
 
   [[nodiscard]] bool isComplete() const override;
   [[nodiscard]] f32 getProgress() const override;
@@ -250,6 +273,9 @@ private:
   bool m_running;
   bool m_complete;
 
+  renderer::Texture m_outgoing;
+  bool m_hasOutgoing = false;
+
   CompletionCallback m_onComplete;
 };
 
@@ -0,0 +1,191 @@
+#pragma once
+
+/**
+ * @file bytecode_file.hpp
+ * @brief Versioned binary container for compiled NM Script (.nmc)
+ *
+ * Layout (little-endian, every section 8-byte aligned):
+ *
+ *   BytecodeFileHeader
+ *   Instruction[instructionCount]      - same layout as scripting::Instruction
+ *   StringRef[stringCount]             - the script string table
+ *   SceneRecord[sceneCount]
+ *   CharacterRecord[characterCount]
+ *   DebugRecord[debugCount]            - optional source mappings
+ *   string data                        - UTF-8 bytes referenced by StringRef
+ *
+ * The instruction section is stored exactly as the VM holds instructions in
+ * memory, so a BytecodeImage opened from a mapped file hands the VM a span
+ * over the file instead of a deserialised std::vector<Instruction>.
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/platform/mapped_file.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NovelMind::scripting {
+
+namespace bytecode {
+
+constexpr char MAGIC[4] = {'N', 'M', 'B', 'C'};
+constexpr u16 FORMAT_VERSION = 1;
+
+/// Header flags
+constexpr u16 FLAG_DEBUG_INFO = 1 << 0;
+
+/// Offset and length of a string inside the string data section
+struct StringRef {
+  u32 offset;
+  u32 length;
+};
+
+struct FileHeader {
+  char magic[4];
+  u16 version;
+  u16 flags;
+  u32 fileSize;
+  u32 instructionCount;
+  u32 instructionOffset;
+  u32 stringCount;
+  u32 stringOffset;
+  u32 sceneCount;
+  u32 sceneOffset;
+  u32 characterCount;
+  u32 characterOffset;
+  u32 debugCount;
+  u32 debugOffset;
+  u32 stringDataOffset;
+  u32 stringDataSize;
+  u32 reserved;
+};
+
+struct SceneRecord {
+  StringRef name;
+  u32 entryPoint;
+  u32 reserved;
+};
+
+struct CharacterRecord {
+  StringRef id;
+  StringRef displayName;
+  StringRef color;
+  StringRef defaultSprite;
+  u32 hasDefaultSprite;
+  u32 reserved;
+};
+
+struct DebugRecord {
+  u32 instruction;
+  u32 line;
+  u32 column;
+  u32 reserved;
+  StringRef filePath;
+  StringRef sceneName;
+};
+
+} // namespace bytecode
+
+/**
+ * @brief Serialize a compiled script into the .nmc container
+ * @param script Compiled script
+ * @param includeDebugInfo Also emit the source-mapping section
+ */
+[[nodiscard]] std::vector<u8> serializeBytecode(const CompiledScript &script,
+                                                bool includeDebugInfo = true);
+
+/**
+ * @brief Serialize a compiled script and write it to @p path
+ */
+[[nodiscard]] Result<void> writeBytecodeFile(const CompiledScript &script,
+                                             const std::string &path,
+                                             bool includeDebugInfo = true);
+
+/**
+ * @brief Validated read-only view of an .nmc container
+ *
+ * The image either maps the file (open()) or owns a copy of the bytes
+ * (fromMemory()). All accessors are views into that storage and stay valid
+ * for the lifetime of the image. Every offset is bounds-checked once when
+ * the image is created, so accessors do no further validation.
+ */
+class BytecodeImage {
+public:
+  BytecodeImage() = default;
+
+  BytecodeImage(const BytecodeImage &) = delete;
+  BytecodeImage &operator=(const BytecodeImage &) = delete;
+  BytecodeImage(BytecodeImage &&) noexcept = default;
+  BytecodeImage &operator=(BytecodeImage &&) noexcept = default;
+
+  /**
+   * @brief Memory-map and validate an .nmc file
+   */
+  [[nodiscard]] static Result<BytecodeImage> open(const std::string &path);
+
+  /**
+   * @brief Validate an .nmc container held in memory (the bytes are copied)
+   */
+  [[nodiscard]] static Result<BytecodeImage>
+  fromMemory(std::span<const u8> bytes);
+
+  /**
+   * @brief Check whether a buffer starts with the .nmc magic
+   */
+  [[nodiscard]] static bool hasMagic(std::span<const u8> bytes);
+
+  [[nodiscard]] std::span<const Instruction> instructions() const;
+
+  [[nodiscard]] u32 stringCount() const { return header().stringCount; }
+  [[nodiscard]] std::string_view string(u32 index) const;
+
+  [[nodiscard]] u32 sceneCount() const { return header().sceneCount; }
+  [[nodiscard]] std::string_view sceneName(u32 index) const;
+  [[nodiscard]] u32 sceneEntryPoint(u32 index) const;
+
+  [[nodiscard]] u32 characterCount() const { return header().characterCount; }
+  [[nodiscard]] CharacterDecl character(u32 index) const;
+
+  [[nodiscard]] bool hasDebugInfo() const { return header().debugCount > 0; }
+
+  /**
+   * @brief Copy the string table out (the VM keeps std::string names)
+   */
+  [[nodiscard]] std::vector<std::string> stringTable() const;
+
+  /**
+   * @brief Materialise everything except the instruction stream
+   *
+   * Fills scene entry points, characters, the string table and source
+   * mappings; instructions are left empty for callers that execute from
+   * instructions().
+   */
+  [[nodiscard]] CompiledScript metadata() const;
+
+  /**
+   * @brief Fully deserialise into a CompiledScript
+   */
+  [[nodiscard]] CompiledScript toCompiledScript() const;
+
+  [[nodiscard]] usize sizeBytes() const { return m_size; }
+  [[nodiscard]] bool isMapped() const { return m_file.isOpen(); }
+
+private:
+  [[nodiscard]] Result<void> validate() const;
+  [[nodiscard]] const bytecode::FileHeader &header() const;
+  [[nodiscard]] std::string_view view(const bytecode::StringRef &ref) const;
+  template <typename T> [[nodiscard]] const T *section(u32 offset) const {
+    return reinterpret_cast<const T *>(m_data + offset);
+  }
+
+  platform::MappedFile m_file;
+  std::vector<u64> m_owned; ///< 8-byte aligned copy for fromMemory()
+  const u8 *m_data = nullptr;
+  usize m_size = 0;
+};
+
+} // namespace NovelMind::scripting
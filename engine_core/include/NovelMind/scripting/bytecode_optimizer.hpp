@@ -0,0 +1,73 @@
+#pragma once
+
+/**
+ * @file bytecode_optimizer.hpp
+ * @brief Peephole optimizer for compiled NM Script bytecode
+ *
+ * Runs after Compiler::compile() has resolved all jumps and rewrites
+ * CompiledScript::instructions in place:
+ * - constant folding of literal operands (PUSH_INT; PUSH_INT; ADD -> PUSH_INT)
+ * - branch simplification (NOT; JUMP_IF -> JUMP_IF_NOT, constant conditions)
+ * - jump threading (JUMP to JUMP collapses to the final target)
+ * - dead-code removal after HALT, RETURN and unconditional JUMP
+ *
+ * Every removal is followed by a remap of jump operands, GOTO_SCENE targets,
+ * sceneEntryPoints and sourceMappings, so the debugger keeps working on the
+ * optimized program.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+
+namespace NovelMind::scripting {
+
+/**
+ * @brief Counters describing what an optimization run changed
+ */
+struct OptimizerStats {
+  u32 instructionsBefore = 0;
+  u32 instructionsAfter = 0;
+  u32 constantsFolded = 0;
+  u32 branchesSimplified = 0;
+  u32 jumpsThreaded = 0;
+  u32 deadInstructionsRemoved = 0;
+};
+
+class BytecodeOptimizer {
+public:
+  /**
+   * @brief Optimize a compiled script in place
+   * @param script Script whose jumps are fully resolved
+   * @return Statistics for the run
+   */
+  OptimizerStats optimize(CompiledScript &script);
+
+private:
+  bool foldConstants(CompiledScript &script);
+  bool simplifyBranches(CompiledScript &script);
+  bool threadJumps(CompiledScript &script);
+  bool removeDeadCode(CompiledScript &script);
+
+  /**
+   * @brief Drop instructions marked in m_removed and remap all addresses
+   *
+   * A removed instruction's address maps to the next surviving one, which is
+   * only correct because every pass removes either unreachable code or the
+   * tail of a pattern whose head was rewritten to an equivalent instruction.
+   */
+  void compact(CompiledScript &script);
+
+  void computeJumpTargets(const CompiledScript &script);
+  [[nodiscard]] bool isJumpTarget(usize index) const {
+    return index < m_jumpTargets.size() && m_jumpTargets[index];
+  }
+
+  /// Remove @p index, handing its source mapping to @p keeper if it has none
+  void removeInto(CompiledScript &script, usize index, usize keeper);
+
+  std::vector<bool> m_jumpTargets;
+  std::vector<bool> m_removed;
+  OptimizerStats m_stats;
+};
+
+} // namespace NovelMind::scripting
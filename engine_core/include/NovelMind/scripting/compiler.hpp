@@ -101,6 +101,12 @@ public:
    */
   [[nodiscard]] const std::vector<CompileError> &getErrors() const;
 
+  /**
+   * @brief Enable or disable the peephole bytecode optimizer (on by default)
+   */
+  void setOptimizationEnabled(bool enabled) { m_optimize = enabled; }
+  [[nodiscard]] bool isOptimizationEnabled() const { return m_optimize; }
+
 private:
   // Compilation helpers
   void reset();
@@ -168,6 +174,8 @@ private:
   // Current compilation context
   std::string m_currentScene;
   std::string m_sourceFilePath; // Source file path for debug mappings
+
+  bool m_optimize = true;
 };
 
 } // namespace NovelMind::scripting
@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * @file prefetch_planner.hpp
+ * @brief Static look-ahead over bytecode to find upcoming assets
+ *
+ * Asset names are known long before they are needed: backgrounds, music and
+ * sounds are string operands of SHOW_BACKGROUND/PLAY_MUSIC/PLAY_SOUND, and
+ * SHOW_CHARACTER names a character whose sprite is declared up front. The
+ * planner walks the control-flow graph breadth-first from an instruction
+ * pointer, following both sides of every conditional jump (which covers
+ * every arm of a CHOICE jump table) and GOTO_SCENE targets, and reports the
+ * assets it meets within a fixed instruction distance.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NovelMind::scripting {
+
+enum class PrefetchKind : u8 {
+  Texture, ///< Background or character sprite
+  Audio    ///< Music track or sound effect
+};
+
+/**
+ * @brief An asset the script may use soon
+ */
+struct PrefetchAsset {
+  PrefetchKind kind = PrefetchKind::Texture;
+  std::string id;
+  u32 distance = 0; ///< Instructions executed before the first use
+};
+
+/**
+ * @brief Counters exposed for telemetry dashboards
+ *
+ * A use is a hit when the asset was already resident, late when a prefetch
+ * was issued but had not finished, and a miss when it was never prefetched.
+ */
+struct PrefetchStats {
+  u64 plansBuilt = 0;
+  u64 requestsIssued = 0;
+  u64 hits = 0;
+  u64 lateHits = 0;
+  u64 misses = 0;
+
+  [[nodiscard]] f64 hitRate() const {
+    const u64 uses = hits + lateHits + misses;
+    return uses == 0 ? 0.0 : static_cast<f64>(hits) / static_cast<f64>(uses);
+  }
+};
+
+class PrefetchPlanner {
+public:
+  static constexpr u32 DEFAULT_LOOKAHEAD = 256;
+
+  /**
+   * @brief Texture a SHOW_CHARACTER of @p characterId displays
+   *
+   * The declared default sprite, or a texture named after the character.
+   */
+  [[nodiscard]] static const std::string &characterTexture(
+      const std::string &characterId,
+      const std::unordered_map<std::string, CharacterDecl> &characters);
+
+  void setLookahead(u32 instructions) { m_lookahead = instructions; }
+  [[nodiscard]] u32 getLookahead() const { return m_lookahead; }
+
+  /**
+   * @brief Collect assets reachable within the look-ahead window
+   * @param program Instruction stream
+   * @param strings String table the operands index into
+   * @param characters Character declarations (for default sprites)
+   * @param ip Instruction pointer to start from
+   * @return Unique assets ordered by distance, nearest first
+   */
+  [[nodiscard]] std::vector<PrefetchAsset>
+  plan(std::span<const Instruction> program,
+       const std::vector<std::string> &strings,
+       const std::unordered_map<std::string, CharacterDecl> &characters,
+       u32 ip) const;
+
+private:
+  u32 m_lookahead = DEFAULT_LOOKAHEAD;
+};
+
+} // namespace NovelMind::scripting
@@ -15,6 +15,7 @@
 #include "NovelMind/audio/audio_manager.hpp"
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/resource/async_load.hpp"
 #include "NovelMind/scene/animation.hpp"
 #include "NovelMind/scene/character_sprite.hpp"
 #include "NovelMind/scene/choice_menu.hpp"
@@ -22,11 +23,15 @@
 #include "NovelMind/scene/scene_manager.hpp"
 #include "NovelMind/scene/transition.hpp"
 #include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/prefetch_planner.hpp"
 #include "NovelMind/scripting/vm.hpp"
 #include <functional>
 #include <memory>
 #include <queue>
+#include <span>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <variant>
 
 namespace NovelMind::resource {
@@ -95,6 +100,8 @@ struct RuntimeConfig {
   f32 autoAdvanceDelay = 2.0f; // Seconds after text complete
   bool skipModeEnabled = false;
   f32 skipModeSpeed = 100.0f; // Text speed in skip mode
+  bool prefetchEnabled = true; // Warm caches for upcoming assets
+  u32 prefetchLookahead = PrefetchPlanner::DEFAULT_LOOKAHEAD; // Instructions
 };
 
 /**
@@ -139,6 +146,11 @@ struct RuntimeSaveState {
  * while (running) {
  *     runtime.update(deltaTime);
  *
+ *     renderer.beginFrame();
+ *     sceneGraph.render(renderer);
+ *     runtime.render(renderer);
+ *     renderer.endFrame();
+ *
  *     if (runtime.isWaitingForInput()) {
  *         if (userClicked) {
  *             runtime.continueExecution();
@@ -159,6 +171,11 @@ public:
    */
   Result<void> load(const CompiledScript &script);
 
+  /**
+   * @brief Load a precompiled .nmc image, executing it in place
+   */
+  Result<void> load(std::shared_ptr<const BytecodeImage> image);
+
   /**
    * @brief Set the scene manager for character/background commands
    */
@@ -214,6 +231,15 @@ public:
    */
   void update(f64 deltaTime);
 
+  /**
+   * @brief Draw the active transition (call each frame, after the scene)
+   *
+   * Once a host renders the runtime, execution pauses for one frame before
+   * it runs into a TRANSITION, so the outgoing scene can be captured here
+   * for transitions that composite it over the new one.
+   */
+  void render(renderer::IRenderer &renderer);
+
   /**
    * @brief Continue execution after waiting for input
    */
@@ -319,6 +345,12 @@ public:
    */
   [[nodiscard]] VirtualMachine &getVM();
 
+  /**
+   * @brief Asset prefetch counters (hit/late/miss per asset use)
+   */
+  [[nodiscard]] const PrefetchStats &getPrefetchStats() const;
+  void resetPrefetchStats();
+
 private:
   // VM callback handlers
   void onShowBackground(const std::vector<Value> &args);
@@ -348,9 +380,34 @@ private:
   std::unique_ptr<Scene::ITransition> createTransition(const std::string &type,
                                                        f32 duration);
 
-  // VM and compiled script
+  /**
+   * @brief Prepare the next TRANSITION for an outgoing-frame capture
+   *
+   * Looks ahead from the IP to the next instruction that waits or branches.
+   * Returns true when a transition lies ahead and the VM should hold this
+   * update so render() can capture the scene before it changes.
+   */
+  bool prepareOutgoingCapture();
+  void resetPendingTransition();
+
+  Result<void> loadProgram();
+  Result<void> finishLoad();
+  [[nodiscard]] std::span<const Instruction> programView() const;
+
+  /**
+   * @brief Start background loads for assets ahead of the current IP
+   *
+   * Called whenever execution stops for the player (dialogue, choice, scene
+   * entry), which is when the next assets are furthest from being needed.
+   */
+  void schedulePrefetch();
+  void recordAssetUse(PrefetchKind kind, const std::string &id);
+
+  // VM and compiled script; when loaded from an image, m_script holds only
+  // the metadata and the instructions live in m_image
   VirtualMachine m_vm;
   CompiledScript m_script;
+  std::shared_ptr<const BytecodeImage> m_image;
 
   // Connected systems
   scene::SceneManager *m_sceneManager = nullptr;
@@ -373,6 +430,13 @@ private:
   f32 m_waitTimer = 0.0f;
   std::unique_ptr<Scene::ITransition> m_activeTransition;
 
+  // Outgoing-frame capture for the next TRANSITION, see render()
+  std::unique_ptr<Scene::ITransition> m_pendingTransition;
+  bool m_captureRequested = false;
+  bool m_rendering = false; // render() has been called by the host
+  u32 m_captureScanFrom = 1; // Last lookahead that found no transition
+  u32 m_captureScanEnd = 0;
+
   // Dialogue state
   bool m_dialogueActive = false;
 
@@ -385,6 +449,14 @@ private:
 
   // Event callback
   EventCallback m_eventCallback;
+
+  // Asset prefetch
+  PrefetchPlanner m_prefetchPlanner;
+  PrefetchStats m_prefetchStats;
+  u32 m_lastPrefetchIp = ~0u;
+  std::unordered_set<std::string> m_prefetchedTextures;
+  std::unordered_map<std::string, std::shared_ptr<resource::LoadRequest<usize>>>
+      m_prefetchedAudio;
 };
 
 /**
@@ -4,8 +4,11 @@
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/scripting/opcode.hpp"
 #include "NovelMind/scripting/value.hpp"
+#include "NovelMind/scripting/vm_value.hpp"
 #include "NovelMind/scripting/vm_security.hpp"
 #include <functional>
+#include <memory>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -14,6 +17,7 @@ namespace NovelMind::scripting {
 
 // Forward declaration for debugger integration
 class VMDebugger;
+class BytecodeImage;
 
 class VirtualMachine {
 public:
@@ -24,6 +28,14 @@ public:
 
   Result<void> load(const std::vector<Instruction> &program,
                     const std::vector<std::string> &stringTable);
+
+  /**
+   * @brief Load a compiled .nmc image and execute its instructions in place
+   *
+   * The VM keeps a reference to @p image; no copy of the instruction stream
+   * is made.
+   */
+  Result<void> load(std::shared_ptr<const BytecodeImage> image);
   void reset();
 
   bool step();
@@ -44,15 +56,11 @@ public:
   void setVariable(const std::string &name, Value value);
   [[nodiscard]] Value getVariable(const std::string &name) const;
   [[nodiscard]] bool hasVariable(const std::string &name) const;
-  [[nodiscard]] std::unordered_map<std::string, Value> getAllVariables() const {
-    return m_variables;
-  }
+  [[nodiscard]] std::unordered_map<std::string, Value> getAllVariables() const;
 
   void setFlag(const std::string &name, bool value);
   [[nodiscard]] bool getFlag(const std::string &name) const;
-  [[nodiscard]] std::unordered_map<std::string, bool> getAllFlags() const {
-    return m_flags;
-  }
+  [[nodiscard]] std::unordered_map<std::string, bool> getAllFlags() const;
 
   void registerCallback(OpCode op, NativeCallback callback);
 
@@ -109,8 +117,17 @@ public:
 
   /**
    * @brief Get current stack contents (for debugging)
+   *
+   * The VM stores compact values internally; this materialises a copy.
    */
-  [[nodiscard]] const std::vector<Value> &getStack() const { return m_stack; }
+  [[nodiscard]] std::vector<Value> getStack() const;
+
+  /**
+   * @brief Number of strings currently interned, string table included
+   */
+  [[nodiscard]] usize getInternedStringCount() const {
+    return m_strings.size();
+  }
 
   /**
    * @brief Get string from string table (for debugging)
@@ -128,18 +145,182 @@ public:
   }
 
 private:
+  /// Sentinel for an operand that could not be linked to a slot
+  static constexpr u32 INVALID_SLOT = 0xFFFFFFFFu;
+  /// Runtime strings allowed to pile up before collectStrings() runs
+  static constexpr usize MIN_COLLECT_STRINGS = 1024;
+
   void executeInstruction(const Instruction &instr);
-  void push(Value value);
-  Value pop();
+  void push(VMValue value);
+  void push(i32 value) { push(VMValue::makeInt(value)); }
+  void push(f32 value) { push(VMValue::makeFloat(value)); }
+  void push(bool value) { push(VMValue::makeBool(value)); }
+  VMValue pop();
   [[nodiscard]] const std::string &getString(u32 index) const;
+  [[nodiscard]] StringHandle getStringHandle(u32 index) const;
+
+  /// String concatenation for ADD; the result is interned in m_strings
+  /// and reclaimed by collectStrings() once nothing references it
+  VMValue concat(const VMValue &a, const VMValue &b);
+  /// Three-way textual comparison with asString() coercion rules
+  int compareStrings(const VMValue &a, const VMValue &b);
 
-  std::vector<Instruction> m_program;
+  // Operator semantics shared by executeInstruction() and the fast loop
+  VMValue addValues(const VMValue &a, const VMValue &b);
+  static VMValue subValues(const VMValue &a, const VMValue &b);
+  static VMValue mulValues(const VMValue &a, const VMValue &b);
+  static VMValue negateValue(const VMValue &a);
+  bool equalValues(const VMValue &a, const VMValue &b);
+  template <typename Compare>
+  bool orderValues(const VMValue &a, const VMValue &b, Compare cmp);
+
+  /**
+   * @brief Shared tail of both load() overloads
+   */
+  void finishLoad();
+
+  /**
+   * @brief Re-intern the string table into a fresh pool on load()
+   */
+  void rebuildStringPool();
+
+  /**
+   * @brief Reclaim runtime strings no longer on the stack or in a variable
+   *
+   * Strings interned after the string table are re-interned from the live
+   * ones and the stack and variable slots are remapped to the new handles.
+   * Table handles never move, so decoded instructions stay valid.
+   */
+  void collectStrings();
+
+  /**
+   * @brief Resolve variable/flag operands of the loaded program to slots
+   *
+   * Runs once per load(). Every LOAD_VAR/STORE_VAR/LOAD_GLOBAL/STORE_GLOBAL
+   * and SET_FLAG/CHECK_FLAG operand is mapped from its string table index to
+   * a dense slot, so execution never hashes a name.
+   */
+  void linkProgram();
+  u32 resolveVariableSlot(const std::string &name);
+  u32 resolveFlagSlot(const std::string &name);
+
+  void storeVariable(u32 slot, VMValue value);
+
+  /**
+   * @brief Dispatch codes for the pre-decoded fast loop
+   *
+   * Opcodes without an inline handler (VN commands, CALL/RETURN, HALT) and
+   * instructions that could only take an error path decode to Slow; the
+   * fast loop stops in front of them and they run through step().
+   *
+   * The last two entries are superinstructions fused from common four-
+   * instruction sequences; the covered instructions keep their own decoded
+   * entries so jumps into the middle of a sequence still work.
+   */
+  enum class FastOp : u8 {
+    Slow,
+    Nop,
+    Jump,
+    JumpIf,
+    JumpIfNot,
+    PushInt,
+    PushFloat,
+    PushString,
+    PushBool,
+    PushNull,
+    Pop,
+    Dup,
+    LoadVar,
+    StoreVar,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Mod,
+    Neg,
+    Eq,
+    Ne,
+    Lt,
+    Le,
+    Gt,
+    Ge,
+    And,
+    Or,
+    Not,
+    SetFlag,
+    CheckFlag,
+    AddVarInt,        ///< LOAD_VAR s; PUSH_INT k; ADD; STORE_VAR s
+    CompareVarIntBranch, ///< LOAD_VAR s; PUSH_INT k; <cmp>; JUMP_IF_NOT t
+    Count
+  };
+
+  struct DecodedInstruction {
+    const void *handler = nullptr; ///< Label address once threaded
+    u32 arg = 0; ///< Resolved slot, jump target, string handle or immediate
+    u32 imm = 0;    ///< Integer constant of a superinstruction
+    u32 target = 0; ///< Branch target of CompareVarIntBranch
+    FastOp op = FastOp::Slow;
+    OpCode cmp = OpCode::NOP; ///< Comparison of CompareVarIntBranch
+  };
+
+  /**
+   * @brief Build m_decoded from the linked program (one entry per
+   *        instruction plus a trailing Slow sentinel)
+   */
+  void decodeProgram();
+
+  /**
+   * @brief Rewrite the head of recognised sequences in m_decoded into
+   *        superinstructions
+   */
+  void fuseSuperinstructions();
+
+  /**
+   * @brief Execute decoded instructions until one needs the slow path
+   *
+   * Uses computed-goto direct threading on GCC/Clang and a switch loop
+   * elsewhere. Never invoked while a debugger is attached.
+   */
+  void runFast();
+
+  /// View of the executing instructions: m_ownedProgram or m_image's data
+  std::span<const Instruction> m_program;
+  std::vector<Instruction> m_ownedProgram;
+  std::shared_ptr<const BytecodeImage> m_image;
   std::vector<std::string> m_stringTable;
-  std::vector<Value> m_stack;
-  std::unordered_map<std::string, Value> m_variables;
-  std::unordered_map<std::string, bool> m_flags;
+  std::vector<VMValue> m_stack;
+
+  // Interned strings: the string table maps 1:1 to handles at load time and
+  // runtime concatenations are added on demand
+  StringPool m_strings;
+  std::vector<StringHandle> m_stringHandles;
+  usize m_permanentStrings = 1; ///< Pool size with just the string table
+  usize m_collectThreshold = 0; ///< Pool size that triggers collectStrings()
+  std::string m_concatBuffer;
+  std::string m_scratchA;
+  std::string m_scratchB;
   std::unordered_map<OpCode, NativeCallback> m_callbacks;
 
+  // Variable storage: dense slots plus a name->slot side table for the
+  // name-based API, save states and the debugger. Slots survive load() so
+  // variables persist across scene reloads exactly like the old map did.
+  std::unordered_map<std::string, u32> m_variableSlots;
+  std::vector<std::string> m_variableNames;
+  std::vector<VMValue> m_variableValues;
+  std::vector<u8> m_variableDefined;
+
+  // Flag storage, same layout as variables
+  std::unordered_map<std::string, u32> m_flagSlots;
+  std::vector<std::string> m_flagNames;
+  std::vector<u8> m_flagValues;
+  std::vector<u8> m_flagDefined;
+
+  /// Per-instruction resolved slot (INVALID_SLOT for non-linked opcodes)
+  std::vector<u32> m_linkedSlots;
+
+  std::vector<DecodedInstruction> m_decoded;
+  bool m_threaded = false; ///< Handlers in m_decoded are filled in
+
   VMSecurityGuard m_securityGuard;
 
   u32 m_ip;
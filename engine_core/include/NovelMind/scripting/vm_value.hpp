@@ -0,0 +1,178 @@
+#pragma once
+
+/**
+ * @file vm_value.hpp
+ * @brief Compact tagged value and interned string pool used inside the VM
+ *
+ * scripting::Value (a std::variant holding std::string) stays the public
+ * currency for callbacks, save states and the debugger. Internally the VM
+ * keeps its stack and variable slots as VMValue: an 8-byte tag + payload
+ * whose strings are handles into a per-VM StringPool, so pushing, copying
+ * and loading values never touches the heap.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/scripting/value.hpp"
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace NovelMind::scripting {
+
+/// Index of an interned string inside a StringPool
+using StringHandle = u32;
+
+/**
+ * @brief Deduplicating string storage addressed by StringHandle
+ *
+ * Handle 0 is always the empty string, so truthiness of a string value is a
+ * handle comparison. Strings live in a deque so the string_view keys used for
+ * lookup stay valid as the pool grows.
+ */
+class StringPool {
+public:
+  static constexpr StringHandle EMPTY = 0;
+
+  StringPool();
+
+  /**
+   * @brief Get the handle for a string, adding it if not yet present
+   */
+  StringHandle intern(std::string_view str);
+
+  [[nodiscard]] std::string_view view(StringHandle handle) const {
+    return handle < m_strings.size() ? std::string_view(m_strings[handle])
+                                     : std::string_view();
+  }
+
+  [[nodiscard]] const std::string &get(StringHandle handle) const;
+
+  [[nodiscard]] usize size() const { return m_strings.size(); }
+
+  /**
+   * @brief Drop every string except the empty string
+   */
+  void clear();
+
+  /**
+   * @brief Drop every string added after the first @p count
+   *
+   * Handles below @p count stay valid; the empty string is always kept.
+   */
+  void truncate(usize count);
+
+private:
+  std::deque<std::string> m_strings;
+  std::unordered_map<std::string_view, StringHandle> m_lookup;
+};
+
+/**
+ * @brief Trivially copyable tagged value used for the VM stack and slots
+ */
+struct VMValue {
+  ValueType type = ValueType::Null;
+  union {
+    i32 i = 0;
+    f32 f;
+    bool b;
+    StringHandle str;
+  };
+
+  [[nodiscard]] static VMValue null() { return {}; }
+
+  [[nodiscard]] static VMValue makeInt(i32 v) {
+    VMValue val;
+    val.type = ValueType::Int;
+    val.i = v;
+    return val;
+  }
+
+  [[nodiscard]] static VMValue makeFloat(f32 v) {
+    VMValue val;
+    val.type = ValueType::Float;
+    val.f = v;
+    return val;
+  }
+
+  [[nodiscard]] static VMValue makeBool(bool v) {
+    VMValue val;
+    val.type = ValueType::Bool;
+    val.b = v;
+    return val;
+  }
+
+  [[nodiscard]] static VMValue makeString(StringHandle handle) {
+    VMValue val;
+    val.type = ValueType::String;
+    val.str = handle;
+    return val;
+  }
+
+  [[nodiscard]] bool isNull() const { return type == ValueType::Null; }
+
+  [[nodiscard]] i32 asInt() const {
+    switch (type) {
+    case ValueType::Int:
+      return i;
+    case ValueType::Float:
+      return static_cast<i32>(f);
+    case ValueType::Bool:
+      return b ? 1 : 0;
+    default:
+      return 0;
+    }
+  }
+
+  [[nodiscard]] f32 asFloat() const {
+    switch (type) {
+    case ValueType::Float:
+      return f;
+    case ValueType::Int:
+      return static_cast<f32>(i);
+    case ValueType::Bool:
+      return b ? 1.0f : 0.0f;
+    default:
+      return 0.0f;
+    }
+  }
+
+  [[nodiscard]] bool asBool() const {
+    switch (type) {
+    case ValueType::Bool:
+      return b;
+    case ValueType::Int:
+      return i != 0;
+    case ValueType::Float:
+      return f != 0.0f;
+    case ValueType::String:
+      return str != StringPool::EMPTY;
+    default:
+      return false;
+    }
+  }
+};
+
+static_assert(sizeof(VMValue) <= 16, "VMValue must stay register-sized");
+
+/**
+ * @brief Convert a VM value to the public variant representation
+ */
+[[nodiscard]] Value toValue(const VMValue &value, const StringPool &pool);
+
+/**
+ * @brief Convert a public value to a VM value, interning strings into @p pool
+ */
+[[nodiscard]] VMValue fromValue(const Value &value, StringPool &pool);
+
+/**
+ * @brief Textual form of a value, matching asString(const Value&)
+ *
+ * Strings are returned as views into the pool; other types are formatted
+ * into @p scratch, which must outlive the returned view.
+ */
+[[nodiscard]] std::string_view stringOf(const VMValue &value,
+                                        const StringPool &pool,
+                                        std::string &scratch);
+
+} // namespace NovelMind::scripting
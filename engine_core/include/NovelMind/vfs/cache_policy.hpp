@@ -0,0 +1,167 @@
+#pragma once
+
+/**
+ * @file cache_policy.hpp
+ * @brief Eviction policies for ResourceCache
+ *
+ * Each cache shard owns one policy instance and calls it under the shard
+ * lock. Policies keep their bookkeeping inside CacheEntry (intrusive list
+ * links, a visited bit, a priority key), so a cache hit never allocates.
+ * Every policy also ranks its candidate on a scale shared by all shards,
+ * so the cache can evict the best victim overall rather than per shard.
+ *
+ * - LRU:   evicts the least recently used entry; a hit moves the entry to
+ *          the front of the list.
+ * - SIEVE: FIFO order plus a visited bit. A hit only sets the bit, and the
+ *          eviction hand gives visited entries a second chance. Scan-
+ *          resistant and cheaper on hits than LRU. Across shards, the
+ *          oldest candidate goes first; a visited one counts from its
+ *          last hit.
+ * - GDSF:  Greedy-Dual-Size-Frequency. Priority is L + frequency / size,
+ *          so large, rarely used entries go first. L ages the cache: it
+ *          is raised to each victim's priority, in every shard.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include "NovelMind/vfs/resource_id.hpp"
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace NovelMind::VFS {
+
+/// Immutable cached bytes shared between the cache and its readers
+using SharedBuffer = std::shared_ptr<const std::vector<u8>>;
+
+enum class EvictionPolicy : u8 { LRU, SIEVE, GDSF };
+
+struct CacheEntry {
+  ResourceId id;
+  SharedBuffer data;
+  usize size = 0;
+  std::chrono::steady_clock::time_point lastAccess;
+  usize accessCount = 0;
+  u64 insertTick = 0; ///< Cache-wide logical clock at insertion
+  u64 accessTick = 0; ///< Cache-wide logical clock at the last insert or hit
+
+  /// @name Policy bookkeeping
+  /// @{
+  CacheEntry *prev = nullptr;
+  CacheEntry *next = nullptr;
+  bool visited = false;
+  f64 priority = 0.0;
+  /// @}
+};
+
+class IEvictionPolicy {
+public:
+  using Filter = std::function<bool(const CacheEntry &)>;
+
+  virtual ~IEvictionPolicy() = default;
+
+  virtual void onInsert(CacheEntry &entry) = 0;
+  virtual void onAccess(CacheEntry &entry) = 0;
+  virtual void onRemove(CacheEntry &entry) = 0;
+
+  /**
+   * @brief Choose the next entry to evict
+   * @param accept Candidates failing the filter are skipped
+   * @return The victim (still tracked; the caller removes it), or nullptr
+   */
+  [[nodiscard]] virtual CacheEntry *selectVictim(const Filter &accept) = 0;
+
+  /**
+   * @brief The entry selectVictim() would return, without side effects
+   */
+  [[nodiscard]] virtual const CacheEntry *
+  peekVictim(const Filter &accept) const = 0;
+
+  /**
+   * @brief Eviction order of an entry; lower ranks go first
+   *
+   * Ranks of instances of the same policy are comparable, so the cache
+   * can pick one victim over all shards.
+   */
+  [[nodiscard]] virtual f64 evictionRank(const CacheEntry &entry) const = 0;
+
+  /// An entry of @p rank was evicted from some shard of the cache
+  virtual void onEvicted(f64 rank) { (void)rank; }
+
+  /// Forget all entries without touching them
+  virtual void clear() = 0;
+};
+
+[[nodiscard]] std::unique_ptr<IEvictionPolicy>
+createEvictionPolicy(EvictionPolicy policy);
+
+/**
+ * @brief Intrusive doubly linked list over CacheEntry::prev/next
+ */
+class CacheEntryList {
+public:
+  void pushFront(CacheEntry &entry);
+  void unlink(CacheEntry &entry);
+  void clear() { m_head = m_tail = nullptr; }
+
+  [[nodiscard]] CacheEntry *head() const { return m_head; }
+  [[nodiscard]] CacheEntry *tail() const { return m_tail; }
+
+private:
+  CacheEntry *m_head = nullptr;
+  CacheEntry *m_tail = nullptr;
+};
+
+class LruPolicy final : public IEvictionPolicy {
+public:
+  void onInsert(CacheEntry &entry) override;
+  void onAccess(CacheEntry &entry) override;
+  void onRemove(CacheEntry &entry) override;
+  [[nodiscard]] CacheEntry *selectVictim(const Filter &accept) override;
+  [[nodiscard]] const CacheEntry *
+  peekVictim(const Filter &accept) const override;
+  [[nodiscard]] f64 evictionRank(const CacheEntry &entry) const override;
+  void clear() override { m_list.clear(); }
+
+private:
+  CacheEntryList m_list;
+};
+
+class SievePolicy final : public IEvictionPolicy {
+public:
+  void onInsert(CacheEntry &entry) override;
+  void onAccess(CacheEntry &entry) override;
+  void onRemove(CacheEntry &entry) override;
+  [[nodiscard]] CacheEntry *selectVictim(const Filter &accept) override;
+  [[nodiscard]] const CacheEntry *
+  peekVictim(const Filter &accept) const override;
+  [[nodiscard]] f64 evictionRank(const CacheEntry &entry) const override;
+  void clear() override;
+
+private:
+  CacheEntryList m_list; ///< Newest at the head
+  CacheEntry *m_hand = nullptr;
+};
+
+class GdsfPolicy final : public IEvictionPolicy {
+public:
+  void onInsert(CacheEntry &entry) override;
+  void onAccess(CacheEntry &entry) override;
+  void onRemove(CacheEntry &entry) override;
+  [[nodiscard]] CacheEntry *selectVictim(const Filter &accept) override;
+  [[nodiscard]] const CacheEntry *
+  peekVictim(const Filter &accept) const override;
+  [[nodiscard]] f64 evictionRank(const CacheEntry &entry) const override;
+  void onEvicted(f64 rank) override;
+  void clear() override;
+
+private:
+  [[nodiscard]] f64 computePriority(const CacheEntry &entry) const;
+
+  std::set<std::pair<f64, CacheEntry *>> m_queue;
+  f64 m_inflation = 0.0;
+};
+
+} // namespace NovelMind::VFS
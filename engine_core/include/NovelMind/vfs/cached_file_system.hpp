@@ -4,10 +4,16 @@
 #include "NovelMind/vfs/virtual_fs.hpp"
 #include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace NovelMind::vfs {
 
+/**
+ * @brief LRU byte-budgeted cache in front of another file system
+ *
+ * Safe to read from loader threads; the inner file system must be too.
+ */
 class CachedFileSystem final : public IVirtualFileSystem {
 public:
   explicit CachedFileSystem(std::unique_ptr<IVirtualFileSystem> inner,
@@ -20,6 +26,15 @@ public:
   [[nodiscard]] Result<std::vector<u8>>
   readFile(const std::string &resourceId) const override;
 
+  [[nodiscard]] Result<ResourceView>
+  readFileView(const std::string &resourceId) const override;
+
+  /**
+   * @brief Serve hits from the cache and fetch all misses in one inner batch
+   */
+  [[nodiscard]] std::vector<Result<std::vector<u8>>>
+  readFiles(const std::vector<std::string> &resourceIds) const override;
+
   [[nodiscard]] bool exists(const std::string &resourceId) const override;
   [[nodiscard]] std::optional<ResourceInfo>
   getInfo(const std::string &resourceId) const override;
@@ -32,13 +47,17 @@ public:
 
 private:
   struct CacheEntry {
-    std::vector<u8> data;
+    ResourceView data; ///< May point into an inner pack mapping
     usize size = 0;
   };
 
+  // All require m_mutex to be held
   void touch(const std::string &resourceId) const;
+  void insert(const std::string &resourceId, const ResourceView &data) const;
   void evictIfNeeded() const;
 
+  mutable std::mutex m_mutex;
+
   mutable std::unordered_map<
       std::string, std::pair<CacheEntry, std::list<std::string>::iterator>>
       m_cache;
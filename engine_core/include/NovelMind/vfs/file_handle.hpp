@@ -2,7 +2,10 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/vfs/virtual_fs.hpp"
 #include <cstddef>
+#include <fstream>
+#include <string>
 #include <vector>
 
 namespace NovelMind::VFS {
@@ -46,4 +49,49 @@ private:
   bool m_valid = false;
 };
 
+/**
+ * @brief Handle over a ResourceView
+ *
+ * Reads straight out of the view, so a resource served from a mapped pack
+ * is never copied as a whole.
+ */
+class ViewFileHandle : public IFileHandle {
+public:
+  explicit ViewFileHandle(vfs::ResourceView view);
+
+  [[nodiscard]] bool isValid() const override;
+  [[nodiscard]] usize size() const override;
+  [[nodiscard]] usize position() const override;
+  [[nodiscard]] bool isEof() const override;
+
+  Result<usize> read(u8 *buffer, usize count) override;
+  Result<void> seek(i64 offset, SeekOrigin origin) override;
+
+private:
+  vfs::ResourceView m_view;
+  usize m_position = 0;
+};
+
+/**
+ * @brief Handle that reads a file from disk on demand
+ */
+class DiskFileHandle : public IFileHandle {
+public:
+  explicit DiskFileHandle(const std::string &path);
+
+  [[nodiscard]] bool isValid() const override;
+  [[nodiscard]] usize size() const override;
+  [[nodiscard]] usize position() const override;
+  [[nodiscard]] bool isEof() const override;
+
+  Result<usize> read(u8 *buffer, usize count) override;
+  Result<void> seek(i64 offset, SeekOrigin origin) override;
+
+private:
+  std::ifstream m_file;
+  usize m_size = 0;
+  usize m_position = 0;
+  bool m_valid = false;
+};
+
 } // namespace NovelMind::VFS
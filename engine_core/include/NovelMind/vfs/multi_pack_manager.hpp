@@ -12,12 +12,15 @@
  * - Language packs: Localization resources
  *
  * Resources are resolved by priority, allowing higher-priority packs
- * to override resources from lower-priority packs.
+ * to override resources from lower-priority packs. Resolution goes through
+ * one shared ResourceIndex that is updated incrementally as packs are
+ * mounted, unmounted, enabled or disabled.
  */
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/secure_memory.hpp"
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/vfs/resource_index.hpp"
 #include "NovelMind/vfs/secure_pack_reader.hpp"
 #include "NovelMind/vfs/virtual_fs.hpp"
 #include <functional>
@@ -331,6 +334,16 @@ public:
    */
   Result<std::vector<u8>> readResource(const std::string &resourceId);
 
+  /**
+   * @brief Read many resources at once (e.g. a scene's assets)
+   *
+   * IDs are grouped by providing pack and handed to each pack reader's
+   * readFiles(), so packs that batch disk access read them in offset
+   * order. Results are in the order of @p resourceIds.
+   */
+  std::vector<Result<std::vector<u8>>>
+  readResources(const std::vector<std::string> &resourceIds);
+
   /**
    * @brief Check if a resource exists in any loaded pack
    */
@@ -399,6 +412,27 @@ public:
    */
   Result<void> loadModConfig(const std::string &path);
 
+  // =========================================================================
+  // Index Snapshot
+  // =========================================================================
+
+  /**
+   * @brief Save the resource index to a snapshot file
+   *
+   * The snapshot holds the interned resource paths and, for each mounted
+   * pack, its path, size, modification time and resource list.
+   */
+  Result<void> saveIndexSnapshot(const std::string &path) const;
+
+  /**
+   * @brief Load a snapshot written by saveIndexSnapshot()
+   *
+   * Must be called before any pack is mounted. Packs whose size and
+   * modification time still match are then indexed from the snapshot
+   * instead of enumerating and interning their resources.
+   */
+  Result<void> loadIndexSnapshot(const std::string &path);
+
   // =========================================================================
   // Statistics
   // =========================================================================
@@ -432,6 +466,7 @@ private:
                                   i32 priority);
   PackInfo readPackManifest(const std::string &path);
   void rebuildResourceIndex();
+  void resetResourceIndex();
   i32 calculateEffectivePriority(PackType type, i32 basePriority) const;
   void firePackLoaded(const PackInfo &info);
   void firePackUnloaded(const std::string &packId);
@@ -442,19 +477,35 @@ private:
   std::string m_packDirectory;
   std::string m_modsDirectory;
 
-  // Loaded packs (ordered by effective priority)
+  // Loaded packs, in load order
   struct LoadedPack {
     PackInfo info;
     std::unique_ptr<IVirtualFileSystem> reader;
     i32 effectivePriority = 0;
-    std::set<std::string> providedResources;
+    u32 slot = 0;          // Stable index into m_packSlots
+    u64 loadSequence = 0;  // Later loads win priority ties
+    std::vector<ResourceIndex::PathId> providedResources; // Sorted
   };
 
+  [[nodiscard]] bool outranks(const LoadedPack &a, const LoadedPack &b) const;
+  void indexPack(const LoadedPack &pack);
+  void unindexPack(const LoadedPack &pack);
+
   std::vector<std::unique_ptr<LoadedPack>> m_packs;
   std::unordered_map<std::string, size_t> m_packIdToIndex;
 
-  // Resource index: resource ID -> pack index
-  std::unordered_map<std::string, size_t> m_resourceIndex;
+  // Resource index: interned path -> providing pack slot
+  ResourceIndex m_resourceIndex;
+  std::vector<LoadedPack *> m_packSlots; // nullptr for free slots
+  u64 m_nextLoadSequence = 0;
+
+  // Resource lists from a loaded snapshot, by pack path
+  struct SnapshotPack {
+    u64 fileSize = 0;
+    i64 modifiedTime = 0;
+    std::vector<ResourceIndex::PathId> resources;
+  };
+  std::unordered_map<std::string, SnapshotPack> m_snapshotPacks;
 
   // Mod load order
   std::vector<std::string> m_modLoadOrder;
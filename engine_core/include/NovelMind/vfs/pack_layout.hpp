@@ -0,0 +1,109 @@
+#pragma once
+
+/**
+ * @file pack_layout.hpp
+ * @brief First-use ordering of pack data
+ *
+ * The planner collects asset IDs in the order a game first needs them,
+ * either from a recorded play trace or from a walk over compiled script
+ * control flow, and turns that into a write order for a pack. Reading the
+ * assets of a scene then becomes a mostly sequential pass over the file.
+ */
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace NovelMind::vfs {
+
+/**
+ * @brief How well a layout serves an access sequence
+ *
+ * A read is sequential when the resource starts at or after the end of the
+ * one read before it, within a gap the batched reader would coalesce.
+ */
+struct LayoutLocality {
+  usize sequentialReads = 0;
+  usize totalReads = 0; ///< Transitions between consecutive accesses
+
+  /// 1.0 when every read continues forward from the previous one
+  [[nodiscard]] f64 score() const {
+    return totalReads == 0 ? 1.0
+                           : static_cast<f64>(sequentialReads) /
+                                 static_cast<f64>(totalReads);
+  }
+
+  LayoutLocality &operator+=(const LayoutLocality &other) {
+    sequentialReads += other.sequentialReads;
+    totalReads += other.totalReads;
+    return *this;
+  }
+};
+
+class PackLayoutPlanner {
+public:
+  /**
+   * @brief Record a use of @p assetId; only the first use sets its position
+   */
+  void addAccess(std::string_view assetId);
+
+  /**
+   * @brief Append a recorded play trace
+   *
+   * One asset ID per line; blank lines and lines starting with '#' are
+   * skipped.
+   * @return Number of new accesses added
+   */
+  Result<usize> loadTrace(const std::string &path);
+
+  [[nodiscard]] const std::vector<std::string> &accesses() const {
+    return m_accesses;
+  }
+  [[nodiscard]] bool empty() const { return m_accesses.empty(); }
+  void clear();
+
+  /**
+   * @brief Map the recorded accesses onto pack resource IDs
+   *
+   * An access matches a resource by exact ID, then by file name, then by
+   * file name without extension, ignoring case, since scripts name assets
+   * by their stem while packs store file names.
+   * @return Indices into @p resourceIds in first-use order, each once
+   */
+  [[nodiscard]] std::vector<usize>
+  resolve(const std::vector<std::string> &resourceIds) const;
+
+  /**
+   * @brief Write order for a pack
+   *
+   * Preloaded resources come first since they are all read at startup,
+   * then the remaining used resources, both in first-use order. Resources
+   * no access reaches keep their original relative order at the end.
+   * @param preload Per resource, or empty when nothing is preloaded
+   * @return A permutation of the indices of @p resourceIds
+   */
+  [[nodiscard]] std::vector<usize>
+  order(const std::vector<std::string> &resourceIds,
+        const std::vector<bool> &preload = {}) const;
+
+  /**
+   * @brief Score a layout against an access sequence
+   * @param accesses Resource indices in the order they are read
+   * @param offsets Data offset of each resource
+   * @param sizes Stored size of each resource
+   * @param maxGap Largest skipped range that still counts as sequential
+   */
+  [[nodiscard]] static LayoutLocality
+  measure(std::span<const usize> accesses, std::span<const u64> offsets,
+          std::span<const u64> sizes, u64 maxGap);
+
+private:
+  std::vector<std::string> m_accesses;
+  std::unordered_set<std::string> m_seen;
+};
+
+} // namespace NovelMind::vfs
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "NovelMind/platform/mapped_file.hpp"
 #include "NovelMind/vfs/virtual_fs.hpp"
 #include <fstream>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 
 namespace NovelMind::vfs {
@@ -51,9 +54,46 @@ public:
   void unmount(const std::string &packPath) override;
   void unmountAll() override;
 
+  /**
+   * @brief Copying read, kept for compatibility with readFileView()
+   */
   [[nodiscard]] Result<std::vector<u8>>
   readFile(const std::string &resourceId) const override;
 
+  /**
+   * @brief Zero-copy read from the pack mapping
+   *
+   * Plain entries of a memory-mapped pack are returned as a view into the
+   * mapping; flagged entries and packs mounted without mapping fall back to
+   * a copy.
+   */
+  [[nodiscard]] Result<ResourceView>
+  readFileView(const std::string &resourceId) const override;
+
+  /**
+   * @brief Batched read for preloading many resources at once
+   *
+   * All IDs are resolved under one lock. Resources of streamed packs are
+   * sorted by pack offset and neighbouring ranges (gaps up to
+   * BATCH_MAX_GAP, spans up to BATCH_MAX_SPAN) are fetched with one
+   * vectored read each, so the pack is opened once and read front to back
+   * instead of seeked to once per resource.
+   */
+  [[nodiscard]] std::vector<Result<std::vector<u8>>>
+  readFiles(const std::vector<std::string> &resourceIds) const override;
+
+  static constexpr u64 BATCH_MAX_GAP = 64 * 1024;
+  static constexpr u64 BATCH_MAX_SPAN = 8 * 1024 * 1024;
+
+  /**
+   * @brief Map packs into memory on mount (default on)
+   *
+   * Only affects packs mounted afterwards. When mapping fails the pack is
+   * still mounted and read through streams.
+   */
+  void setMemoryMappingEnabled(bool enabled);
+  [[nodiscard]] bool isMemoryMappingEnabled() const;
+
   [[nodiscard]] bool exists(const std::string &resourceId) const override;
 
   [[nodiscard]] std::optional<ResourceInfo>
@@ -68,18 +108,40 @@ private:
     PackHeader header;
     std::unordered_map<std::string, PackResourceEntry> entries;
     std::vector<std::string> stringTable;
+    /// Whole-file mapping, shared with every view handed out
+    std::shared_ptr<const platform::MappedFile> mapping;
+  };
+
+  /// Everything needed to read one resource without holding the lock
+  struct Location {
+    std::string packPath;
+    u64 packDataOffset = 0;
+    PackResourceEntry entry{};
+    std::shared_ptr<const platform::MappedFile> mapping;
   };
 
+  [[nodiscard]] std::optional<Location>
+  locate(const std::string &resourceId) const;
+  /// Same as locate(); m_mutex must be held
+  [[nodiscard]] std::optional<Location>
+  locateLocked(const std::string &resourceId) const;
+
   Result<void> readPackHeader(std::ifstream &file, PackHeader &header);
   Result<void> readResourceTable(std::ifstream &file, MountedPack &pack);
   Result<void> readStringTable(std::ifstream &file, MountedPack &pack);
 
   [[nodiscard]] Result<std::vector<u8>>
-  readResourceData(const std::string &packPath,
-                   const PackResourceEntry &entry) const;
+  readResourceData(const Location &location) const;
+
+  /**
+   * @brief Bounds-checked span of a resource inside its pack mapping
+   */
+  [[nodiscard]] static Result<std::span<const u8>>
+  mappedResourceBytes(const Location &location);
 
   mutable std::mutex m_mutex;
   std::unordered_map<std::string, MountedPack> m_packs;
+  bool m_useMapping = true;
 };
 
 } // namespace NovelMind::vfs
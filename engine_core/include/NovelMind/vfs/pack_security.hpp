@@ -135,6 +135,16 @@ public:
   [[nodiscard]] Result<std::vector<u8>>
   readResource(const std::string &resourceId);
 
+  /**
+   * @brief Read several resources with one batched pass over the pack
+   *
+   * Raw bytes are read in offset order (see PackReader::readFiles()), then
+   * each resource is decrypted, decompressed and checked on its own.
+   * Results are in the order of @p resourceIds.
+   */
+  [[nodiscard]] std::vector<Result<std::vector<u8>>>
+  readResources(const std::vector<std::string> &resourceIds);
+
   [[nodiscard]] bool isOpen() const { return m_isOpen; }
   [[nodiscard]] PackVerificationResult lastVerificationResult() const {
     return m_lastResult;
@@ -178,6 +188,11 @@ private:
     u8 reserved[12];
   };
 
+  /// Decrypt, decompress and verify the raw bytes of one resource
+  Result<std::vector<u8>> decodeResource(const std::string &resourceId,
+                                         const PackResourceEntry &entry,
+                                         std::vector<u8> data);
+
   std::unique_ptr<PackDecryptor> m_decryptor;
   std::unique_ptr<PackIntegrityChecker> m_integrityChecker;
   std::string m_packPath;
@@ -185,7 +200,6 @@ private:
   PackFooter m_footer{};
   u64 m_fileSize = 0;
   std::unordered_map<std::string, PackResourceEntry> m_entries;
-  std::vector<std::string> m_stringTable;
   bool m_isOpen = false;
   PackVerificationResult m_lastResult = PackVerificationResult::Valid;
 };
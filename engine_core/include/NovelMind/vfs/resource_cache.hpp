@@ -1,22 +1,30 @@
 #pragma once
 
+/**
+ * @file resource_cache.hpp
+ * @brief Sharded, size-bounded cache of resource bytes
+ *
+ * Entries are spread over lock-striped shards by ResourceId hash, so
+ * parallel loaders rarely contend. Cached data is handed out as a
+ * SharedBuffer instead of being copied. Budgets are global (maxSize) and,
+ * optionally, per ResourceType. Each shard orders its entries with its own
+ * IEvictionPolicy instance; eviction compares the candidates of all shards
+ * and removes the lowest-ranked one, so the cache as a whole follows the
+ * policy no matter which shard was just written.
+ */
+
 #include "NovelMind/core/types.hpp"
+#include "NovelMind/vfs/cache_policy.hpp"
 #include "NovelMind/vfs/resource_id.hpp"
-#include <chrono>
-#include <list>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
-#include <optional>
 #include <unordered_map>
 #include <vector>
 
 namespace NovelMind::VFS {
 
-struct CacheEntry {
-  std::vector<u8> data;
-  std::chrono::steady_clock::time_point lastAccess;
-  usize accessCount = 0;
-};
-
 struct CacheStats {
   usize totalSize = 0;
   usize entryCount = 0;
@@ -33,41 +41,92 @@ struct CacheStats {
 
 class ResourceCache {
 public:
-  explicit ResourceCache(usize maxSize = 64 * 1024 * 1024);
+  static constexpr usize DEFAULT_SHARD_COUNT = 16;
+
+  explicit ResourceCache(usize maxSize = 64 * 1024 * 1024,
+                         EvictionPolicy policy = EvictionPolicy::LRU,
+                         usize shardCount = DEFAULT_SHARD_COUNT);
   ~ResourceCache() = default;
 
   ResourceCache(const ResourceCache &) = delete;
   ResourceCache &operator=(const ResourceCache &) = delete;
 
   void setMaxSize(usize maxSize);
-  [[nodiscard]] usize maxSize() const { return m_maxSize; }
+  [[nodiscard]] usize maxSize() const {
+    return m_maxSize.load(std::memory_order_relaxed);
+  }
 
-  [[nodiscard]] std::optional<std::vector<u8>> get(const ResourceId &id);
+  /**
+   * @brief Cap the bytes held for one resource type (0 removes the cap)
+   */
+  void setTypeBudget(ResourceType type, usize maxBytes);
+  [[nodiscard]] usize typeBudget(ResourceType type) const;
+  [[nodiscard]] usize typeSize(ResourceType type) const;
+
+  [[nodiscard]] EvictionPolicy policy() const { return m_policy; }
+  [[nodiscard]] usize shardCount() const { return m_shards.size(); }
+
+  /**
+   * @brief Look up cached bytes
+   * @return Shared read-only buffer, or nullptr on a miss
+   */
+  [[nodiscard]] SharedBuffer get(const ResourceId &id);
   void put(const ResourceId &id, std::vector<u8> data);
+  void put(const ResourceId &id, SharedBuffer data);
   void remove(const ResourceId &id);
   void clear();
 
   [[nodiscard]] bool contains(const ResourceId &id) const;
-  [[nodiscard]] usize currentSize() const { return m_currentSize; }
-  [[nodiscard]] usize entryCount() const { return m_cache.size(); }
+  [[nodiscard]] usize currentSize() const {
+    return m_currentSize.load(std::memory_order_relaxed);
+  }
+  [[nodiscard]] usize entryCount() const {
+    return m_entryCount.load(std::memory_order_relaxed);
+  }
 
   [[nodiscard]] CacheStats stats() const;
   void resetStats();
 
 private:
-  void evictIfNeeded(usize requiredSpace);
-  void updateAccessOrder(const ResourceId &id);
-
-  mutable std::mutex m_mutex;
-  usize m_maxSize;
-  usize m_currentSize = 0;
-
-  std::unordered_map<ResourceId, CacheEntry> m_cache;
-  std::list<ResourceId> m_accessOrder;
-  std::unordered_map<ResourceId, std::list<ResourceId>::iterator>
-      m_orderIterators;
-
-  mutable CacheStats m_stats;
+  static constexpr usize TYPE_COUNT =
+      static_cast<usize>(ResourceType::Config) + 1;
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<ResourceId, CacheEntry> entries;
+    std::unique_ptr<IEvictionPolicy> policy;
+  };
+
+  [[nodiscard]] usize shardIndex(const ResourceId &id) const;
+  [[nodiscard]] static usize typeIndex(ResourceType type);
+
+  /// Unlink and erase an entry; the shard lock must be held
+  void eraseLocked(Shard &shard,
+                   std::unordered_map<ResourceId, CacheEntry>::iterator it);
+
+  /**
+   * @brief Evict until the global and type budgets hold
+   * @param type Type whose budget to enforce, or Unknown for global only
+   * @param keep Entry that must survive (the one just inserted)
+   */
+  void enforceBudgets(ResourceType type, const ResourceId *keep);
+
+  /// Evict the lowest-ranked entry accepted by @p accept over all shards
+  bool evictOne(const IEvictionPolicy::Filter &accept);
+
+  std::vector<std::unique_ptr<Shard>> m_shards;
+  EvictionPolicy m_policy;
+
+  std::atomic<usize> m_maxSize;
+  std::atomic<u64> m_clock{0}; ///< Logical time for CacheEntry ticks
+  std::atomic<usize> m_currentSize{0};
+  std::atomic<usize> m_entryCount{0};
+  std::array<std::atomic<usize>, TYPE_COUNT> m_typeSizes{};
+  std::array<std::atomic<usize>, TYPE_COUNT> m_typeBudgets{};
+
+  std::atomic<usize> m_hitCount{0};
+  std::atomic<usize> m_missCount{0};
+  std::atomic<usize> m_evictionCount{0};
 };
 
 } // namespace NovelMind::VFS
@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * @file resource_index.hpp
+ * @brief Interned resource paths and their resolved providers
+ *
+ * Every resource path seen in any mounted pack is stored once and given a
+ * dense PathId. A flat open-addressing table maps the path hash to its
+ * PathId, and a parallel array holds the pack slot currently providing each
+ * path, so resolving a resource is one hash, usually one probe and one
+ * array read. Packs keep their contents as sorted PathId lists instead of
+ * their own path strings.
+ */
+
+#include "NovelMind/core/types.hpp"
+#include <string_view>
+#include <vector>
+
+namespace NovelMind::vfs {
+
+class ResourceIndex {
+public:
+  using PathId = u32;
+  static constexpr PathId NO_PATH = ~u32{0};
+  static constexpr u32 NO_PACK = ~u32{0};
+
+  /**
+   * @brief Get the ID of @p path, adding it if it is new
+   */
+  PathId intern(std::string_view path);
+
+  /**
+   * @brief Get the ID of @p path, or NO_PATH if it was never interned
+   */
+  [[nodiscard]] PathId find(std::string_view path) const;
+
+  /**
+   * @brief Path of an ID; valid until the next intern()
+   */
+  [[nodiscard]] std::string_view path(PathId id) const;
+
+  [[nodiscard]] usize pathCount() const { return m_hashes.size(); }
+
+  /**
+   * @brief Pack slot providing @p id, or NO_PACK
+   */
+  [[nodiscard]] u32 provider(PathId id) const { return m_providers[id]; }
+
+  /**
+   * @brief Pack slot providing @p path, or NO_PACK
+   */
+  [[nodiscard]] u32 provider(std::string_view path) const;
+
+  void setProvider(PathId id, u32 packSlot);
+
+  /**
+   * @brief Remove every provider, keeping the interned paths
+   */
+  void clearProviders();
+
+  /**
+   * @brief Number of paths that currently have a provider
+   */
+  [[nodiscard]] usize resolvedCount() const { return m_resolvedCount; }
+
+  void reserve(usize pathCount);
+  void clear();
+
+  static u64 hashPath(std::string_view path);
+
+private:
+  void grow();
+  void rehash(usize slotCount);
+  [[nodiscard]] usize probe(u64 hash, std::string_view path) const;
+
+  std::vector<char> m_chars;      // All paths back to back
+  std::vector<u32> m_offsets{0};  // Path i is [m_offsets[i], m_offsets[i+1])
+  std::vector<u64> m_hashes;      // Per PathId
+  std::vector<u32> m_providers;   // Per PathId
+  std::vector<PathId> m_slots;    // Open addressing; NO_PATH marks empty
+  usize m_resolvedCount = 0;
+};
+
+} // namespace NovelMind::vfs
@@ -29,6 +29,9 @@ public:
   [[nodiscard]] Result<std::vector<u8>>
   readFile(const std::string &resourceId) const override;
 
+  [[nodiscard]] std::vector<Result<std::vector<u8>>>
+  readFiles(const std::vector<std::string> &resourceIds) const override;
+
   [[nodiscard]] bool exists(const std::string &resourceId) const override;
 
   [[nodiscard]] std::optional<ResourceInfo>
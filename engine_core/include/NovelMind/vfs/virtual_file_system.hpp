@@ -11,6 +11,8 @@ namespace NovelMind::VFS {
 
 struct VFSConfig {
   usize cacheMaxSize = 64 * 1024 * 1024;
+  EvictionPolicy cachePolicy = EvictionPolicy::LRU;
+  usize cacheShardCount = ResourceCache::DEFAULT_SHARD_COUNT;
   bool enableCaching = true;
   bool enableLogging = false;
 };
@@ -41,6 +43,13 @@ public:
   [[nodiscard]] Result<std::vector<u8>> readAll(const ResourceId &id);
   [[nodiscard]] Result<std::vector<u8>> readAll(const std::string &id);
 
+  /**
+   * @brief Read a resource without copying cached bytes
+   *
+   * The buffer is shared with the cache and stays valid after eviction.
+   */
+  [[nodiscard]] Result<SharedBuffer> readShared(const ResourceId &id);
+
   [[nodiscard]] bool exists(const ResourceId &id) const;
   [[nodiscard]] bool exists(const std::string &id) const;
   [[nodiscard]] std::optional<ResourceInfo> getInfo(const ResourceId &id) const;
@@ -49,6 +58,7 @@ public:
 
   void clearCache();
   void setCacheMaxSize(usize maxSize);
+  void setCacheTypeBudget(ResourceType type, usize maxBytes);
   [[nodiscard]] VFSStats stats() const;
 
   using ResourceLoadCallback =
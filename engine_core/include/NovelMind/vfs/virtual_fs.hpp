@@ -2,7 +2,9 @@
 
 #include "NovelMind/core/result.hpp"
 #include "NovelMind/core/types.hpp"
+#include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -27,6 +29,42 @@ struct ResourceInfo {
   u32 checksum;
 };
 
+/**
+ * @brief Read-only view of resource bytes that keeps its storage alive
+ *
+ * The bytes may live in a memory-mapped pack or in a buffer owned by the
+ * view itself; either way the span stays valid for as long as any copy of
+ * the view exists, even if the pack is unmounted in the meantime.
+ */
+class ResourceView {
+public:
+  ResourceView() = default;
+  ResourceView(std::span<const u8> bytes, std::shared_ptr<const void> owner)
+      : m_bytes(bytes), m_owner(std::move(owner)) {}
+
+  /**
+   * @brief Wrap an owned buffer (used by the copying fallback paths)
+   */
+  [[nodiscard]] static ResourceView fromVector(std::vector<u8> data) {
+    auto owned = std::make_shared<const std::vector<u8>>(std::move(data));
+    std::span<const u8> bytes(owned->data(), owned->size());
+    return ResourceView(bytes, std::move(owned));
+  }
+
+  [[nodiscard]] std::span<const u8> bytes() const { return m_bytes; }
+  [[nodiscard]] const u8 *data() const { return m_bytes.data(); }
+  [[nodiscard]] usize size() const { return m_bytes.size(); }
+  [[nodiscard]] bool empty() const { return m_bytes.empty(); }
+
+  [[nodiscard]] std::vector<u8> toVector() const {
+    return {m_bytes.begin(), m_bytes.end()};
+  }
+
+private:
+  std::span<const u8> m_bytes;
+  std::shared_ptr<const void> m_owner;
+};
+
 class IVirtualFileSystem {
 public:
   virtual ~IVirtualFileSystem() = default;
@@ -38,6 +76,39 @@ public:
   [[nodiscard]] virtual Result<std::vector<u8>>
   readFile(const std::string &resourceId) const = 0;
 
+  /**
+   * @brief Read a resource without copying it where the backend allows
+   *
+   * Backends that can serve bytes in place (memory-mapped packs) override
+   * this; the default wraps readFile() in an owning view.
+   */
+  [[nodiscard]] virtual Result<ResourceView>
+  readFileView(const std::string &resourceId) const {
+    auto data = readFile(resourceId);
+    if (data.isError()) {
+      return Result<ResourceView>::error(data.error());
+    }
+    return Result<ResourceView>::ok(
+        ResourceView::fromVector(std::move(data).value()));
+  }
+
+  /**
+   * @brief Read several resources in one call
+   *
+   * Results are returned in the order of @p resourceIds, each with its own
+   * error. Backends that can batch disk access (pack readers) override
+   * this; the default calls readFile() for each ID.
+   */
+  [[nodiscard]] virtual std::vector<Result<std::vector<u8>>>
+  readFiles(const std::vector<std::string> &resourceIds) const {
+    std::vector<Result<std::vector<u8>>> results;
+    results.reserve(resourceIds.size());
+    for (const auto &id : resourceIds) {
+      results.push_back(readFile(id));
+    }
+    return results;
+  }
+
   [[nodiscard]] virtual bool exists(const std::string &resourceId) const = 0;
 
   [[nodiscard]] virtual std::optional<ResourceInfo>
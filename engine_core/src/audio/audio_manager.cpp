@@ -17,19 +17,167 @@ void MaEngineDeleter::operator()(ma_engine* engine) const {
   }
 }
 
-void MaDecoderDeleter::operator()(ma_decoder* decoder) const {
-  if (decoder) {
-    ma_decoder_uninit(decoder);
-    delete decoder;
+// ============================================================================
+// Stream VFS
+// ============================================================================
+
+/**
+ * @brief miniaudio VFS that opens tracks through AudioManager::openStream
+ *
+ * Installed as the engine's resource manager VFS, so ma_sound_init_from_file
+ * reads every track through the providers. miniaudio casts the ma_vfs
+ * pointer back to this struct, which is why the callbacks come first.
+ */
+struct AudioStreamVfs {
+  ma_vfs_callbacks callbacks{};
+  AudioManager *manager = nullptr;
+
+  explicit AudioStreamVfs(AudioManager *owner) : manager(owner) {
+    callbacks.onOpen = onOpen;
+    callbacks.onClose = onClose;
+    callbacks.onRead = onRead;
+    callbacks.onSeek = onSeek;
+    callbacks.onTell = onTell;
+    callbacks.onInfo = onInfo;
+  }
+
+  static VFS::IFileHandle *handleOf(ma_vfs_file file) {
+    return static_cast<VFS::IFileHandle *>(file);
+  }
+
+  static ma_result onOpen(ma_vfs *vfs, const char *path, ma_uint32 openMode,
+                          ma_vfs_file *file) {
+    if (!vfs || !path || !file) {
+      return MA_INVALID_ARGS;
+    }
+    *file = nullptr;
+    if ((openMode & MA_OPEN_MODE_WRITE) != 0) {
+      return MA_ACCESS_DENIED;
+    }
+
+    auto *self = reinterpret_cast<AudioStreamVfs *>(vfs);
+    auto stream = self->manager->openStream(path);
+    if (!stream.isOk()) {
+      return MA_DOES_NOT_EXIST;
+    }
+    *file = std::move(stream).value().release();
+    return MA_SUCCESS;
+  }
+
+  static ma_result onClose(ma_vfs *, ma_vfs_file file) {
+    delete handleOf(file);
+    return MA_SUCCESS;
+  }
+
+  static ma_result onRead(ma_vfs *, ma_vfs_file file, void *dst,
+                          size_t sizeInBytes, size_t *bytesRead) {
+    auto result = handleOf(file)->read(static_cast<u8 *>(dst), sizeInBytes);
+    if (!result.isOk()) {
+      return MA_IO_ERROR;
+    }
+    if (bytesRead) {
+      *bytesRead = result.value();
+    }
+    // Match the stdio backend: short reads succeed, empty reads end
+    return result.value() == 0 && sizeInBytes > 0 ? MA_AT_END : MA_SUCCESS;
+  }
+
+  static ma_result onSeek(ma_vfs *, ma_vfs_file file, ma_int64 offset,
+                          ma_seek_origin origin) {
+    VFS::SeekOrigin seekOrigin = VFS::SeekOrigin::Begin;
+    if (origin == ma_seek_origin_current) {
+      seekOrigin = VFS::SeekOrigin::Current;
+    } else if (origin == ma_seek_origin_end) {
+      seekOrigin = VFS::SeekOrigin::End;
+    }
+    return handleOf(file)->seek(offset, seekOrigin).isOk() ? MA_SUCCESS
+                                                           : MA_BAD_SEEK;
+  }
+
+  static ma_result onTell(ma_vfs *, ma_vfs_file file, ma_int64 *cursor) {
+    if (!cursor) {
+      return MA_INVALID_ARGS;
+    }
+    *cursor = static_cast<ma_int64>(handleOf(file)->position());
+    return MA_SUCCESS;
+  }
+
+  static ma_result onInfo(ma_vfs *, ma_vfs_file file, ma_file_info *info) {
+    if (!info) {
+      return MA_INVALID_ARGS;
+    }
+    info->sizeInBytes = static_cast<ma_uint64>(handleOf(file)->size());
+    return MA_SUCCESS;
+  }
+};
+
+// ============================================================================
+// Asynchronous Loading
+// ============================================================================
+
+namespace {
+
+bool isStreamedChannel(AudioChannel channel) {
+  return channel == AudioChannel::Music || channel == AudioChannel::Voice ||
+         channel == AudioChannel::Ambient;
+}
+
+f64 millisecondsSince(std::chrono::steady_clock::time_point start,
+                      std::chrono::steady_clock::time_point end) {
+  return std::chrono::duration<f64, std::milli>(end - start).count();
+}
+
+/// Worker priority of a source load; voice lines go first
+i32 loadPriority(AudioChannel channel) {
+  switch (channel) {
+  case AudioChannel::Voice:
+    return 3;
+  case AudioChannel::Sound:
+  case AudioChannel::UI:
+    return 2;
+  case AudioChannel::Music:
+    return 1;
+  default:
+    return 0;
   }
 }
 
+constexpr i32 WARM_PRIORITY = -1;
+constexpr usize LOADER_THREADS = 2;
+
+} // namespace
+
+/**
+ * @brief Decoded sound effect kept alive so later plays can copy it
+ */
+struct PooledSound {
+  ma_sound sound{};
+  bool initialized = false;
+  u64 lastUse = 0;
+
+  PooledSound() = default;
+  PooledSound(const PooledSound &) = delete;
+  PooledSound &operator=(const PooledSound &) = delete;
+  ~PooledSound() {
+    if (initialized) {
+      ma_sound_uninit(&sound);
+    }
+  }
+};
+
 // ============================================================================
 // AudioSource Implementation
 // ============================================================================
 
 AudioSource::AudioSource() = default;
-AudioSource::~AudioSource() = default;
+
+AudioSource::~AudioSource() {
+  // Detach from the node graph before the memory goes away; this also waits
+  // for any load job still running for the sound
+  if (m_soundReady && m_sound) {
+    ma_sound_uninit(m_sound.get());
+  }
+}
 
 void AudioSource::play() {
   if (m_state == PlaybackState::Paused) {
@@ -100,7 +248,8 @@ void AudioSource::update(f64 deltaTime) {
     ma_sound_get_length_in_seconds(m_sound.get(), &lengthSeconds);
     m_position = cursorSeconds;
     m_duration = lengthSeconds;
-  } else {
+  } else if (!m_loading) {
+    // Sources still loading have not started yet
     m_position += static_cast<f32>(deltaTime);
   }
 
@@ -195,12 +344,17 @@ Result<void> AudioManager::initialize() {
   }
 
   auto engine = std::make_unique<ma_engine>();
+  if (!m_streamVfs) {
+    m_streamVfs = std::make_unique<AudioStreamVfs>(this);
+  }
   ma_engine_config config = ma_engine_config_init();
+  config.pResourceManagerVFS = m_streamVfs.get();
   if (ma_engine_init(&config, engine.get()) != MA_SUCCESS) {
     return Result<void>::error("Failed to initialize audio engine");
   }
   m_engine = MaEnginePtr(engine.release());
   m_engineInitialized = true;
+  m_loader = std::make_unique<core::WorkerPool>(LOADER_THREADS);
 
   m_initialized = true;
   return Result<void>::ok();
@@ -213,15 +367,17 @@ void AudioManager::shutdown() {
 
   stopAll(0.0f);
 
+  // Drop queued loads and wait for running ones before sources go away
+  m_loader.reset();
+
   {
     std::unique_lock<std::shared_mutex> lock(m_sourcesMutex);
-    for (auto &source : m_sources) {
-      if (source && source->m_soundReady && source->m_sound) {
-        ma_sound_uninit(source->m_sound.get());
-      }
-    }
     m_sources.clear();
   }
+  {
+    std::lock_guard<std::mutex> lock(m_poolMutex);
+    m_soundPool.clear();
+  }
 
   if (m_engineInitialized && m_engine) {
     m_engine.reset();
@@ -255,14 +411,29 @@ void AudioManager::update(f64 deltaTime) {
   // Update ducking
   updateDucking(deltaTime);
 
+  // Channel volumes take m_stateMutex, so read them before the sources lock
+  std::unordered_map<AudioChannel, f32> channelVolumes;
+  for (AudioChannel channel :
+       {AudioChannel::Music, AudioChannel::Sound, AudioChannel::Voice,
+        AudioChannel::Ambient, AudioChannel::UI}) {
+    channelVolumes[channel] = calculateEffectiveVolume(channel);
+  }
+
   // Update all sources (use unique_lock for potential modification)
+  std::vector<std::pair<AudioHandle, std::string>> failedLoads;
   {
     std::unique_lock<std::shared_mutex> lock(m_sourcesMutex);
+    for (auto &source : m_sources) {
+      if (source && source->m_failed) {
+        failedLoads.emplace_back(source->handle, source->trackId);
+      }
+    }
+
     for (auto &source : m_sources) {
       if (source && source->isPlaying()) {
         if (source->m_soundReady && source->m_sound) {
           const f32 effective =
-              source->m_volume * calculateEffectiveVolume(*source);
+              source->m_volume * channelVolumes[source->channel];
           ma_sound_set_volume(source->m_sound.get(), effective);
           ma_sound_set_pan(source->m_sound.get(), source->m_pan);
           ma_sound_set_pitch(source->m_sound.get(), source->m_pitch);
@@ -275,14 +446,19 @@ void AudioManager::update(f64 deltaTime) {
     // Remove stopped sources (but keep some pooled)
     m_sources.erase(std::remove_if(m_sources.begin(), m_sources.end(),
                                    [](const auto &s) {
-                                     return s &&
-                                            s->getState() ==
-                                                PlaybackState::Stopped &&
-                                            s->channel != AudioChannel::Music;
+                                     return s && (s->m_failed ||
+                                                  (s->getState() ==
+                                                       PlaybackState::Stopped &&
+                                                   s->channel !=
+                                                       AudioChannel::Music));
                                    }),
                     m_sources.end());
   }
 
+  for (const auto &[handle, trackId] : failedLoads) {
+    fireEvent(AudioEvent::Type::Error, handle, trackId);
+  }
+
   // Check voice playback status
   if (m_voicePlaying.load(std::memory_order_acquire)) {
     AudioHandle voiceHandle;
@@ -323,7 +499,7 @@ AudioHandle AudioManager::playSound(const std::string &id,
     }
   }
 
-  AudioHandle handle = createSource(id, config.channel);
+  AudioHandle handle = createSource(id, config.channel, config.startTime);
   auto *source = getSource(handle);
   if (!source) {
     return {};
@@ -335,16 +511,6 @@ AudioHandle AudioManager::playSound(const std::string &id,
   source->setLoop(config.loop);
   source->priority = config.priority;
 
-  if (config.startTime > 0.0f && source->m_soundReady && source->m_sound &&
-      m_engineInitialized && m_engine) {
-    ma_uint32 sampleRate = ma_engine_get_sample_rate(m_engine.get());
-    if (sampleRate > 0) {
-      ma_uint64 startFrames = static_cast<ma_uint64>(
-          config.startTime * static_cast<f32>(sampleRate));
-      ma_sound_seek_to_pcm_frame(source->m_sound.get(), startFrames);
-    }
-  }
-
   if (config.fadeInDuration > 0.0f) {
     source->fadeIn(config.fadeInDuration);
   } else {
@@ -394,15 +560,10 @@ AudioHandle AudioManager::playMusic(const std::string &id,
     return {};
   }
 
-  // Stop current music
-  {
-    std::lock_guard<std::mutex> lock(m_stateMutex);
-    if (m_currentMusicHandle.isValid()) {
-      stopMusic(0.0f);
-    }
-  }
+  // Stop current music (stopMusic() takes m_stateMutex itself)
+  stopMusic(0.0f);
 
-  AudioHandle handle = createSource(id, AudioChannel::Music);
+  AudioHandle handle = createSource(id, AudioChannel::Music, config.startTime);
   auto *source = getSource(handle);
   if (!source) {
     return {};
@@ -411,16 +572,6 @@ AudioHandle AudioManager::playMusic(const std::string &id,
   source->setVolume(config.volume);
   source->setLoop(config.loop);
 
-  if (config.startTime > 0.0f && source->m_soundReady && source->m_sound &&
-      m_engineInitialized && m_engine) {
-    ma_uint32 sampleRate = ma_engine_get_sample_rate(m_engine.get());
-    if (sampleRate > 0) {
-      ma_uint64 startFrames = static_cast<ma_uint64>(
-          config.startTime * static_cast<f32>(sampleRate));
-      ma_sound_seek_to_pcm_frame(source->m_sound.get(), startFrames);
-    }
-  }
-
   if (config.fadeInDuration > 0.0f) {
     source->fadeIn(config.fadeInDuration);
   } else {
@@ -444,14 +595,13 @@ AudioHandle AudioManager::crossfadeMusic(const std::string &id, f32 duration,
   }
 
   // Fade out current music
+  AudioHandle current;
   {
     std::lock_guard<std::mutex> lock(m_stateMutex);
-    if (m_currentMusicHandle.isValid()) {
-      auto *current = getSource(m_currentMusicHandle);
-      if (current) {
-        current->fadeOut(duration, true);
-      }
-    }
+    current = m_currentMusicHandle;
+  }
+  if (auto *source = getSource(current)) {
+    source->fadeOut(duration, true);
   }
 
   // Start new music with fade in
@@ -460,43 +610,62 @@ AudioHandle AudioManager::crossfadeMusic(const std::string &id, f32 duration,
   return playMusic(id, newConfig);
 }
 
+// The music and voice controls below copy their handle out of m_stateMutex
+// before touching sources: update() and the loader lock m_sourcesMutex
+// first, and fireEvent() takes m_stateMutex again.
+
 void AudioManager::stopMusic(f32 fadeDuration) {
-  std::lock_guard<std::mutex> lock(m_stateMutex);
-  if (!m_currentMusicHandle.isValid()) {
-    return;
+  AudioHandle handle;
+  std::string musicId;
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    if (!m_currentMusicHandle.isValid()) {
+      return;
+    }
+    handle = m_currentMusicHandle;
+    musicId = std::move(m_currentMusicId);
+    m_currentMusicHandle.invalidate();
+    m_currentMusicId.clear();
   }
 
-  auto *source = getSource(m_currentMusicHandle);
+  auto *source = getSource(handle);
   if (source) {
     if (fadeDuration > 0.0f) {
       source->fadeOut(fadeDuration, true);
     } else {
       source->stop();
-      fireEvent(AudioEvent::Type::Stopped, m_currentMusicHandle,
-                m_currentMusicId);
+      fireEvent(AudioEvent::Type::Stopped, handle, musicId);
     }
   }
-
-  m_currentMusicHandle.invalidate();
-  m_currentMusicId.clear();
 }
 
 void AudioManager::pauseMusic() {
-  std::lock_guard<std::mutex> lock(m_stateMutex);
-  auto *source = getSource(m_currentMusicHandle);
+  AudioHandle handle;
+  std::string musicId;
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    handle = m_currentMusicHandle;
+    musicId = m_currentMusicId;
+  }
+  auto *source = getSource(handle);
   if (source) {
     source->pause();
-    fireEvent(AudioEvent::Type::Paused, m_currentMusicHandle, m_currentMusicId);
+    fireEvent(AudioEvent::Type::Paused, handle, musicId);
   }
 }
 
 void AudioManager::resumeMusic() {
-  std::lock_guard<std::mutex> lock(m_stateMutex);
-  auto *source = getSource(m_currentMusicHandle);
+  AudioHandle handle;
+  std::string musicId;
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    handle = m_currentMusicHandle;
+    musicId = m_currentMusicId;
+  }
+  auto *source = getSource(handle);
   if (source) {
     source->play();
-    fireEvent(AudioEvent::Type::Resumed, m_currentMusicHandle,
-              m_currentMusicId);
+    fireEvent(AudioEvent::Type::Resumed, handle, musicId);
   }
 }
 
@@ -537,8 +706,12 @@ f32 AudioManager::getMusicPosition() const {
 }
 
 void AudioManager::seekMusic(f32 position) {
-  std::lock_guard<std::mutex> lock(m_stateMutex);
-  auto *source = getSource(m_currentMusicHandle);
+  AudioHandle handle;
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    handle = m_currentMusicHandle;
+  }
+  auto *source = getSource(handle);
   if (!source || !source->m_soundReady || !source->m_sound) {
     return;
   }
@@ -573,13 +746,8 @@ AudioHandle AudioManager::playVoice(const std::string &id,
     return {};
   }
 
-  // Stop current voice
-  {
-    std::lock_guard<std::mutex> lock(m_stateMutex);
-    if (m_currentVoiceHandle.isValid()) {
-      stopVoice(0.0f);
-    }
-  }
+  // Stop current voice (stopVoice() takes m_stateMutex itself)
+  stopVoice(0.0f);
 
   AudioHandle handle = createSource(id, AudioChannel::Voice);
   auto *source = getSource(handle);
@@ -609,12 +777,17 @@ AudioHandle AudioManager::playVoice(const std::string &id,
 }
 
 void AudioManager::stopVoice(f32 fadeDuration) {
-  std::lock_guard<std::mutex> lock(m_stateMutex);
-  if (!m_currentVoiceHandle.isValid()) {
-    return;
+  AudioHandle handle;
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    if (!m_currentVoiceHandle.isValid()) {
+      return;
+    }
+    handle = m_currentVoiceHandle;
+    m_currentVoiceHandle.invalidate();
   }
 
-  auto *source = getSource(m_currentVoiceHandle);
+  auto *source = getSource(handle);
   if (source) {
     if (fadeDuration > 0.0f) {
       source->fadeOut(fadeDuration, true);
@@ -625,7 +798,6 @@ void AudioManager::stopVoice(f32 fadeDuration) {
 
   m_voicePlaying.store(false, std::memory_order_release);
   m_targetDuckLevel.store(1.0f, std::memory_order_release);
-  m_currentVoiceHandle.invalidate();
 }
 
 bool AudioManager::isVoicePlaying() const {
@@ -777,6 +949,97 @@ void AudioManager::setDataProvider(DataProvider provider) {
   m_dataProvider = std::move(provider);
 }
 
+void AudioManager::setStreamProvider(StreamProvider provider) {
+  std::lock_guard<std::mutex> lock(m_stateMutex);
+  m_streamProvider = std::move(provider);
+}
+
+Result<std::unique_ptr<VFS::IFileHandle>>
+AudioManager::openStream(const std::string &trackId) {
+  using StreamResult = Result<std::unique_ptr<VFS::IFileHandle>>;
+
+  StreamProvider streamProvider;
+  DataProvider dataProvider;
+  {
+    std::lock_guard<std::mutex> lock(m_stateMutex);
+    streamProvider = m_streamProvider;
+    dataProvider = m_dataProvider;
+  }
+
+  if (streamProvider) {
+    auto stream = streamProvider(trackId);
+    if (stream.isOk() && stream.value()) {
+      return stream;
+    }
+  }
+
+  if (dataProvider) {
+    auto data = dataProvider(trackId);
+    if (data.isOk() && !data.value().empty()) {
+      return StreamResult::ok(std::make_unique<VFS::MemoryFileHandle>(
+          std::move(data).value()));
+    }
+  }
+
+  auto file = std::make_unique<VFS::DiskFileHandle>(trackId);
+  if (file->isValid()) {
+    return StreamResult::ok(std::move(file));
+  }
+  return StreamResult::error("Audio track not found: " + trackId);
+}
+
+Result<void> AudioManager::warmSound(const std::string &id) {
+  if (!m_engineInitialized || !m_engine || !m_loader) {
+    return Result<void>::error("Audio engine not initialized");
+  }
+  if (m_soundPoolSize.load(std::memory_order_relaxed) == 0) {
+    return Result<void>::error("Sound pool is disabled");
+  }
+
+  m_loader->submit([this, id] { loadPooledSound(id); }, WARM_PRIORITY);
+  return Result<void>::ok();
+}
+
+void AudioManager::setSoundPoolSize(size_t size) {
+  std::lock_guard<std::mutex> lock(m_poolMutex);
+  m_soundPoolSize.store(size, std::memory_order_relaxed);
+  while (m_soundPool.size() > size) {
+    evictPooledSoundLocked();
+  }
+}
+
+size_t AudioManager::getSoundPoolSize() const {
+  return m_soundPoolSize.load(std::memory_order_relaxed);
+}
+
+size_t AudioManager::getPooledSoundCount() const {
+  std::lock_guard<std::mutex> lock(m_poolMutex);
+  return m_soundPool.size();
+}
+
+AudioLatencyStats AudioManager::getLatencyStats(AudioChannel channel) const {
+  std::lock_guard<std::mutex> lock(m_statsMutex);
+  auto it = m_latencyStats.find(channel);
+  return it != m_latencyStats.end() ? it->second : AudioLatencyStats{};
+}
+
+void AudioManager::resetLatencyStats() {
+  std::lock_guard<std::mutex> lock(m_statsMutex);
+  m_latencyStats.clear();
+}
+
+f64 AudioManager::getAudioPeriodMs() const {
+  if (!m_engineInitialized || !m_engine) {
+    return 0.0;
+  }
+  const ma_device *device = ma_engine_get_device(m_engine.get());
+  if (!device || device->sampleRate == 0) {
+    return 0.0;
+  }
+  return 1000.0 * static_cast<f64>(device->playback.internalPeriodSizeInFrames) /
+         static_cast<f64>(device->sampleRate);
+}
+
 void AudioManager::setMaxSounds(size_t max) {
   m_maxSounds.store(max, std::memory_order_relaxed);
 }
@@ -796,10 +1059,11 @@ void AudioManager::setDuckingParams(f32 duckVolume, f32 fadeDuration) {
 }
 
 AudioHandle AudioManager::createSource(const std::string &trackId,
-                                       AudioChannel channel) {
-  if (!m_engineInitialized || !m_engine) {
+                                       AudioChannel channel, f32 startTime) {
+  if (!m_engineInitialized || !m_engine || !m_loader) {
     return {};
   }
+  const auto requestTime = std::chrono::steady_clock::now();
   auto source = std::make_unique<AudioSource>();
 
   AudioHandle handle;
@@ -810,82 +1074,214 @@ AudioHandle AudioManager::createSource(const std::string &trackId,
   source->trackId = trackId;
   source->channel = channel;
 
-  auto sound = std::make_unique<ma_sound>();
-  ma_uint32 flags = 0;
-  if (channel == AudioChannel::Music || channel == AudioChannel::Voice ||
-      channel == AudioChannel::Ambient) {
-    flags |= MA_SOUND_FLAG_STREAM;
+  u64 startFrame = 0;
+  if (startTime > 0.0f) {
+    startFrame = static_cast<u64>(
+        startTime * static_cast<f32>(ma_engine_get_sample_rate(m_engine.get())));
   }
 
+  // A pooled effect is copied on the spot; it shares already decoded
+  // samples, so there is nothing to wait for
+  bool pooled = false;
+  if (!isStreamedChannel(channel)) {
+    auto sound = std::make_unique<ma_sound>();
+    if (copyPooledSound(trackId, *sound)) {
+      if (startFrame > 0) {
+        ma_sound_seek_to_pcm_frame(sound.get(), startFrame);
+      }
+      source->m_sound = std::move(sound);
+      source->m_soundReady = true;
+      pooled = true;
+    }
+  }
+  source->m_loading = !pooled;
+
+  {
+    std::unique_lock<std::shared_mutex> lock(m_sourcesMutex);
+    m_sources.push_back(std::move(source));
+  }
+
+  const f64 callMs =
+      millisecondsSince(requestTime, std::chrono::steady_clock::now());
+  recordCall(channel, callMs, pooled);
+  if (pooled) {
+    recordLoad(channel, true, callMs);
+    return handle;
+  }
+
+  // Everything that touches the track (provider I/O, decoder set-up, the
+  // first stream pages) runs on the loader pool
+  m_loader->submit(
+      [this, handle, trackId, channel, startFrame, requestTime] {
+        loadSource(handle, trackId, channel, startFrame, requestTime);
+      },
+      loadPriority(channel));
+  return handle;
+}
+
+void AudioManager::loadSource(AudioHandle handle, const std::string &trackId,
+                              AudioChannel channel, u64 startFrame,
+                              std::chrono::steady_clock::time_point requestTime) {
+  auto sound = std::make_unique<ma_sound>();
   bool loaded = false;
-  DataProvider provider;
+  if (isStreamedChannel(channel)) {
+    // Streams keep only a couple of decoded pages in memory
+    ma_sound_config config = ma_sound_config_init_2(m_engine.get());
+    config.pFilePath = trackId.c_str();
+    config.flags = MA_SOUND_FLAG_STREAM;
+    config.initialSeekPointInPCMFrames = startFrame;
+    loaded = ma_sound_init_ex(m_engine.get(), &config, sound.get()) ==
+             MA_SUCCESS;
+  } else {
+    // The copy is taken under the pool lock, so a concurrent eviction cannot
+    // take the entry away in between; anything the pool cannot serve (pool
+    // disabled, copy failed) is decoded privately
+    loaded = loadPooledSound(trackId, sound.get());
+    if (!loaded) {
+      loaded = ma_sound_init_from_file(m_engine.get(), trackId.c_str(),
+                                       MA_SOUND_FLAG_DECODE, nullptr, nullptr,
+                                       sound.get()) == MA_SUCCESS;
+    }
+    if (loaded && startFrame > 0) {
+      ma_sound_seek_to_pcm_frame(sound.get(), startFrame);
+    }
+  }
+  const auto readyAt = std::chrono::steady_clock::now();
+  const f32 channelVolume = calculateEffectiveVolume(channel);
+
+  bool delivered = false;
   {
-    std::lock_guard<std::mutex> lock(m_stateMutex);
-    provider = m_dataProvider;
-  }
-  if (provider) {
-    auto dataResult = provider(trackId);
-    if (dataResult.isOk() && !dataResult.value().empty()) {
-      source->m_memoryData = std::move(dataResult.value());
-      auto decoder = std::make_unique<ma_decoder>();
-      ma_decoder_config config = ma_decoder_config_init(
-          ma_format_f32, ma_engine_get_channels(m_engine.get()),
-          ma_engine_get_sample_rate(m_engine.get()));
-      if (ma_decoder_init_memory(source->m_memoryData.data(),
-                                 source->m_memoryData.size(), &config,
-                                 decoder.get()) == MA_SUCCESS) {
-        // Transfer ownership to MaDecoderPtr only after successful init
-        source->m_decoder = MaDecoderPtr(decoder.release());
-        if (ma_sound_init_from_data_source(m_engine.get(), source->m_decoder.get(),
-                                           flags, nullptr,
-                                           sound.get()) == MA_SUCCESS) {
-          loaded = true;
-          source->m_decoderReady = true;
-        } else {
-          // Custom deleter will handle ma_decoder_uninit automatically
-          source->m_decoder.reset();
-          source->m_memoryData.clear();
-        }
+    std::unique_lock<std::shared_mutex> lock(m_sourcesMutex);
+    auto it = std::find_if(m_sources.begin(), m_sources.end(),
+                           [&handle](const auto &s) {
+                             return s && s->handle.id == handle.id;
+                           });
+    if (it != m_sources.end()) {
+      AudioSource &source = **it;
+      delivered = true;
+      if (!loaded) {
+        source.m_failed = true;
       } else {
-        // Decoder init failed, decoder will be cleaned up automatically
-        source->m_memoryData.clear();
+        ma_sound_set_volume(sound.get(), source.m_volume * channelVolume);
+        ma_sound_set_pan(sound.get(), source.m_pan);
+        ma_sound_set_pitch(sound.get(), source.m_pitch);
+        ma_sound_set_looping(sound.get(), source.m_loop);
+        source.m_sound = std::move(sound);
+        source.m_soundReady = true;
+        // Pairs with the state check in AudioSource::play(), so exactly one
+        // side sees the other and starts the sound
+        if (source.isPlaying()) {
+          ma_sound_start(source.m_sound.get());
+        }
       }
+      source.m_loading = false;
     }
   }
 
-  if (!loaded) {
-    if (ma_sound_init_from_file(m_engine.get(), trackId.c_str(), flags, nullptr,
-                                nullptr, sound.get()) != MA_SUCCESS) {
-      fireEvent(AudioEvent::Type::Error, handle, trackId);
-      return {};
-    }
+  if (loaded && !delivered) {
+    // The source was stopped and dropped while its track was loading
+    ma_sound_uninit(sound.get());
   }
-  source->m_sound = std::move(sound);
-  source->m_soundReady = true;
+  recordLoad(channel, loaded, millisecondsSince(requestTime, readyAt));
+}
 
-  float lengthSeconds = 0.0f;
-  ma_sound_get_length_in_seconds(source->m_sound.get(), &lengthSeconds);
-  source->m_duration = lengthSeconds;
+bool AudioManager::copyPooledSound(const std::string &trackId, ma_sound &sound) {
+  std::lock_guard<std::mutex> lock(m_poolMutex);
+  auto it = m_soundPool.find(trackId);
+  if (it == m_soundPool.end()) {
+    return false;
+  }
+  return copyPooledSoundLocked(*it->second, &sound);
+}
 
+bool AudioManager::copyPooledSoundLocked(PooledSound &entry, ma_sound *sound) {
+  entry.lastUse = ++m_poolClock;
+  if (sound == nullptr) {
+    return true;
+  }
+  return ma_sound_init_copy(m_engine.get(), &entry.sound, 0, nullptr, sound) ==
+         MA_SUCCESS;
+}
+
+bool AudioManager::loadPooledSound(const std::string &trackId, ma_sound *copyTo) {
+  const size_t capacity = m_soundPoolSize.load(std::memory_order_relaxed);
+  if (capacity == 0) {
+    return false;
+  }
   {
-    std::unique_lock<std::shared_mutex> lock(m_sourcesMutex);
-    m_sources.push_back(std::move(source));
+    std::lock_guard<std::mutex> lock(m_poolMutex);
+    auto it = m_soundPool.find(trackId);
+    if (it != m_soundPool.end()) {
+      return copyPooledSoundLocked(*it->second, copyTo);
+    }
   }
-  return handle;
+
+  // Decode outside the lock; concurrent loads of one track share a single
+  // resource manager buffer, and the loser's entry is simply dropped
+  auto entry = std::make_unique<PooledSound>();
+  if (ma_sound_init_from_file(m_engine.get(), trackId.c_str(),
+                              MA_SOUND_FLAG_DECODE, nullptr, nullptr,
+                              &entry->sound) != MA_SUCCESS) {
+    return false;
+  }
+  entry->initialized = true;
+
+  std::lock_guard<std::mutex> lock(m_poolMutex);
+  if (auto it = m_soundPool.find(trackId); it != m_soundPool.end()) {
+    return copyPooledSoundLocked(*it->second, copyTo);
+  }
+  while (!m_soundPool.empty() &&
+         m_soundPool.size() >= m_soundPoolSize.load(std::memory_order_relaxed)) {
+    evictPooledSoundLocked();
+  }
+  if (m_soundPoolSize.load(std::memory_order_relaxed) == 0) {
+    return false;
+  }
+  const bool copied = copyPooledSoundLocked(*entry, copyTo);
+  m_soundPool.emplace(trackId, std::move(entry));
+  return copied;
+}
+
+void AudioManager::evictPooledSoundLocked() {
+  auto oldest = std::min_element(m_soundPool.begin(), m_soundPool.end(),
+                                 [](const auto &a, const auto &b) {
+                                   return a.second->lastUse <
+                                          b.second->lastUse;
+                                 });
+  if (oldest != m_soundPool.end()) {
+    m_soundPool.erase(oldest);
+  }
+}
+
+void AudioManager::recordCall(AudioChannel channel, f64 callMs, bool pooled) {
+  std::lock_guard<std::mutex> lock(m_statsMutex);
+  auto &stats = m_latencyStats[channel];
+  ++stats.requests;
+  if (pooled) {
+    ++stats.pooledStarts;
+  }
+  stats.lastCallMs = callMs;
+  stats.maxCallMs = std::max(stats.maxCallMs, callMs);
+}
+
+void AudioManager::recordLoad(AudioChannel channel, bool loaded, f64 readyMs) {
+  std::lock_guard<std::mutex> lock(m_statsMutex);
+  auto &stats = m_latencyStats[channel];
+  if (!loaded) {
+    ++stats.failed;
+    return;
+  }
+  ++stats.ready;
+  stats.lastReadyMs = readyMs;
+  stats.maxReadyMs = std::max(stats.maxReadyMs, readyMs);
+  stats.totalReadyMs += readyMs;
 }
 
 void AudioManager::releaseSource(AudioHandle handle) {
   std::unique_lock<std::shared_mutex> lock(m_sourcesMutex);
   m_sources.erase(std::remove_if(m_sources.begin(), m_sources.end(),
                                  [&handle](const auto &s) {
-                                   if (!s || s->handle.id != handle.id) {
-                                     return false;
-                                   }
-                                   if (s->m_soundReady && s->m_sound) {
-                                     ma_sound_uninit(s->m_sound.get());
-                                   }
-                                   // Decoder cleanup handled by MaDecoderPtr custom deleter
-                                   return true;
+                                   return s && s->handle.id == handle.id;
                                  }),
                   m_sources.end());
 }
@@ -928,14 +1324,13 @@ void AudioManager::updateDucking(f64 deltaTime) {
   m_currentDuckLevel.store(newLevel, std::memory_order_release);
 }
 
-f32 AudioManager::calculateEffectiveVolume(const AudioSource &source) const {
-  if (m_allMuted.load(std::memory_order_acquire) ||
-      isChannelMuted(source.channel)) {
+f32 AudioManager::calculateEffectiveVolume(AudioChannel channel) const {
+  if (m_allMuted.load(std::memory_order_acquire) || isChannelMuted(channel)) {
     return 0.0f;
   }
 
   f32 volume = getChannelVolume(AudioChannel::Master);
-  volume *= getChannelVolume(source.channel);
+  volume *= getChannelVolume(channel);
 
   f32 masterFade;
   {
@@ -945,7 +1340,7 @@ f32 AudioManager::calculateEffectiveVolume(const AudioSource &source) const {
   volume *= masterFade;
 
   // Apply ducking to music
-  if (source.channel == AudioChannel::Music) {
+  if (channel == AudioChannel::Music) {
     volume *= m_currentDuckLevel.load(std::memory_order_acquire);
   }
 
@@ -1,5 +1,6 @@
 #include "NovelMind/core/application.hpp"
 #include "NovelMind/core/logger.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
 #include "NovelMind/vfs/cached_file_system.hpp"
 #include "NovelMind/vfs/memory_fs.hpp"
 #include "NovelMind/vfs/secure_pack_reader.hpp"
@@ -48,17 +49,20 @@ Result<void> Application::initialize(const EngineConfig &config) {
   }
 
   m_resources = std::make_unique<resource::ResourceManager>(m_vfs.get());
+  // Dialogue layout measures with the glyphs the renderer draws
+  m_renderer->setGlyphCache(m_resources->getGlyphCache());
   m_sceneGraph = std::make_unique<scene::SceneGraph>();
   m_sceneGraph->setResourceManager(m_resources.get());
 
   m_input = std::make_unique<input::InputManager>();
 
   m_audio = std::make_unique<audio::AudioManager>();
-  m_audio->setDataProvider([this](const std::string &id) {
+  m_audio->setStreamProvider([this](const std::string &id) {
     if (!m_resources) {
-      return Result<std::vector<u8>>::error("Resource manager unavailable");
+      return Result<std::unique_ptr<VFS::IFileHandle>>::error(
+          "Resource manager unavailable");
     }
-    return m_resources->readData(id);
+    return m_resources->openStream(id);
   });
   m_audio->initialize();
 
@@ -158,6 +162,45 @@ localization::LocalizationManager *Application::getLocalization() {
   return m_localization.get();
 }
 
+void Application::setScriptRuntime(scripting::ScriptRuntime *runtime) {
+  m_scriptRuntime = runtime;
+}
+
+void Application::saveGame(i32 slot, save::SaveData data) {
+  m_pendingSaves.emplace_back(slot, std::move(data));
+}
+
+void Application::writePendingSaves() {
+  if (m_pendingSaves.empty()) {
+    return;
+  }
+
+  // One readback serves every save queued this frame
+  auto frame = m_renderer ? m_renderer->readPixels()
+                          : Result<renderer::DecodedImage>::error("No renderer");
+  if (frame.isError()) {
+    NOVELMIND_LOG_WARN("Saving without a thumbnail: " + frame.error());
+  }
+
+  for (auto &[slot, data] : m_pendingSaves) {
+    if (frame.isOk()) {
+      const auto &image = frame.value();
+      save::setThumbnail(data, image.pixels.data(), image.width, image.height);
+    }
+    if (!m_saveManager) {
+      NOVELMIND_LOG_ERROR("Cannot save slot " + std::to_string(slot) +
+                          ": save manager unavailable");
+      continue;
+    }
+    auto result = m_saveManager->save(slot, data);
+    if (result.isError()) {
+      NOVELMIND_LOG_ERROR("Failed to save slot " + std::to_string(slot) + ": " +
+                          result.error());
+    }
+  }
+  m_pendingSaves.clear();
+}
+
 void Application::onInitialize() {
   // Override in derived class
 }
@@ -182,10 +225,16 @@ void Application::mainLoop() {
     m_window->pollEvents();
 
     onUpdate(deltaTime);
+    if (m_scriptRuntime) {
+      m_scriptRuntime->update(deltaTime);
+    }
     if (m_input) {
       m_input->update();
     }
 
+    if (m_resources) {
+      m_resources->processUploads();
+    }
     if (m_sceneGraph) {
       m_sceneGraph->update(deltaTime);
     }
@@ -201,6 +250,10 @@ void Application::mainLoop() {
     if (m_renderer && m_sceneGraph) {
       m_sceneGraph->render(*m_renderer);
     }
+    if (m_renderer && m_scriptRuntime) {
+      m_scriptRuntime->render(*m_renderer);
+    }
+    writePendingSaves();
 
     if (m_renderer) {
       m_renderer->endFrame();
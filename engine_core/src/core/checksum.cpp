@@ -0,0 +1,318 @@
+/**
+ * @file checksum.cpp
+ * @brief CRC-32 kernels and runtime dispatch
+ *
+ * Every kernel works on the inverted running state; crc32() inverts on the
+ * way in and out, which is what makes results chain like zlib's.
+ */
+
+#include "NovelMind/core/checksum.hpp"
+#include <array>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) ||            \
+    defined(_M_IX86)
+#define NOVELMIND_CRC32_X86 1
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <wmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define NOVELMIND_TARGET_PCLMUL
+#else
+#include <cpuid.h>
+#define NOVELMIND_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#endif
+#endif
+
+#if defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN) &&                     \
+    (defined(__GNUC__) || defined(__clang__))
+#define NOVELMIND_CRC32_ARM 1
+#include <arm_acle.h>
+#if defined(__ARM_FEATURE_CRC32)
+#define NOVELMIND_TARGET_CRC
+#elif defined(__clang__)
+#define NOVELMIND_TARGET_CRC __attribute__((target("crc")))
+#else
+#define NOVELMIND_TARGET_CRC __attribute__((target("arch=armv8-a+crc")))
+#endif
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace NovelMind::core {
+
+namespace {
+
+constexpr u32 CRC32_POLYNOMIAL = 0xEDB88320;
+
+/// Table k maps a byte to its CRC contribution followed by k zero bytes
+constexpr std::array<std::array<u32, 256>, 16> makeTables() {
+  std::array<std::array<u32, 256>, 16> tables{};
+  for (u32 i = 0; i < 256; ++i) {
+    u32 crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc >> 1) ^ ((crc & 1u) ? CRC32_POLYNOMIAL : 0u);
+    }
+    tables[0][i] = crc;
+  }
+  for (usize k = 1; k < 16; ++k) {
+    for (usize i = 0; i < 256; ++i) {
+      const u32 previous = tables[k - 1][i];
+      tables[k][i] = (previous >> 8) ^ tables[0][previous & 0xFF];
+    }
+  }
+  return tables;
+}
+
+constexpr auto TABLES = makeTables();
+
+inline u32 loadLE32(const u8 *p) {
+  u32 value;
+  std::memcpy(&value, p, sizeof(value));
+  if constexpr (std::endian::native == std::endian::big) {
+    value = (value >> 24) | ((value >> 8) & 0xFF00u) |
+            ((value << 8) & 0xFF0000u) | (value << 24);
+  }
+  return value;
+}
+
+u32 crcBytewise(u32 state, const u8 *p, usize n) {
+  for (usize i = 0; i < n; ++i) {
+    state = TABLES[0][(state ^ p[i]) & 0xFF] ^ (state >> 8);
+  }
+  return state;
+}
+
+u32 crcSlicing16(u32 state, const u8 *p, usize n) {
+  const auto &t = TABLES;
+  while (n >= 16) {
+    const u32 a = loadLE32(p) ^ state;
+    const u32 b = loadLE32(p + 4);
+    const u32 c = loadLE32(p + 8);
+    const u32 d = loadLE32(p + 12);
+    state = t[15][a & 0xFF] ^ t[14][(a >> 8) & 0xFF] ^
+            t[13][(a >> 16) & 0xFF] ^ t[12][a >> 24] ^ t[11][b & 0xFF] ^
+            t[10][(b >> 8) & 0xFF] ^ t[9][(b >> 16) & 0xFF] ^ t[8][b >> 24] ^
+            t[7][c & 0xFF] ^ t[6][(c >> 8) & 0xFF] ^ t[5][(c >> 16) & 0xFF] ^
+            t[4][c >> 24] ^ t[3][d & 0xFF] ^ t[2][(d >> 8) & 0xFF] ^
+            t[1][(d >> 16) & 0xFF] ^ t[0][d >> 24];
+    p += 16;
+    n -= 16;
+  }
+  return crcBytewise(state, p, n);
+}
+
+#ifdef NOVELMIND_CRC32_X86
+
+NOVELMIND_TARGET_PCLMUL inline __m128i load128(const u8 *p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+/// Fold @p acc forward by 128 bits and add @p next
+NOVELMIND_TARGET_PCLMUL inline __m128i fold128(__m128i acc, __m128i next,
+                                               __m128i k) {
+  const __m128i low = _mm_clmulepi64_si128(acc, k, 0x00);
+  const __m128i high = _mm_clmulepi64_si128(acc, k, 0x11);
+  return _mm_xor_si128(_mm_xor_si128(high, next), low);
+}
+
+/**
+ * Folds four 128-bit lanes over the input with carry-less multiplies, then
+ * reduces to 32 bits with a Barrett step ("Fast CRC Computation for Generic
+ * Polynomials Using PCLMULQDQ", Intel 2009). The constants are the
+ * bit-reflected x^n mod P(x) values for the IEEE polynomial.
+ */
+NOVELMIND_TARGET_PCLMUL u32 crcPclmul(u32 state, const u8 *p, usize n) {
+  if (n < 64) {
+    return crcSlicing16(state, p, n);
+  }
+
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+  const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124);
+  const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+
+  __m128i x1 = load128(p);
+  __m128i x2 = load128(p + 16);
+  __m128i x3 = load128(p + 32);
+  __m128i x4 = load128(p + 48);
+  x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(state)));
+  p += 64;
+  n -= 64;
+
+  // Fold 64 bytes at a time into the four lanes (by 512 bits each)
+  while (n >= 64) {
+    x1 = fold128(x1, load128(p), k1k2);
+    x2 = fold128(x2, load128(p + 16), k1k2);
+    x3 = fold128(x3, load128(p + 32), k1k2);
+    x4 = fold128(x4, load128(p + 48), k1k2);
+    p += 64;
+    n -= 64;
+  }
+
+  // Fold the lanes into one, then any remaining 16-byte blocks into it
+  x1 = fold128(x1, x2, k3k4);
+  x1 = fold128(x1, x3, k3k4);
+  x1 = fold128(x1, x4, k3k4);
+  while (n >= 16) {
+    x1 = fold128(x1, load128(p), k3k4);
+    p += 16;
+    n -= 16;
+  }
+
+  // 128 -> 64 bits
+  const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+  x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+  x2 = _mm_srli_si128(x1, 4);
+  x1 = _mm_and_si128(x1, mask32);
+  x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+
+  // Barrett reduction to 32 bits
+  x2 = _mm_and_si128(x1, mask32);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+  x2 = _mm_and_si128(x2, mask32);
+  x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2);
+  state = static_cast<u32>(_mm_extract_epi32(x1, 1));
+
+  return crcSlicing16(state, p, n);
+}
+
+bool cpuHasPclmul() {
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 1);
+  const auto ecx = static_cast<unsigned>(info[2]);
+#else
+  unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return false;
+  }
+#endif
+  constexpr unsigned PCLMULQDQ = 1u << 1;
+  constexpr unsigned SSE41 = 1u << 19;
+  return (ecx & PCLMULQDQ) != 0 && (ecx & SSE41) != 0;
+}
+
+#endif
+
+#ifdef NOVELMIND_CRC32_ARM
+
+NOVELMIND_TARGET_CRC u32 crcArm(u32 state, const u8 *p, usize n) {
+  while (n >= 8) {
+    u64 value;
+    std::memcpy(&value, p, sizeof(value));
+    state = __crc32d(state, value);
+    p += 8;
+    n -= 8;
+  }
+  for (usize i = 0; i < n; ++i) {
+    state = __crc32b(state, p[i]);
+  }
+  return state;
+}
+
+bool cpuHasArmCrc() {
+#if defined(__ARM_FEATURE_CRC32) || defined(__APPLE__)
+  return true;
+#elif defined(__linux__)
+  constexpr unsigned long HWCAP_CRC32_BIT = 1ul << 7;
+  return (getauxval(AT_HWCAP) & HWCAP_CRC32_BIT) != 0;
+#else
+  return false;
+#endif
+}
+
+#endif
+
+using KernelFn = u32 (*)(u32, const u8 *, usize);
+
+KernelFn kernelFunction(Crc32Kernel kernel) {
+  if (!isCrc32KernelSupported(kernel)) {
+    return crcSlicing16;
+  }
+  switch (kernel) {
+  case Crc32Kernel::Bytewise:
+    return crcBytewise;
+#ifdef NOVELMIND_CRC32_X86
+  case Crc32Kernel::Pclmul:
+    return crcPclmul;
+#endif
+#ifdef NOVELMIND_CRC32_ARM
+  case Crc32Kernel::ArmCrc:
+    return crcArm;
+#endif
+  default:
+    return crcSlicing16;
+  }
+}
+
+} // namespace
+
+bool isCrc32KernelSupported(Crc32Kernel kernel) {
+  switch (kernel) {
+  case Crc32Kernel::Bytewise:
+  case Crc32Kernel::Slicing16:
+    return true;
+  case Crc32Kernel::Pclmul: {
+#ifdef NOVELMIND_CRC32_X86
+    static const bool supported = cpuHasPclmul();
+    return supported;
+#else
+    return false;
+#endif
+  }
+  case Crc32Kernel::ArmCrc: {
+#ifdef NOVELMIND_CRC32_ARM
+    static const bool supported = cpuHasArmCrc();
+    return supported;
+#else
+    return false;
+#endif
+  }
+  }
+  return false;
+}
+
+Crc32Kernel activeCrc32Kernel() {
+  static const Crc32Kernel kernel = [] {
+    if (isCrc32KernelSupported(Crc32Kernel::Pclmul)) {
+      return Crc32Kernel::Pclmul;
+    }
+    if (isCrc32KernelSupported(Crc32Kernel::ArmCrc)) {
+      return Crc32Kernel::ArmCrc;
+    }
+    return Crc32Kernel::Slicing16;
+  }();
+  return kernel;
+}
+
+const char *crc32KernelName(Crc32Kernel kernel) {
+  switch (kernel) {
+  case Crc32Kernel::Bytewise:
+    return "bytewise";
+  case Crc32Kernel::Slicing16:
+    return "slicing-by-16";
+  case Crc32Kernel::Pclmul:
+    return "pclmulqdq";
+  case Crc32Kernel::ArmCrc:
+    return "armv8-crc";
+  }
+  return "unknown";
+}
+
+u32 crc32(const void *data, usize size, u32 crc) {
+  static const KernelFn kernel = kernelFunction(activeCrc32Kernel());
+  return ~kernel(~crc, static_cast<const u8 *>(data), size);
+}
+
+u32 crc32With(Crc32Kernel kernel, const void *data, usize size, u32 crc) {
+  return ~kernelFunction(kernel)(~crc, static_cast<const u8 *>(data), size);
+}
+
+} // namespace NovelMind::core
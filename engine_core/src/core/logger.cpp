@@ -1,5 +1,7 @@
 #include "NovelMind/core/logger.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -7,105 +9,290 @@
 
 namespace NovelMind::core {
 
+namespace {
+
+struct LogRecord {
+  LogLevel level = LogLevel::Info;
+  std::chrono::system_clock::time_point time;
+  std::string message;
+};
+
+// How long the writer sleeps when nobody wakes it
+constexpr auto WRITER_INTERVAL = std::chrono::milliseconds(20);
+
+} // namespace
+
+/**
+ * @brief Single-producer/single-consumer queue of one thread's records
+ *
+ * The owning thread pushes; whoever holds Logger::m_writeMutex pops.
+ */
+struct LogRing {
+  static constexpr size_t CAPACITY = 1024;
+
+  bool tryPush(LogRecord &record) {
+    const size_t head = m_head.load(std::memory_order_relaxed);
+    if (head - m_tail.load(std::memory_order_acquire) == CAPACITY) {
+      return false;
+    }
+    m_slots[head % CAPACITY] = std::move(record);
+    m_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  template <typename Sink> void drain(Sink &&sink) {
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    const size_t head = m_head.load(std::memory_order_acquire);
+    for (; tail != head; ++tail) {
+      sink(std::move(m_slots[tail % CAPACITY]));
+    }
+    m_tail.store(tail, std::memory_order_release);
+  }
+
+  [[nodiscard]] size_t size() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+  }
+
+  /// Set once the owning thread has exited
+  std::atomic<bool> orphaned{false};
+
+private:
+  std::array<LogRecord, CAPACITY> m_slots;
+  alignas(64) std::atomic<size_t> m_head{0};
+  alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+namespace {
+
+struct ThreadRing {
+  std::shared_ptr<LogRing> ring;
+
+  ~ThreadRing() {
+    if (ring) {
+      ring->orphaned.store(true, std::memory_order_release);
+    }
+  }
+};
+
+thread_local ThreadRing t_ring;
+
+} // namespace
+
 Logger &Logger::instance() {
   static Logger instance;
   return instance;
 }
 
-Logger::Logger() : m_level(LogLevel::Info), m_useColors(true) {}
-
-Logger::~Logger() { closeOutputFile(); }
-
-void Logger::setLevel(LogLevel level) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_level = level;
+Logger::Logger() : m_level(LogLevel::Info), m_useColors(true) {
+  m_running.store(true);
+  m_writer = std::thread([this]() { writerLoop(); });
 }
 
-LogLevel Logger::getLevel() const {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  return m_level;
+Logger::~Logger() {
+  {
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_running.store(false);
+  }
+  m_wakeCondition.notify_one();
+  if (m_writer.joinable()) {
+    m_writer.join();
+  }
+  flush();
+  closeOutputFile();
 }
 
+void Logger::setLevel(LogLevel level) { m_level.store(level, std::memory_order_relaxed); }
+
+LogLevel Logger::getLevel() const { return m_level.load(std::memory_order_relaxed); }
+
 void Logger::setOutputFile(const std::string &path) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  closeOutputFile();
+  // Messages queued before the switch still go to the old file
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  drainLocked();
+  if (m_fileStream.is_open()) {
+    m_fileStream.close();
+  }
   m_fileStream.open(path, std::ios::out | std::ios::app);
 }
 
 void Logger::closeOutputFile() {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  drainLocked();
   if (m_fileStream.is_open()) {
     m_fileStream.close();
   }
 }
 
+void Logger::setConsoleOutput(bool enabled) {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  drainLocked();
+  m_consoleOutput = enabled;
+}
+
 void Logger::addLogCallback(LogCallback callback) {
-  std::lock_guard<std::mutex> lock(m_mutex);
+  std::lock_guard<std::mutex> lock(m_writeMutex);
   m_callbacks.push_back(std::move(callback));
 }
 
 void Logger::clearLogCallbacks() {
-  std::lock_guard<std::mutex> lock(m_mutex);
+  std::lock_guard<std::mutex> lock(m_writeMutex);
   m_callbacks.clear();
 }
 
 void Logger::log(LogLevel level, std::string_view message) {
-  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!isEnabled(level)) {
+    return;
+  }
+
+  LogRecord record{level, std::chrono::system_clock::now(), std::string(message)};
+  LogRing *ring = threadRing();
+  while (!ring->tryPush(record)) {
+    // Full ring: let the writer catch up, or drain it ourselves once the
+    // writer is gone
+    if (m_running.load()) {
+      wakeWriter();
+      std::this_thread::yield();
+    } else {
+      flush();
+    }
+  }
+
+  if (level >= LogLevel::Fatal) {
+    flush();
+  } else if (level >= LogLevel::Error || ring->size() >= LogRing::CAPACITY / 2) {
+    wakeWriter();
+  }
+}
+
+void Logger::flush() {
+  std::lock_guard<std::mutex> lock(m_writeMutex);
+  drainLocked();
+}
+
+LogRing *Logger::threadRing() {
+  if (!t_ring.ring) {
+    auto ring = std::make_shared<LogRing>();
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    m_rings.push_back(ring);
+    t_ring.ring = std::move(ring);
+  }
+  return t_ring.ring.get();
+}
+
+void Logger::wakeWriter() {
+  // No lock on the hot path; a missed wakeup costs at most WRITER_INTERVAL
+  if (!m_wakeRequested.exchange(true)) {
+    m_wakeCondition.notify_one();
+  }
+}
 
-  // Thread safety: read m_level inside lock
-  if (level < m_level || m_level == LogLevel::Off) {
+void Logger::writerLoop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_wakeMutex);
+      m_wakeCondition.wait_for(lock, WRITER_INTERVAL, [this]() {
+        return m_wakeRequested.load() || !m_running.load();
+      });
+      m_wakeRequested.store(false);
+    }
+    if (!m_running.load()) {
+      return;
+    }
+    flush();
+  }
+}
+
+void Logger::drainLocked() {
+  std::vector<LogRecord> batch;
+  {
+    std::lock_guard<std::mutex> lock(m_ringsMutex);
+    for (auto it = m_rings.begin(); it != m_rings.end();) {
+      // Check before draining so a record pushed right before the owner
+      // exited is not lost
+      const bool orphaned = (*it)->orphaned.load(std::memory_order_acquire);
+      (*it)->drain([&batch](LogRecord &&record) { batch.push_back(std::move(record)); });
+      it = orphaned ? m_rings.erase(it) : it + 1;
+    }
+  }
+  if (batch.empty()) {
     return;
   }
 
-  std::string timestamp = getCurrentTimestamp();
-  const char *levelStr = levelToString(level);
+  // Each ring is already in order; interleave threads by time
+  std::stable_sort(batch.begin(), batch.end(), [](const LogRecord &a, const LogRecord &b) {
+    return a.time < b.time;
+  });
 
-  std::ostringstream oss;
-  oss << "[" << timestamp << "] [" << levelStr << "] " << message;
-  std::string logLine = oss.str();
+  std::string fileText;
+  std::string outText;
+  std::string errText;
+  for (const auto &record : batch) {
+    std::string line = "[" + formatTimestamp(record.time) + "] [" + levelToString(record.level) +
+                       "] " + record.message + "\n";
 
-  if (m_fileStream.is_open()) {
-    m_fileStream << logLine << std::endl;
-  }
-
-  std::ostream &out = (level >= LogLevel::Warning) ? std::cerr : std::cout;
-
-  if (m_useColors) {
-    const char *colorCode = "";
-    const char *resetCode = "\033[0m";
-
-    switch (level) {
-    case LogLevel::Trace:
-      colorCode = "\033[90m";
-      break;
-    case LogLevel::Debug:
-      colorCode = "\033[36m";
-      break;
-    case LogLevel::Info:
-      colorCode = "\033[32m";
-      break;
-    case LogLevel::Warning:
-      colorCode = "\033[33m";
-      break;
-    case LogLevel::Error:
-      colorCode = "\033[31m";
-      break;
-    case LogLevel::Fatal:
-      colorCode = "\033[35m";
-      break;
-    default:
-      break;
+    if (m_fileStream.is_open()) {
+      fileText += line;
     }
 
-    out << colorCode << logLine << resetCode << std::endl;
-  } else {
-    out << logLine << std::endl;
+    if (!m_consoleOutput) {
+      continue;
+    }
+
+    std::string &out = (record.level >= LogLevel::Warning) ? errText : outText;
+    if (m_useColors) {
+      const char *colorCode = "";
+      const char *resetCode = "\033[0m";
+
+      switch (record.level) {
+      case LogLevel::Trace:
+        colorCode = "\033[90m";
+        break;
+      case LogLevel::Debug:
+        colorCode = "\033[36m";
+        break;
+      case LogLevel::Info:
+        colorCode = "\033[32m";
+        break;
+      case LogLevel::Warning:
+        colorCode = "\033[33m";
+        break;
+      case LogLevel::Error:
+        colorCode = "\033[31m";
+        break;
+      case LogLevel::Fatal:
+        colorCode = "\033[35m";
+        break;
+      default:
+        break;
+      }
+
+      line.pop_back();
+      out += colorCode;
+      out += line;
+      out += resetCode;
+      out += '\n';
+    } else {
+      out += line;
+    }
+  }
+
+  if (!fileText.empty()) {
+    m_fileStream << fileText;
+    m_fileStream.flush();
+  }
+  if (!outText.empty()) {
+    std::cout << outText << std::flush;
+  }
+  if (!errText.empty()) {
+    std::cerr << errText << std::flush;
   }
 
   // Call registered callbacks (e.g., for GUI console)
-  std::string messageStr(message);
-  for (const auto &callback : m_callbacks) {
-    if (callback) {
-      callback(level, messageStr);
+  for (const auto &record : batch) {
+    for (const auto &callback : m_callbacks) {
+      if (callback) {
+        callback(record.level, record.message);
+      }
     }
   }
 }
@@ -143,25 +330,30 @@ const char *Logger::levelToString(LogLevel level) const {
   }
 }
 
-std::string Logger::getCurrentTimestamp() const {
-  auto now = std::chrono::system_clock::now();
+std::string Logger::formatTimestamp(std::chrono::system_clock::time_point now) {
   auto time = std::chrono::system_clock::to_time_t(now);
-  auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
-                now.time_since_epoch()) %
-            1000;
+  auto ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
 
-  // Thread safety: use localtime_r (POSIX) or localtime_s (Windows)
-  std::tm timeinfo{};
+  // Batches usually share a second, so only the milliseconds change
+  if (time != m_cachedSecond || m_cachedTimestamp.empty()) {
+    // Thread safety: use localtime_r (POSIX) or localtime_s (Windows)
+    std::tm timeinfo{};
 #if defined(_WIN32) || defined(_WIN64)
-  localtime_s(&timeinfo, &time);
+    localtime_s(&timeinfo, &time);
 #else
-  localtime_r(&time, &timeinfo);
+    localtime_r(&time, &timeinfo);
 #endif
 
-  std::ostringstream oss;
-  oss << std::put_time(&timeinfo, "%Y-%m-%d %H:%M:%S");
-  oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-  return oss.str();
+    std::ostringstream oss;
+    oss << std::put_time(&timeinfo, "%Y-%m-%d %H:%M:%S");
+    m_cachedSecond = time;
+    m_cachedTimestamp = oss.str();
+  }
+
+  char millis[8];
+  std::snprintf(millis, sizeof(millis), ".%03d", static_cast<int>(ms.count()));
+  return m_cachedTimestamp + millis;
 }
 
 } // namespace NovelMind::core
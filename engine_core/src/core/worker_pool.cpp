@@ -0,0 +1,119 @@
+#include "NovelMind/core/worker_pool.hpp"
+#include "NovelMind/core/logger.hpp"
+#include <algorithm>
+#include <exception>
+
+namespace NovelMind::core {
+
+WorkerPool::WorkerPool(usize threadCount) {
+  if (threadCount == 0) {
+    const usize hardware = std::thread::hardware_concurrency();
+    // Leave one core for the main thread
+    threadCount = std::clamp<usize>(hardware > 1 ? hardware - 1 : 1, 1, 4);
+  }
+
+  m_threads.reserve(threadCount);
+  for (usize i = 0; i < threadCount; ++i) {
+    m_threads.emplace_back([this] { workerLoop(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+    m_queue.clear();
+    m_queuedPriorities.clear();
+  }
+  m_wakeWorkers.notify_all();
+  for (auto &thread : m_threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+WorkerPool::JobId WorkerPool::submit(Job job, i32 priority) {
+  JobId id;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    id = m_nextId++;
+    m_queue.emplace(QueueKey{priority, id}, std::move(job));
+    m_queuedPriorities.emplace(id, priority);
+  }
+  m_wakeWorkers.notify_one();
+  return id;
+}
+
+bool WorkerPool::cancel(JobId id) {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  auto it = m_queuedPriorities.find(id);
+  if (it == m_queuedPriorities.end()) {
+    return false;
+  }
+  m_queue.erase(QueueKey{it->second, id});
+  m_queuedPriorities.erase(it);
+  if (m_queue.empty() && m_running == 0) {
+    lock.unlock();
+    m_idle.notify_all();
+  }
+  return true;
+}
+
+bool WorkerPool::setPriority(JobId id, i32 priority) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_queuedPriorities.find(id);
+  if (it == m_queuedPriorities.end()) {
+    return false;
+  }
+  if (it->second != priority) {
+    auto node = m_queue.extract(QueueKey{it->second, id});
+    node.key().priority = priority;
+    m_queue.insert(std::move(node));
+    it->second = priority;
+  }
+  return true;
+}
+
+void WorkerPool::waitIdle() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_idle.wait(lock, [this] { return m_queue.empty() && m_running == 0; });
+}
+
+usize WorkerPool::getQueuedCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queue.size();
+}
+
+void WorkerPool::workerLoop() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true) {
+    m_wakeWorkers.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+    if (m_stopping) {
+      return;
+    }
+
+    auto node = m_queue.extract(m_queue.begin());
+    m_queuedPriorities.erase(node.key().id);
+    ++m_running;
+    lock.unlock();
+
+    try {
+      node.mapped()();
+    } catch (const std::exception &e) {
+      NOVELMIND_LOG_ERROR(std::string("Worker job threw: ") + e.what());
+    } catch (...) {
+      NOVELMIND_LOG_ERROR("Worker job threw an unknown exception");
+    }
+    // Release captured state before re-taking the lock
+    node.mapped() = nullptr;
+
+    lock.lock();
+    --m_running;
+    if (m_queue.empty() && m_running == 0) {
+      m_idle.notify_all();
+    }
+  }
+}
+
+} // namespace NovelMind::core
@@ -4,43 +4,27 @@
  */
 
 #include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/localization/localization_reader.hpp"
+#include "NovelMind/localization/string_bundle.hpp"
+#include "NovelMind/platform/mapped_file.hpp"
 #include <algorithm>
-#include <filesystem>
 #include <fstream>
 #include <regex>
-#include <sstream>
 
 namespace NovelMind::localization {
 
-namespace fs = std::filesystem;
-namespace {
-
-bool readFileToString(std::ifstream &file, std::string &out) {
-  file.seekg(0, std::ios::end);
-  const std::streampos size = file.tellg();
-  if (size < 0) {
-    return false;
-  }
-
-  out.resize(static_cast<size_t>(size));
-  file.seekg(0, std::ios::beg);
-  file.read(out.data(), static_cast<std::streamsize>(out.size()));
-  return static_cast<bool>(file);
-}
-
-} // namespace
-
 // =========================================================================
 // StringTable Implementation
 // =========================================================================
 
 StringTable::StringTable(const LocaleId &locale) : m_locale(locale) {}
 
-void StringTable::addString(const std::string &id, const std::string &value) {
+void StringTable::addString(std::string id, std::string value) {
   LocalizedString str;
   str.id = id;
-  str.forms[PluralCategory::Other] = value;
-  m_strings[id] = std::move(str);
+  str.forms[PluralCategory::Other] = std::move(value);
+  m_strings.insert_or_assign(std::move(id), std::move(str));
+  ++m_version;
 }
 
 void StringTable::addPluralString(
@@ -50,28 +34,44 @@ void StringTable::addPluralString(
   str.id = id;
   str.forms = forms;
   m_strings[id] = std::move(str);
+  ++m_version;
 }
 
 std::optional<std::string> StringTable::getString(const std::string &id) const {
+  if (const std::string *str = findString(id)) {
+    return *str;
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> StringTable::getPluralString(const std::string &id,
+                                                        i64 count) const {
+  if (const std::string *str = findPluralString(id, count)) {
+    return *str;
+  }
+  return std::nullopt;
+}
+
+const std::string *StringTable::findString(std::string_view id) const {
   auto it = m_strings.find(id);
   if (it != m_strings.end()) {
     auto formIt = it->second.forms.find(PluralCategory::Other);
     if (formIt != it->second.forms.end()) {
-      return formIt->second;
+      return &formIt->second;
     }
     // Return first available form
     if (!it->second.forms.empty()) {
-      return it->second.forms.begin()->second;
+      return &it->second.forms.begin()->second;
     }
   }
-  return std::nullopt;
+  return nullptr;
 }
 
-std::optional<std::string> StringTable::getPluralString(const std::string &id,
-                                                        i64 count) const {
+const std::string *StringTable::findPluralString(std::string_view id,
+                                                 i64 count) const {
   auto it = m_strings.find(id);
   if (it == m_strings.end())
-    return std::nullopt;
+    return nullptr;
 
   // Determine plural category (English rules as default)
   PluralCategory category;
@@ -85,16 +85,16 @@ std::optional<std::string> StringTable::getPluralString(const std::string &id,
   // Try exact category first
   auto formIt = it->second.forms.find(category);
   if (formIt != it->second.forms.end()) {
-    return formIt->second;
+    return &formIt->second;
   }
 
   // Fall back to Other
   formIt = it->second.forms.find(PluralCategory::Other);
   if (formIt != it->second.forms.end()) {
-    return formIt->second;
+    return &formIt->second;
   }
 
-  return std::nullopt;
+  return nullptr;
 }
 
 bool StringTable::hasString(const std::string &id) const {
@@ -110,9 +110,15 @@ std::vector<std::string> StringTable::getStringIds() const {
   return ids;
 }
 
-void StringTable::clear() { m_strings.clear(); }
+void StringTable::clear() {
+  m_strings.clear();
+  ++m_version;
+}
 
-void StringTable::removeString(const std::string &id) { m_strings.erase(id); }
+void StringTable::removeString(const std::string &id) {
+  m_strings.erase(id);
+  ++m_version;
+}
 
 // =========================================================================
 // LocalizationManager Implementation
@@ -122,6 +128,7 @@ LocalizationManager::LocalizationManager() {
   // Set default English locale
   m_defaultLocale.language = "en";
   m_currentLocale = m_defaultLocale;
+  refreshActiveStrings();
 }
 
 LocalizationManager::~LocalizationManager() = default;
@@ -132,11 +139,13 @@ LocalizationManager::~LocalizationManager() = default;
 
 void LocalizationManager::setDefaultLocale(const LocaleId &locale) {
   m_defaultLocale = locale;
+  refreshActiveStrings();
 }
 
 void LocalizationManager::setCurrentLocale(const LocaleId &locale) {
   if (m_currentLocale.toString() != locale.toString()) {
     m_currentLocale = locale;
+    refreshActiveStrings();
     if (m_onLanguageChanged) {
       m_onLanguageChanged(locale);
     }
@@ -145,15 +154,21 @@ void LocalizationManager::setCurrentLocale(const LocaleId &locale) {
 
 std::vector<LocaleId> LocalizationManager::getAvailableLocales() const {
   std::vector<LocaleId> locales;
-  locales.reserve(m_stringTables.size());
+  locales.reserve(m_stringTables.size() + m_bundles.size());
   for (const auto &[locale, table] : m_stringTables) {
     locales.push_back(locale);
   }
+  for (const auto &[locale, bundle] : m_bundles) {
+    if (m_stringTables.find(locale) == m_stringTables.end()) {
+      locales.push_back(locale);
+    }
+  }
   return locales;
 }
 
 bool LocalizationManager::isLocaleAvailable(const LocaleId &locale) const {
-  return m_stringTables.find(locale) != m_stringTables.end();
+  return m_stringTables.find(locale) != m_stringTables.end() ||
+         m_bundles.find(locale) != m_bundles.end();
 }
 
 void LocalizationManager::registerLocale(const LocaleId &locale,
@@ -194,22 +209,20 @@ bool LocalizationManager::isCurrentLocaleRightToLeft() const {
 Result<void> LocalizationManager::loadStrings(const LocaleId &locale,
                                               const std::string &filePath,
                                               LocalizationFormat format) {
-  std::ifstream file(filePath);
-  if (!file.is_open()) {
+  auto mapped = platform::MappedFile::open(filePath);
+  if (mapped.isError()) {
     return Result<void>::error("Failed to open localization file: " + filePath);
   }
 
-  std::string content;
-  if (!readFileToString(file, content)) {
-    return Result<void>::error("Failed to read localization file: " + filePath);
-  }
-
+  const auto &file = mapped.value();
+  const std::string_view content(reinterpret_cast<const char *>(file.data()),
+                                 file.size());
   return loadStringsFromMemory(locale, content, format);
 }
 
 Result<void>
 LocalizationManager::loadStringsFromMemory(const LocaleId &locale,
-                                           const std::string &data,
+                                           std::string_view data,
                                            LocalizationFormat format) {
   switch (format) {
   case LocalizationFormat::CSV:
@@ -232,36 +245,64 @@ Result<void> LocalizationManager::mergeStrings(const LocaleId &locale,
   return loadStrings(locale, filePath, format);
 }
 
+Result<void> LocalizationManager::loadBundle(const LocaleId &locale,
+                                             const std::string &filePath) {
+  auto bundle = StringBundle::open(filePath);
+  if (bundle.isError()) {
+    return Result<void>::error(bundle.error());
+  }
+  m_bundles[locale] = std::make_unique<StringBundle>(std::move(bundle).value());
+  refreshActiveStrings();
+  return {};
+}
+
+Result<void> LocalizationManager::loadBundleFromMemory(const LocaleId &locale,
+                                                       std::vector<u8> data) {
+  auto bundle = StringBundle::fromMemory(std::move(data));
+  if (bundle.isError()) {
+    return Result<void>::error(bundle.error());
+  }
+  m_bundles[locale] = std::make_unique<StringBundle>(std::move(bundle).value());
+  refreshActiveStrings();
+  return {};
+}
+
+const StringBundle *
+LocalizationManager::getBundle(const LocaleId &locale) const {
+  auto it = m_bundles.find(locale);
+  return it != m_bundles.end() ? it->second.get() : nullptr;
+}
+
 void LocalizationManager::unloadLocale(const LocaleId &locale) {
   m_stringTables.erase(locale);
+  m_bundles.erase(locale);
+  refreshActiveStrings();
 }
 
-void LocalizationManager::clearAll() { m_stringTables.clear(); }
+void LocalizationManager::clearAll() {
+  m_stringTables.clear();
+  m_bundles.clear();
+  refreshActiveStrings();
+}
 
 // =========================================================================
 // String Retrieval
 // =========================================================================
 
 std::string LocalizationManager::get(const std::string &id) const {
+  return std::string(getView(id));
+}
+
+std::string_view LocalizationManager::getView(std::string_view id) const {
   // Try current locale first
-  auto it = m_stringTables.find(m_currentLocale);
-  if (it != m_stringTables.end()) {
-    auto str = it->second.getString(id);
-    if (str) {
-      return *str;
-    }
+  if (auto str = findIn(m_current, id)) {
+    return *str;
   }
 
   // Fall back to default locale
-  if (m_currentLocale.toString() != m_defaultLocale.toString()) {
-    it = m_stringTables.find(m_defaultLocale);
-    if (it != m_stringTables.end()) {
-      auto str = it->second.getString(id);
-      if (str) {
-        fireMissingString(id, m_currentLocale);
-        return *str;
-      }
-    }
+  if (auto str = findIn(m_fallback, id)) {
+    fireMissingString(id, m_currentLocale);
+    return *str;
   }
 
   // Return the ID as fallback
@@ -272,31 +313,27 @@ std::string LocalizationManager::get(const std::string &id) const {
 std::string LocalizationManager::get(
     const std::string &id,
     const std::unordered_map<std::string, std::string> &variables) const {
-  std::string text = get(id);
-  return interpolate(text, variables);
+  std::string result;
+  format(result, id, variables);
+  return result;
 }
 
 std::string LocalizationManager::getPlural(const std::string &id,
                                            i64 count) const {
+  return std::string(getPluralView(id, count));
+}
+
+std::string_view LocalizationManager::getPluralView(std::string_view id,
+                                                    i64 count) const {
   // Try current locale first
-  auto it = m_stringTables.find(m_currentLocale);
-  if (it != m_stringTables.end()) {
-    auto str = it->second.getPluralString(id, count);
-    if (str) {
-      return *str;
-    }
+  if (auto str = findPluralIn(m_current, m_currentLocale, id, count)) {
+    return *str;
   }
 
   // Fall back to default locale
-  if (m_currentLocale.toString() != m_defaultLocale.toString()) {
-    it = m_stringTables.find(m_defaultLocale);
-    if (it != m_stringTables.end()) {
-      auto str = it->second.getPluralString(id, count);
-      if (str) {
-        fireMissingString(id, m_currentLocale);
-        return *str;
-      }
-    }
+  if (auto str = findPluralIn(m_fallback, m_defaultLocale, id, count)) {
+    fireMissingString(id, m_currentLocale);
+    return *str;
   }
 
   fireMissingString(id, m_currentLocale);
@@ -306,18 +343,38 @@ std::string LocalizationManager::getPlural(const std::string &id,
 std::string LocalizationManager::getPlural(
     const std::string &id, i64 count,
     const std::unordered_map<std::string, std::string> &variables) const {
-  std::string text = getPlural(id, count);
-  return interpolate(text, variables);
+  std::string result;
+  formatPlural(result, id, count, variables);
+  return result;
+}
+
+void LocalizationManager::format(
+    std::string &out, std::string_view id,
+    const std::unordered_map<std::string, std::string> &variables) const {
+  const std::string_view text = getView(id);
+  if (text.data() == id.data()) {
+    // Missing strings are shown as their ID, which is not a template
+    StringTemplate::formatTo(out, text, variables);
+    return;
+  }
+  templateFor(id, text)->formatTo(out, variables);
+}
+
+void LocalizationManager::formatPlural(
+    std::string &out, std::string_view id, i64 count,
+    const std::unordered_map<std::string, std::string> &variables) const {
+  const std::string_view text = getPluralView(id, count);
+  if (text.data() == id.data()) {
+    StringTemplate::formatTo(out, text, variables);
+    return;
+  }
+  templateFor(id, text)->formatTo(out, variables);
 }
 
 std::string LocalizationManager::getForLocale(const LocaleId &locale,
                                               const std::string &id) const {
-  auto it = m_stringTables.find(locale);
-  if (it != m_stringTables.end()) {
-    auto str = it->second.getString(id);
-    if (str) {
-      return *str;
-    }
+  if (auto str = findIn(stringsFor(locale), id)) {
+    return std::string(*str);
   }
   return id;
 }
@@ -328,11 +385,9 @@ bool LocalizationManager::hasString(const std::string &id) const {
 
 bool LocalizationManager::hasString(const LocaleId &locale,
                                     const std::string &id) const {
-  auto it = m_stringTables.find(locale);
-  if (it != m_stringTables.end()) {
-    return it->second.hasString(id);
-  }
-  return false;
+  const LocaleStrings strings = stringsFor(locale);
+  return (strings.table && strings.table->hasString(id)) ||
+         (strings.bundle && strings.bundle->contains(id));
 }
 
 // =========================================================================
@@ -379,20 +434,28 @@ Result<void>
 LocalizationManager::exportStrings(const LocaleId &locale,
                                    const std::string &filePath,
                                    LocalizationFormat format) const {
-  auto it = m_stringTables.find(locale);
-  if (it == m_stringTables.end()) {
+  // Bundle-only locales are expanded into a temporary table
+  std::optional<StringTable> expanded;
+  const StringTable *table = getStringTable(locale);
+  if (!table) {
+    if (const StringBundle *bundle = getBundle(locale)) {
+      expanded = bundle->toStringTable();
+      table = &*expanded;
+    }
+  }
+  if (!table) {
     return Result<void>::error("Locale not found: " + locale.toString());
   }
 
   switch (format) {
   case LocalizationFormat::CSV:
-    return exportCSV(it->second, filePath);
+    return exportCSV(*table, filePath);
   case LocalizationFormat::JSON:
-    return exportJSON(it->second, filePath);
+    return exportJSON(*table, filePath);
   case LocalizationFormat::PO:
-    return exportPO(it->second, filePath);
+    return exportPO(*table, filePath);
   case LocalizationFormat::XLIFF:
-    return exportXLIFF(it->second, filePath);
+    return exportXLIFF(*table, filePath);
   default:
     return Result<void>::error("Unsupported export format");
   }
@@ -499,19 +562,69 @@ PluralCategory LocalizationManager::getPluralCategory(const LocaleId &locale,
 std::string LocalizationManager::interpolate(
     const std::string &text,
     const std::unordered_map<std::string, std::string> &variables) const {
-  std::string result = text;
-
-  // Replace {variable} patterns
-  for (const auto &[name, value] : variables) {
-    std::string pattern = "{" + name + "}";
-    size_t pos = 0;
-    while ((pos = result.find(pattern, pos)) != std::string::npos) {
-      result.replace(pos, pattern.length(), value);
-      pos += value.length();
+  std::string result;
+  result.reserve(text.size());
+  StringTemplate::formatTo(result, text, variables);
+  return result;
+}
+
+usize LocalizationManager::getTemplateCacheSize() const {
+  std::lock_guard<std::mutex> lock(m_templateMutex);
+  usize count = 0;
+  for (const auto &[id, templates] : m_templates) {
+    count += templates.size();
+  }
+  return count;
+}
+
+std::shared_ptr<const StringTemplate>
+LocalizationManager::templateFor(std::string_view id,
+                                 std::string_view text) const {
+  const u64 version = stringsVersion();
+  std::lock_guard<std::mutex> lock(m_templateMutex);
+
+  auto it = m_templates.find(id);
+  if (it == m_templates.end()) {
+    it = m_templates.emplace(std::string(id), std::vector<CachedTemplate>())
+             .first;
+  }
+
+  auto &templates = it->second;
+  for (auto &cached : templates) {
+    if (cached.version == version) {
+      if (cached.text == text.data() &&
+          cached.parsed->getSource().size() == text.size()) {
+        return cached.parsed;
+      }
+    } else if (cached.parsed->getSource() == text) {
+      // Some string changed since; this one did not, so keep the parse
+      cached.text = text.data();
+      cached.version = version;
+      return cached.parsed;
     }
   }
 
-  return result;
+  // One template per plural category at most; more means the text changed
+  constexpr usize MAX_FORMS = 6;
+  if (templates.size() >= MAX_FORMS) {
+    templates.clear();
+  }
+  templates.push_back(
+      {std::make_shared<const StringTemplate>(text), text.data(), version});
+  return templates.back().parsed;
+}
+
+u64 LocalizationManager::stringsVersion() const {
+  // Each term only grows, and refreshActiveStrings() drops the cache when
+  // the set of tables changes, so the sum never repeats a stale value
+  u64 version = m_generation;
+  if (m_current.table) {
+    version += m_current.table->getVersion();
+  }
+  if (m_fallback.table) {
+    version += m_fallback.table->getVersion();
+  }
+  return version;
 }
 
 // =========================================================================
@@ -524,164 +637,87 @@ StringTable &LocalizationManager::getOrCreateTable(const LocaleId &locale) {
     return it->second;
   }
 
-  m_stringTables[locale] = StringTable(locale);
-  return m_stringTables[locale];
+  StringTable &table = m_stringTables[locale];
+  table.setLocale(locale);
+  refreshActiveStrings();
+  return table;
 }
 
-void LocalizationManager::fireMissingString(const std::string &id,
+void LocalizationManager::fireMissingString(std::string_view id,
                                             const LocaleId &locale) const {
   if (m_onStringMissing) {
-    m_onStringMissing(id, locale);
+    m_onStringMissing(std::string(id), locale);
   }
 }
 
-Result<void> LocalizationManager::loadCSV(const LocaleId &locale,
-                                          const std::string &content) {
-  StringTable &table = getOrCreateTable(locale);
+LocalizationManager::LocaleStrings
+LocalizationManager::stringsFor(const LocaleId &locale) const {
+  LocaleStrings strings;
+  strings.table = getStringTable(locale);
+  strings.bundle = getBundle(locale);
+  return strings;
+}
 
-  std::istringstream stream(content);
-  std::string line;
-  bool headerSkipped = false;
+void LocalizationManager::refreshActiveStrings() {
+  // Templates belong to the previous locale's strings
+  {
+    std::lock_guard<std::mutex> lock(m_templateMutex);
+    m_templates.clear();
+  }
+  ++m_generation;
+  m_current = stringsFor(m_currentLocale);
+  m_fallback = m_currentLocale.toString() != m_defaultLocale.toString()
+                   ? stringsFor(m_defaultLocale)
+                   : LocaleStrings{};
+}
 
-  while (std::getline(stream, line)) {
-    // Skip header
-    if (!headerSkipped) {
-      headerSkipped = true;
-      continue;
+std::optional<std::string_view>
+LocalizationManager::findIn(const LocaleStrings &strings, std::string_view id) {
+  if (strings.table) {
+    if (const std::string *str = strings.table->findString(id)) {
+      return std::string_view(*str);
     }
+  }
+  if (strings.bundle) {
+    return strings.bundle->find(id);
+  }
+  return std::nullopt;
+}
 
-    // Skip empty lines
-    if (line.empty())
-      continue;
-
-    // Simple CSV parsing (ID,Text format)
-    size_t commaPos = line.find(',');
-    if (commaPos != std::string::npos) {
-      std::string id = line.substr(0, commaPos);
-      std::string value = line.substr(commaPos + 1);
-
-      // Remove quotes if present
-      if (!id.empty() && id.front() == '"' && id.back() == '"') {
-        id = id.substr(1, id.size() - 2);
-      }
-      if (!value.empty() && value.front() == '"' && value.back() == '"') {
-        value = value.substr(1, value.size() - 2);
-      }
-
-      // Unescape double quotes
-      size_t pos = 0;
-      while ((pos = value.find("\"\"", pos)) != std::string::npos) {
-        value.replace(pos, 2, "\"");
-        pos += 1;
-      }
-
-      table.addString(id, value);
+std::optional<std::string_view>
+LocalizationManager::findPluralIn(const LocaleStrings &strings,
+                                  const LocaleId &locale, std::string_view id,
+                                  i64 count) const {
+  if (strings.table) {
+    if (const std::string *str = strings.table->findPluralString(id, count)) {
+      return std::string_view(*str);
     }
   }
+  if (strings.bundle) {
+    return strings.bundle->find(id, getPluralCategory(locale, count));
+  }
+  return std::nullopt;
+}
 
-  return {};
+Result<void> LocalizationManager::loadCSV(const LocaleId &locale,
+                                          std::string_view content) {
+  return readCSV(content, getOrCreateTable(locale));
 }
 
 Result<void> LocalizationManager::loadJSON(const LocaleId &locale,
-                                           const std::string &content) {
-  StringTable &table = getOrCreateTable(locale);
-
-  // Simple JSON parsing for {"key": "value"} format
-  // Pattern: "key" : "value"
-  std::string pattern = "\"([^\"]+)\"\\s*:\\s*\"((?:[^\"\\\\]|\\\\.)*)\"";
-  std::regex keyValueRegex(pattern);
-  auto begin =
-      std::sregex_iterator(content.begin(), content.end(), keyValueRegex);
-  auto end = std::sregex_iterator();
-
-  for (auto it = begin; it != end; ++it) {
-    std::string id = (*it)[1].str();
-    std::string value = (*it)[2].str();
-
-    // Unescape JSON strings
-    size_t pos = 0;
-    while ((pos = value.find("\\n", pos)) != std::string::npos) {
-      value.replace(pos, 2, "\n");
-      pos += 1;
-    }
-    pos = 0;
-    while ((pos = value.find("\\\"", pos)) != std::string::npos) {
-      value.replace(pos, 2, "\"");
-      pos += 1;
-    }
-
-    table.addString(id, value);
-  }
-
-  return {};
+                                           std::string_view content) {
+  return readJSON(content, getOrCreateTable(locale));
 }
 
 Result<void> LocalizationManager::loadPO(const LocaleId &locale,
-                                         const std::string &content) {
-  StringTable &table = getOrCreateTable(locale);
-
-  std::istringstream stream(content);
-  std::string line;
-  std::string currentMsgid;
-  std::string currentMsgstr;
-  bool inMsgstr = false;
-
-  auto commitEntry = [&]() {
-    if (!currentMsgid.empty() && !currentMsgstr.empty()) {
-      table.addString(currentMsgid, currentMsgstr);
-    }
-    currentMsgid.clear();
-    currentMsgstr.clear();
-    inMsgstr = false;
-  };
-
-  while (std::getline(stream, line)) {
-    // Remove leading/trailing whitespace
-    size_t start = line.find_first_not_of(" \t");
-    if (start == std::string::npos)
-      continue;
-    line = line.substr(start);
-
-    // Skip comments
-    if (line[0] == '#')
-      continue;
-
-    if (line.substr(0, 5) == "msgid") {
-      commitEntry();
-      // Extract string
-      size_t quoteStart = line.find('"');
-      size_t quoteEnd = line.rfind('"');
-      if (quoteStart != std::string::npos && quoteEnd > quoteStart) {
-        currentMsgid = line.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-      }
-    } else if (line.substr(0, 6) == "msgstr") {
-      inMsgstr = true;
-      size_t quoteStart = line.find('"');
-      size_t quoteEnd = line.rfind('"');
-      if (quoteStart != std::string::npos && quoteEnd > quoteStart) {
-        currentMsgstr = line.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-      }
-    } else if (line[0] == '"' && !currentMsgid.empty()) {
-      // Continuation line
-      size_t quoteEnd = line.rfind('"');
-      if (quoteEnd > 0) {
-        std::string cont = line.substr(1, quoteEnd - 1);
-        if (inMsgstr) {
-          currentMsgstr += cont;
-        } else {
-          currentMsgid += cont;
-        }
-      }
-    }
-  }
-
-  commitEntry();
-  return {};
+                                         std::string_view content) {
+  return readPO(content, getOrCreateTable(locale));
 }
 
 Result<void> LocalizationManager::loadXLIFF(const LocaleId &locale,
-                                            const std::string &content) {
+                                            std::string_view data) {
   StringTable &table = getOrCreateTable(locale);
+  const std::string content(data);
 
   // Simple XLIFF parsing for trans-unit elements
   std::string transUnitPattern = "<trans-unit[^>]*id=\"([^\"]*)\"[^>]*>";
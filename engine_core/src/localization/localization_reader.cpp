@@ -0,0 +1,667 @@
+/**
+ * @file localization_reader.cpp
+ * @brief Single-pass CSV/JSON/PO readers
+ */
+
+#include "NovelMind/localization/localization_reader.hpp"
+#include <algorithm>
+#include <optional>
+
+namespace NovelMind::localization {
+
+namespace {
+
+constexpr std::string_view UTF8_BOM = "\xEF\xBB\xBF";
+
+std::string_view skipBom(std::string_view data) {
+  if (data.substr(0, UTF8_BOM.size()) == UTF8_BOM) {
+    data.remove_prefix(UTF8_BOM.size());
+  }
+  return data;
+}
+
+/// Line count is only computed when reporting an error
+Result<void> parseError(std::string_view format, std::string_view data,
+                        size_t pos, std::string_view message) {
+  pos = std::min(pos, data.size());
+  const auto line =
+      1 + std::count(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(pos), '\n');
+  return Result<void>::error(std::string(format) + " parse error at line " +
+                             std::to_string(line) + ": " +
+                             std::string(message));
+}
+
+/// Tables usually hold one entry per line; good enough to reserve up front
+size_t estimateEntries(std::string_view data) {
+  return static_cast<size_t>(std::count(data.begin(), data.end(), '\n')) + 1;
+}
+
+void appendUtf8(std::string &out, u32 codepoint) {
+  if (codepoint < 0x80) {
+    out += static_cast<char>(codepoint);
+  } else if (codepoint < 0x800) {
+    out += static_cast<char>(0xC0 | (codepoint >> 6));
+    out += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else if (codepoint < 0x10000) {
+    out += static_cast<char>(0xE0 | (codepoint >> 12));
+    out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (codepoint >> 18));
+    out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+}
+
+std::optional<PluralCategory> pluralCategoryFromName(std::string_view name) {
+  if (name == "zero")
+    return PluralCategory::Zero;
+  if (name == "one")
+    return PluralCategory::One;
+  if (name == "two")
+    return PluralCategory::Two;
+  if (name == "few")
+    return PluralCategory::Few;
+  if (name == "many")
+    return PluralCategory::Many;
+  if (name == "other")
+    return PluralCategory::Other;
+  return std::nullopt;
+}
+
+// =========================================================================
+// JSON
+// =========================================================================
+
+class JsonReader {
+public:
+  JsonReader(std::string_view data, StringTable &table)
+      : m_data(data), m_table(table) {}
+
+  Result<void> read() {
+    skipWhitespace();
+    if (!consume('{')) {
+      return parseError("JSON", m_data, m_pos, "expected an object");
+    }
+
+    std::string path;
+    if (!readMembers(path)) {
+      return parseError("JSON", m_data, m_errorPos, m_error);
+    }
+
+    skipWhitespace();
+    if (m_pos != m_data.size()) {
+      return parseError("JSON", m_data, m_pos, "unexpected data after the object");
+    }
+    return {};
+  }
+
+private:
+  static constexpr int MAX_DEPTH = 64;
+
+  [[nodiscard]] bool atEnd() const { return m_pos >= m_data.size(); }
+
+  void skipWhitespace() {
+    while (m_pos < m_data.size()) {
+      const char c = m_data[m_pos];
+      if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+        return;
+      }
+      ++m_pos;
+    }
+  }
+
+  bool consume(char c) {
+    if (m_pos < m_data.size() && m_data[m_pos] == c) {
+      ++m_pos;
+      return true;
+    }
+    return false;
+  }
+
+  bool fail(std::string_view message) {
+    m_error = std::string(message);
+    m_errorPos = m_pos;
+    return false;
+  }
+
+  /// Members of an object whose '{' was consumed; IDs are prefixed by @p path
+  bool readMembers(std::string &path) {
+    const size_t prefixLength = path.size();
+    skipWhitespace();
+    if (consume('}')) {
+      return true;
+    }
+
+    while (true) {
+      skipWhitespace();
+      if (!consume('"')) {
+        return fail("expected a string key");
+      }
+      if (!readString(m_key)) {
+        return false;
+      }
+      skipWhitespace();
+      if (!consume(':')) {
+        return fail("expected ':' after a key");
+      }
+      skipWhitespace();
+
+      // The documented layout keeps the table in a top-level "strings"
+      // object next to metadata such as "language"; its IDs stay unprefixed
+      const bool stringsWrapper = m_depth == 0 && m_key == "strings" &&
+                                  m_pos < m_data.size() && m_data[m_pos] == '{';
+
+      path.resize(prefixLength);
+      if (!stringsWrapper) {
+        if (prefixLength > 0) {
+          path += '.';
+        }
+        path += m_key;
+      }
+      if (!readValue(path)) {
+        return false;
+      }
+
+      skipWhitespace();
+      if (consume(',')) {
+        continue;
+      }
+      if (consume('}')) {
+        path.resize(prefixLength);
+        return true;
+      }
+      return fail("expected ',' or '}'");
+    }
+  }
+
+  bool readValue(std::string &path) {
+    if (atEnd()) {
+      return fail("unexpected end of input");
+    }
+
+    const char c = m_data[m_pos];
+    if (c == '"') {
+      ++m_pos;
+      if (!readString(m_value)) {
+        return false;
+      }
+      m_table.addString(path, m_value);
+      return true;
+    }
+
+    if (c == '{') {
+      ++m_pos;
+      if (++m_depth > MAX_DEPTH) {
+        return fail("objects nested too deeply");
+      }
+
+      // Try the object as a set of plural forms first; on the first key
+      // that is not a category, re-read it as a nested group
+      const size_t start = m_pos;
+      if (readPluralForms()) {
+        m_table.addPluralString(path, m_forms);
+      } else {
+        m_pos = start;
+        if (!readMembers(path)) {
+          return false;
+        }
+      }
+      --m_depth;
+      return true;
+    }
+
+    return skipValue();
+  }
+
+  /// Reads {"one": "...", "other": "..."}; false if it is anything else
+  bool readPluralForms() {
+    m_forms.clear();
+    skipWhitespace();
+    if (atEnd() || m_data[m_pos] == '}') {
+      return false;
+    }
+
+    while (true) {
+      skipWhitespace();
+      if (!consume('"') || !readString(m_key)) {
+        return false;
+      }
+      const auto category = pluralCategoryFromName(m_key);
+      if (!category) {
+        return false;
+      }
+      skipWhitespace();
+      if (!consume(':')) {
+        return false;
+      }
+      skipWhitespace();
+      if (!consume('"') || !readString(m_value)) {
+        return false;
+      }
+      m_forms[*category] = m_value;
+
+      skipWhitespace();
+      if (consume(',')) {
+        continue;
+      }
+      return consume('}');
+    }
+  }
+
+  /// Skips numbers, literals, arrays and objects nested in arrays
+  bool skipValue() {
+    if (atEnd()) {
+      return fail("unexpected end of input");
+    }
+
+    const char c = m_data[m_pos];
+    if (c == '"') {
+      ++m_pos;
+      return readString(m_scratch);
+    }
+
+    if (c == '[' || c == '{') {
+      const char close = c == '[' ? ']' : '}';
+      ++m_pos;
+      if (++m_depth > MAX_DEPTH) {
+        return fail("arrays nested too deeply");
+      }
+      skipWhitespace();
+      if (!consume(close)) {
+        while (true) {
+          skipWhitespace();
+          if (close == '}') {
+            if (!consume('"') || !readString(m_scratch)) {
+              return fail("expected a string key");
+            }
+            skipWhitespace();
+            if (!consume(':')) {
+              return fail("expected ':' after a key");
+            }
+            skipWhitespace();
+          }
+          if (!skipValue()) {
+            return false;
+          }
+          skipWhitespace();
+          if (consume(',')) {
+            continue;
+          }
+          if (consume(close)) {
+            break;
+          }
+          return fail(close == ']' ? "expected ',' or ']'" : "expected ',' or '}'");
+        }
+      }
+      --m_depth;
+      return true;
+    }
+
+    // Number, true, false or null
+    const size_t start = m_pos;
+    while (m_pos < m_data.size()) {
+      const char ch = m_data[m_pos];
+      const bool literal = (ch >= '0' && ch <= '9') || (ch >= 'a' && ch <= 'z') ||
+                           ch == '-' || ch == '+' || ch == '.' || ch == 'E';
+      if (!literal) {
+        break;
+      }
+      ++m_pos;
+    }
+    if (m_pos == start) {
+      return fail("unexpected character");
+    }
+    return true;
+  }
+
+  /// Reads a string whose opening quote was consumed
+  bool readString(std::string &out) {
+    // Fast path: no escapes, copy the span directly
+    const size_t start = m_pos;
+    while (m_pos < m_data.size()) {
+      const char c = m_data[m_pos];
+      if (c == '"') {
+        out.assign(m_data.substr(start, m_pos - start));
+        ++m_pos;
+        return true;
+      }
+      if (c == '\\') {
+        break;
+      }
+      ++m_pos;
+    }
+    if (atEnd()) {
+      m_pos = start;
+      return fail("unterminated string");
+    }
+
+    out.assign(m_data.substr(start, m_pos - start));
+    while (m_pos < m_data.size()) {
+      const char c = m_data[m_pos++];
+      if (c == '"') {
+        return true;
+      }
+      if (c != '\\') {
+        out += c;
+        continue;
+      }
+      if (atEnd()) {
+        break;
+      }
+
+      const char escape = m_data[m_pos++];
+      switch (escape) {
+      case '"':
+      case '\\':
+      case '/':
+        out += escape;
+        break;
+      case 'b':
+        out += '\b';
+        break;
+      case 'f':
+        out += '\f';
+        break;
+      case 'n':
+        out += '\n';
+        break;
+      case 'r':
+        out += '\r';
+        break;
+      case 't':
+        out += '\t';
+        break;
+      case 'u': {
+        u32 codepoint = 0;
+        if (!readHex4(codepoint)) {
+          return false;
+        }
+        // Combine a UTF-16 surrogate pair
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF &&
+            m_data.substr(m_pos, 2) == "\\u") {
+          m_pos += 2;
+          u32 low = 0;
+          if (!readHex4(low)) {
+            return false;
+          }
+          if (low >= 0xDC00 && low <= 0xDFFF) {
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+          } else {
+            appendUtf8(out, codepoint);
+            codepoint = low;
+          }
+        }
+        appendUtf8(out, codepoint);
+        break;
+      }
+      default:
+        --m_pos;
+        return fail("invalid escape sequence");
+      }
+    }
+    return fail("unterminated string");
+  }
+
+  bool readHex4(u32 &value) {
+    if (m_data.size() - m_pos < 4) {
+      return fail("truncated \\u escape");
+    }
+    value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = m_data[m_pos++];
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= static_cast<u32>(c - '0');
+      } else if (c >= 'a' && c <= 'f') {
+        value |= static_cast<u32>(c - 'a' + 10);
+      } else if (c >= 'A' && c <= 'F') {
+        value |= static_cast<u32>(c - 'A' + 10);
+      } else {
+        return fail("invalid \\u escape");
+      }
+    }
+    return true;
+  }
+
+  std::string_view m_data;
+  StringTable &m_table;
+  size_t m_pos = 0;
+  int m_depth = 0;
+
+  // Reused between entries
+  std::string m_key;
+  std::string m_value;
+  std::string m_scratch;
+  std::unordered_map<PluralCategory, std::string> m_forms;
+
+  std::string m_error;
+  size_t m_errorPos = 0;
+};
+
+// =========================================================================
+// PO
+// =========================================================================
+
+std::string_view trim(std::string_view text) {
+  while (!text.empty() && (text.front() == ' ' || text.front() == '\t')) {
+    text.remove_prefix(1);
+  }
+  while (!text.empty() && (text.back() == ' ' || text.back() == '\t' ||
+                           text.back() == '\r')) {
+    text.remove_suffix(1);
+  }
+  return text;
+}
+
+/// Appends the contents of a "quoted" PO string; false if not quoted
+bool appendPoString(std::string_view quoted, std::string &out) {
+  if (quoted.size() < 2 || quoted.front() != '"' || quoted.back() != '"') {
+    return false;
+  }
+  quoted = quoted.substr(1, quoted.size() - 2);
+
+  size_t pos = 0;
+  while (pos < quoted.size()) {
+    const size_t backslash = quoted.find('\\', pos);
+    if (backslash == std::string_view::npos) {
+      out.append(quoted.substr(pos));
+      break;
+    }
+    out.append(quoted.substr(pos, backslash - pos));
+    if (backslash + 1 >= quoted.size()) {
+      out += '\\';
+      break;
+    }
+
+    const char escape = quoted[backslash + 1];
+    switch (escape) {
+    case 'n':
+      out += '\n';
+      break;
+    case 't':
+      out += '\t';
+      break;
+    case 'r':
+      out += '\r';
+      break;
+    case '"':
+    case '\\':
+      out += escape;
+      break;
+    default:
+      out += '\\';
+      out += escape;
+      break;
+    }
+    pos = backslash + 2;
+  }
+  return true;
+}
+
+} // namespace
+
+Result<void> readCSV(std::string_view data, StringTable &table) {
+  data = skipBom(data);
+  table.reserve(table.size() + estimateEntries(data));
+
+  std::string id;
+  std::string value;
+  std::string extra;
+  bool headerSkipped = false;
+  size_t headerColumns = 0;
+  size_t pos = 0;
+
+  while (pos < data.size()) {
+    const size_t recordStart = pos;
+    size_t fieldCount = 0;
+    bool endOfRecord = false;
+
+    while (!endOfRecord) {
+      std::string &field = fieldCount == 0 ? id : fieldCount == 1 ? value : extra;
+      field.clear();
+
+      // In a two-column ID,Text file an unquoted text keeps its commas
+      const bool restOfLine =
+          fieldCount == 1 && headerSkipped && headerColumns <= 2;
+
+      const bool quoted = pos < data.size() && data[pos] == '"';
+      if (quoted) {
+        // Quoted field: may contain commas, newlines and doubled quotes
+        ++pos;
+        while (true) {
+          const size_t quote = data.find('"', pos);
+          if (quote == std::string_view::npos) {
+            return parseError("CSV", data, recordStart, "unterminated quoted field");
+          }
+          field.append(data.substr(pos, quote - pos));
+          pos = quote + 1;
+          if (pos < data.size() && data[pos] == '"') {
+            field += '"';
+            ++pos;
+            continue;
+          }
+          break;
+        }
+      }
+
+      size_t stop = pos;
+      while (stop < data.size() && data[stop] != '\n' &&
+             (data[stop] != ',' || (restOfLine && !quoted))) {
+        ++stop;
+      }
+      field.append(data.substr(pos, stop - pos));
+      pos = stop;
+
+      if (pos < data.size() && data[pos] == ',') {
+        ++pos;
+      } else {
+        endOfRecord = true;
+        if (pos < data.size()) {
+          ++pos;
+        }
+        if (!field.empty() && field.back() == '\r') {
+          field.pop_back();
+        }
+      }
+      ++fieldCount;
+    }
+
+    if (!headerSkipped) {
+      headerSkipped = true;
+      headerColumns = fieldCount;
+      continue;
+    }
+    if (fieldCount >= 2 && !id.empty()) {
+      table.addString(id, value);
+    }
+  }
+
+  return {};
+}
+
+Result<void> readJSON(std::string_view data, StringTable &table) {
+  data = skipBom(data);
+  table.reserve(table.size() + estimateEntries(data));
+  return JsonReader(data, table).read();
+}
+
+Result<void> readPO(std::string_view data, StringTable &table) {
+  data = skipBom(data);
+  // An entry takes at least msgid, msgstr and a blank line
+  table.reserve(table.size() + estimateEntries(data) / 3);
+
+  enum class Field { None, Id, Str, Ignored };
+
+  std::string msgid;
+  std::string msgstr;
+  Field field = Field::None;
+
+  auto commitEntry = [&]() {
+    if (!msgid.empty() && !msgstr.empty()) {
+      table.addString(msgid, msgstr);
+    }
+    msgid.clear();
+    msgstr.clear();
+    field = Field::None;
+  };
+
+  size_t pos = 0;
+  while (pos < data.size()) {
+    const size_t lineStart = pos;
+    size_t lineEnd = data.find('\n', pos);
+    if (lineEnd == std::string_view::npos) {
+      lineEnd = data.size();
+    }
+    pos = lineEnd + 1;
+
+    std::string_view line = trim(data.substr(lineStart, lineEnd - lineStart));
+    if (line.empty() || line.front() == '#') {
+      continue;
+    }
+
+    std::string *target = nullptr;
+    if (line.front() == '"') {
+      // Continuation of the previous keyword
+      if (field == Field::Id) {
+        target = &msgid;
+      } else if (field == Field::Str) {
+        target = &msgstr;
+      } else {
+        continue;
+      }
+    } else {
+      const size_t space = line.find_first_of(" \t");
+      const std::string_view keyword = line.substr(0, space);
+      line = space == std::string_view::npos ? std::string_view{}
+                                              : trim(line.substr(space));
+
+      if (keyword == "msgid") {
+        commitEntry();
+        field = Field::Id;
+        target = &msgid;
+      } else if (keyword == "msgstr" || keyword == "msgstr[0]") {
+        field = Field::Str;
+        target = &msgstr;
+      } else if (keyword == "msgctxt") {
+        commitEntry();
+        field = Field::Ignored;
+        continue;
+      } else {
+        // msgid_plural, msgstr[N] and unknown keywords
+        field = Field::Ignored;
+        continue;
+      }
+    }
+
+    if (!appendPoString(line, *target)) {
+      return parseError("PO", data, lineStart, "expected a quoted string");
+    }
+  }
+
+  commitEntry();
+  return {};
+}
+
+} // namespace NovelMind::localization
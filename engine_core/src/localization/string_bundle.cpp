@@ -0,0 +1,409 @@
+/**
+ * @file string_bundle.cpp
+ * @brief Compiled string bundle writer and reader
+ */
+
+#include "NovelMind/localization/string_bundle.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace NovelMind::localization {
+
+namespace {
+
+constexpr std::array<char, 4> BUNDLE_MAGIC = {'N', 'M', 'L', 'B'};
+constexpr usize PLURAL_CATEGORY_COUNT = 6;
+
+// Gives up on a bucket after this many displacements; with one bucket per
+// key this is never reached in practice
+constexpr u32 MAX_DISPLACEMENT = 1u << 24;
+
+struct BundleHeader {
+  std::array<char, 4> magic;
+  u16 version;
+  u16 headerSize;
+  u32 entryCount;
+  u32 localeOffset;
+  u32 localeLength;
+  u32 displaceOffset;
+  u32 entriesOffset;
+  u32 formsOffset;
+  u32 formCount;
+  u32 blobOffset;
+  u32 blobSize;
+};
+static_assert(sizeof(BundleHeader) == 44);
+
+struct BundleForm {
+  u32 offset;
+  u32 length;
+};
+static_assert(sizeof(BundleForm) == 8);
+
+/// FNV-1a keyed by @p seed with a final avalanche, so `% n` stays uniform
+u64 bundleHash(std::string_view key, u32 seed) {
+  u64 hash = 14695981039346656037ull ^ (static_cast<u64>(seed) * 0x9E3779B97F4A7C15ull);
+  for (const char c : key) {
+    hash ^= static_cast<u8>(c);
+    hash *= 1099511628211ull;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+template <typename T> void appendPod(std::vector<u8> &out, const T &value) {
+  const auto *bytes = reinterpret_cast<const u8 *>(&value);
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T> T readPod(const u8 *data, usize offset) {
+  T value;
+  std::memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+usize alignUp(usize value) { return (value + 3) & ~usize{3}; }
+
+} // namespace
+
+// =========================================================================
+// Compilation
+// =========================================================================
+
+Result<std::vector<u8>> StringBundle::compile(const StringTable &table) {
+  std::vector<std::string> ids = table.getStringIds();
+  std::sort(ids.begin(), ids.end());
+  const usize count = ids.size();
+  if (count > std::numeric_limits<i32>::max()) {
+    return Result<std::vector<u8>>::error("String table too large for a bundle");
+  }
+
+  // Blob: locale, then each key followed by its forms
+  std::string blob = table.getLocale().toString();
+  const u32 localeLength = static_cast<u32>(blob.size());
+
+  std::vector<Entry> entries(count);
+  std::vector<BundleForm> forms;
+  for (usize i = 0; i < count; ++i) {
+    const LocalizedString &str = table.getStrings().find(ids[i])->second;
+    Entry &entry = entries[i];
+    entry = Entry{};
+    entry.keyOffset = static_cast<u32>(blob.size());
+    entry.keyLength = static_cast<u32>(ids[i].size());
+    entry.firstForm = static_cast<u32>(forms.size());
+    blob += ids[i];
+
+    for (usize c = 0; c < PLURAL_CATEGORY_COUNT; ++c) {
+      const auto form = str.forms.find(static_cast<PluralCategory>(c));
+      if (form == str.forms.end()) {
+        continue;
+      }
+      entry.formMask |= static_cast<u8>(1u << c);
+      forms.push_back({static_cast<u32>(blob.size()), static_cast<u32>(form->second.size())});
+      blob += form->second;
+    }
+  }
+
+  // Hash and displace: bucket keys by their seed-0 hash, then place the
+  // largest buckets first by searching for a seed that sends all of their
+  // keys to free slots. Single-key buckets take a free slot directly and
+  // store it as a negative displacement.
+  std::vector<i32> displacements(count, 0);
+  std::vector<u32> slotOf(count, 0);
+  if (count > 0) {
+    std::vector<std::vector<u32>> buckets(count);
+    for (u32 i = 0; i < count; ++i) {
+      buckets[bundleHash(ids[i], 0) % count].push_back(i);
+    }
+
+    std::vector<u32> order(count);
+    for (u32 b = 0; b < count; ++b) {
+      order[b] = b;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](u32 a, u32 b) {
+      return buckets[a].size() > buckets[b].size();
+    });
+
+    std::vector<bool> used(count, false);
+    std::vector<usize> candidate;
+    usize next = 0;
+    for (; next < count && buckets[order[next]].size() > 1; ++next) {
+      const auto &bucket = buckets[order[next]];
+      bool placed = false;
+      for (u32 seed = 1; seed < MAX_DISPLACEMENT && !placed; ++seed) {
+        candidate.clear();
+        for (const u32 key : bucket) {
+          const usize slot = bundleHash(ids[key], seed) % count;
+          if (used[slot] ||
+              std::find(candidate.begin(), candidate.end(), slot) != candidate.end()) {
+            break;
+          }
+          candidate.push_back(slot);
+        }
+        if (candidate.size() != bucket.size()) {
+          continue;
+        }
+        for (usize k = 0; k < bucket.size(); ++k) {
+          used[candidate[k]] = true;
+          slotOf[bucket[k]] = static_cast<u32>(candidate[k]);
+        }
+        displacements[order[next]] = static_cast<i32>(seed);
+        placed = true;
+      }
+      if (!placed) {
+        return Result<std::vector<u8>>::error("Failed to build a perfect hash for the bundle");
+      }
+    }
+
+    usize freeSlot = 0;
+    for (; next < count && buckets[order[next]].size() == 1; ++next) {
+      while (used[freeSlot]) {
+        ++freeSlot;
+      }
+      used[freeSlot] = true;
+      slotOf[buckets[order[next]].front()] = static_cast<u32>(freeSlot);
+      displacements[order[next]] = -static_cast<i32>(freeSlot) - 1;
+    }
+  }
+
+  const u64 totalSize = alignUp(sizeof(BundleHeader)) +
+                        u64{count} * (sizeof(i32) + sizeof(Entry)) +
+                        u64{forms.size()} * sizeof(BundleForm) + blob.size();
+  if (totalSize > std::numeric_limits<u32>::max()) {
+    return Result<std::vector<u8>>::error("String table too large for a bundle");
+  }
+
+  BundleHeader header{};
+  header.magic = BUNDLE_MAGIC;
+  header.version = FORMAT_VERSION;
+  header.headerSize = sizeof(BundleHeader);
+  header.entryCount = static_cast<u32>(count);
+  header.localeOffset = 0;
+  header.localeLength = localeLength;
+  header.displaceOffset = static_cast<u32>(alignUp(sizeof(BundleHeader)));
+  header.entriesOffset = header.displaceOffset + static_cast<u32>(count * sizeof(i32));
+  header.formsOffset = header.entriesOffset + static_cast<u32>(count * sizeof(Entry));
+  header.formCount = static_cast<u32>(forms.size());
+  header.blobOffset = header.formsOffset + static_cast<u32>(forms.size() * sizeof(BundleForm));
+  header.blobSize = static_cast<u32>(blob.size());
+
+  std::vector<u8> out;
+  out.reserve(header.blobOffset + blob.size());
+  appendPod(out, header);
+  out.resize(header.displaceOffset, 0);
+  for (const i32 displacement : displacements) {
+    appendPod(out, displacement);
+  }
+
+  std::vector<Entry> slots(count);
+  for (usize i = 0; i < count; ++i) {
+    slots[slotOf[i]] = entries[i];
+  }
+  for (const Entry &entry : slots) {
+    appendPod(out, entry);
+  }
+  for (const BundleForm &form : forms) {
+    appendPod(out, form);
+  }
+  out.insert(out.end(), blob.begin(), blob.end());
+  return Result<std::vector<u8>>::ok(std::move(out));
+}
+
+Result<void> StringBundle::compileToFile(const StringTable &table, const std::string &path) {
+  auto bytes = compile(table);
+  if (bytes.isError()) {
+    return Result<void>::error(bytes.error());
+  }
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    return Result<void>::error("Failed to open file for writing: " + path);
+  }
+  const auto &data = bytes.value();
+  file.write(reinterpret_cast<const char *>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  if (!file) {
+    return Result<void>::error("Failed to write string bundle: " + path);
+  }
+  return {};
+}
+
+// =========================================================================
+// Loading
+// =========================================================================
+
+Result<StringBundle> StringBundle::open(const std::string &path) {
+  auto mapped = platform::MappedFile::open(path);
+  if (mapped.isError()) {
+    return Result<StringBundle>::error("Failed to open string bundle: " + path);
+  }
+
+  StringBundle bundle;
+  bundle.m_file = std::move(mapped).value();
+  bundle.m_size = bundle.m_file.size();
+  return attach(std::move(bundle));
+}
+
+Result<StringBundle> StringBundle::fromMemory(std::vector<u8> data) {
+  StringBundle bundle;
+  bundle.m_buffer = std::move(data);
+  bundle.m_size = bundle.m_buffer.size();
+  return attach(std::move(bundle));
+}
+
+Result<StringBundle> StringBundle::attach(StringBundle bundle) {
+  const u8 *base = bundle.data();
+  const usize size = bundle.m_size;
+  if (!base || size < sizeof(BundleHeader)) {
+    return Result<StringBundle>::error("String bundle is truncated");
+  }
+
+  const auto header = readPod<BundleHeader>(base, 0);
+  if (header.magic != BUNDLE_MAGIC) {
+    return Result<StringBundle>::error("Not a string bundle");
+  }
+  if (header.version != FORMAT_VERSION) {
+    return Result<StringBundle>::error("Unsupported string bundle version " +
+                                       std::to_string(header.version));
+  }
+
+  // Sections must be in bounds, in order and 4-byte aligned
+  const u64 count = header.entryCount;
+  const bool layoutOk =
+      header.displaceOffset >= sizeof(BundleHeader) && header.displaceOffset % 4 == 0 &&
+      header.entriesOffset == header.displaceOffset + count * sizeof(i32) &&
+      header.formsOffset == header.entriesOffset + count * sizeof(Entry) &&
+      header.blobOffset == header.formsOffset + u64{header.formCount} * sizeof(BundleForm) &&
+      u64{header.blobOffset} + header.blobSize <= size &&
+      u64{header.localeOffset} + header.localeLength <= header.blobSize;
+  if (!layoutOk) {
+    return Result<StringBundle>::error("String bundle layout is corrupt");
+  }
+
+  bundle.m_entryCount = header.entryCount;
+  bundle.m_displaceOffset = header.displaceOffset;
+  bundle.m_entriesOffset = header.entriesOffset;
+  bundle.m_formsOffset = header.formsOffset;
+  bundle.m_blobOffset = header.blobOffset;
+  bundle.m_blobSize = header.blobSize;
+
+  // Validate every span once so lookups need no bounds checks
+  for (u32 i = 0; i < bundle.m_entryCount; ++i) {
+    const Entry entry = bundle.entryAt(i);
+    const i32 displacement = readPod<i32>(base, header.displaceOffset + usize{i} * sizeof(i32));
+    const auto formCount = static_cast<u32>(std::popcount(entry.formMask));
+    const bool entryOk =
+        u64{entry.keyOffset} + entry.keyLength <= header.blobSize &&
+        entry.formMask < (1u << PLURAL_CATEGORY_COUNT) &&
+        u64{entry.firstForm} + formCount <= header.formCount &&
+        (displacement >= 0 || static_cast<u64>(-(static_cast<i64>(displacement) + 1)) < count);
+    if (!entryOk) {
+      return Result<StringBundle>::error("String bundle entry " + std::to_string(i) +
+                                         " is corrupt");
+    }
+  }
+  for (u32 i = 0; i < header.formCount; ++i) {
+    const auto form =
+        readPod<BundleForm>(base, header.formsOffset + usize{i} * sizeof(BundleForm));
+    if (u64{form.offset} + form.length > header.blobSize) {
+      return Result<StringBundle>::error("String bundle form " + std::to_string(i) +
+                                         " is corrupt");
+    }
+  }
+
+  bundle.m_locale = LocaleId::fromString(
+      std::string(bundle.blobView(header.localeOffset, header.localeLength)));
+  return Result<StringBundle>::ok(std::move(bundle));
+}
+
+// =========================================================================
+// Lookup
+// =========================================================================
+
+const u8 *StringBundle::data() const {
+  return m_file.isOpen() ? m_file.data() : m_buffer.data();
+}
+
+StringBundle::Entry StringBundle::entryAt(u32 index) const {
+  return readPod<Entry>(data(), m_entriesOffset + usize{index} * sizeof(Entry));
+}
+
+std::string_view StringBundle::blobView(u32 offset, u32 length) const {
+  return {reinterpret_cast<const char *>(data()) + m_blobOffset + offset, length};
+}
+
+std::optional<StringBundle::Entry> StringBundle::lookup(std::string_view id) const {
+  if (m_entryCount == 0) {
+    return std::nullopt;
+  }
+
+  const usize bucket = bundleHash(id, 0) % m_entryCount;
+  const i32 displacement = readPod<i32>(data(), m_displaceOffset + bucket * sizeof(i32));
+  const usize slot = displacement < 0
+                         ? static_cast<usize>(-(static_cast<i64>(displacement) + 1))
+                         : bundleHash(id, static_cast<u32>(displacement)) % m_entryCount;
+
+  const Entry entry = entryAt(static_cast<u32>(slot));
+  if (blobView(entry.keyOffset, entry.keyLength) != id) {
+    return std::nullopt;
+  }
+  return entry;
+}
+
+std::string_view StringBundle::formView(const Entry &entry, PluralCategory category) const {
+  const auto bit = static_cast<u32>(category);
+  const u32 index =
+      entry.firstForm + static_cast<u32>(std::popcount(entry.formMask & ((1u << bit) - 1)));
+  const auto form = readPod<BundleForm>(data(), m_formsOffset + usize{index} * sizeof(BundleForm));
+  return blobView(form.offset, form.length);
+}
+
+std::optional<std::string_view> StringBundle::find(std::string_view id) const {
+  return find(id, PluralCategory::Other);
+}
+
+std::optional<std::string_view> StringBundle::find(std::string_view id,
+                                                   PluralCategory category) const {
+  const auto entry = lookup(id);
+  if (!entry || entry->formMask == 0) {
+    return std::nullopt;
+  }
+
+  const u8 mask = entry->formMask;
+  if (mask & (1u << static_cast<u32>(category))) {
+    return formView(*entry, category);
+  }
+  if (mask & (1u << static_cast<u32>(PluralCategory::Other))) {
+    return formView(*entry, PluralCategory::Other);
+  }
+  // Same as StringTable::getString: fall back to the first form present
+  return formView(*entry, static_cast<PluralCategory>(std::countr_zero(mask)));
+}
+
+bool StringBundle::contains(std::string_view id) const { return lookup(id).has_value(); }
+
+StringTable StringBundle::toStringTable() const {
+  StringTable table(m_locale);
+  table.reserve(m_entryCount);
+  std::unordered_map<PluralCategory, std::string> forms;
+  for (u32 i = 0; i < m_entryCount; ++i) {
+    const Entry entry = entryAt(i);
+    forms.clear();
+    for (usize c = 0; c < PLURAL_CATEGORY_COUNT; ++c) {
+      if (entry.formMask & (1u << c)) {
+        const auto category = static_cast<PluralCategory>(c);
+        forms[category] = std::string(formView(entry, category));
+      }
+    }
+    table.addPluralString(std::string(blobView(entry.keyOffset, entry.keyLength)), forms);
+  }
+  return table;
+}
+
+} // namespace NovelMind::localization
@@ -0,0 +1,116 @@
+/**
+ * @file string_template.cpp
+ * @brief Placeholder parsing and single-pass formatting
+ */
+
+#include "NovelMind/localization/string_template.hpp"
+
+namespace NovelMind::localization {
+
+namespace {
+
+/**
+ * @brief Split @p text into literals and placeholders, in order
+ *
+ * Calls onLiteral(offset, length) for text to copy and
+ * onPlaceholder(name) for each "{name}".
+ */
+template <typename Literal, typename Placeholder>
+void scanPlaceholders(std::string_view text, Literal &&onLiteral,
+                      Placeholder &&onPlaceholder) {
+  usize literalStart = 0;
+  usize pos = 0;
+  while ((pos = text.find('{', pos)) != std::string_view::npos) {
+    const usize end = text.find_first_of("{}", pos + 1);
+    if (end == std::string_view::npos) {
+      break;
+    }
+    if (text[end] == '{' || end == pos + 1) {
+      // Not a placeholder; the brace stays literal and a following '{' may
+      // start one
+      pos = text[end] == '{' ? end : end + 1;
+      continue;
+    }
+    onLiteral(literalStart, pos - literalStart);
+    onPlaceholder(text.substr(pos + 1, end - pos - 1));
+    literalStart = end + 1;
+    pos = end + 1;
+  }
+  onLiteral(literalStart, text.size() - literalStart);
+}
+
+} // namespace
+
+StringTemplate::StringTemplate(std::string_view text) : m_source(text) {
+  Segment pending{0, 0, NO_PLACEHOLDER};
+  scanPlaceholders(
+      m_source,
+      [&pending](usize offset, usize length) {
+        pending.offset = static_cast<u32>(offset);
+        pending.length = static_cast<u32>(length);
+      },
+      [this, &pending](std::string_view name) {
+        pending.placeholder = static_cast<u32>(m_placeholders.size());
+        m_placeholders.emplace_back(name);
+        m_segments.push_back(pending);
+        pending = Segment{0, 0, NO_PLACEHOLDER};
+      });
+  if (pending.length > 0) {
+    m_segments.push_back(pending);
+  }
+}
+
+void StringTemplate::formatTo(
+    std::string &out,
+    const std::unordered_map<std::string, std::string> &variables) const {
+  const std::string_view source = m_source;
+  for (const Segment &segment : m_segments) {
+    out.append(source.substr(segment.offset, segment.length));
+    if (segment.placeholder == NO_PLACEHOLDER) {
+      continue;
+    }
+    const std::string &name = m_placeholders[segment.placeholder];
+    auto it = variables.find(name);
+    if (it != variables.end()) {
+      out += it->second;
+    } else {
+      // Unknown placeholders are kept as written
+      out += '{';
+      out += name;
+      out += '}';
+    }
+  }
+}
+
+std::string StringTemplate::format(
+    const std::unordered_map<std::string, std::string> &variables) const {
+  std::string out;
+  out.reserve(m_source.size());
+  formatTo(out, variables);
+  return out;
+}
+
+void StringTemplate::formatTo(
+    std::string &out, std::string_view text,
+    const std::unordered_map<std::string, std::string> &variables) {
+  // Without a template the name must be copied to look it up; reuse one key
+  std::string key;
+  scanPlaceholders(
+      text,
+      [&out, text](usize offset, usize length) {
+        out.append(text.substr(offset, length));
+      },
+      [&out, &key, &variables](std::string_view name) {
+        key.assign(name);
+        auto it = variables.find(key);
+        if (it != variables.end()) {
+          out += it->second;
+        } else {
+          out += '{';
+          out += name;
+          out += '}';
+        }
+      });
+}
+
+} // namespace NovelMind::localization
@@ -0,0 +1,182 @@
+#include "NovelMind/platform/mapped_file.hpp"
+#include <cstdint>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace NovelMind::platform {
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0)),
+      m_open(std::exchange(other.m_open, false))
+#ifdef _WIN32
+      ,
+      m_fileHandle(std::exchange(other.m_fileHandle, nullptr)),
+      m_mappingHandle(std::exchange(other.m_mappingHandle, nullptr))
+#endif
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    close();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_open = std::exchange(other.m_open, false);
+#ifdef _WIN32
+    m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+    m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+#endif
+  }
+  return *this;
+}
+
+#ifdef _WIN32
+
+Result<MappedFile> MappedFile::open(const std::string &path) {
+  HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return Result<MappedFile>::error("Cannot open file: " + path);
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size)) {
+    CloseHandle(file);
+    return Result<MappedFile>::error("Cannot stat file: " + path);
+  }
+
+  MappedFile mapped;
+  mapped.m_open = true;
+  mapped.m_fileHandle = file;
+  if (size.QuadPart == 0) {
+    return Result<MappedFile>::ok(std::move(mapped)); // nothing to map
+  }
+
+  HANDLE mapping =
+      CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) {
+    return Result<MappedFile>::error("Cannot map file: " + path);
+  }
+  mapped.m_mappingHandle = mapping;
+
+  void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    return Result<MappedFile>::error("Cannot map file: " + path);
+  }
+
+  mapped.m_data = static_cast<const u8 *>(view);
+  mapped.m_size = static_cast<usize>(size.QuadPart);
+  return Result<MappedFile>::ok(std::move(mapped));
+}
+
+void MappedFile::close() {
+  if (m_data) {
+    UnmapViewOfFile(m_data);
+  }
+  if (m_mappingHandle) {
+    CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+  }
+  if (m_fileHandle) {
+    CloseHandle(static_cast<HANDLE>(m_fileHandle));
+  }
+  m_data = nullptr;
+  m_size = 0;
+  m_open = false;
+  m_fileHandle = nullptr;
+  m_mappingHandle = nullptr;
+}
+
+#else
+
+Result<MappedFile> MappedFile::open(const std::string &path) {
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return Result<MappedFile>::error("Cannot open file: " + path);
+  }
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return Result<MappedFile>::error("Cannot stat file: " + path);
+  }
+
+  MappedFile mapped;
+  mapped.m_open = true;
+  if (st.st_size == 0) {
+    ::close(fd);
+    return Result<MappedFile>::ok(std::move(mapped)); // nothing to map
+  }
+
+  const auto size = static_cast<usize>(st.st_size);
+  void *view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps its own reference to the file
+  ::close(fd);
+  if (view == MAP_FAILED) {
+    return Result<MappedFile>::error("Cannot map file: " + path);
+  }
+
+  mapped.m_data = static_cast<const u8 *>(view);
+  mapped.m_size = size;
+  return Result<MappedFile>::ok(std::move(mapped));
+}
+
+void MappedFile::close() {
+  if (m_data) {
+    ::munmap(const_cast<u8 *>(m_data), m_size);
+  }
+  m_data = nullptr;
+  m_size = 0;
+  m_open = false;
+}
+
+#endif
+
+void prefetchPages(std::span<const u8> range) {
+  if (range.empty()) {
+    return;
+  }
+
+#ifdef _WIN32
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  const usize pageSize = info.dwPageSize;
+#else
+  const usize pageSize = static_cast<usize>(::sysconf(_SC_PAGESIZE));
+  // Let the kernel read the whole range ahead in one go; the loop below
+  // then finds the pages resident, or waits for the read in flight
+  const auto first = reinterpret_cast<uintptr_t>(range.data());
+  const auto aligned = first & ~(static_cast<uintptr_t>(pageSize) - 1);
+  (void)::madvise(reinterpret_cast<void *>(aligned),
+                  range.size() + static_cast<usize>(first - aligned),
+                  MADV_WILLNEED);
+#endif
+
+  u8 sum = 0;
+  for (usize offset = 0; offset < range.size(); offset += pageSize) {
+    sum = static_cast<u8>(sum ^ range[offset]);
+  }
+  sum = static_cast<u8>(sum ^ range.back());
+  // Keeps the reads from being optimized away
+  volatile u8 sink = sum;
+  (void)sink;
+}
+
+} // namespace NovelMind::platform
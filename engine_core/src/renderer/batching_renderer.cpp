@@ -0,0 +1,158 @@
+#include "NovelMind/renderer/batching_renderer.hpp"
+#include "NovelMind/core/logger.hpp"
+#include <algorithm>
+
+namespace NovelMind::renderer {
+
+void BatchingRenderer::drawSprite(const Texture &texture,
+                                  const Transform2D &transform,
+                                  const Color &tint) {
+  if (!texture.isValid()) {
+    return;
+  }
+  drawSprite(texture,
+             Rect{0, 0, static_cast<f32>(texture.getWidth()),
+                  static_cast<f32>(texture.getHeight())},
+             transform, tint);
+}
+
+void BatchingRenderer::drawSprite(const Texture &texture,
+                                  const Rect &sourceRect,
+                                  const Transform2D &transform,
+                                  const Color &tint) {
+  if (!texture.isValid()) {
+    return;
+  }
+  m_batch.addSprite(textureId(texture), static_cast<f32>(texture.getWidth()),
+                    static_cast<f32>(texture.getHeight()), sourceRect,
+                    transform, tint);
+}
+
+void BatchingRenderer::drawText(const Font &font, const std::string &text,
+                                f32 x, f32 y, const Color &color) {
+  if (text.empty() || !m_glyphCache) {
+    return;
+  }
+
+  const f32 pageSize = static_cast<f32>(m_glyphCache->getPageSize());
+  const f32 lineHeight = m_glyphCache->getLineHeight(font);
+  const f32 missingAdvance = static_cast<f32>(font.getSize()) * 0.5f;
+
+  f32 penX = x;
+  f32 baseline = y + lineHeight;
+  for (usize pos = 0; pos < text.size();) {
+    const char32_t codepoint = nextCodepoint(text, pos);
+    if (codepoint == U'\n') {
+      penX = x;
+      baseline += lineHeight;
+      continue;
+    }
+
+    const CachedGlyph *glyph = m_glyphCache->getGlyph(font, codepoint);
+    if (!glyph) {
+      penX += missingAdvance;
+      continue;
+    }
+
+    if (glyph->page) {
+      const GlyphInfo &info = glyph->info;
+      Rect src{info.uv.x * pageSize, info.uv.y * pageSize,
+               info.uv.width * pageSize, info.uv.height * pageSize};
+      Transform2D transform;
+      transform.x = penX + info.bearingX;
+      transform.y = baseline - info.bearingY;
+      m_batch.addSprite(textureId(*glyph->page), pageSize, pageSize, src,
+                        transform, color);
+    }
+    penX += glyph->info.advanceX;
+  }
+}
+
+void BatchingRenderer::setFade(f32 alpha, const Color &color) {
+  Color fade = color;
+  fade.a = static_cast<u8>(std::clamp(alpha, 0.0f, 1.0f) * 255.0f);
+  m_batch.addRect(
+      Rect{0.0f, 0.0f, static_cast<f32>(m_width), static_cast<f32>(m_height)},
+      fade);
+}
+
+Result<void> BatchingRenderer::snapshot(Texture &target) {
+  auto pixels = readPixels();
+  if (pixels.isError()) {
+    return Result<void>::error(pixels.error());
+  }
+  const auto &image = pixels.value();
+  return target.loadFromRGBA(image.pixels.data(), image.width, image.height);
+}
+
+Result<DecodedImage> BatchingRenderer::readPixels() {
+  flushBatch();
+  return readFramebuffer();
+}
+
+Result<void> BatchingRenderer::beginRenderTarget(Texture &target,
+                                                 const Color &clearColor) {
+  if (m_renderTarget) {
+    return Result<void>::error("A render target is already active");
+  }
+
+  auto saved = snapshot(m_savedScreen);
+  if (saved.isError()) {
+    return saved;
+  }
+  m_renderTarget = &target;
+  clear(clearColor);
+  return Result<void>::ok();
+}
+
+Result<void> BatchingRenderer::endRenderTarget() {
+  if (!m_renderTarget) {
+    return Result<void>::error("No render target is active");
+  }
+
+  Texture *target = m_renderTarget;
+  m_renderTarget = nullptr;
+  auto captured = snapshot(*target);
+
+  // Put the screen back as it was before the target began
+  const BlendMode blend = m_batch.getBlendMode();
+  clear(Color::Transparent);
+  m_batch.setBlendMode(BlendMode::None);
+  drawSprite(m_savedScreen, Transform2D{});
+  m_batch.setBlendMode(blend);
+  return captured;
+}
+
+void BatchingRenderer::flushBatch() {
+  if (m_batch.empty()) {
+    return;
+  }
+  if (m_glyphCache) {
+    m_glyphCache->flushUploads();
+  }
+  m_batch.build();
+  submitBatch(m_batch);
+
+  const BatchStats &stats = m_batch.stats();
+  m_pendingStats.drawCalls += stats.drawCalls;
+  m_pendingStats.quads += stats.quads;
+  m_pendingStats.vertices += stats.vertices;
+  m_pendingStats.textureSwitches += stats.textureSwitches;
+  m_pendingStats.blendSwitches += stats.blendSwitches;
+  m_batch.clear();
+}
+
+void BatchingRenderer::finishFrame() {
+  if (m_renderTarget) {
+    NOVELMIND_LOG_WARN("Render target still active at the end of the frame");
+    (void)endRenderTarget();
+  }
+  flushBatch();
+  m_frameStats = m_pendingStats;
+  m_pendingStats = BatchStats{};
+  if (m_glyphCache) {
+    m_glyphCache->endFrame();
+  }
+}
+
+} // namespace NovelMind::renderer
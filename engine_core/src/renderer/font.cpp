@@ -1,7 +1,9 @@
 #include "NovelMind/renderer/font.hpp"
 #include "NovelMind/core/logger.hpp"
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <utility>
 
 #if defined(NOVELMIND_HAS_FREETYPE)
 #include <ft2build.h>
@@ -10,23 +12,38 @@
 
 namespace NovelMind::renderer {
 
+namespace {
+u64 nextFontId() {
+  static std::atomic<u64> counter{0};
+  return ++counter;
+}
+} // namespace
+
 Font::Font() : m_handle(nullptr), m_size(0) {}
 
 Font::~Font() { destroy(); }
 
 Font::Font(Font &&other) noexcept
-    : m_handle(other.m_handle), m_size(other.m_size) {
+    : m_handle(other.m_handle), m_library(other.m_library),
+      m_size(other.m_size), m_id(other.m_id), m_data(std::move(other.m_data)) {
   other.m_handle = nullptr;
+  other.m_library = nullptr;
   other.m_size = 0;
+  other.m_id = 0;
 }
 
 Font &Font::operator=(Font &&other) noexcept {
   if (this != &other) {
     destroy();
     m_handle = other.m_handle;
+    m_library = other.m_library;
     m_size = other.m_size;
+    m_id = other.m_id;
+    m_data = std::move(other.m_data);
     other.m_handle = nullptr;
+    other.m_library = nullptr;
     other.m_size = 0;
+    other.m_id = 0;
   }
   return *this;
 }
@@ -37,31 +54,39 @@ Result<void> Font::loadFromMemory(const std::vector<u8> &data, i32 size) {
   }
 
 #if defined(NOVELMIND_HAS_FREETYPE)
+  destroy();
+
   FT_Library ft;
   if (FT_Init_FreeType(&ft)) {
     return Result<void>::error("Failed to init FreeType");
   }
 
+  // The face keeps pointing into the buffer, so the font owns a copy
+  m_data = data;
   FT_Face face;
-  if (FT_New_Memory_Face(ft, reinterpret_cast<const FT_Byte *>(data.data()),
-                         static_cast<FT_Long>(data.size()), 0, &face)) {
+  if (FT_New_Memory_Face(ft, reinterpret_cast<const FT_Byte *>(m_data.data()),
+                         static_cast<FT_Long>(m_data.size()), 0, &face)) {
     FT_Done_FreeType(ft);
+    m_data.clear();
     return Result<void>::error("Failed to load font from memory");
   }
 
   if (FT_Set_Pixel_Sizes(face, 0, static_cast<FT_UInt>(size))) {
     FT_Done_Face(face);
     FT_Done_FreeType(ft);
+    m_data.clear();
     return Result<void>::error("Failed to set font pixel size");
   }
 
   m_handle = face;
   m_size = size;
   m_library = ft;
+  m_id = nextFontId();
   NOVELMIND_LOG_INFO("Font loaded via FreeType, size " + std::to_string(size));
   return Result<void>::ok();
 #else
   m_size = size;
+  m_id = nextFontId();
   NOVELMIND_LOG_WARN("FreeType not available, font metrics are placeholders");
   return Result<void>::ok();
 #endif
@@ -83,7 +108,9 @@ void Font::destroy() {
     // Font resource cleanup is handled by platform backend.
     m_handle = nullptr;
   }
+  m_data.clear();
   m_size = 0;
+  m_id = 0;
 }
 
 bool Font::isValid() const { return m_size > 0; }
@@ -0,0 +1,446 @@
+#include "NovelMind/renderer/glyph_cache.hpp"
+#include "NovelMind/core/logger.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#if defined(NOVELMIND_HAS_FREETYPE)
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+namespace NovelMind::renderer {
+
+namespace {
+
+/// Empty texels around every glyph so bilinear sampling never reaches a
+/// neighbour
+constexpr i32 GLYPH_PADDING = 1;
+constexpr char32_t REPLACEMENT_CHARACTER = 0xFFFD;
+
+} // namespace
+
+char32_t nextCodepoint(std::string_view text, usize &pos) {
+  const auto lead = static_cast<u8>(text[pos++]);
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  usize continuation = 0;
+  char32_t codepoint = 0;
+  if ((lead & 0xE0) == 0xC0) {
+    continuation = 1;
+    codepoint = lead & 0x1Fu;
+  } else if ((lead & 0xF0) == 0xE0) {
+    continuation = 2;
+    codepoint = lead & 0x0Fu;
+  } else if ((lead & 0xF8) == 0xF0) {
+    continuation = 3;
+    codepoint = lead & 0x07u;
+  } else {
+    return REPLACEMENT_CHARACTER;
+  }
+
+  if (pos + continuation > text.size()) {
+    return REPLACEMENT_CHARACTER;
+  }
+  for (usize i = 0; i < continuation; ++i) {
+    const auto next = static_cast<u8>(text[pos + i]);
+    if ((next & 0xC0) != 0x80) {
+      return REPLACEMENT_CHARACTER;
+    }
+    codepoint = (codepoint << 6) | (next & 0x3Fu);
+  }
+  pos += continuation;
+
+  // Overlong encodings, surrogates and values past U+10FFFF
+  static constexpr char32_t kMinimum[] = {0, 0x80, 0x800, 0x10000};
+  if (codepoint < kMinimum[continuation] || codepoint > 0x10FFFF ||
+      (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+    return REPLACEMENT_CHARACTER;
+  }
+  return codepoint;
+}
+
+usize countCodepoints(std::string_view text) {
+  usize count = 0;
+  for (usize pos = 0; pos < text.size(); ++count) {
+    (void)nextCodepoint(text, pos);
+  }
+  return count;
+}
+
+GlyphCache::GlyphCache(i32 pageSize, usize memoryBudget)
+    : m_pageSize(std::max(pageSize, 16)), m_memoryBudget(memoryBudget) {}
+
+GlyphCache::~GlyphCache() = default;
+
+const GlyphInfo *GlyphCache::getMetrics(const Font &font, char32_t codepoint) {
+  Entry *entry = findOrLoad(font, codepoint);
+  return entry ? &entry->glyph.info : nullptr;
+}
+
+const CachedGlyph *GlyphCache::getGlyph(const Font &font, char32_t codepoint) {
+  Entry *entry = findOrLoad(font, codepoint);
+  if (!entry) {
+    return nullptr;
+  }
+
+  if (entry->page) {
+    entry->page->lastUsed = m_frame;
+  } else if (!entry->oversized &&
+             (!entry->rasterized || (entry->glyph.info.width > 0.0f &&
+                                     entry->glyph.info.height > 0.0f))) {
+    // Not drawn yet, or its page was evicted
+    (void)place(font, codepoint, *entry);
+  }
+  return &entry->glyph;
+}
+
+f32 GlyphCache::getLineHeight(const Font &font) {
+  if (!font.isValid()) {
+    return 0.0f;
+  }
+  return fontGlyphs(font).lineHeight;
+}
+
+void GlyphCache::flushUploads() {
+  const usize rowTexels = static_cast<usize>(m_pageSize);
+  for (auto &page : m_pages) {
+    if (page->dirtyMaxY <= page->dirtyMinY) {
+      continue;
+    }
+
+    // Whole rows keep the staging copy contiguous; glyphs packed in the
+    // same frame usually share a shelf anyway
+    const i32 rows = page->dirtyMaxY - page->dirtyMinY;
+    const usize texels = rowTexels * static_cast<usize>(rows);
+    const u8 *coverage =
+        page->coverage.data() + rowTexels * static_cast<usize>(page->dirtyMinY);
+    m_uploadRows.resize(texels * 4);
+    for (usize i = 0; i < texels; ++i) {
+      u8 *texel = &m_uploadRows[i * 4];
+      texel[0] = 255;
+      texel[1] = 255;
+      texel[2] = 255;
+      texel[3] = coverage[i];
+    }
+
+    auto uploaded = page->texture.updateRegion(
+        m_uploadRows.data(), 0, page->dirtyMinY, m_pageSize, rows);
+    if (uploaded.isError()) {
+      NOVELMIND_LOG_WARN("Glyph page upload failed: " + uploaded.error());
+    } else {
+      ++m_stats.uploads;
+      m_stats.uploadedBytes += texels * 4;
+    }
+    page->dirtyMinY = 0;
+    page->dirtyMaxY = 0;
+  }
+}
+
+void GlyphCache::endFrame() {
+  ++m_frame;
+
+  // Pages allocated over budget while every page was in use go first
+  while (m_pages.size() > maxPages()) {
+    usize oldest = 0;
+    for (usize i = 1; i < m_pages.size(); ++i) {
+      if (m_pages[i]->lastUsed < m_pages[oldest]->lastUsed) {
+        oldest = i;
+      }
+    }
+    destroyPage(oldest);
+  }
+}
+
+void GlyphCache::releaseFont(const Font &font) {
+  auto it = m_fonts.find(font.getId());
+  if (it == m_fonts.end()) {
+    return;
+  }
+
+  // The glyphs' page space is reclaimed when their page is evicted
+  const u64 id = font.getId();
+  for (auto &page : m_pages) {
+    auto &entries = page->entries;
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [id](const Entry *entry) {
+                                   return entry->fontId == id;
+                                 }),
+                  entries.end());
+  }
+  m_fonts.erase(it);
+}
+
+void GlyphCache::clear() {
+  m_fonts.clear();
+  m_pages.clear();
+}
+
+void GlyphCache::setMemoryBudget(usize bytes) { m_memoryBudget = bytes; }
+
+usize GlyphCache::getMemoryUsage() const {
+  return m_pages.size() * static_cast<usize>(m_pageSize) *
+         static_cast<usize>(m_pageSize) * 4;
+}
+
+GlyphCacheStats GlyphCache::getStats() const {
+  GlyphCacheStats stats = m_stats;
+  stats.pages = m_pages.size();
+  for (const auto &page : m_pages) {
+    stats.residentGlyphs += page->entries.size();
+  }
+  return stats;
+}
+
+GlyphCache::FontGlyphs &GlyphCache::fontGlyphs(const Font &font) {
+  auto [it, inserted] = m_fonts.try_emplace(font.getId());
+  if (inserted) {
+    it->second.lineHeight = static_cast<f32>(font.getSize());
+#if defined(NOVELMIND_HAS_FREETYPE)
+    auto *face = static_cast<FT_Face>(font.getNativeHandle());
+    if (face && face->size) {
+      it->second.lineHeight =
+          static_cast<f32>(face->size->metrics.height / 64); // 26.6 fixed
+    }
+#endif
+  }
+  return it->second;
+}
+
+GlyphCache::Entry *GlyphCache::findOrLoad(const Font &font,
+                                          char32_t codepoint) {
+  if (!font.isValid()) {
+    return nullptr;
+  }
+
+  auto &glyphs = fontGlyphs(font).glyphs;
+  auto it = glyphs.find(codepoint);
+  if (it != glyphs.end()) {
+    return it->second.missing ? nullptr : &it->second;
+  }
+
+  Entry &entry = glyphs[codepoint];
+  entry.fontId = font.getId();
+#if defined(NOVELMIND_HAS_FREETYPE)
+  auto *face = static_cast<FT_Face>(font.getNativeHandle());
+  if (!face ||
+      FT_Load_Char(face, static_cast<FT_ULong>(codepoint), FT_LOAD_DEFAULT)) {
+    entry.missing = true;
+    return nullptr;
+  }
+
+  // Outline metrics are enough for layout; place() replaces them with the
+  // bitmap's once the glyph is drawn
+  const FT_GlyphSlot slot = face->glyph;
+  GlyphInfo &info = entry.glyph.info;
+  info.advanceX = static_cast<f32>(slot->advance.x) / 64.0f;
+  info.bearingX = static_cast<f32>(slot->metrics.horiBearingX) / 64.0f;
+  info.bearingY = static_cast<f32>(slot->metrics.horiBearingY) / 64.0f;
+  info.width = static_cast<f32>(slot->metrics.width) / 64.0f;
+  info.height = static_cast<f32>(slot->metrics.height) / 64.0f;
+  return &entry;
+#else
+  entry.missing = true;
+  return nullptr;
+#endif
+}
+
+bool GlyphCache::place(const Font &font, char32_t codepoint, Entry &entry) {
+#if defined(NOVELMIND_HAS_FREETYPE)
+  auto *face = static_cast<FT_Face>(font.getNativeHandle());
+  if (!face ||
+      FT_Load_Char(face, static_cast<FT_ULong>(codepoint), FT_LOAD_RENDER)) {
+    return false;
+  }
+  ++m_stats.rasterized;
+
+  const FT_GlyphSlot slot = face->glyph;
+  const FT_Bitmap &bitmap = slot->bitmap;
+  const i32 width = static_cast<i32>(bitmap.width);
+  const i32 height = static_cast<i32>(bitmap.rows);
+
+  GlyphInfo &info = entry.glyph.info;
+  info.advanceX = static_cast<f32>(slot->advance.x) / 64.0f;
+  info.bearingX = static_cast<f32>(slot->bitmap_left);
+  info.bearingY = static_cast<f32>(slot->bitmap_top);
+  info.width = static_cast<f32>(width);
+  info.height = static_cast<f32>(height);
+  info.uv = Rect(0, 0, 0, 0);
+  entry.rasterized = true;
+  if (width == 0 || height == 0) {
+    return true;
+  }
+
+  const i32 slotWidth = width + GLYPH_PADDING * 2;
+  const i32 slotHeight = height + GLYPH_PADDING * 2;
+  if (slotWidth > m_pageSize || slotHeight > m_pageSize) {
+    NOVELMIND_LOG_WARN("Glyph " + std::to_string(static_cast<u32>(codepoint)) +
+                       " does not fit on a glyph cache page");
+    entry.oversized = true;
+    return false;
+  }
+
+  i32 slotX = 0;
+  i32 slotY = 0;
+  Page *page = allocate(slotWidth, slotHeight, slotX, slotY);
+  if (!page) {
+    return false;
+  }
+
+  // The whole slot is written, so the padding never shows what a glyph
+  // from an evicted page left behind
+  const usize pageWidth = static_cast<usize>(m_pageSize);
+  const bool mono = bitmap.pixel_mode == FT_PIXEL_MODE_MONO;
+  for (i32 row = 0; row < slotHeight; ++row) {
+    u8 *dst = page->coverage.data() +
+              static_cast<usize>(slotY + row) * pageWidth +
+              static_cast<usize>(slotX);
+    std::memset(dst, 0, static_cast<usize>(slotWidth));
+
+    const i32 srcRow = row - GLYPH_PADDING;
+    if (srcRow < 0 || srcRow >= height) {
+      continue;
+    }
+    const u8 *src = bitmap.buffer + srcRow * bitmap.pitch;
+    for (i32 x = 0; x < width; ++x) {
+      dst[GLYPH_PADDING + x] =
+          mono ? static_cast<u8>(((src[x >> 3] >> (7 - (x & 7))) & 1) * 255)
+               : src[x];
+    }
+  }
+
+  if (page->dirtyMaxY <= page->dirtyMinY) {
+    page->dirtyMinY = slotY;
+    page->dirtyMaxY = slotY + slotHeight;
+  } else {
+    page->dirtyMinY = std::min(page->dirtyMinY, slotY);
+    page->dirtyMaxY = std::max(page->dirtyMaxY, slotY + slotHeight);
+  }
+
+  page->lastUsed = m_frame;
+  page->entries.push_back(&entry);
+  entry.page = page;
+  entry.glyph.page = &page->texture;
+
+  const f32 size = static_cast<f32>(m_pageSize);
+  info.uv = Rect(static_cast<f32>(slotX + GLYPH_PADDING) / size,
+                 static_cast<f32>(slotY + GLYPH_PADDING) / size,
+                 static_cast<f32>(width) / size,
+                 static_cast<f32>(height) / size);
+  return true;
+#else
+  (void)font;
+  (void)codepoint;
+  (void)entry;
+  return false;
+#endif
+}
+
+GlyphCache::Page *GlyphCache::allocate(i32 width, i32 height, i32 &x,
+                                       i32 &y) {
+  for (auto &page : m_pages) {
+    if (pack(*page, width, height, x, y)) {
+      return page.get();
+    }
+  }
+
+  if (m_pages.size() >= maxPages()) {
+    // Recycle the least recently used page not drawn from this frame
+    Page *oldest = nullptr;
+    for (auto &page : m_pages) {
+      if (page->lastUsed < m_frame &&
+          (!oldest || page->lastUsed < oldest->lastUsed)) {
+        oldest = page.get();
+      }
+    }
+    if (oldest) {
+      evict(*oldest);
+      return pack(*oldest, width, height, x, y) ? oldest : nullptr;
+    }
+
+    if (!m_warnedOverBudget) {
+      NOVELMIND_LOG_WARN("Glyph cache over budget: every page is in use by "
+                         "the current frame");
+      m_warnedOverBudget = true;
+    }
+  }
+
+  Page *page = newPage();
+  return page && pack(*page, width, height, x, y) ? page : nullptr;
+}
+
+bool GlyphCache::pack(Page &page, i32 width, i32 height, i32 &x,
+                      i32 &y) const {
+  Shelf *best = nullptr;
+  for (auto &shelf : page.shelves) {
+    if (shelf.height >= height && shelf.x + width <= m_pageSize &&
+        (!best || shelf.height < best->height)) {
+      best = &shelf;
+    }
+  }
+
+  // Rather open a new shelf than waste most of a much taller one
+  const bool shelfFits = page.nextShelfY + height <= m_pageSize;
+  if (best && (best->height <= height + height / 2 || !shelfFits)) {
+    x = best->x;
+    y = best->y;
+    best->x += width;
+    return true;
+  }
+  if (!shelfFits) {
+    return false;
+  }
+
+  page.shelves.push_back(Shelf{page.nextShelfY, height, width});
+  x = 0;
+  y = page.nextShelfY;
+  page.nextShelfY += height;
+  return true;
+}
+
+GlyphCache::Page *GlyphCache::newPage() {
+  const usize texels =
+      static_cast<usize>(m_pageSize) * static_cast<usize>(m_pageSize);
+  auto page = std::make_unique<Page>();
+  page->coverage.assign(texels, 0);
+
+  // Created up front so the page has a texture identity to batch against
+  m_uploadRows.assign(texels * 4, 0);
+  auto created =
+      page->texture.loadFromRGBA(m_uploadRows.data(), m_pageSize, m_pageSize);
+  if (created.isError()) {
+    NOVELMIND_LOG_WARN("Failed to create glyph cache page: " +
+                       created.error());
+    return nullptr;
+  }
+
+  page->lastUsed = m_frame;
+  m_pages.push_back(std::move(page));
+  return m_pages.back().get();
+}
+
+void GlyphCache::evict(Page &page) {
+  for (Entry *entry : page.entries) {
+    entry->page = nullptr;
+    entry->glyph.page = nullptr;
+  }
+  page.entries.clear();
+  page.shelves.clear();
+  page.nextShelfY = 0;
+  ++m_stats.evictedPages;
+}
+
+void GlyphCache::destroyPage(usize index) {
+  evict(*m_pages[index]);
+  m_pages.erase(m_pages.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+usize GlyphCache::maxPages() const {
+  const usize pageBytes =
+      static_cast<usize>(m_pageSize) * static_cast<usize>(m_pageSize) * 4;
+  return std::max<usize>(1, m_memoryBudget / pageBytes);
+}
+
+} // namespace NovelMind::renderer
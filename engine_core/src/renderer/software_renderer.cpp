@@ -0,0 +1,580 @@
+#include "NovelMind/renderer/software_renderer.hpp"
+#include "NovelMind/core/checksum.hpp"
+#include "NovelMind/core/logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#if defined(NOVELMIND_HAS_ZLIB)
+#include <zlib.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NOVELMIND_SOFTWARE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace NovelMind::renderer {
+
+namespace {
+
+/// x / 255 rounded, exact for x <= 255 * 255
+inline u32 div255(u32 x) {
+  x += 128;
+  return (x + (x >> 8)) >> 8;
+}
+
+inline u32 loadPixel(const u8 *p) {
+  u32 value;
+  std::memcpy(&value, p, 4);
+  return value;
+}
+
+inline void storePixel(u8 *p, u32 value) { std::memcpy(p, &value, 4); }
+
+inline u32 packColor(const Color &color) {
+  const u8 bytes[4] = {color.r, color.g, color.b, color.a};
+  return loadPixel(bytes);
+}
+
+/**
+ * @brief Blend one pixel the way the matching glBlendFunc does
+ *
+ * None: src. Alpha: src * a + dst * (1 - a). Additive: dst + src * a.
+ * Multiply: src * dst + dst * (1 - a). Saturating. Unlike GL, the alpha
+ * channel is not weighted by itself (src.a + dst.a * (1 - a) for Alpha),
+ * so a frame cleared opaque stays opaque in screenshots.
+ */
+inline void blendPixel(u8 *dst, const u8 *src, BlendMode mode) {
+  const u32 a = src[3];
+  for (int c = 0; c < 4; ++c) {
+    const u32 s = src[c];
+    const u32 d = dst[c];
+    const u32 weight = c == 3 ? 255 : a;
+    u32 result = s;
+    switch (mode) {
+    case BlendMode::None:
+      break;
+    case BlendMode::Alpha:
+      result = div255(s * weight + d * (255 - a));
+      break;
+    case BlendMode::Additive:
+      result = std::min(d + div255(s * weight), 255u);
+      break;
+    case BlendMode::Multiply:
+      result = std::min(div255(s * d) + div255(d * (255 - a)), 255u);
+      break;
+    }
+    dst[c] = static_cast<u8>(result);
+  }
+}
+
+#ifdef NOVELMIND_SOFTWARE_SSE2
+
+inline __m128i div255x8(__m128i x) {
+  x = _mm_add_epi16(x, _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+/// Two pixels widened to eight 16-bit lanes; same math as blendPixel()
+inline __m128i blendLanes(__m128i s, __m128i d, BlendMode mode) {
+  const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+  const __m128i inverse = _mm_sub_epi16(_mm_set1_epi16(255), a);
+  // The alpha lanes are weighted by 255 instead of by themselves
+  const __m128i weight =
+      _mm_max_epi16(a, _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0));
+  switch (mode) {
+  case BlendMode::None:
+    return s;
+  case BlendMode::Alpha:
+    return div255x8(
+        _mm_add_epi16(_mm_mullo_epi16(s, weight), _mm_mullo_epi16(d, inverse)));
+  case BlendMode::Additive:
+    return _mm_add_epi16(d, div255x8(_mm_mullo_epi16(s, weight)));
+  case BlendMode::Multiply:
+    return _mm_add_epi16(div255x8(_mm_mullo_epi16(s, d)),
+                         div255x8(_mm_mullo_epi16(d, inverse)));
+  }
+  return s;
+}
+
+#endif // NOVELMIND_SOFTWARE_SSE2
+
+/**
+ * @brief Modulate @p count pixels by @p tint and blend them into @p dst
+ *
+ * With @p src null the source is the solid @p tint itself.
+ */
+void blendRow(u8 *dst, const u8 *src, usize count, const Color &tint,
+              BlendMode mode) {
+  const bool solid = src == nullptr;
+  const u8 tintBytes[4] = {tint.r, tint.g, tint.b, tint.a};
+  const bool modulate = !solid && tint != Color::White;
+
+  if (solid) {
+    if (tint.a == 0 &&
+        (mode == BlendMode::Alpha || mode == BlendMode::Additive)) {
+      return;
+    }
+    if (mode == BlendMode::None ||
+        (mode == BlendMode::Alpha && tint.a == 255)) {
+      const u32 value = packColor(tint);
+      for (usize i = 0; i < count; ++i) {
+        storePixel(dst + i * 4, value);
+      }
+      return;
+    }
+  }
+
+  usize i = 0;
+#ifdef NOVELMIND_SOFTWARE_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+  const __m128i solidPixels = _mm_set1_epi32(static_cast<int>(packColor(tint)));
+  const __m128i tintLanes = _mm_unpacklo_epi8(solidPixels, zero);
+
+  for (; i + 4 <= count; i += 4) {
+    u8 *out = dst + i * 4;
+    __m128i s = solidPixels;
+    if (!solid) {
+      s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 4));
+      if (modulate) {
+        s = _mm_packus_epi16(
+            div255x8(_mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), tintLanes)),
+            div255x8(_mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), tintLanes)));
+      }
+      if (mode == BlendMode::Alpha || mode == BlendMode::Additive) {
+        const int opaque =
+            _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(s, alphaMask),
+                                             alphaMask));
+        const int clear =
+            _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(s, alphaMask), zero));
+        if (clear == 0xFFFF) {
+          continue;
+        }
+        if (mode == BlendMode::Alpha && opaque == 0xFFFF) {
+          _mm_storeu_si128(reinterpret_cast<__m128i *>(out), s);
+          continue;
+        }
+      }
+    }
+
+    const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(out));
+    const __m128i lo = blendLanes(_mm_unpacklo_epi8(s, zero),
+                                  _mm_unpacklo_epi8(d, zero), mode);
+    const __m128i hi = blendLanes(_mm_unpackhi_epi8(s, zero),
+                                  _mm_unpackhi_epi8(d, zero), mode);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out),
+                     _mm_packus_epi16(lo, hi));
+  }
+#endif
+
+  for (; i < count; ++i) {
+    u8 pixel[4] = {tint.r, tint.g, tint.b, tint.a};
+    if (!solid) {
+      std::memcpy(pixel, src + i * 4, 4);
+      if (modulate) {
+        for (int c = 0; c < 4; ++c) {
+          pixel[c] = static_cast<u8>(div255(u32{pixel[c]} * tintBytes[c]));
+        }
+      }
+    }
+    blendPixel(dst + i * 4, pixel, mode);
+  }
+}
+
+/// Per-byte lerp of two packed pixels, @p weight in [0, 256]
+inline u32 lerpPixel(u32 a, u32 b, u32 weight) {
+  const u32 inverse = 256 - weight;
+  const u32 rb =
+      (((a & 0x00FF00FFu) * inverse + (b & 0x00FF00FFu) * weight) >> 8) &
+      0x00FF00FFu;
+  const u32 ga = (((a >> 8) & 0x00FF00FFu) * inverse +
+                  ((b >> 8) & 0x00FF00FFu) * weight) &
+                 0xFF00FF00u;
+  return rb | ga;
+}
+
+struct TextureView {
+  const u8 *texels = nullptr;
+  i32 width = 0;
+  i32 height = 0;
+
+  [[nodiscard]] u32 texel(i32 x, i32 y) const {
+    x = std::clamp(x, 0, width - 1);
+    y = std::clamp(y, 0, height - 1);
+    return loadPixel(texels + (static_cast<usize>(y) * static_cast<usize>(width) +
+                               static_cast<usize>(x)) *
+                                  4);
+  }
+
+  /// Bilinear sample at texel-space (tx, ty), texel centers on integers
+  [[nodiscard]] u32 sample(f32 tx, f32 ty) const {
+    const f32 fx = std::floor(tx);
+    const f32 fy = std::floor(ty);
+    const i32 x = static_cast<i32>(fx);
+    const i32 y = static_cast<i32>(fy);
+    const u32 wx = static_cast<u32>((tx - fx) * 256.0f);
+    const u32 wy = static_cast<u32>((ty - fy) * 256.0f);
+    const u32 top = lerpPixel(texel(x, y), texel(x + 1, y), wx);
+    const u32 bottom = lerpPixel(texel(x, y + 1), texel(x + 1, y + 1), wx);
+    return lerpPixel(top, bottom, wy);
+  }
+};
+
+/**
+ * @brief Sample @p count texels along a row into @p out
+ *
+ * Spans that land on texel centers one texel apart (unscaled, unrotated
+ * sprites at whole-pixel positions) are copied without filtering.
+ */
+void sampleSpan(const TextureView &view, f32 tx, f32 ty, f32 stepX, f32 stepY,
+                usize count, u8 *out) {
+  const f32 n = static_cast<f32>(count);
+  const f32 roundX = std::round(tx);
+  const f32 roundY = std::round(ty);
+  if (std::abs(stepX - 1.0f) * n < 0.01f && std::abs(stepY) * n < 0.01f &&
+      std::abs(tx - roundX) < 0.01f && std::abs(ty - roundY) < 0.01f) {
+    const i32 x = static_cast<i32>(roundX);
+    const i32 y = std::clamp(static_cast<i32>(roundY), 0, view.height - 1);
+    if (x >= 0 && static_cast<i64>(x) + static_cast<i64>(count) <= view.width) {
+      std::memcpy(out,
+                  view.texels + (static_cast<usize>(y) *
+                                     static_cast<usize>(view.width) +
+                                 static_cast<usize>(x)) *
+                                    4,
+                  count * 4);
+      return;
+    }
+    for (usize i = 0; i < count; ++i) {
+      storePixel(out + i * 4, view.texel(x + static_cast<i32>(i), y));
+    }
+    return;
+  }
+
+  for (usize i = 0; i < count; ++i) {
+    const f32 k = static_cast<f32>(i);
+    storePixel(out + i * 4, view.sample(tx + k * stepX, ty + k * stepY));
+  }
+}
+
+/// Narrow [lo, hi) to the steps k where 0 <= start + k * step < 1
+void clipToUnit(f32 start, f32 step, i32 &lo, i32 &hi) {
+  if (std::abs(step) < 1e-12f) {
+    if (start < 0.0f || start >= 1.0f) {
+      hi = lo;
+    }
+    return;
+  }
+
+  const f32 atZero = -start / step;
+  const f32 atOne = (1.0f - start) / step;
+  f32 first = 0.0f;
+  f32 last = 0.0f;
+  if (step > 0.0f) {
+    first = std::ceil(atZero);
+    last = std::ceil(atOne);
+  } else {
+    first = std::floor(atOne) + 1.0f;
+    last = std::floor(atZero) + 1.0f;
+  }
+  const f32 lower = static_cast<f32>(lo);
+  const f32 upper = static_cast<f32>(hi);
+  lo = static_cast<i32>(std::clamp(first, lower, upper));
+  hi = static_cast<i32>(std::clamp(last, lower, upper));
+}
+
+void appendU32(std::vector<u8> &out, u32 value) {
+  out.push_back(static_cast<u8>(value >> 24));
+  out.push_back(static_cast<u8>(value >> 16));
+  out.push_back(static_cast<u8>(value >> 8));
+  out.push_back(static_cast<u8>(value));
+}
+
+void appendChunk(std::vector<u8> &out, const char *type, const u8 *data,
+                 usize size) {
+  appendU32(out, static_cast<u32>(size));
+  const usize start = out.size();
+  out.insert(out.end(), type, type + 4);
+  if (size > 0) {
+    out.insert(out.end(), data, data + size);
+  }
+  appendU32(out, core::crc32(out.data() + start, size + 4));
+}
+
+#if !defined(NOVELMIND_HAS_ZLIB)
+/// zlib stream of uncompressed deflate blocks
+std::vector<u8> storeZlib(const std::vector<u8> &raw) {
+  constexpr usize MAX_BLOCK = 65535;
+  std::vector<u8> out{0x78, 0x01};
+  out.reserve(raw.size() + raw.size() / MAX_BLOCK * 5 + 16);
+
+  usize pos = 0;
+  do {
+    const usize block = std::min(raw.size() - pos, MAX_BLOCK);
+    const bool final = pos + block == raw.size();
+    out.push_back(final ? 1 : 0);
+    out.push_back(static_cast<u8>(block));
+    out.push_back(static_cast<u8>(block >> 8));
+    out.push_back(static_cast<u8>(~block));
+    out.push_back(static_cast<u8>(~block >> 8));
+    out.insert(out.end(), raw.begin() + static_cast<std::ptrdiff_t>(pos),
+               raw.begin() + static_cast<std::ptrdiff_t>(pos + block));
+    pos += block;
+  } while (pos < raw.size());
+
+  // Adler-32, reduced every 5552 bytes so the sums cannot overflow
+  u32 a = 1;
+  u32 b = 0;
+  for (usize i = 0; i < raw.size();) {
+    const usize end = std::min(raw.size(), i + 5552);
+    for (; i < end; ++i) {
+      a += raw[i];
+      b += a;
+    }
+    a %= 65521;
+    b %= 65521;
+  }
+  appendU32(out, (b << 16) | a);
+  return out;
+}
+#endif
+
+} // namespace
+
+Result<void> SoftwareRenderer::initialize(platform::IWindow &window) {
+  return initialize(window.getWidth(), window.getHeight());
+}
+
+Result<void> SoftwareRenderer::initialize(i32 width, i32 height) {
+  if (width <= 0 || height <= 0) {
+    return Result<void>::error("Invalid software framebuffer size");
+  }
+
+  m_width = width;
+  m_height = height;
+  m_pixels.assign(static_cast<usize>(width) * static_cast<usize>(height) * 4,
+                  0);
+  m_span.resize(static_cast<usize>(width) * 4);
+  NOVELMIND_LOG_INFO("Software renderer initialized (" +
+                     std::to_string(width) + "x" + std::to_string(height) +
+                     ")");
+  return Result<void>::ok();
+}
+
+void SoftwareRenderer::shutdown() {
+  discardBatch();
+  m_pixels.clear();
+  m_pixels.shrink_to_fit();
+  m_span.clear();
+  m_width = 0;
+  m_height = 0;
+}
+
+void SoftwareRenderer::beginFrame() { clear(Color(13, 13, 15)); }
+
+void SoftwareRenderer::endFrame() { finishFrame(); }
+
+void SoftwareRenderer::clear(const Color &color) {
+  discardBatch();
+  const u32 value = packColor(color);
+  for (usize i = 0; i < m_pixels.size(); i += 4) {
+    storePixel(m_pixels.data() + i, value);
+  }
+}
+
+Color SoftwareRenderer::getPixel(i32 x, i32 y) const {
+  if (x < 0 || y < 0 || x >= m_width || y >= m_height) {
+    return Color::Transparent;
+  }
+  const u8 *p = m_pixels.data() + (static_cast<usize>(y) *
+                                       static_cast<usize>(m_width) +
+                                   static_cast<usize>(x)) *
+                                      4;
+  return Color(p[0], p[1], p[2], p[3]);
+}
+
+Result<DecodedImage> SoftwareRenderer::readFramebuffer() {
+  if (m_pixels.empty()) {
+    return Result<DecodedImage>::error("Software renderer not initialized");
+  }
+  DecodedImage image;
+  image.pixels = m_pixels;
+  image.width = m_width;
+  image.height = m_height;
+  return Result<DecodedImage>::ok(std::move(image));
+}
+
+Result<void> SoftwareRenderer::savePng(const std::string &path) const {
+  auto png = encodePng(m_pixels.data(), m_width, m_height);
+  if (png.isError()) {
+    return Result<void>::error(png.error());
+  }
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return Result<void>::error("Failed to open " + path + " for writing");
+  }
+  const auto &data = png.value();
+  file.write(reinterpret_cast<const char *>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  if (!file) {
+    return Result<void>::error("Failed to write " + path);
+  }
+  return Result<void>::ok();
+}
+
+void SoftwareRenderer::submitBatch(const SpriteBatch &batch) {
+  if (m_pixels.empty()) {
+    return;
+  }
+
+  const auto &vertices = batch.vertices();
+  for (const auto &draw : batch.batches()) {
+    const auto *texture = static_cast<const Texture *>(draw.texture);
+    if (texture && texture->getPixels().size() <
+                       static_cast<usize>(texture->getWidth()) *
+                           static_cast<usize>(texture->getHeight()) * 4) {
+      if (!m_warnedGpuTexture) {
+        NOVELMIND_LOG_WARN("Software renderer skipped a texture without CPU "
+                           "pixels (created with a GL context current)");
+        m_warnedGpuTexture = true;
+      }
+      continue;
+    }
+
+    for (u32 v = 0; v < draw.vertexCount; v += 4) {
+      drawQuad(&vertices[draw.firstVertex + v], texture, draw.blend);
+    }
+  }
+}
+
+void SoftwareRenderer::drawQuad(const BatchVertex *quad, const Texture *texture,
+                                BlendMode blend) {
+  // Quads are parallelograms: corner 1 lies along the s (u) edge from
+  // corner 0 and corner 3 along the t (v) edge
+  const BatchVertex &origin = quad[0];
+  const f32 e1x = quad[1].x - origin.x;
+  const f32 e1y = quad[1].y - origin.y;
+  const f32 e2x = quad[3].x - origin.x;
+  const f32 e2y = quad[3].y - origin.y;
+  const f32 det = e1x * e2y - e1y * e2x;
+  if (std::abs(det) < 1e-6f) {
+    return;
+  }
+  const f32 inv = 1.0f / det;
+  const f32 dsdx = e2y * inv;
+  const f32 dtdx = -e1y * inv;
+
+  f32 minX = origin.x;
+  f32 maxX = origin.x;
+  f32 minY = origin.y;
+  f32 maxY = origin.y;
+  for (int i = 1; i < 4; ++i) {
+    minX = std::min(minX, quad[i].x);
+    maxX = std::max(maxX, quad[i].x);
+    minY = std::min(minY, quad[i].y);
+    maxY = std::max(maxY, quad[i].y);
+  }
+
+  // Pixels whose centers fall inside the quad
+  const f32 width = static_cast<f32>(m_width);
+  const f32 height = static_cast<f32>(m_height);
+  const i32 x0 = static_cast<i32>(std::ceil(std::clamp(minX - 0.5f, 0.0f, width)));
+  const i32 x1 = static_cast<i32>(std::ceil(std::clamp(maxX - 0.5f, 0.0f, width)));
+  const i32 y0 = static_cast<i32>(std::ceil(std::clamp(minY - 0.5f, 0.0f, height)));
+  const i32 y1 = static_cast<i32>(std::ceil(std::clamp(maxY - 0.5f, 0.0f, height)));
+  if (x0 >= x1 || y0 >= y1) {
+    return;
+  }
+
+  TextureView view;
+  f32 txBase = 0.0f;
+  f32 txScale = 0.0f;
+  f32 tyBase = 0.0f;
+  f32 tyScale = 0.0f;
+  if (texture) {
+    view.texels = texture->getPixels().data();
+    view.width = texture->getWidth();
+    view.height = texture->getHeight();
+    const f32 tw = static_cast<f32>(view.width);
+    const f32 th = static_cast<f32>(view.height);
+    txBase = origin.u * tw - 0.5f;
+    txScale = (quad[1].u - origin.u) * tw;
+    tyBase = origin.v * th - 0.5f;
+    tyScale = (quad[3].v - origin.v) * th;
+  }
+
+  const usize stride = static_cast<usize>(m_width) * 4;
+  for (i32 y = y0; y < y1; ++y) {
+    const f32 px = static_cast<f32>(x0) + 0.5f - origin.x;
+    const f32 py = static_cast<f32>(y) + 0.5f - origin.y;
+    const f32 s = (px * e2y - py * e2x) * inv;
+    const f32 t = (e1x * py - e1y * px) * inv;
+
+    i32 lo = 0;
+    i32 hi = x1 - x0;
+    clipToUnit(s, dsdx, lo, hi);
+    clipToUnit(t, dtdx, lo, hi);
+    if (lo >= hi) {
+      continue;
+    }
+
+    const usize count = static_cast<usize>(hi - lo);
+    u8 *dst = m_pixels.data() + static_cast<usize>(y) * stride +
+              static_cast<usize>(x0 + lo) * 4;
+    if (!texture) {
+      blendRow(dst, nullptr, count, origin.color, blend);
+      continue;
+    }
+
+    const f32 first = static_cast<f32>(lo);
+    sampleSpan(view, txBase + txScale * (s + first * dsdx),
+               tyBase + tyScale * (t + first * dtdx), txScale * dsdx,
+               tyScale * dtdx, count, m_span.data());
+    blendRow(dst, m_span.data(), count, origin.color, blend);
+  }
+}
+
+Result<std::vector<u8>> encodePng(const u8 *rgba, i32 width, i32 height) {
+  if (!rgba || width <= 0 || height <= 0) {
+    return Result<std::vector<u8>>::error("Invalid image for PNG encoding");
+  }
+
+  // Every scanline gets filter type 0 (None)
+  const usize rowBytes = static_cast<usize>(width) * 4;
+  std::vector<u8> raw;
+  raw.reserve((rowBytes + 1) * static_cast<usize>(height));
+  for (i32 y = 0; y < height; ++y) {
+    const u8 *row = rgba + static_cast<usize>(y) * rowBytes;
+    raw.push_back(0);
+    raw.insert(raw.end(), row, row + rowBytes);
+  }
+
+  std::vector<u8> compressed;
+#if defined(NOVELMIND_HAS_ZLIB)
+  uLongf compressedSize = compressBound(static_cast<uLong>(raw.size()));
+  compressed.resize(compressedSize);
+  if (compress2(compressed.data(), &compressedSize, raw.data(),
+                static_cast<uLong>(raw.size()), Z_BEST_SPEED) != Z_OK) {
+    return Result<std::vector<u8>>::error("PNG compression failed");
+  }
+  compressed.resize(compressedSize);
+#else
+  compressed = storeZlib(raw);
+#endif
+
+  std::vector<u8> png{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  std::vector<u8> header;
+  appendU32(header, static_cast<u32>(width));
+  appendU32(header, static_cast<u32>(height));
+  header.insert(header.end(), {8, 6, 0, 0, 0}); // 8-bit RGBA, no interlace
+  appendChunk(png, "IHDR", header.data(), header.size());
+  appendChunk(png, "IDAT", compressed.data(), compressed.size());
+  appendChunk(png, "IEND", nullptr, 0);
+  return Result<std::vector<u8>>::ok(std::move(png));
+}
+
+} // namespace NovelMind::renderer
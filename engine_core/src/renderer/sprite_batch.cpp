@@ -0,0 +1,155 @@
+#include "NovelMind/renderer/sprite_batch.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace NovelMind::renderer {
+
+namespace {
+
+constexpr f32 DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+bool overlaps(f32 aMinX, f32 aMinY, f32 aMaxX, f32 aMaxY, f32 bMinX, f32 bMinY,
+              f32 bMaxX, f32 bMaxY) {
+  return aMinX < bMaxX && bMinX < aMaxX && aMinY < bMaxY && bMinY < aMaxY;
+}
+
+} // namespace
+
+void SpriteBatch::clear() {
+  m_quads.clear();
+  m_batches.clear();
+  m_batchBounds.clear();
+  m_vertices.clear();
+}
+
+void SpriteBatch::addSprite(TextureId texture, f32 textureWidth,
+                            f32 textureHeight, const Rect &sourceRect,
+                            const Transform2D &transform, const Color &tint) {
+  if (textureWidth <= 0.0f || textureHeight <= 0.0f) {
+    return;
+  }
+
+  const f32 u0 = sourceRect.x / textureWidth;
+  const f32 v0 = sourceRect.y / textureHeight;
+  const f32 u1 = (sourceRect.x + sourceRect.width) / textureWidth;
+  const f32 v1 = (sourceRect.y + sourceRect.height) / textureHeight;
+
+  const f32 angle = transform.rotation * DEG_TO_RAD;
+  const f32 cosA = std::cos(angle);
+  const f32 sinA = std::sin(angle);
+  auto place = [&](f32 localX, f32 localY, f32 u, f32 v) {
+    const f32 sx = (localX - transform.anchorX) * transform.scaleX;
+    const f32 sy = (localY - transform.anchorY) * transform.scaleY;
+    return BatchVertex{transform.x + sx * cosA - sy * sinA,
+                       transform.y + sx * sinA + sy * cosA, u, v, tint};
+  };
+
+  const BatchVertex corners[4] = {
+      place(0.0f, 0.0f, u0, v0),
+      place(sourceRect.width, 0.0f, u1, v0),
+      place(sourceRect.width, sourceRect.height, u1, v1),
+      place(0.0f, sourceRect.height, u0, v1)};
+  addQuad(texture, corners);
+}
+
+void SpriteBatch::addRect(const Rect &rect, const Color &color) {
+  const f32 x1 = rect.x + rect.width;
+  const f32 y1 = rect.y + rect.height;
+  const BatchVertex corners[4] = {{rect.x, rect.y, 0.0f, 0.0f, color},
+                                  {x1, rect.y, 0.0f, 0.0f, color},
+                                  {x1, y1, 0.0f, 0.0f, color},
+                                  {rect.x, y1, 0.0f, 0.0f, color}};
+  addQuad(nullptr, corners);
+}
+
+void SpriteBatch::addOutline(const Rect &rect, const Color &color,
+                             f32 thickness) {
+  const f32 inner = std::max(rect.height - thickness * 2.0f, 0.0f);
+  addRect(Rect{rect.x, rect.y, rect.width, thickness}, color);
+  addRect(Rect{rect.x, rect.y + rect.height - thickness, rect.width, thickness},
+          color);
+  addRect(Rect{rect.x, rect.y + thickness, thickness, inner}, color);
+  addRect(Rect{rect.x + rect.width - thickness, rect.y + thickness, thickness,
+               inner},
+          color);
+}
+
+void SpriteBatch::addQuad(TextureId texture, const BatchVertex (&corners)[4]) {
+  Bounds bounds{corners[0].x, corners[0].y, corners[0].x, corners[0].y};
+  for (const auto &corner : corners) {
+    bounds.minX = std::min(bounds.minX, corner.x);
+    bounds.minY = std::min(bounds.minY, corner.y);
+    bounds.maxX = std::max(bounds.maxX, corner.x);
+    bounds.maxY = std::max(bounds.maxY, corner.y);
+  }
+
+  // Walk back to the nearest batch with the same state, stopping at the
+  // first batch this quad would have to be drawn underneath
+  usize target = m_batches.size();
+  const usize stop =
+      m_batches.size() > MERGE_LOOKBACK ? m_batches.size() - MERGE_LOOKBACK : 0;
+  for (usize i = m_batches.size(); i > stop; --i) {
+    const DrawBatch &batch = m_batches[i - 1];
+    if (batch.texture == texture && batch.blend == m_blend) {
+      target = i - 1;
+      break;
+    }
+    const Bounds &other = m_batchBounds[i - 1];
+    if (overlaps(bounds.minX, bounds.minY, bounds.maxX, bounds.maxY,
+                 other.minX, other.minY, other.maxX, other.maxY)) {
+      break;
+    }
+  }
+
+  if (target == m_batches.size()) {
+    m_batches.push_back(DrawBatch{texture, m_blend, 0, 0});
+    m_batchBounds.push_back(bounds);
+  } else {
+    Bounds &merged = m_batchBounds[target];
+    merged.minX = std::min(merged.minX, bounds.minX);
+    merged.minY = std::min(merged.minY, bounds.minY);
+    merged.maxX = std::max(merged.maxX, bounds.maxX);
+    merged.maxY = std::max(merged.maxY, bounds.maxY);
+  }
+
+  Quad quad;
+  std::copy(std::begin(corners), std::end(corners), quad.corners);
+  quad.batch = static_cast<u32>(target);
+  m_batches[target].vertexCount += 4;
+  m_quads.push_back(quad);
+}
+
+void SpriteBatch::build() {
+  // Counting sort of the quads by batch; stable, so each batch keeps the
+  // order its quads were recorded in
+  m_batchCursor.assign(m_batches.size(), 0);
+  u32 first = 0;
+  for (usize i = 0; i < m_batches.size(); ++i) {
+    m_batches[i].firstVertex = first;
+    m_batchCursor[i] = first;
+    first += m_batches[i].vertexCount;
+  }
+
+  m_vertices.resize(first);
+  for (const auto &quad : m_quads) {
+    u32 &cursor = m_batchCursor[quad.batch];
+    std::copy(std::begin(quad.corners), std::end(quad.corners),
+              m_vertices.begin() + cursor);
+    cursor += 4;
+  }
+
+  m_stats = BatchStats{};
+  m_stats.quads = static_cast<u32>(m_quads.size());
+  m_stats.vertices = first;
+  m_stats.drawCalls = static_cast<u32>(m_batches.size());
+  for (usize i = 0; i < m_batches.size(); ++i) {
+    if (i == 0 || m_batches[i].texture != m_batches[i - 1].texture) {
+      ++m_stats.textureSwitches;
+    }
+    if (i == 0 || m_batches[i].blend != m_batches[i - 1].blend) {
+      ++m_stats.blendSwitches;
+    }
+  }
+}
+
+} // namespace NovelMind::renderer
@@ -6,6 +6,24 @@
 
 namespace NovelMind::renderer {
 
+namespace {
+
+bool isSpace(char32_t c) {
+  return c < 0x80 && std::isspace(static_cast<int>(c));
+}
+
+/// Scripts written without spaces: a line may break around every glyph
+bool isIdeograph(char32_t c) {
+  return (c >= 0x1100 && c <= 0x115F) ||  // Hangul Jamo
+         (c >= 0x2E80 && c <= 0xA4CF) ||  // CJK, kana, Bopomofo, Yi
+         (c >= 0xAC00 && c <= 0xD7A3) ||  // Hangul syllables
+         (c >= 0xF900 && c <= 0xFAFF) ||  // CJK compatibility ideographs
+         (c >= 0xFF00 && c <= 0xFF60) ||  // Fullwidth forms
+         (c >= 0x20000 && c <= 0x3FFFD); // CJK extensions
+}
+
+} // namespace
+
 // RichTextParser implementation
 
 std::vector<TextSegment>
@@ -230,6 +248,10 @@ void TextLayoutEngine::setFontAtlas(std::shared_ptr<FontAtlas> atlas) {
   m_fontAtlas = std::move(atlas);
 }
 
+void TextLayoutEngine::setGlyphCache(std::shared_ptr<GlyphCache> cache) {
+  m_glyphCache = std::move(cache);
+}
+
 void TextLayoutEngine::setMaxWidth(f32 width) { m_maxWidth = width; }
 
 void TextLayoutEngine::setLineHeight(f32 height) { m_lineHeight = height; }
@@ -251,7 +273,9 @@ TextLayout TextLayoutEngine::layout(const std::string &text) const {
   TextLine currentLine;
   f32 lineWidth = 0.0f;
   f32 baseLineHeight = m_defaultStyle.size * m_lineHeight;
-  if (m_fontAtlas && m_fontAtlas->isValid()) {
+  if (m_glyphCache && m_font && m_font->isValid()) {
+    baseLineHeight = m_glyphCache->getLineHeight(*m_font);
+  } else if (m_fontAtlas && m_fontAtlas->isValid()) {
     baseLineHeight = static_cast<f32>(m_fontAtlas->getLineHeight());
   }
   f32 lineHeight = baseLineHeight;
@@ -269,17 +293,47 @@ TextLayout TextLayoutEngine::layout(const std::string &text) const {
     const std::string &segText = segment.text;
     std::string currentWord;
 
-    for (size_t i = 0; i < segText.length(); ++i) {
-      char c = segText[i];
+    // Place the pending word, wrapping first when it would overflow
+    auto placeWord = [&]() {
+      if (currentWord.empty()) {
+        return;
+      }
+      f32 wordWidth = measureWord(currentWord, segment.style);
 
-      if (c == '\n') {
+      // Check if we need to wrap
+      if (m_maxWidth > 0.0f && lineWidth + wordWidth > m_maxWidth &&
+          lineWidth > 0.0f) {
+        currentLine.width = lineWidth;
+        currentLine.height = lineHeight;
+        result.lines.push_back(std::move(currentLine));
+        result.totalHeight += lineHeight;
+        result.totalWidth = std::max(result.totalWidth, lineWidth);
+
+        currentLine = TextLine{};
+        lineWidth = 0.0f;
+      }
+
+      TextSegment wordSeg;
+      wordSeg.text = currentWord;
+      wordSeg.style = segment.style;
+      currentLine.segments.push_back(std::move(wordSeg));
+      lineWidth += wordWidth;
+      charCount += static_cast<i32>(countCodepoints(currentWord));
+      currentWord.clear();
+    };
+
+    for (size_t i = 0; i < segText.length();) {
+      const size_t start = i;
+      const char32_t c = nextCodepoint(segText, i);
+
+      if (c == U'\n') {
         // Handle newline
         if (!currentWord.empty()) {
           TextSegment wordSeg;
           wordSeg.text = currentWord;
           wordSeg.style = segment.style;
           currentLine.segments.push_back(std::move(wordSeg));
-          charCount += static_cast<i32>(currentWord.length());
+          charCount += static_cast<i32>(countCodepoints(currentWord));
           currentWord.clear();
         }
 
@@ -293,33 +347,9 @@ TextLayout TextLayoutEngine::layout(const std::string &text) const {
         // Start new line
         currentLine = TextLine{};
         lineWidth = 0.0f;
-      } else if (std::isspace(c)) {
+      } else if (isSpace(c)) {
         // End of word
-        if (!currentWord.empty()) {
-          f32 wordWidth = measureWord(currentWord, segment.style);
-
-          // Check if we need to wrap
-          if (m_maxWidth > 0.0f && lineWidth + wordWidth > m_maxWidth &&
-              lineWidth > 0.0f) {
-            // Wrap to next line
-            currentLine.width = lineWidth;
-            currentLine.height = lineHeight;
-            result.lines.push_back(std::move(currentLine));
-            result.totalHeight += lineHeight;
-            result.totalWidth = std::max(result.totalWidth, lineWidth);
-
-            currentLine = TextLine{};
-            lineWidth = 0.0f;
-          }
-
-          TextSegment wordSeg;
-          wordSeg.text = currentWord;
-          wordSeg.style = segment.style;
-          currentLine.segments.push_back(std::move(wordSeg));
-          lineWidth += wordWidth;
-          charCount += static_cast<i32>(currentWord.length());
-          currentWord.clear();
-        }
+        placeWord();
 
         // Add space
         f32 spaceWidth = measureChar(' ', segment.style);
@@ -331,35 +361,18 @@ TextLayout TextLayoutEngine::layout(const std::string &text) const {
           lineWidth += spaceWidth;
           ++charCount;
         }
+      } else if (isIdeograph(c)) {
+        // No spaces to break at: every ideograph is a word of its own
+        placeWord();
+        currentWord.append(segText, start, i - start);
+        placeWord();
       } else {
-        currentWord += c;
+        currentWord.append(segText, start, i - start);
       }
     }
 
     // Handle remaining word
-    if (!currentWord.empty()) {
-      f32 wordWidth = measureWord(currentWord, segment.style);
-
-      // Check if we need to wrap
-      if (m_maxWidth > 0.0f && lineWidth + wordWidth > m_maxWidth &&
-          lineWidth > 0.0f) {
-        currentLine.width = lineWidth;
-        currentLine.height = lineHeight;
-        result.lines.push_back(std::move(currentLine));
-        result.totalHeight += lineHeight;
-        result.totalWidth = std::max(result.totalWidth, lineWidth);
-
-        currentLine = TextLine{};
-        lineWidth = 0.0f;
-      }
-
-      TextSegment wordSeg;
-      wordSeg.text = currentWord;
-      wordSeg.style = segment.style;
-      currentLine.segments.push_back(std::move(wordSeg));
-      lineWidth += wordWidth;
-      charCount += static_cast<i32>(currentWord.length());
-    }
+    placeWord();
   }
 
   // Add last line
@@ -397,8 +410,9 @@ i32 TextLayoutEngine::getCharacterAtPosition(const TextLayout &layout, f32 x,
           continue;
         }
 
-        for (char c : segment.text) {
-          f32 charWidth = measureChar(c, segment.style);
+        for (size_t pos = 0; pos < segment.text.size();) {
+          f32 charWidth =
+              measureChar(nextCodepoint(segment.text, pos), segment.style);
           if (!layout.rightToLeft) {
             if (x >= currentX && x < currentX + charWidth) {
               return charIndex;
@@ -423,7 +437,7 @@ i32 TextLayoutEngine::getCharacterAtPosition(const TextLayout &layout, f32 x,
     // Count characters in line
     for (const auto &segment : line.segments) {
       if (!segment.isCommand()) {
-        charIndex += static_cast<i32>(segment.text.length());
+        charIndex += static_cast<i32>(countCodepoints(segment.text));
       }
     }
   }
@@ -445,8 +459,9 @@ TextLayoutEngine::getCharacterPosition(const TextLayout &layout,
         continue;
       }
 
-      for (char c : segment.text) {
-        f32 charWidth = measureChar(c, segment.style);
+      for (size_t pos = 0; pos < segment.text.size();) {
+        f32 charWidth =
+            measureChar(nextCodepoint(segment.text, pos), segment.style);
         if (charIndex == targetIndex) {
           f32 charX = layout.rightToLeft ? (currentX - charWidth) : currentX;
           return {charX, currentY};
@@ -472,7 +487,7 @@ TextLayoutEngine::breakIntoWords(const std::string &text) const {
   std::string current;
 
   for (char c : text) {
-    if (std::isspace(c)) {
+    if (std::isspace(static_cast<unsigned char>(c))) {
       if (!current.empty()) {
         words.push_back(current);
         current.clear();
@@ -489,11 +504,14 @@ TextLayoutEngine::breakIntoWords(const std::string &text) const {
   return words;
 }
 
-f32 TextLayoutEngine::measureChar(char c, const TextStyle &style) const {
-  // Use atlas metrics when available for precise width
-  if (m_fontAtlas && m_fontAtlas->isValid()) {
-    if (const auto *glyph =
-            m_fontAtlas->getGlyph(static_cast<unsigned char>(c))) {
+f32 TextLayoutEngine::measureChar(char32_t c, const TextStyle &style) const {
+  // Glyph cache or atlas metrics when available for precise width
+  if (m_glyphCache && m_font && m_font->isValid()) {
+    if (const auto *glyph = m_glyphCache->getMetrics(*m_font, c)) {
+      return glyph->advanceX;
+    }
+  } else if (m_fontAtlas && m_fontAtlas->isValid()) {
+    if (const auto *glyph = m_fontAtlas->getGlyph(c)) {
       return glyph->advanceX;
     }
   }
@@ -506,30 +524,41 @@ f32 TextLayoutEngine::measureChar(char c, const TextStyle &style) const {
   }
 
   // Fallback: estimate based on character
-  if (std::isspace(c)) {
+  if (isSpace(c)) {
     return style.size * 0.25f;
   }
+  if (isIdeograph(c)) {
+    return style.size;
+  }
+  if (c >= 0x80) {
+    return style.size * 0.5f;
+  }
 
   // Wide characters
   static const char *wideChars = "WMQOCD";
-  if (std::strchr(wideChars, std::toupper(c))) {
+  if (std::strchr(wideChars, std::toupper(static_cast<int>(c)))) {
     return style.size * 0.7f;
   }
 
   // Narrow characters
   static const char *narrowChars = "iIlj1!|";
-  if (std::strchr(narrowChars, c)) {
+  if (std::strchr(narrowChars, static_cast<int>(c))) {
     return style.size * 0.3f;
   }
 
   return style.size * 0.5f;
 }
 
+f32 TextLayoutEngine::measureGlyph(char32_t codepoint,
+                                   const TextStyle &style) const {
+  return measureChar(codepoint, style);
+}
+
 f32 TextLayoutEngine::measureWord(const std::string &word,
                                   const TextStyle &style) const {
   f32 width = 0.0f;
-  for (char c : word) {
-    width += measureChar(c, style);
+  for (size_t pos = 0; pos < word.size();) {
+    width += measureChar(nextCodepoint(word, pos), style);
   }
   return width;
 }
@@ -601,9 +630,10 @@ void TypewriterAnimator::update(f64 deltaTime) {
           continue;
         }
 
-        for (char c : segment.text) {
-          if (charIndex == currentChar - 1) {
-            f32 pause = getPunctuationPause(c);
+        for (size_t pos = 0; pos < segment.text.size();) {
+          const char32_t c = nextCodepoint(segment.text, pos);
+          if (charIndex == currentChar - 1 && c < 0x80) {
+            f32 pause = getPunctuationPause(static_cast<char>(c));
             if (pause > 0.0f) {
               m_state.waitTimer = pause;
             }
@@ -1,6 +1,7 @@
 #include "NovelMind/renderer/texture.hpp"
 #include "NovelMind/core/logger.hpp"
 #include "stb/stb_image.h"
+#include <cstring>
 
 #if defined(NOVELMIND_HAS_SDL2) && defined(NOVELMIND_HAS_OPENGL)
 #include <SDL.h>
@@ -15,7 +16,8 @@ Texture::~Texture() { destroy(); }
 
 Texture::Texture(Texture &&other) noexcept
     : m_handle(other.m_handle), m_width(other.m_width),
-      m_height(other.m_height) {
+      m_height(other.m_height), m_pixels(std::move(other.m_pixels)) {
+  other.m_pixels.clear();
   other.m_handle = nullptr;
   other.m_width = 0;
   other.m_height = 0;
@@ -27,6 +29,8 @@ Texture &Texture::operator=(Texture &&other) noexcept {
     m_handle = other.m_handle;
     m_width = other.m_width;
     m_height = other.m_height;
+    m_pixels = std::move(other.m_pixels);
+    other.m_pixels.clear();
     other.m_handle = nullptr;
     other.m_width = 0;
     other.m_height = 0;
@@ -34,9 +38,9 @@ Texture &Texture::operator=(Texture &&other) noexcept {
   return *this;
 }
 
-Result<void> Texture::loadFromMemory(const std::vector<u8> &data) {
+Result<DecodedImage> Texture::decode(std::span<const u8> data) {
   if (data.empty()) {
-    return Result<void>::error("Empty texture data");
+    return Result<DecodedImage>::error("Empty texture data");
   }
 
   int width = 0;
@@ -48,13 +52,30 @@ Result<void> Texture::loadFromMemory(const std::vector<u8> &data) {
 
   if (!pixels || width <= 0 || height <= 0) {
     const char *reason = stbi_failure_reason();
-    return Result<void>::error(reason ? reason : "Failed to decode texture");
+    if (pixels) {
+      stbi_image_free(pixels);
+    }
+    return Result<DecodedImage>::error(reason ? reason
+                                              : "Failed to decode texture");
   }
 
-  auto result =
-      loadFromRGBA(reinterpret_cast<const u8 *>(pixels), width, height);
+  DecodedImage image;
+  image.width = width;
+  image.height = height;
+  const auto *begin = reinterpret_cast<const u8 *>(pixels);
+  image.pixels.assign(begin, begin + static_cast<usize>(width) *
+                                         static_cast<usize>(height) * 4);
   stbi_image_free(pixels);
-  return result;
+  return Result<DecodedImage>::ok(std::move(image));
+}
+
+Result<void> Texture::loadFromMemory(std::span<const u8> data) {
+  auto decoded = decode(data);
+  if (decoded.isError()) {
+    return Result<void>::error(decoded.error());
+  }
+  const auto &image = decoded.value();
+  return loadFromRGBA(image.pixels.data(), image.width, image.height);
 }
 
 Result<void> Texture::loadFromRGBA(const u8 *pixels, i32 width, i32 height) {
@@ -66,6 +87,21 @@ Result<void> Texture::loadFromRGBA(const u8 *pixels, i32 width, i32 height) {
   m_height = height;
 
 #if defined(NOVELMIND_HAS_SDL2) && defined(NOVELMIND_HAS_OPENGL)
+  if (!SDL_GL_GetCurrentContext()) {
+    // Headless: keep the pixels for the software renderer instead
+    m_pixels.assign(pixels, pixels + static_cast<usize>(width) *
+                                         static_cast<usize>(height) * 4);
+    return Result<void>::ok();
+  }
+
+  m_pixels.clear();
+  if (m_handle) {
+    // Reloading (e.g. a frame snapshot) replaces the previous GL texture
+    GLuint previous = static_cast<GLuint>(reinterpret_cast<uintptr_t>(m_handle));
+    glDeleteTextures(1, &previous);
+    m_handle = nullptr;
+  }
+
   GLuint tex = 0;
   glGenTextures(1, &tex);
   glBindTexture(GL_TEXTURE_2D, tex);
@@ -78,8 +114,43 @@ Result<void> Texture::loadFromRGBA(const u8 *pixels, i32 width, i32 height) {
   m_handle = reinterpret_cast<void *>(static_cast<uintptr_t>(tex));
 #else
   m_handle = nullptr;
+  m_pixels.assign(pixels, pixels + static_cast<usize>(width) *
+                                       static_cast<usize>(height) * 4);
+#endif
+
+  return Result<void>::ok();
+}
+
+Result<void> Texture::updateRegion(const u8 *pixels, i32 x, i32 y, i32 width,
+                                   i32 height) {
+  if (!pixels || width <= 0 || height <= 0 || x < 0 || y < 0 ||
+      x + width > m_width || y + height > m_height) {
+    return Result<void>::error("Invalid texture region");
+  }
+
+#if defined(NOVELMIND_HAS_SDL2) && defined(NOVELMIND_HAS_OPENGL)
+  if (m_handle) {
+    GLuint tex = static_cast<GLuint>(reinterpret_cast<uintptr_t>(m_handle));
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_RGBA,
+                    GL_UNSIGNED_BYTE, pixels);
+    return Result<void>::ok();
+  }
 #endif
 
+  if (m_pixels.empty()) {
+    return Result<void>::error("Texture has no pixels to update");
+  }
+  const usize rowBytes = static_cast<usize>(width) * 4;
+  for (i32 row = 0; row < height; ++row) {
+    const usize dst =
+        (static_cast<usize>(y + row) * static_cast<usize>(m_width) +
+         static_cast<usize>(x)) *
+        4;
+    std::memcpy(m_pixels.data() + dst,
+                pixels + static_cast<usize>(row) * rowBytes, rowBytes);
+  }
   return Result<void>::ok();
 }
 
@@ -94,6 +165,8 @@ void Texture::destroy() {
     // Texture resource cleanup is handled by platform backend.
     m_handle = nullptr;
   }
+  m_pixels.clear();
+  m_pixels.shrink_to_fit();
   m_width = 0;
   m_height = 0;
 }
@@ -1,7 +1,10 @@
 #include "NovelMind/resource/resource_manager.hpp"
 #include "NovelMind/core/logger.hpp"
+#include "NovelMind/platform/mapped_file.hpp"
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 
 namespace NovelMind::resource {
 
@@ -36,9 +39,29 @@ bool readFileToBytes(const std::string &path, std::vector<u8> &out) {
 
 } // namespace
 
-ResourceManager::ResourceManager(vfs::IVirtualFileSystem *vfs) : m_vfs(vfs) {}
+ResourceManager::ResourceManager(vfs::IVirtualFileSystem *vfs)
+    : m_vfs(vfs), m_glyphCache(std::make_shared<renderer::GlyphCache>()) {}
 
-ResourceManager::~ResourceManager() { clearCache(); }
+ResourceManager::~ResourceManager() {
+  // Join the loader threads before the state they reference goes away
+  m_workers.reset();
+  for (auto &[id, pending] : m_pendingTextures) {
+    pending.request->cancel();
+  }
+  for (auto &[id, sizes] : m_pendingFonts) {
+    for (auto &[size, pending] : sizes) {
+      pending.request->cancel();
+    }
+  }
+  for (auto &[id, pending] : m_pendingData) {
+    pending.request->cancel();
+  }
+  m_pendingTextures.clear();
+  m_pendingFonts.clear();
+  m_pendingData.clear();
+  m_commits.clear();
+  clearCache();
+}
 
 void ResourceManager::setVfs(vfs::IVirtualFileSystem *vfs) { m_vfs = vfs; }
 
@@ -60,13 +83,13 @@ Result<TextureHandle> ResourceManager::loadTexture(const std::string &id) {
     return Result<TextureHandle>::ok(it->second);
   }
 
-  auto dataResult = readResource(id);
+  auto dataResult = readResourceView(id);
   if (dataResult.isError()) {
     return Result<TextureHandle>::error(dataResult.error());
   }
 
   auto texture = std::make_shared<renderer::Texture>();
-  auto loadResult = texture->loadFromMemory(dataResult.value());
+  auto loadResult = texture->loadFromMemory(dataResult.value().bytes());
   if (loadResult.isError()) {
     return Result<TextureHandle>::error(loadResult.error());
   }
@@ -113,7 +136,13 @@ void ResourceManager::unloadFont(const std::string &id, i32 size) {
   if (it == m_fonts.end()) {
     return;
   }
-  it->second.erase(size);
+  auto font = it->second.find(size);
+  if (font != it->second.end()) {
+    if (font->second) {
+      m_glyphCache->releaseFont(*font->second);
+    }
+    it->second.erase(font);
+  }
   if (it->second.empty()) {
     m_fonts.erase(it);
   }
@@ -152,12 +181,311 @@ Result<std::vector<u8>> ResourceManager::readData(const std::string &id) const {
   return readResource(id);
 }
 
+Result<std::unique_ptr<VFS::IFileHandle>>
+ResourceManager::openStream(const std::string &id) const {
+  using StreamResult = Result<std::unique_ptr<VFS::IFileHandle>>;
+
+  std::string path = resolvePath(id);
+  if (!path.empty()) {
+    auto handle = std::make_unique<VFS::DiskFileHandle>(path);
+    if (handle->isValid()) {
+      return StreamResult::ok(std::move(handle));
+    }
+  }
+
+  if (m_vfs) {
+    auto view = m_vfs->readFileView(id);
+    if (view.isOk()) {
+      return StreamResult::ok(
+          std::make_unique<VFS::ViewFileHandle>(std::move(view).value()));
+    }
+  }
+
+  return StreamResult::error("Failed to open resource: " + id);
+}
+
 void ResourceManager::clearCache() {
   m_textures.clear();
+  for (const auto &[id, sizes] : m_fonts) {
+    for (const auto &[size, font] : sizes) {
+      if (font) {
+        m_glyphCache->releaseFont(*font);
+      }
+    }
+  }
   m_fonts.clear();
   m_fontAtlases.clear();
 }
 
+TextureRequest ResourceManager::loadTextureAsync(const std::string &id,
+                                                 LoadPriority priority) {
+  auto request = std::make_shared<LoadRequest<TextureHandle>>(id, priority);
+  if (id.empty()) {
+    request->complete(Result<TextureHandle>::error("Texture id is empty"),
+                      LoadState::Failed);
+    return request;
+  }
+
+  auto cached = m_textures.find(id);
+  if (cached != m_textures.end() && cached->second &&
+      cached->second->isValid()) {
+    request->complete(Result<TextureHandle>::ok(cached->second),
+                      LoadState::Ready);
+    return request;
+  }
+
+  auto pending = m_pendingTextures.find(id);
+  if (pending != m_pendingTextures.end() &&
+      !pending->second.request->isDone()) {
+    auto &existing = pending->second;
+    if (priority > existing.request->getPriority()) {
+      existing.request->setPriority(priority);
+      workers().setPriority(existing.job, static_cast<i32>(priority));
+    }
+    return existing.request;
+  }
+
+  auto job = workers().submit(
+      [this, request] {
+        if (!request->advance(LoadState::Queued, LoadState::Loading)) {
+          // Cancelled while queued; let the main thread drop it
+          postCommit(request->getPriority(), 0,
+                     [this, request] {
+                       commitTexture(request,
+                                     Result<renderer::DecodedImage>::error(
+                                         "Load cancelled"));
+                     });
+          return;
+        }
+
+        auto data = readResourceView(request->getId());
+        auto decoded =
+            data.isOk()
+                ? renderer::Texture::decode(data.value().bytes())
+                : Result<renderer::DecodedImage>::error(data.error());
+        request->advance(LoadState::Loading, LoadState::Uploading);
+
+        const usize bytes = decoded.isOk() ? decoded.value().sizeBytes() : 0;
+        auto shared = std::make_shared<Result<renderer::DecodedImage>>(
+            std::move(decoded));
+        postCommit(request->getPriority(), bytes, [this, request, shared] {
+          commitTexture(request, std::move(*shared));
+        });
+      },
+      static_cast<i32>(priority));
+
+  m_pendingTextures[id] = PendingLoad<TextureHandle>{request, job};
+  return request;
+}
+
+FontRequest ResourceManager::loadFontAsync(const std::string &id, i32 size,
+                                           LoadPriority priority) {
+  auto request = std::make_shared<LoadRequest<FontHandle>>(id, priority);
+  if (id.empty() || size <= 0) {
+    request->complete(Result<FontHandle>::error(
+                          id.empty() ? "Font id is empty"
+                                     : "Font size must be positive"),
+                      LoadState::Failed);
+    return request;
+  }
+
+  auto fontIt = m_fonts.find(id);
+  if (fontIt != m_fonts.end()) {
+    auto cached = fontIt->second.find(size);
+    if (cached != fontIt->second.end() && cached->second &&
+        cached->second->isValid()) {
+      request->complete(Result<FontHandle>::ok(cached->second),
+                        LoadState::Ready);
+      return request;
+    }
+  }
+
+  auto &pendingSizes = m_pendingFonts[id];
+  auto pending = pendingSizes.find(size);
+  if (pending != pendingSizes.end() && !pending->second.request->isDone()) {
+    auto &existing = pending->second;
+    if (priority > existing.request->getPriority()) {
+      existing.request->setPriority(priority);
+      workers().setPriority(existing.job, static_cast<i32>(priority));
+    }
+    return existing.request;
+  }
+
+  auto job = workers().submit(
+      [this, request, size] {
+        if (!request->advance(LoadState::Queued, LoadState::Loading)) {
+          postCommit(request->getPriority(), 0, [this, request, size] {
+            commitFont(request, size,
+                       Result<FontHandle>::error("Load cancelled"));
+          });
+          return;
+        }
+
+        // FreeType face creation is CPU-only, so the whole load runs here
+        Result<FontHandle> result = Result<FontHandle>::error("");
+        auto data = readResource(request->getId());
+        if (data.isError()) {
+          result = Result<FontHandle>::error(data.error());
+        } else {
+          auto font = std::make_shared<renderer::Font>();
+          auto loaded = font->loadFromMemory(data.value(), size);
+          result = loaded.isOk() ? Result<FontHandle>::ok(std::move(font))
+                                 : Result<FontHandle>::error(loaded.error());
+        }
+        request->advance(LoadState::Loading, LoadState::Uploading);
+
+        auto shared = std::make_shared<Result<FontHandle>>(std::move(result));
+        postCommit(request->getPriority(), 0, [this, request, size, shared] {
+          commitFont(request, size, std::move(*shared));
+        });
+      },
+      static_cast<i32>(priority));
+
+  pendingSizes[size] = PendingLoad<FontHandle>{request, job};
+  return request;
+}
+
+DataRequest ResourceManager::prefetchData(const std::string &id,
+                                          LoadPriority priority) {
+  auto request = std::make_shared<LoadRequest<usize>>(id, priority);
+  if (id.empty()) {
+    request->complete(Result<usize>::error("Resource id is empty"),
+                      LoadState::Failed);
+    return request;
+  }
+
+  auto pending = m_pendingData.find(id);
+  if (pending != m_pendingData.end() && !pending->second.request->isDone()) {
+    auto &existing = pending->second;
+    if (priority > existing.request->getPriority()) {
+      existing.request->setPriority(priority);
+      workers().setPriority(existing.job, static_cast<i32>(priority));
+    }
+    return existing.request;
+  }
+
+  auto job = workers().submit(
+      [this, request] {
+        Result<usize> result = Result<usize>::error("Load cancelled");
+        if (request->advance(LoadState::Queued, LoadState::Loading)) {
+          auto data = readResourceView(request->getId());
+          if (data.isOk()) {
+            // A view into a mapped pack has not read anything yet
+            platform::prefetchPages(data.value().bytes());
+          }
+          result = data.isOk() ? Result<usize>::ok(data.value().size())
+                               : Result<usize>::error(data.error());
+          request->advance(LoadState::Loading, LoadState::Uploading);
+        }
+        postCommit(request->getPriority(), 0, [this, request, result] {
+          commitData(request, result);
+        });
+      },
+      static_cast<i32>(priority));
+
+  m_pendingData[id] = PendingLoad<usize>{request, job};
+  return request;
+}
+
+bool ResourceManager::isTextureCached(const std::string &id) const {
+  auto it = m_textures.find(id);
+  return it != m_textures.end() && it->second && it->second->isValid();
+}
+
+bool ResourceManager::isTextureLoading(const std::string &id) const {
+  auto it = m_pendingTextures.find(id);
+  return it != m_pendingTextures.end() && !it->second.request->isDone();
+}
+
+usize ResourceManager::processUploads(usize byteBudget) {
+  std::vector<PendingCommit> batch;
+  {
+    std::lock_guard<std::mutex> lock(m_commitMutex);
+    if (m_commits.empty()) {
+      return 0;
+    }
+
+    std::sort(m_commits.begin(), m_commits.end(),
+              [](const PendingCommit &a, const PendingCommit &b) {
+                if (a.priority != b.priority) {
+                  return a.priority > b.priority;
+                }
+                return a.sequence < b.sequence;
+              });
+
+    usize spent = 0;
+    usize taken = 0;
+    for (; taken < m_commits.size(); ++taken) {
+      const usize bytes = m_commits[taken].bytes;
+      if (taken > 0 && bytes > 0 && spent + bytes > byteBudget) {
+        break;
+      }
+      spent += bytes;
+    }
+    batch.assign(std::make_move_iterator(m_commits.begin()),
+                 std::make_move_iterator(m_commits.begin() +
+                                         static_cast<std::ptrdiff_t>(taken)));
+    m_commits.erase(m_commits.begin(),
+                    m_commits.begin() + static_cast<std::ptrdiff_t>(taken));
+  }
+
+  for (auto &entry : batch) {
+    entry.commit();
+  }
+  return batch.size();
+}
+
+void ResourceManager::finishPendingLoads() {
+  while (getPendingLoadCount() > 0 && m_workers) {
+    m_workers->waitIdle();
+    if (processUploads(std::numeric_limits<usize>::max()) == 0) {
+      break;
+    }
+  }
+}
+
+usize ResourceManager::cancelPendingLoads(LoadPriority keep) {
+  usize cancelled = 0;
+
+  auto cancelLoad = [&](auto &pending) {
+    if (pending.request->getPriority() >= keep) {
+      return false;
+    }
+    if (pending.request->cancel()) {
+      ++cancelled;
+    }
+    // A job still in the queue never runs, so nothing would clean it up
+    return m_workers && m_workers->cancel(pending.job);
+  };
+
+  for (auto it = m_pendingTextures.begin(); it != m_pendingTextures.end();) {
+    it = cancelLoad(it->second) ? m_pendingTextures.erase(it) : std::next(it);
+  }
+  for (auto it = m_pendingData.begin(); it != m_pendingData.end();) {
+    it = cancelLoad(it->second) ? m_pendingData.erase(it) : std::next(it);
+  }
+  for (auto fontIt = m_pendingFonts.begin(); fontIt != m_pendingFonts.end();) {
+    auto &sizes = fontIt->second;
+    for (auto it = sizes.begin(); it != sizes.end();) {
+      it = cancelLoad(it->second) ? sizes.erase(it) : std::next(it);
+    }
+    fontIt = sizes.empty() ? m_pendingFonts.erase(fontIt) : std::next(fontIt);
+  }
+  return cancelled;
+}
+
+void ResourceManager::setLoaderThreadCount(usize count) {
+  m_loaderThreadCount = count;
+}
+
+usize ResourceManager::getPendingLoadCount() const {
+  usize count = m_pendingTextures.size() + m_pendingData.size();
+  for (const auto &pair : m_pendingFonts) {
+    count += pair.second.size();
+  }
+  return count;
+}
+
 size_t ResourceManager::getTextureCount() const { return m_textures.size(); }
 
 size_t ResourceManager::getFontCount() const {
@@ -178,6 +506,104 @@ size_t ResourceManager::getFontAtlasCount() const {
   return count;
 }
 
+core::WorkerPool &ResourceManager::workers() {
+  if (!m_workers) {
+    m_workers = std::make_unique<core::WorkerPool>(m_loaderThreadCount);
+  }
+  return *m_workers;
+}
+
+void ResourceManager::postCommit(LoadPriority priority, usize bytes,
+                                 std::function<void()> commit) {
+  std::lock_guard<std::mutex> lock(m_commitMutex);
+  m_commits.push_back(
+      PendingCommit{priority, m_commitSequence++, bytes, std::move(commit)});
+}
+
+void ResourceManager::commitTexture(const TextureRequest &request,
+                                    Result<renderer::DecodedImage> decoded) {
+  const std::string &id = request->getId();
+  auto pending = m_pendingTextures.find(id);
+  if (pending != m_pendingTextures.end() &&
+      pending->second.request == request) {
+    m_pendingTextures.erase(pending);
+  }
+  if (request->isDone()) {
+    return;
+  }
+
+  if (decoded.isError()) {
+    request->complete(Result<TextureHandle>::error(decoded.error()),
+                      LoadState::Failed);
+    return;
+  }
+
+  // A synchronous loadTexture() may have won the race
+  auto cached = m_textures.find(id);
+  if (cached != m_textures.end() && cached->second &&
+      cached->second->isValid()) {
+    request->complete(Result<TextureHandle>::ok(cached->second),
+                      LoadState::Ready);
+    return;
+  }
+
+  const auto &image = decoded.value();
+  auto texture = std::make_shared<renderer::Texture>();
+  auto uploaded =
+      texture->loadFromRGBA(image.pixels.data(), image.width, image.height);
+  if (uploaded.isError()) {
+    request->complete(Result<TextureHandle>::error(uploaded.error()),
+                      LoadState::Failed);
+    return;
+  }
+
+  m_textures[id] = texture;
+  request->complete(Result<TextureHandle>::ok(texture), LoadState::Ready);
+}
+
+void ResourceManager::commitFont(const FontRequest &request, i32 size,
+                                 Result<FontHandle> font) {
+  const std::string &id = request->getId();
+  auto sizes = m_pendingFonts.find(id);
+  if (sizes != m_pendingFonts.end()) {
+    auto pending = sizes->second.find(size);
+    if (pending != sizes->second.end() &&
+        pending->second.request == request) {
+      sizes->second.erase(pending);
+      if (sizes->second.empty()) {
+        m_pendingFonts.erase(sizes);
+      }
+    }
+  }
+  if (request->isDone()) {
+    return;
+  }
+
+  if (font.isError()) {
+    request->complete(std::move(font), LoadState::Failed);
+    return;
+  }
+
+  auto &cached = m_fonts[id][size];
+  if (!cached || !cached->isValid()) {
+    cached = font.value();
+  }
+  request->complete(Result<FontHandle>::ok(cached), LoadState::Ready);
+}
+
+void ResourceManager::commitData(const DataRequest &request,
+                                 Result<usize> bytes) {
+  auto pending = m_pendingData.find(request->getId());
+  if (pending != m_pendingData.end() && pending->second.request == request) {
+    m_pendingData.erase(pending);
+  }
+  if (request->isDone()) {
+    return;
+  }
+  const LoadState state = bytes.isOk() ? LoadState::Ready : LoadState::Failed;
+  request->complete(std::move(bytes), state);
+}
+
 Result<std::vector<u8>>
 ResourceManager::readResource(const std::string &id) const {
   std::vector<u8> data;
@@ -197,6 +623,26 @@ ResourceManager::readResource(const std::string &id) const {
   return Result<std::vector<u8>>::error("Failed to read resource: " + id);
 }
 
+Result<vfs::ResourceView>
+ResourceManager::readResourceView(const std::string &id) const {
+  std::vector<u8> data;
+
+  std::string path = resolvePath(id);
+  if (!path.empty() && readFileToBytes(path, data)) {
+    return Result<vfs::ResourceView>::ok(
+        vfs::ResourceView::fromVector(std::move(data)));
+  }
+
+  if (m_vfs) {
+    auto vfsResult = m_vfs->readFileView(id);
+    if (vfsResult.isOk()) {
+      return vfsResult;
+    }
+  }
+
+  return Result<vfs::ResourceView>::error("Failed to read resource: " + id);
+}
+
 std::string ResourceManager::resolvePath(const std::string &id) const {
   if (id.empty()) {
     return {};
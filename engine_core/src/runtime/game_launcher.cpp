@@ -622,58 +622,31 @@ Result<void> GameLauncher::initializeLocalization() {
   }
 
   // Load localization files from packs
-  // VFS path: locales/<locale>.json  (e.g., "locales/en.json",
-  // "locales/ru.json") These files should be packed in game packs and contain
-  // localized strings
+  // VFS path: locales/<locale>.nmlb (compiled bundle emitted by the build) or
+  // locales/<locale>.json (e.g., "locales/en.json", "locales/ru.json")
   if (m_packManager && m_packManager->getPackCount() > 0) {
-    // Load current locale
-    std::string currentLocaleFile =
-        "locales/" + config.localization.currentLocale + ".json";
-    logInfo("Loading localization from VFS path: " + currentLocaleFile);
-
-    if (m_packManager->exists(currentLocaleFile)) {
-      auto resourceData = m_packManager->readResource(currentLocaleFile);
-      if (resourceData.isOk()) {
-        std::string jsonContent(resourceData.value().begin(),
-                                resourceData.value().end());
-        auto loadResult = m_localizationManager->loadStringsFromMemory(
-            localization::LocaleId::fromString(
-                config.localization.currentLocale),
-            jsonContent, localization::LocalizationFormat::JSON);
-        if (loadResult.isError()) {
-          logWarning("Failed to load localization from pack: " +
-                     loadResult.error());
-        } else {
-          logInfo("Loaded localization from pack: " + currentLocaleFile);
-        }
-      }
-    } else {
-      logInfo("Localization file not found in packs: " + currentLocaleFile);
-      logInfo("Available VFS paths for localization: locales/<locale>.json");
-    }
-
-    // Also load fallback (default) locale if different from current
+    // Load the current locale and the fallback (default) locale, if
+    // different, with one batched read
+    std::vector<std::string> locales = {config.localization.currentLocale};
     if (config.localization.defaultLocale !=
         config.localization.currentLocale) {
-      std::string defaultLocaleFile =
-          "locales/" + config.localization.defaultLocale + ".json";
-      if (m_packManager->exists(defaultLocaleFile)) {
-        auto resourceData = m_packManager->readResource(defaultLocaleFile);
-        if (resourceData.isOk()) {
-          std::string jsonContent(resourceData.value().begin(),
-                                  resourceData.value().end());
-          m_localizationManager->loadStringsFromMemory(
-              localization::LocaleId::fromString(
-                  config.localization.defaultLocale),
-              jsonContent, localization::LocalizationFormat::JSON);
-          logInfo("Loaded fallback localization: " + defaultLocaleFile);
-        }
-      }
+      locales.push_back(config.localization.defaultLocale);
+    }
+
+    auto loadResults = loadLocalesFromPacks(locales);
+    if (loadResults[0].isError()) {
+      logWarning(loadResults[0].error());
+      logInfo("Available VFS paths for localization: "
+              "locales/<locale>.nmlb, locales/<locale>.json");
+    }
+    if (loadResults.size() > 1 && loadResults[1].isError()) {
+      logWarning(loadResults[1].error());
     }
   }
 
   // Set callback to handle language changes from settings
-  // When language changes, reload localization from the new locale file
+  // Locales that are already resident are switched to without reparsing;
+  // others are loaded from the packs on first use
   m_localizationManager->setOnLanguageChanged(
       [this](const localization::LocaleId &newLocale) {
         logInfo("Language changed to: " + newLocale.toString());
@@ -683,19 +656,13 @@ Result<void> GameLauncher::initializeLocalization() {
           m_configManager->setLocale(newLocale.toString());
         }
 
-        // Reload localization from new locale file
+        if (m_localizationManager->isLocaleAvailable(newLocale)) {
+          return;
+        }
         if (m_packManager && m_packManager->getPackCount() > 0) {
-          std::string localeFile = "locales/" + newLocale.toString() + ".json";
-          if (m_packManager->exists(localeFile)) {
-            auto resourceData = m_packManager->readResource(localeFile);
-            if (resourceData.isOk()) {
-              std::string jsonContent(resourceData.value().begin(),
-                                      resourceData.value().end());
-              m_localizationManager->loadStringsFromMemory(
-                  newLocale, jsonContent,
-                  localization::LocalizationFormat::JSON);
-              logInfo("Reloaded localization for: " + localeFile);
-            }
+          auto loadResult = loadLocaleFromPacks(newLocale.toString());
+          if (loadResult.isError()) {
+            logWarning(loadResult.error());
           }
         }
       });
@@ -704,6 +671,86 @@ Result<void> GameLauncher::initializeLocalization() {
   return Result<void>::ok();
 }
 
+Result<void> GameLauncher::loadLocaleFromPacks(const std::string &locale) {
+  return std::move(loadLocalesFromPacks({locale}).front());
+}
+
+std::vector<Result<void>>
+GameLauncher::loadLocalesFromPacks(const std::vector<std::string> &locales) {
+  // Prefer the compiled bundle: it is used in place, without parsing
+  std::vector<std::string> files;
+  files.reserve(locales.size());
+  for (const auto &locale : locales) {
+    const std::string bundleFile = "locales/" + locale + ".nmlb";
+    files.push_back(m_packManager->exists(bundleFile)
+                        ? bundleFile
+                        : "locales/" + locale + ".json");
+  }
+
+  auto data = m_packManager->readResources(files);
+
+  std::vector<Result<void>> results;
+  results.reserve(locales.size());
+  for (usize i = 0; i < locales.size(); ++i) {
+    if (data[i].isOk()) {
+      results.push_back(
+          loadLocaleData(locales[i], files[i], std::move(data[i]).value()));
+    } else if (!m_packManager->exists(files[i])) {
+      results.push_back(Result<void>::error(
+          "Localization file not found in packs: " + files[i]));
+    } else {
+      results.push_back(Result<void>::error("Failed to read " + files[i] +
+                                            ": " + data[i].error()));
+    }
+
+    // A bundle that fails to load falls back to the JSON source
+    const std::string jsonFile = "locales/" + locales[i] + ".json";
+    if (results.back().isError() && files[i] != jsonFile) {
+      logWarning(results.back().error());
+      if (!m_packManager->exists(jsonFile)) {
+        results.back() = Result<void>::error(
+            "Localization file not found in packs: " + jsonFile);
+        continue;
+      }
+      auto json = m_packManager->readResource(jsonFile);
+      results.back() =
+          json.isOk()
+              ? loadLocaleData(locales[i], jsonFile, std::move(json).value())
+              : Result<void>::error("Failed to read " + jsonFile + ": " +
+                                    json.error());
+    }
+  }
+  return results;
+}
+
+Result<void> GameLauncher::loadLocaleData(const std::string &locale,
+                                          const std::string &file,
+                                          std::vector<u8> data) {
+  const auto localeId = localization::LocaleId::fromString(locale);
+
+  if (file.ends_with(".nmlb")) {
+    auto loadResult =
+        m_localizationManager->loadBundleFromMemory(localeId, std::move(data));
+    if (loadResult.isError()) {
+      return Result<void>::error("Failed to load localization bundle " + file +
+                                 ": " + loadResult.error());
+    }
+    logInfo("Loaded localization bundle from pack: " + file);
+    return Result<void>::ok();
+  }
+
+  std::string_view jsonContent(reinterpret_cast<const char *>(data.data()),
+                               data.size());
+  auto loadResult = m_localizationManager->loadStringsFromMemory(
+      localeId, jsonContent, localization::LocalizationFormat::JSON);
+  if (loadResult.isError()) {
+    return Result<void>::error("Failed to load localization from pack: " +
+                               loadResult.error());
+  }
+  logInfo("Loaded localization from pack: " + file);
+  return Result<void>::ok();
+}
+
 Result<void> GameLauncher::initializeInput() {
   // Initialize input manager
   m_inputManager = std::make_unique<input::InputManager>();
@@ -263,6 +263,54 @@ Result<std::vector<u8>> decryptData(const std::vector<u8> &input,
 
 } // namespace
 
+void setThumbnail(SaveData &data, const u8 *rgba, i32 width, i32 height,
+                  i32 maxWidth, i32 maxHeight) {
+  data.thumbnailData.clear();
+  data.thumbnailWidth = 0;
+  data.thumbnailHeight = 0;
+  if (!rgba || width <= 0 || height <= 0 || maxWidth <= 0 || maxHeight <= 0) {
+    return;
+  }
+
+  const f64 scale = std::min({1.0, static_cast<f64>(maxWidth) / width,
+                              static_cast<f64>(maxHeight) / height});
+  const i32 outWidth = std::max(1, static_cast<i32>(width * scale + 0.5));
+  const i32 outHeight = std::max(1, static_cast<i32>(height * scale + 0.5));
+
+  // Each thumbnail pixel averages the block of source pixels it covers
+  data.thumbnailData.resize(static_cast<size_t>(outWidth) *
+                            static_cast<size_t>(outHeight) * 4);
+  for (i32 y = 0; y < outHeight; ++y) {
+    const i64 y0 = static_cast<i64>(y) * height / outHeight;
+    const i64 y1 = std::max(y0 + 1, static_cast<i64>(y + 1) * height / outHeight);
+    for (i32 x = 0; x < outWidth; ++x) {
+      const i64 x0 = static_cast<i64>(x) * width / outWidth;
+      const i64 x1 = std::max(x0 + 1, static_cast<i64>(x + 1) * width / outWidth);
+      u64 sum[4] = {0, 0, 0, 0};
+      for (i64 sy = y0; sy < y1; ++sy) {
+        const u8 *row = rgba + (static_cast<size_t>(sy) * static_cast<size_t>(width) +
+                                static_cast<size_t>(x0)) *
+                                   4;
+        for (i64 sx = x0; sx < x1; ++sx, row += 4) {
+          for (int c = 0; c < 4; ++c) {
+            sum[c] += row[c];
+          }
+        }
+      }
+      const u64 count = static_cast<u64>((y1 - y0) * (x1 - x0));
+      u8 *out = data.thumbnailData.data() +
+                (static_cast<size_t>(y) * static_cast<size_t>(outWidth) +
+                 static_cast<size_t>(x)) *
+                    4;
+      for (int c = 0; c < 4; ++c) {
+        out[c] = static_cast<u8>((sum[c] + count / 2) / count);
+      }
+    }
+  }
+  data.thumbnailWidth = outWidth;
+  data.thumbnailHeight = outHeight;
+}
+
 SaveManager::SaveManager() : m_savePath("./saves/") {}
 
 SaveManager::~SaveManager() = default;
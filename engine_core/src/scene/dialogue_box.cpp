@@ -156,6 +156,11 @@ void DialogueBox::updateTypewriter(f64 deltaTime) {
          m_visibleCharacters < m_text.size()) {
     m_typewriterTimer -= charInterval;
     ++m_visibleCharacters;
+    // Reveal whole UTF-8 code points, never a partial sequence
+    while (m_visibleCharacters < m_text.size() &&
+           (static_cast<u8>(m_text[m_visibleCharacters]) & 0xC0) == 0x80) {
+      ++m_visibleCharacters;
+    }
 
     // Handle punctuation pauses
     if (m_visibleCharacters > 0 && m_visibleCharacters < m_text.size()) {
@@ -167,6 +167,7 @@ void SceneObjectBase::setProperty(const std::string &name,
   auto it = m_properties.find(name);
   std::string oldValue = (it != m_properties.end()) ? it->second : "";
   m_properties[name] = value;
+  ++m_propertyRevision;
   notifyPropertyChanged(name, oldValue, value);
 }
 
@@ -221,6 +222,7 @@ void SceneObjectBase::loadState(const SceneObjectState &state) {
   m_visible = state.visible;
   m_zOrder = state.zOrder;
   m_properties = state.properties;
+  ++m_propertyRevision;
 }
 
 void SceneObjectBase::animatePosition(f32 toX, f32 toY, f32 duration,
@@ -23,10 +23,13 @@ DialogueUIObject::DialogueUIObject(const std::string &id)
 
 void DialogueUIObject::setSpeaker(const std::string &speaker) {
   m_speaker = speaker;
+  m_layout.valid = false;
 }
 
 void DialogueUIObject::setText(const std::string &text) {
   m_text = text;
+  m_textGlyphs = renderer::countCodepoints(m_text);
+  m_layout.valid = false;
   m_typewriterProgress = 0.0f;
   m_typewriterComplete = !m_typewriterEnabled;
 }
@@ -53,7 +56,7 @@ void DialogueUIObject::startTypewriter() {
 }
 
 void DialogueUIObject::skipTypewriter() {
-  m_typewriterProgress = static_cast<f32>(m_text.length());
+  m_typewriterProgress = static_cast<f32>(m_textGlyphs);
   m_typewriterComplete = true;
 }
 
@@ -62,123 +65,99 @@ void DialogueUIObject::update(f64 deltaTime) {
 
   if (m_typewriterEnabled && !m_typewriterComplete) {
     m_typewriterProgress += static_cast<f32>(deltaTime) * m_typewriterSpeed;
-    if (m_typewriterProgress >= static_cast<f32>(m_text.length())) {
-      m_typewriterProgress = static_cast<f32>(m_text.length());
+    if (m_typewriterProgress >= static_cast<f32>(m_textGlyphs)) {
+      m_typewriterProgress = static_cast<f32>(m_textGlyphs);
       m_typewriterComplete = true;
     }
   }
 }
 
-void DialogueUIObject::render(renderer::IRenderer &renderer) {
-  if (!m_visible || m_alpha <= 0.0f) {
-    return;
-  }
-
-  if (!m_resources) {
-    return;
-  }
-
-  const bool rtl = detail::parseBool(
-      getProperty("rtl"),
-      m_localization ? m_localization->isCurrentLocaleRightToLeft() : false);
-  renderer::TextAlign align =
+void DialogueUIObject::rebuildLayout(bool localeRtl) {
+  m_layout.propertyRevision = getPropertyRevision();
+  m_layout.resources = m_resources;
+  m_layout.localeRtl = localeRtl;
+  m_layout.runs.clear();
+  m_layout.advances.clear();
+  m_layout.font.reset();
+  m_layout.speakerFont.reset();
+
+  const bool rtl = detail::parseBool(getProperty("rtl"), localeRtl);
+  const renderer::TextAlign align =
       rtl ? renderer::TextAlign::Right : renderer::TextAlign::Left;
-
-  const float width =
+  m_layout.rtl = rtl;
+  m_layout.width =
       detail::parseFloat(getProperty("width"), detail::kDefaultDialogueWidth);
-  const float height =
+  m_layout.height =
       detail::parseFloat(getProperty("height"), detail::kDefaultDialogueHeight);
-  const float padding = detail::parseFloat(getProperty("padding"),
-                                           detail::kDefaultDialoguePadding);
-
-  renderer::Rect rect{m_transform.x - width * m_anchorX,
-                      m_transform.y - height * m_anchorY, width, height};
+  m_layout.padding = detail::parseFloat(getProperty("padding"),
+                                        detail::kDefaultDialoguePadding);
+  const f32 width = m_layout.width;
+  const f32 padding = m_layout.padding;
 
-  if (!m_backgroundTextureId.empty()) {
-    auto texResult = m_resources->loadTexture(m_backgroundTextureId);
-    if (texResult.isOk() && texResult.value()->isValid()) {
-      const auto &texture = *texResult.value();
-      renderer::Transform2D transform{};
-      transform.x = rect.x;
-      transform.y = rect.y;
-      transform.scaleX = rect.width / static_cast<f32>(texture.getWidth());
-      transform.scaleY = rect.height / static_cast<f32>(texture.getHeight());
-      transform.anchorX = 0.0f;
-      transform.anchorY = 0.0f;
-      renderer::Color tint = renderer::Color::White;
-      tint.a = static_cast<u8>(tint.a * m_alpha);
-      renderer.drawSprite(texture, transform, tint);
-    }
-  } else {
-    renderer::Color bg = renderer::Color(30, 30, 30, 200);
-    bg.a = static_cast<u8>(bg.a * m_alpha);
-    renderer.fillRect(rect, bg);
-  }
+  // Fonts that fail to load (not mounted yet) are retried on the next frame
+  bool resolved = true;
 
   std::string fontId =
       detail::getTextProperty(*this, "fontId", detail::defaultFontPath());
   i32 fontSize =
       static_cast<i32>(detail::parseFloat(getProperty("fontSize"), 18.0f));
   if (!fontId.empty()) {
+    resolved = false;
     auto fontResult = m_resources->loadFont(fontId, fontSize);
     if (fontResult.isOk()) {
-      auto atlasResult =
-          m_resources->loadFontAtlas(fontId, fontSize,
-                                     " !\"#$%&'()*+,-./0123456789:;<=>?"
-                                     "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
-                                     "`abcdefghijklmnopqrstuvwxyz{|}~");
-      if (atlasResult.isOk()) {
-        renderer::TextLayoutEngine layout;
-        layout.setFont(fontResult.value());
-        layout.setFontAtlas(atlasResult.value());
-        layout.setMaxWidth(rect.width - padding * 2.0f);
-        layout.setAlignment(align);
-        layout.setRightToLeft(rtl);
-        renderer::TextStyle style;
-        style.color = renderer::Color::White;
-        style.size = static_cast<f32>(fontSize);
-        layout.setDefaultStyle(style);
-
-        std::string visible = m_text;
-        if (m_typewriterEnabled) {
-          size_t count = static_cast<size_t>(
-              std::min(m_typewriterProgress, static_cast<f32>(m_text.size())));
-          visible = m_text.substr(0, count);
+      m_layout.font = fontResult.value();
+      resolved = true;
+
+      // Measured with the glyph cache the renderer draws from, so any
+      // script the font covers lays out without a pre-baked atlas
+      renderer::TextLayoutEngine layout;
+      layout.setFont(fontResult.value());
+      layout.setGlyphCache(m_resources->getGlyphCache());
+      layout.setMaxWidth(width - padding * 2.0f);
+      layout.setAlignment(align);
+      layout.setRightToLeft(rtl);
+      renderer::TextStyle style;
+      style.color = renderer::Color::White;
+      style.size = static_cast<f32>(fontSize);
+      layout.setDefaultStyle(style);
+
+      // Runs are stored in reveal order; in RTL each run sits to the
+      // left of the one before it
+      renderer::TextLayout textLayout = layout.layout(m_text);
+      f32 y = padding + static_cast<f32>(fontSize);
+      for (const auto &line : textLayout.lines) {
+        f32 x = padding;
+        if (align == renderer::TextAlign::Center) {
+          x = (width - line.width) * 0.5f;
+        } else if (align == renderer::TextAlign::Right) {
+          x = width - padding;
         }
 
-        renderer::TextLayout textLayout = layout.layout(visible);
-        f32 y = rect.y + padding + static_cast<f32>(fontSize);
-        for (const auto &line : textLayout.lines) {
-          f32 x = rect.x + padding;
-          if (align == renderer::TextAlign::Center) {
-            x = rect.x + (rect.width - line.width) * 0.5f;
-          } else if (align == renderer::TextAlign::Right) {
-            x = rect.x + rect.width - padding;
+        for (const auto &segment : line.segments) {
+          if (segment.isCommand()) {
+            continue;
           }
-
-          if (!rtl) {
-            for (const auto &segment : line.segments) {
-              if (segment.isCommand()) {
-                continue;
-              }
-              renderer.drawText(*fontResult.value(), segment.text, x, y,
-                                segment.style.color);
-              x += layout.measureText(segment.text).first;
-            }
+          GlyphRun run;
+          run.text = segment.text;
+          run.color = segment.style.color;
+          run.y = y;
+          run.firstGlyph = m_layout.advances.size();
+          for (usize pos = 0; pos < segment.text.size(); ++run.glyphCount) {
+            const f32 advance = layout.measureGlyph(
+                renderer::nextCodepoint(segment.text, pos), segment.style);
+            m_layout.advances.push_back(advance);
+            run.width += advance;
+          }
+          if (rtl) {
+            x -= run.width;
+            run.x = x;
           } else {
-            for (auto it = line.segments.rbegin(); it != line.segments.rend();
-                 ++it) {
-              if (it->isCommand()) {
-                continue;
-              }
-              const f32 segWidth = layout.measureText(it->text).first;
-              x -= segWidth;
-              renderer.drawText(*fontResult.value(), it->text, x, y,
-                                it->style.color);
-            }
+            run.x = x;
+            x += run.width;
           }
-          y += line.height;
+          m_layout.runs.push_back(std::move(run));
         }
+        y += line.height;
       }
     }
   }
@@ -190,22 +169,110 @@ void DialogueUIObject::render(renderer::IRenderer &renderer) {
         getProperty("speakerFontSize"), static_cast<float>(fontSize + 2)));
     if (!speakerFontId.empty()) {
       auto fontResult = m_resources->loadFont(speakerFontId, speakerFontSize);
+      resolved = resolved && fontResult.isOk();
       if (fontResult.isOk()) {
-        f32 speakerX = rect.x + padding;
+        m_layout.speakerFont = fontResult.value();
+        m_layout.speakerX = padding;
         if (rtl) {
           renderer::TextLayoutEngine speakerLayout;
           speakerLayout.setFont(fontResult.value());
+          speakerLayout.setGlyphCache(m_resources->getGlyphCache());
           renderer::TextStyle speakerStyle;
           speakerStyle.size = static_cast<f32>(speakerFontSize);
           speakerLayout.setDefaultStyle(speakerStyle);
           f32 speakerWidth = speakerLayout.measureText(m_speaker).first;
-          speakerX = rect.x + rect.width - padding - speakerWidth;
+          m_layout.speakerX = width - padding - speakerWidth;
+        }
+      }
+    }
+  }
+
+  m_layout.valid = resolved;
+}
+
+void DialogueUIObject::render(renderer::IRenderer &renderer) {
+  if (!m_visible || m_alpha <= 0.0f) {
+    return;
+  }
+
+  if (!m_resources) {
+    return;
+  }
+
+  const bool localeRtl =
+      m_localization ? m_localization->isCurrentLocaleRightToLeft() : false;
+  if (!m_layout.valid || m_layout.propertyRevision != getPropertyRevision() ||
+      m_layout.resources != m_resources || m_layout.localeRtl != localeRtl) {
+    rebuildLayout(localeRtl);
+  }
+
+  renderer::Rect rect{m_transform.x - m_layout.width * m_anchorX,
+                      m_transform.y - m_layout.height * m_anchorY,
+                      m_layout.width, m_layout.height};
+
+  if (!m_backgroundTextureId.empty()) {
+    auto texResult = m_resources->loadTexture(m_backgroundTextureId);
+    if (texResult.isOk() && texResult.value()->isValid()) {
+      const auto &texture = *texResult.value();
+      renderer::Transform2D transform{};
+      transform.x = rect.x;
+      transform.y = rect.y;
+      transform.scaleX = rect.width / static_cast<f32>(texture.getWidth());
+      transform.scaleY = rect.height / static_cast<f32>(texture.getHeight());
+      transform.anchorX = 0.0f;
+      transform.anchorY = 0.0f;
+      renderer::Color tint = renderer::Color::White;
+      tint.a = static_cast<u8>(tint.a * m_alpha);
+      renderer.drawSprite(texture, transform, tint);
+    }
+  } else {
+    renderer::Color bg = renderer::Color(30, 30, 30, 200);
+    bg.a = static_cast<u8>(bg.a * m_alpha);
+    renderer.fillRect(rect, bg);
+  }
+
+  if (m_layout.font) {
+    usize visible = m_layout.advances.size();
+    if (m_typewriterEnabled) {
+      visible = std::min(visible, static_cast<usize>(std::max(
+                                      m_typewriterProgress, 0.0f)));
+    }
+
+    for (const auto &run : m_layout.runs) {
+      if (run.firstGlyph >= visible) {
+        break;
+      }
+      const usize count = std::min(run.glyphCount, visible - run.firstGlyph);
+      if (count == run.glyphCount) {
+        renderer.drawText(*m_layout.font, run.text, rect.x + run.x,
+                          rect.y + run.y, run.color);
+        continue;
+      }
+
+      // Partially typed run: LTR grows from the left edge, RTL from the right
+      usize bytes = 0;
+      for (usize i = 0; i < count; ++i) {
+        (void)renderer::nextCodepoint(run.text, bytes);
+      }
+      m_partialRun.assign(run.text, 0, bytes);
+      f32 x = run.x;
+      if (m_layout.rtl) {
+        f32 typedWidth = 0.0f;
+        for (usize i = 0; i < count; ++i) {
+          typedWidth += m_layout.advances[run.firstGlyph + i];
         }
-        renderer.drawText(*fontResult.value(), m_speaker, speakerX,
-                          rect.y + padding, m_speakerColor);
+        x += run.width - typedWidth;
       }
+      renderer.drawText(*m_layout.font, m_partialRun, rect.x + x,
+                        rect.y + run.y, run.color);
     }
   }
+
+  if (m_layout.speakerFont) {
+    renderer.drawText(*m_layout.speakerFont, m_speaker,
+                      rect.x + m_layout.speakerX, rect.y + m_layout.padding,
+                      m_speakerColor);
+  }
 }
 
 SceneObjectState DialogueUIObject::saveState() const {
@@ -221,14 +288,17 @@ SceneObjectState DialogueUIObject::saveState() const {
 
 void DialogueUIObject::loadState(const SceneObjectState &state) {
   SceneObjectBase::loadState(state);
+  m_layout.valid = false;
 
   auto it = state.properties.find("speaker");
   if (it != state.properties.end())
     m_speaker = it->second;
 
   it = state.properties.find("text");
-  if (it != state.properties.end())
+  if (it != state.properties.end()) {
     m_text = it->second;
+    m_textGlyphs = renderer::countCodepoints(m_text);
+  }
 
   it = state.properties.find("backgroundTextureId");
   if (it != state.properties.end())
@@ -255,9 +255,40 @@ void SlideTransition::update(f64 deltaTime) {
 }
 
 void SlideTransition::render(renderer::IRenderer &renderer) {
-  // Slide transitions don't directly render anything
-  // They provide offset values for the scene to use
-  (void)renderer;
+  if (!m_hasOutgoing || !m_running) {
+    return;
+  }
+
+  // The old frame leads the incoming content by one screen
+  renderer::Transform2D transform;
+  switch (m_direction) {
+  case Direction::Left:
+    transform.x = m_offset - m_screenSize;
+    break;
+  case Direction::Right:
+    transform.x = m_offset + m_screenSize;
+    break;
+  case Direction::Up:
+    transform.y = m_offset - m_screenSize;
+    break;
+  case Direction::Down:
+    transform.y = m_offset + m_screenSize;
+    break;
+  }
+
+  renderer.setBlendMode(renderer::BlendMode::None);
+  renderer.drawSprite(m_outgoing, transform);
+  renderer.setBlendMode(renderer::BlendMode::Alpha);
+}
+
+void SlideTransition::captureOutgoing(renderer::IRenderer &renderer) {
+  const bool horizontal =
+      m_direction == Direction::Left || m_direction == Direction::Right;
+  const i32 size = horizontal ? renderer.getWidth() : renderer.getHeight();
+  if (size > 0) {
+    m_screenSize = static_cast<f32>(size);
+  }
+  m_hasOutgoing = renderer.snapshot(m_outgoing).isOk();
 }
 
 bool SlideTransition::isComplete() const { return m_complete; }
@@ -329,10 +360,23 @@ void DissolveTransition::update(f64 deltaTime) {
 }
 
 void DissolveTransition::render(renderer::IRenderer &renderer) {
-  // Dissolve uses alpha blending controlled by getDissolveAlpha()
-  // The actual dissolve pattern would need shader support
-  // For now, we can approximate with a simple crossfade
-  (void)renderer;
+  if (!m_hasOutgoing || !m_running) {
+    return;
+  }
+
+  const f32 remaining = 1.0f - getDissolveAlpha();
+  if (remaining <= 0.0f) {
+    return;
+  }
+
+  renderer.setBlendMode(renderer::BlendMode::Alpha);
+  renderer.drawSprite(m_outgoing, renderer::Transform2D{},
+                      renderer::Color(255, 255, 255,
+                                      static_cast<u8>(remaining * 255.0f)));
+}
+
+void DissolveTransition::captureOutgoing(renderer::IRenderer &renderer) {
+  m_hasOutgoing = renderer.snapshot(m_outgoing).isOk();
 }
 
 bool DissolveTransition::isComplete() const { return m_complete; }
@@ -0,0 +1,381 @@
+#include "NovelMind/scripting/bytecode_file.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+namespace NovelMind::scripting {
+
+using namespace bytecode;
+
+// The instruction section is the in-memory Instruction layout; the VM reads
+// it in place, so the two must never drift apart.
+static_assert(std::endian::native == std::endian::little,
+              ".nmc images are little-endian");
+static_assert(std::is_trivially_copyable_v<Instruction>);
+static_assert(sizeof(Instruction) == 8 && offsetof(Instruction, operand) == 4,
+              "Instruction layout must match the .nmc instruction section");
+static_assert(sizeof(FileHeader) == 64);
+static_assert(sizeof(SceneRecord) == 16);
+static_assert(sizeof(CharacterRecord) == 40);
+static_assert(sizeof(DebugRecord) == 32);
+
+namespace {
+
+constexpr usize ALIGNMENT = 8;
+
+usize alignUp(usize value) {
+  return (value + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+/// Accumulates the string data section, deduplicating identical strings
+class StringDataBuilder {
+public:
+  StringRef add(const std::string &str) {
+    auto it = m_offsets.find(str);
+    if (it != m_offsets.end()) {
+      return {it->second, static_cast<u32>(str.size())};
+    }
+    const auto offset = static_cast<u32>(m_data.size());
+    m_data.insert(m_data.end(), str.begin(), str.end());
+    m_offsets.emplace(str, offset);
+    return {offset, static_cast<u32>(str.size())};
+  }
+
+  [[nodiscard]] const std::vector<u8> &data() const { return m_data; }
+
+private:
+  std::vector<u8> m_data;
+  std::unordered_map<std::string, u32> m_offsets;
+};
+
+template <typename T>
+void writeAt(std::vector<u8> &out, usize offset, const T *items, usize count) {
+  if (count > 0) {
+    std::memcpy(out.data() + offset, items, sizeof(T) * count);
+  }
+}
+
+bool rangeFits(usize offset, usize count, usize itemSize, usize total) {
+  if (offset % 4 != 0 || offset > total) {
+    return false;
+  }
+  return count <= (total - offset) / itemSize;
+}
+
+} // namespace
+
+std::vector<u8> serializeBytecode(const CompiledScript &script,
+                                  bool includeDebugInfo) {
+  StringDataBuilder strings;
+
+  std::vector<StringRef> stringRefs;
+  stringRefs.reserve(script.stringTable.size());
+  for (const auto &str : script.stringTable) {
+    stringRefs.push_back(strings.add(str));
+  }
+
+  std::vector<SceneRecord> scenes;
+  scenes.reserve(script.sceneEntryPoints.size());
+  for (const auto &[name, entry] : script.sceneEntryPoints) {
+    scenes.push_back({strings.add(name), entry, 0});
+  }
+
+  std::vector<CharacterRecord> characters;
+  characters.reserve(script.characters.size());
+  for (const auto &[id, decl] : script.characters) {
+    CharacterRecord record{};
+    record.id = strings.add(id);
+    record.displayName = strings.add(decl.displayName);
+    record.color = strings.add(decl.color);
+    if (decl.defaultSprite) {
+      record.defaultSprite = strings.add(*decl.defaultSprite);
+      record.hasDefaultSprite = 1;
+    }
+    characters.push_back(record);
+  }
+
+  std::vector<DebugRecord> debug;
+  if (includeDebugInfo) {
+    debug.reserve(script.sourceMappings.size());
+    for (const auto &[ip, loc] : script.sourceMappings) {
+      DebugRecord record{};
+      record.instruction = ip;
+      record.line = loc.line;
+      record.column = loc.column;
+      record.filePath = strings.add(loc.filePath);
+      record.sceneName = strings.add(loc.sceneName);
+      debug.push_back(record);
+    }
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = FORMAT_VERSION;
+  header.flags = debug.empty() ? 0 : FLAG_DEBUG_INFO;
+
+  usize offset = alignUp(sizeof(FileHeader));
+  auto place = [&offset](usize count, usize itemSize) {
+    const usize at = offset;
+    offset = alignUp(offset + count * itemSize);
+    return static_cast<u32>(at);
+  };
+
+  header.instructionCount = static_cast<u32>(script.instructions.size());
+  header.instructionOffset =
+      place(script.instructions.size(), sizeof(Instruction));
+  header.stringCount = static_cast<u32>(stringRefs.size());
+  header.stringOffset = place(stringRefs.size(), sizeof(StringRef));
+  header.sceneCount = static_cast<u32>(scenes.size());
+  header.sceneOffset = place(scenes.size(), sizeof(SceneRecord));
+  header.characterCount = static_cast<u32>(characters.size());
+  header.characterOffset = place(characters.size(), sizeof(CharacterRecord));
+  header.debugCount = static_cast<u32>(debug.size());
+  header.debugOffset = place(debug.size(), sizeof(DebugRecord));
+  header.stringDataSize = static_cast<u32>(strings.data().size());
+  header.stringDataOffset = place(strings.data().size(), 1);
+  header.fileSize = static_cast<u32>(offset);
+
+  std::vector<u8> out(offset, 0);
+  writeAt(out, 0, &header, 1);
+  // Instruction has padding after the opcode; write field by field so the
+  // padding bytes in the file are always zero
+  for (usize i = 0; i < script.instructions.size(); ++i) {
+    u8 *dst = out.data() + header.instructionOffset + i * sizeof(Instruction);
+    std::memcpy(dst, &script.instructions[i].opcode, sizeof(OpCode));
+    std::memcpy(dst + offsetof(Instruction, operand),
+                &script.instructions[i].operand, sizeof(u32));
+  }
+  writeAt(out, header.stringOffset, stringRefs.data(), stringRefs.size());
+  writeAt(out, header.sceneOffset, scenes.data(), scenes.size());
+  writeAt(out, header.characterOffset, characters.data(), characters.size());
+  writeAt(out, header.debugOffset, debug.data(), debug.size());
+  writeAt(out, header.stringDataOffset, strings.data().data(),
+          strings.data().size());
+  return out;
+}
+
+Result<void> writeBytecodeFile(const CompiledScript &script,
+                               const std::string &path,
+                               bool includeDebugInfo) {
+  const auto bytes = serializeBytecode(script, includeDebugInfo);
+
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    return Result<void>::error("Cannot create bytecode file: " + path);
+  }
+  file.write(reinterpret_cast<const char *>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+  if (!file) {
+    return Result<void>::error("Failed to write bytecode file: " + path);
+  }
+  return Result<void>::ok();
+}
+
+// =========================================================================
+// BytecodeImage
+// =========================================================================
+
+Result<BytecodeImage> BytecodeImage::open(const std::string &path) {
+  auto mapped = platform::MappedFile::open(path);
+  if (mapped.isError()) {
+    return Result<BytecodeImage>::error(mapped.error());
+  }
+
+  BytecodeImage image;
+  image.m_file = std::move(mapped).value();
+  image.m_data = image.m_file.data();
+  image.m_size = image.m_file.size();
+
+  auto valid = image.validate();
+  if (valid.isError()) {
+    return Result<BytecodeImage>::error(path + ": " + valid.error());
+  }
+  return Result<BytecodeImage>::ok(std::move(image));
+}
+
+Result<BytecodeImage> BytecodeImage::fromMemory(std::span<const u8> bytes) {
+  BytecodeImage image;
+  image.m_owned.resize((bytes.size() + sizeof(u64) - 1) / sizeof(u64));
+  if (!bytes.empty()) {
+    std::memcpy(image.m_owned.data(), bytes.data(), bytes.size());
+  }
+  image.m_data = reinterpret_cast<const u8 *>(image.m_owned.data());
+  image.m_size = bytes.size();
+
+  auto valid = image.validate();
+  if (valid.isError()) {
+    return Result<BytecodeImage>::error(valid.error());
+  }
+  return Result<BytecodeImage>::ok(std::move(image));
+}
+
+bool BytecodeImage::hasMagic(std::span<const u8> bytes) {
+  return bytes.size() >= sizeof(MAGIC) &&
+         std::memcmp(bytes.data(), MAGIC, sizeof(MAGIC)) == 0;
+}
+
+Result<void> BytecodeImage::validate() const {
+  if (m_size < sizeof(FileHeader) ||
+      !hasMagic(std::span<const u8>(m_data, m_size))) {
+    return Result<void>::error("Not a compiled script (bad magic)");
+  }
+  if (reinterpret_cast<uintptr_t>(m_data) % alignof(u32) != 0) {
+    return Result<void>::error("Bytecode image is misaligned");
+  }
+
+  const FileHeader &h = header();
+  if (h.version != FORMAT_VERSION) {
+    return Result<void>::error("Unsupported bytecode format version " +
+                               std::to_string(h.version));
+  }
+  if (h.fileSize < sizeof(FileHeader) || h.fileSize > m_size) {
+    return Result<void>::error("Bytecode image is truncated");
+  }
+
+  const usize size = h.fileSize;
+  if (!rangeFits(h.instructionOffset, h.instructionCount, sizeof(Instruction),
+                 size) ||
+      !rangeFits(h.stringOffset, h.stringCount, sizeof(StringRef), size) ||
+      !rangeFits(h.sceneOffset, h.sceneCount, sizeof(SceneRecord), size) ||
+      !rangeFits(h.characterOffset, h.characterCount, sizeof(CharacterRecord),
+                 size) ||
+      !rangeFits(h.debugOffset, h.debugCount, sizeof(DebugRecord), size) ||
+      h.stringDataOffset > size || h.stringDataSize > size - h.stringDataOffset) {
+    return Result<void>::error("Bytecode section out of bounds");
+  }
+
+  auto refValid = [&h](const StringRef &ref) {
+    return ref.offset <= h.stringDataSize &&
+           ref.length <= h.stringDataSize - ref.offset;
+  };
+
+  const auto *strings = section<StringRef>(h.stringOffset);
+  for (u32 i = 0; i < h.stringCount; ++i) {
+    if (!refValid(strings[i])) {
+      return Result<void>::error("Bytecode string table entry out of bounds");
+    }
+  }
+  const auto *scenes = section<SceneRecord>(h.sceneOffset);
+  for (u32 i = 0; i < h.sceneCount; ++i) {
+    if (!refValid(scenes[i].name) || scenes[i].entryPoint > h.instructionCount) {
+      return Result<void>::error("Bytecode scene record is invalid");
+    }
+  }
+  const auto *characters = section<CharacterRecord>(h.characterOffset);
+  for (u32 i = 0; i < h.characterCount; ++i) {
+    const auto &c = characters[i];
+    if (!refValid(c.id) || !refValid(c.displayName) || !refValid(c.color) ||
+        !refValid(c.defaultSprite)) {
+      return Result<void>::error("Bytecode character record is invalid");
+    }
+  }
+  const auto *debug = section<DebugRecord>(h.debugOffset);
+  for (u32 i = 0; i < h.debugCount; ++i) {
+    if (!refValid(debug[i].filePath) || !refValid(debug[i].sceneName)) {
+      return Result<void>::error("Bytecode debug record is invalid");
+    }
+  }
+
+  return Result<void>::ok();
+}
+
+const FileHeader &BytecodeImage::header() const {
+  static const FileHeader empty{};
+  return m_data ? *section<FileHeader>(0) : empty;
+}
+
+std::string_view BytecodeImage::view(const StringRef &ref) const {
+  const char *base =
+      reinterpret_cast<const char *>(m_data + header().stringDataOffset);
+  return {base + ref.offset, ref.length};
+}
+
+std::span<const Instruction> BytecodeImage::instructions() const {
+  if (!m_data) {
+    return {};
+  }
+  return {section<Instruction>(header().instructionOffset),
+          header().instructionCount};
+}
+
+std::string_view BytecodeImage::string(u32 index) const {
+  if (index >= header().stringCount) {
+    return {};
+  }
+  return view(section<StringRef>(header().stringOffset)[index]);
+}
+
+std::string_view BytecodeImage::sceneName(u32 index) const {
+  if (index >= header().sceneCount) {
+    return {};
+  }
+  return view(section<SceneRecord>(header().sceneOffset)[index].name);
+}
+
+u32 BytecodeImage::sceneEntryPoint(u32 index) const {
+  if (index >= header().sceneCount) {
+    return 0;
+  }
+  return section<SceneRecord>(header().sceneOffset)[index].entryPoint;
+}
+
+CharacterDecl BytecodeImage::character(u32 index) const {
+  CharacterDecl decl;
+  if (index >= header().characterCount) {
+    return decl;
+  }
+  const auto &record = section<CharacterRecord>(header().characterOffset)[index];
+  decl.id = std::string(view(record.id));
+  decl.displayName = std::string(view(record.displayName));
+  decl.color = std::string(view(record.color));
+  if (record.hasDefaultSprite) {
+    decl.defaultSprite = std::string(view(record.defaultSprite));
+  }
+  return decl;
+}
+
+std::vector<std::string> BytecodeImage::stringTable() const {
+  std::vector<std::string> table;
+  table.reserve(stringCount());
+  for (u32 i = 0; i < stringCount(); ++i) {
+    table.emplace_back(string(i));
+  }
+  return table;
+}
+
+CompiledScript BytecodeImage::metadata() const {
+  CompiledScript script;
+  script.stringTable = stringTable();
+
+  for (u32 i = 0; i < sceneCount(); ++i) {
+    script.sceneEntryPoints.emplace(std::string(sceneName(i)),
+                                    sceneEntryPoint(i));
+  }
+  for (u32 i = 0; i < characterCount(); ++i) {
+    auto decl = character(i);
+    const std::string id = decl.id;
+    script.characters.emplace(id, std::move(decl));
+  }
+
+  const auto *debug = section<DebugRecord>(header().debugOffset);
+  for (u32 i = 0; i < header().debugCount; ++i) {
+    DebugSourceLocation loc(std::string(view(debug[i].filePath)),
+                            debug[i].line, debug[i].column);
+    loc.sceneName = std::string(view(debug[i].sceneName));
+    script.sourceMappings.emplace(debug[i].instruction, std::move(loc));
+  }
+
+  return script;
+}
+
+CompiledScript BytecodeImage::toCompiledScript() const {
+  CompiledScript script = metadata();
+  const auto code = instructions();
+  script.instructions.assign(code.begin(), code.end());
+  return script;
+}
+
+} // namespace NovelMind::scripting
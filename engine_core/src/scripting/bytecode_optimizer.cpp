@@ -0,0 +1,454 @@
+#include "NovelMind/scripting/bytecode_optimizer.hpp"
+#include "NovelMind/scripting/vm_value.hpp"
+#include <cstring>
+#include <limits>
+#include <optional>
+
+namespace NovelMind::scripting {
+
+namespace {
+
+constexpr u32 MAX_PASSES = 16;
+
+bool isJumpOp(OpCode op) {
+  return op == OpCode::JUMP || op == OpCode::JUMP_IF ||
+         op == OpCode::JUMP_IF_NOT;
+}
+
+/// Opcodes whose operand is an instruction address
+bool hasCodeOperand(OpCode op) {
+  return isJumpOp(op) || op == OpCode::GOTO_SCENE;
+}
+
+std::optional<VMValue> literalOf(const Instruction &instr) {
+  switch (instr.opcode) {
+  case OpCode::PUSH_INT:
+    return VMValue::makeInt(static_cast<i32>(instr.operand));
+  case OpCode::PUSH_FLOAT: {
+    f32 val;
+    std::memcpy(&val, &instr.operand, sizeof(f32));
+    return VMValue::makeFloat(val);
+  }
+  case OpCode::PUSH_BOOL:
+    return VMValue::makeBool(instr.operand != 0);
+  default:
+    return std::nullopt;
+  }
+}
+
+Instruction literalInstruction(const VMValue &value) {
+  switch (value.type) {
+  case ValueType::Float: {
+    u32 bits = 0;
+    std::memcpy(&bits, &value.f, sizeof(f32));
+    return {OpCode::PUSH_FLOAT, bits};
+  }
+  case ValueType::Bool:
+    return {OpCode::PUSH_BOOL, value.b ? 1u : 0u};
+  default:
+    return {OpCode::PUSH_INT, static_cast<u32>(value.i)};
+  }
+}
+
+bool isNumeric(const VMValue &v) {
+  return v.type == ValueType::Int || v.type == ValueType::Float;
+}
+
+std::optional<VMValue> intResult(i64 value) {
+  if (value < std::numeric_limits<i32>::min() ||
+      value > std::numeric_limits<i32>::max()) {
+    return std::nullopt; // leave overflow to the runtime
+  }
+  return VMValue::makeInt(static_cast<i32>(value));
+}
+
+// Folding mirrors the VM operator semantics exactly; anything that would
+// take a runtime error path (division by zero, overflow) is left alone.
+std::optional<VMValue> foldBinary(OpCode op, const VMValue &a,
+                                  const VMValue &b) {
+  const bool anyFloat =
+      a.type == ValueType::Float || b.type == ValueType::Float;
+
+  switch (op) {
+  case OpCode::ADD:
+  case OpCode::SUB:
+  case OpCode::MUL: {
+    if (!isNumeric(a) || !isNumeric(b)) {
+      return std::nullopt;
+    }
+    if (anyFloat) {
+      const f32 x = a.asFloat();
+      const f32 y = b.asFloat();
+      return VMValue::makeFloat(op == OpCode::ADD   ? x + y
+                                : op == OpCode::SUB ? x - y
+                                                    : x * y);
+    }
+    const i64 x = a.i;
+    const i64 y = b.i;
+    return intResult(op == OpCode::ADD   ? x + y
+                     : op == OpCode::SUB ? x - y
+                                         : x * y);
+  }
+  case OpCode::DIV:
+    if (!isNumeric(a) || !isNumeric(b)) {
+      return std::nullopt;
+    }
+    if (anyFloat) {
+      if (b.asFloat() == 0.0f) {
+        return std::nullopt;
+      }
+      return VMValue::makeFloat(a.asFloat() / b.asFloat());
+    }
+    if (b.i == 0) {
+      return std::nullopt;
+    }
+    return intResult(static_cast<i64>(a.i) / b.i);
+  case OpCode::MOD:
+    if (a.type != ValueType::Int || b.type != ValueType::Int || b.i == 0 ||
+        b.i == -1) {
+      return std::nullopt;
+    }
+    return VMValue::makeInt(a.i % b.i);
+  case OpCode::EQ:
+  case OpCode::NE: {
+    bool equal = false;
+    if (a.type == ValueType::Bool && b.type == ValueType::Bool) {
+      equal = a.b == b.b;
+    } else if (anyFloat) {
+      equal = a.asFloat() == b.asFloat();
+    } else {
+      equal = a.asInt() == b.asInt();
+    }
+    return VMValue::makeBool(op == OpCode::EQ ? equal : !equal);
+  }
+  case OpCode::LT:
+  case OpCode::LE:
+  case OpCode::GT:
+  case OpCode::GE: {
+    int cmp = 0;
+    if (anyFloat) {
+      const f32 x = a.asFloat();
+      const f32 y = b.asFloat();
+      if (x != x || y != y) {
+        return std::nullopt; // NaN ordering is not three-way
+      }
+      cmp = x < y ? -1 : (x > y ? 1 : 0);
+    } else {
+      cmp = a.asInt() < b.asInt() ? -1 : (a.asInt() > b.asInt() ? 1 : 0);
+    }
+    switch (op) {
+    case OpCode::LT:
+      return VMValue::makeBool(cmp < 0);
+    case OpCode::LE:
+      return VMValue::makeBool(cmp <= 0);
+    case OpCode::GT:
+      return VMValue::makeBool(cmp > 0);
+    default:
+      return VMValue::makeBool(cmp >= 0);
+    }
+  }
+  case OpCode::AND:
+    return VMValue::makeBool(a.asBool() && b.asBool());
+  case OpCode::OR:
+    return VMValue::makeBool(a.asBool() || b.asBool());
+  default:
+    return std::nullopt;
+  }
+}
+
+std::optional<VMValue> foldUnary(OpCode op, const VMValue &a) {
+  switch (op) {
+  case OpCode::NEG:
+    if (a.type == ValueType::Float) {
+      return VMValue::makeFloat(-a.f);
+    }
+    return intResult(-static_cast<i64>(a.asInt()));
+  case OpCode::NOT:
+    return VMValue::makeBool(!a.asBool());
+  default:
+    return std::nullopt;
+  }
+}
+
+} // namespace
+
+OptimizerStats BytecodeOptimizer::optimize(CompiledScript &script) {
+  m_stats = OptimizerStats{};
+  m_stats.instructionsBefore = static_cast<u32>(script.instructions.size());
+
+  for (u32 pass = 0; pass < MAX_PASSES; ++pass) {
+    bool changed = false;
+    changed |= foldConstants(script);
+    changed |= simplifyBranches(script);
+    changed |= threadJumps(script);
+    changed |= removeDeadCode(script);
+    if (!changed) {
+      break;
+    }
+  }
+
+  m_stats.instructionsAfter = static_cast<u32>(script.instructions.size());
+  return m_stats;
+}
+
+void BytecodeOptimizer::computeJumpTargets(const CompiledScript &script) {
+  const usize n = script.instructions.size();
+  m_jumpTargets.assign(n + 1, false);
+  m_jumpTargets[0] = true;
+
+  for (const auto &instr : script.instructions) {
+    if (hasCodeOperand(instr.opcode) && instr.operand <= n) {
+      m_jumpTargets[instr.operand] = true;
+    }
+  }
+  for (const auto &[name, entry] : script.sceneEntryPoints) {
+    if (entry <= n) {
+      m_jumpTargets[entry] = true;
+    }
+  }
+}
+
+void BytecodeOptimizer::removeInto(CompiledScript &script, usize index,
+                                   usize keeper) {
+  m_removed[index] = true;
+
+  auto it = script.sourceMappings.find(static_cast<u32>(index));
+  if (it == script.sourceMappings.end()) {
+    return;
+  }
+  if (keeper < script.instructions.size() &&
+      script.sourceMappings.find(static_cast<u32>(keeper)) ==
+          script.sourceMappings.end()) {
+    script.sourceMappings[static_cast<u32>(keeper)] = it->second;
+  }
+  script.sourceMappings.erase(it);
+}
+
+bool BytecodeOptimizer::foldConstants(CompiledScript &script) {
+  auto &code = script.instructions;
+  const usize n = code.size();
+  computeJumpTargets(script);
+  m_removed.assign(n, false);
+  bool changed = false;
+
+  for (usize i = 0; i < n; ++i) {
+    auto a = literalOf(code[i]);
+    if (!a) {
+      continue;
+    }
+
+    // literal literal binop  ->  literal
+    if (i + 2 < n && !isJumpTarget(i + 1) && !isJumpTarget(i + 2)) {
+      if (auto b = literalOf(code[i + 1])) {
+        if (auto result = foldBinary(code[i + 2].opcode, *a, *b)) {
+          code[i] = literalInstruction(*result);
+          removeInto(script, i + 1, i);
+          removeInto(script, i + 2, i);
+          ++m_stats.constantsFolded;
+          changed = true;
+          i += 2;
+          continue;
+        }
+      }
+    }
+
+    // literal unop  ->  literal
+    if (i + 1 < n && !isJumpTarget(i + 1)) {
+      if (auto result = foldUnary(code[i + 1].opcode, *a)) {
+        code[i] = literalInstruction(*result);
+        removeInto(script, i + 1, i);
+        ++m_stats.constantsFolded;
+        changed = true;
+        i += 1;
+      }
+    }
+  }
+
+  if (changed) {
+    compact(script);
+  }
+  return changed;
+}
+
+bool BytecodeOptimizer::simplifyBranches(CompiledScript &script) {
+  auto &code = script.instructions;
+  const usize n = code.size();
+  computeJumpTargets(script);
+  m_removed.assign(n, false);
+  bool changed = false;
+
+  for (usize i = 0; i < n; ++i) {
+    const OpCode op = code[i].opcode;
+
+    // Jumps to the very next instruction
+    if (isJumpOp(op) && code[i].operand == i + 1) {
+      if (op == OpCode::JUMP) {
+        removeInto(script, i, i + 1);
+      } else {
+        code[i] = Instruction(OpCode::POP); // still consumes the condition
+      }
+      ++m_stats.branchesSimplified;
+      changed = true;
+      continue;
+    }
+
+    if (i + 1 >= n || isJumpTarget(i + 1)) {
+      continue;
+    }
+    const Instruction &next = code[i + 1];
+    if (next.opcode != OpCode::JUMP_IF && next.opcode != OpCode::JUMP_IF_NOT) {
+      continue;
+    }
+
+    // NOT; JUMP_IF  ->  JUMP_IF_NOT   (and vice versa)
+    if (op == OpCode::NOT) {
+      const OpCode inverted = next.opcode == OpCode::JUMP_IF
+                                  ? OpCode::JUMP_IF_NOT
+                                  : OpCode::JUMP_IF;
+      code[i] = Instruction(inverted, next.operand);
+      removeInto(script, i + 1, i);
+      ++m_stats.branchesSimplified;
+      changed = true;
+      ++i;
+      continue;
+    }
+
+    // literal; JUMP_IF(_NOT)  ->  JUMP or fall through
+    if (auto cond = literalOf(code[i])) {
+      const bool taken = next.opcode == OpCode::JUMP_IF ? cond->asBool()
+                                                        : !cond->asBool();
+      if (taken) {
+        code[i] = Instruction(OpCode::JUMP, next.operand);
+        removeInto(script, i + 1, i);
+      } else if (i + 2 < n) {
+        removeInto(script, i, i + 2);
+        removeInto(script, i + 1, i + 2);
+      } else {
+        continue;
+      }
+      ++m_stats.branchesSimplified;
+      changed = true;
+      ++i;
+    }
+  }
+
+  if (changed) {
+    compact(script);
+  }
+  return changed;
+}
+
+bool BytecodeOptimizer::threadJumps(CompiledScript &script) {
+  auto &code = script.instructions;
+  const usize n = code.size();
+  bool changed = false;
+
+  for (usize i = 0; i < n; ++i) {
+    if (!isJumpOp(code[i].opcode)) {
+      continue;
+    }
+
+    u32 target = code[i].operand;
+    usize hops = 0;
+    while (target < n && code[target].opcode == OpCode::JUMP &&
+           code[target].operand != target && hops < n) {
+      target = code[target].operand;
+      ++hops;
+    }
+
+    if (target != code[i].operand) {
+      code[i].operand = target;
+      ++m_stats.jumpsThreaded;
+      changed = true;
+    }
+
+    // An unconditional jump straight to HALT may as well halt here
+    if (code[i].opcode == OpCode::JUMP && target < n &&
+        code[target].opcode == OpCode::HALT) {
+      code[i] = Instruction(OpCode::HALT);
+      ++m_stats.jumpsThreaded;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+bool BytecodeOptimizer::removeDeadCode(CompiledScript &script) {
+  auto &code = script.instructions;
+  const usize n = code.size();
+  computeJumpTargets(script);
+  m_removed.assign(n, false);
+  bool changed = false;
+
+  for (usize i = 0; i < n; ++i) {
+    const OpCode op = code[i].opcode;
+    if (op != OpCode::HALT && op != OpCode::RETURN && op != OpCode::JUMP) {
+      continue;
+    }
+
+    // Everything up to the next jump target can never execute
+    usize j = i + 1;
+    while (j < n && !isJumpTarget(j)) {
+      m_removed[j] = true;
+      script.sourceMappings.erase(static_cast<u32>(j));
+      ++m_stats.deadInstructionsRemoved;
+      changed = true;
+      ++j;
+    }
+    i = j - 1;
+  }
+
+  if (changed) {
+    compact(script);
+  }
+  return changed;
+}
+
+void BytecodeOptimizer::compact(CompiledScript &script) {
+  auto &code = script.instructions;
+  const usize n = code.size();
+
+  // newIndex[k] = number of survivors before k, i.e. the new address of k or
+  // of the first survivor after it. Index n maps the one-past-end address.
+  std::vector<u32> newIndex(n + 1, 0);
+  u32 survivors = 0;
+  for (usize k = 0; k < n; ++k) {
+    newIndex[k] = survivors;
+    if (!m_removed[k]) {
+      ++survivors;
+    }
+  }
+  newIndex[n] = survivors;
+
+  std::vector<Instruction> compacted;
+  compacted.reserve(survivors);
+  std::unordered_map<u32, DebugSourceLocation> mappings;
+  for (usize k = 0; k < n; ++k) {
+    if (m_removed[k]) {
+      continue;
+    }
+    Instruction instr = code[k];
+    if (hasCodeOperand(instr.opcode) && instr.operand <= n) {
+      instr.operand = newIndex[instr.operand];
+    }
+    compacted.push_back(instr);
+
+    auto it = script.sourceMappings.find(static_cast<u32>(k));
+    if (it != script.sourceMappings.end()) {
+      mappings.emplace(newIndex[k], std::move(it->second));
+    }
+  }
+
+  for (auto &[name, entry] : script.sceneEntryPoints) {
+    if (entry <= n) {
+      entry = newIndex[entry];
+    }
+  }
+
+  code = std::move(compacted);
+  script.sourceMappings = std::move(mappings);
+  m_removed.assign(code.size(), false);
+}
+
+} // namespace NovelMind::scripting
@@ -1,4 +1,5 @@
 #include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/bytecode_optimizer.hpp"
 #include "NovelMind/scripting/vm_debugger.hpp"
 #include <cstring>
 
@@ -41,6 +42,11 @@ Result<CompiledScript> Compiler::compile(const Program &program, const std::stri
     return Result<CompiledScript>::error(m_errors[0].message);
   }
 
+  if (m_optimize) {
+    BytecodeOptimizer optimizer;
+    optimizer.optimize(m_output);
+  }
+
   return Result<CompiledScript>::ok(std::move(m_output));
 }
 
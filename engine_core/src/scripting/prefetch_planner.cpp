@@ -0,0 +1,109 @@
+#include "NovelMind/scripting/prefetch_planner.hpp"
+#include <deque>
+#include <unordered_set>
+
+namespace NovelMind::scripting {
+
+const std::string &PrefetchPlanner::characterTexture(
+    const std::string &characterId,
+    const std::unordered_map<std::string, CharacterDecl> &characters) {
+  auto it = characters.find(characterId);
+  if (it != characters.end() && it->second.defaultSprite.has_value()) {
+    return *it->second.defaultSprite;
+  }
+  return characterId;
+}
+
+std::vector<PrefetchAsset> PrefetchPlanner::plan(
+    std::span<const Instruction> program,
+    const std::vector<std::string> &strings,
+    const std::unordered_map<std::string, CharacterDecl> &characters,
+    u32 ip) const {
+  std::vector<PrefetchAsset> assets;
+  if (ip >= program.size() || m_lookahead == 0) {
+    return assets;
+  }
+
+  std::vector<bool> visited(program.size(), false);
+  std::unordered_set<std::string> seenTextures;
+  std::unordered_set<std::string> seenAudio;
+
+  auto addAsset = [&](PrefetchKind kind, const std::string &id,
+                      u32 distance) {
+    if (id.empty()) {
+      return;
+    }
+    auto &seen = kind == PrefetchKind::Texture ? seenTextures : seenAudio;
+    if (seen.insert(id).second) {
+      assets.push_back(PrefetchAsset{kind, id, distance});
+    }
+  };
+
+  auto stringAt = [&](u32 index) -> const std::string * {
+    return index < strings.size() ? &strings[index] : nullptr;
+  };
+
+  // Breadth-first, so every asset is reported at its shortest distance
+  std::deque<std::pair<u32, u32>> queue;
+  queue.emplace_back(ip, 0);
+  visited[ip] = true;
+
+  auto enqueue = [&](u32 target, u32 distance) {
+    if (target < program.size() && !visited[target] &&
+        distance <= m_lookahead) {
+      visited[target] = true;
+      queue.emplace_back(target, distance);
+    }
+  };
+
+  while (!queue.empty()) {
+    const auto [pc, distance] = queue.front();
+    queue.pop_front();
+    const Instruction &instr = program[pc];
+
+    switch (instr.opcode) {
+    case OpCode::SHOW_BACKGROUND:
+      if (const auto *id = stringAt(instr.operand)) {
+        addAsset(PrefetchKind::Texture, *id, distance);
+      }
+      break;
+    case OpCode::SHOW_CHARACTER:
+      if (const auto *id = stringAt(instr.operand)) {
+        addAsset(PrefetchKind::Texture, characterTexture(*id, characters),
+                 distance);
+      }
+      break;
+    case OpCode::PLAY_MUSIC:
+    case OpCode::PLAY_SOUND:
+      if (const auto *id = stringAt(instr.operand)) {
+        addAsset(PrefetchKind::Audio, *id, distance);
+      }
+      break;
+    default:
+      break;
+    }
+
+    const u32 next = distance + 1;
+    switch (instr.opcode) {
+    case OpCode::HALT:
+    case OpCode::RETURN:
+      break;
+    case OpCode::JUMP:
+    case OpCode::GOTO_SCENE:
+      enqueue(instr.operand, next);
+      break;
+    case OpCode::JUMP_IF:
+    case OpCode::JUMP_IF_NOT:
+      enqueue(pc + 1, next);
+      enqueue(instr.operand, next);
+      break;
+    default:
+      enqueue(pc + 1, next);
+      break;
+    }
+  }
+
+  return assets;
+}
+
+} // namespace NovelMind::scripting
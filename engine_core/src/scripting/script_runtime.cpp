@@ -1,6 +1,7 @@
 #include "NovelMind/scripting/script_runtime.hpp"
 #include "NovelMind/core/logger.hpp"
 #include "NovelMind/resource/resource_manager.hpp"
+#include "NovelMind/scripting/bytecode_file.hpp"
 #include "NovelMind/scripting/vm_debugger.hpp"
 #include <algorithm>
 #include <cstring>
@@ -12,15 +13,37 @@ ScriptRuntime::~ScriptRuntime() = default;
 
 Result<void> ScriptRuntime::load(const CompiledScript &script) {
   m_script = script;
+  m_image.reset();
+  return finishLoad();
+}
 
-  auto result = m_vm.load(script.instructions, script.stringTable);
+Result<void> ScriptRuntime::load(std::shared_ptr<const BytecodeImage> image) {
+  if (!image) {
+    return Result<void>::error("No bytecode image");
+  }
+  // Scenes, characters and source mappings are small; the instruction
+  // stream stays in the image and the VM executes it in place
+  m_script = image->metadata();
+  m_image = std::move(image);
+  return finishLoad();
+}
+
+Result<void> ScriptRuntime::loadProgram() {
+  if (m_image) {
+    return m_vm.load(m_image);
+  }
+  return m_vm.load(m_script.instructions, m_script.stringTable);
+}
+
+Result<void> ScriptRuntime::finishLoad() {
+  auto result = loadProgram();
   if (!result.isOk()) {
     return Result<void>::error(result.error());
   }
 
   // Load source mappings into debugger if attached
-  if (m_vm.hasDebugger() && !script.sourceMappings.empty()) {
-    m_vm.debugger()->loadSourceMappings(script.sourceMappings);
+  if (m_vm.hasDebugger() && !m_script.sourceMappings.empty()) {
+    m_vm.debugger()->loadSourceMappings(m_script.sourceMappings);
   }
 
   registerCallbacks();
@@ -30,10 +53,22 @@ Result<void> ScriptRuntime::load(const CompiledScript &script) {
   m_currentSpeaker.clear();
   m_currentDialogue.clear();
   m_currentChoices.clear();
+  m_lastPrefetchIp = ~0u;
+  m_prefetchedTextures.clear();
+  m_prefetchedAudio.clear();
+  m_activeTransition.reset();
+  resetPendingTransition();
 
   return Result<void>::ok();
 }
 
+std::span<const Instruction> ScriptRuntime::programView() const {
+  if (m_image) {
+    return m_image->instructions();
+  }
+  return m_script.instructions;
+}
+
 void ScriptRuntime::setSceneManager(scene::SceneManager *manager) {
   m_sceneManager = manager;
 }
@@ -91,10 +126,8 @@ Result<void> ScriptRuntime::gotoScene(const std::string &sceneName) {
 
   u32 entryPoint = it->second;
   m_currentScene = sceneName;
+  // The program was linked once by load(); a jump only rewinds the VM
   m_vm.reset();
-
-  // Load the full program and set IP to scene entry point
-  m_vm.load(m_script.instructions, m_script.stringTable);
   m_vm.setIP(entryPoint);
   m_visibleCharacters.clear();
   m_currentChoices.clear();
@@ -102,8 +135,15 @@ Result<void> ScriptRuntime::gotoScene(const std::string &sceneName) {
   m_currentSpeaker.clear();
   m_currentBackground.clear();
   m_dialogueActive = false;
+  resetPendingTransition();
+
+  // Plan afresh from the entry point and only track this scene's requests
+  m_lastPrefetchIp = ~0u;
+  m_prefetchedTextures.clear();
+  m_prefetchedAudio.clear();
 
   m_state = RuntimeState::Running;
+  schedulePrefetch();
   fireEvent(ScriptEventType::SceneChange, sceneName);
 
   NOVELMIND_LOG_INFO("Jumped to scene '" + sceneName + "' at instruction " +
@@ -152,6 +192,9 @@ void ScriptRuntime::update(f64 deltaTime) {
     if (m_skipMode) {
       // In skip mode, run faster
       for (i32 i = 0; i < 10 && m_state == RuntimeState::Running; ++i) {
+        if (prepareOutgoingCapture()) {
+          break;
+        }
         if (!m_vm.step()) {
           if (m_vm.isWaiting() || m_vm.isPaused()) {
             break;
@@ -166,6 +209,9 @@ void ScriptRuntime::update(f64 deltaTime) {
       }
     } else {
       // Normal execution
+      if (prepareOutgoingCapture()) {
+        break;
+      }
       if (!m_vm.step()) {
         if (m_vm.isWaiting() || m_vm.isPaused()) {
           break;
@@ -185,6 +231,19 @@ void ScriptRuntime::update(f64 deltaTime) {
   updateDialogue(deltaTime);
 }
 
+void ScriptRuntime::render(renderer::IRenderer &renderer) {
+  m_rendering = true;
+
+  if (m_captureRequested && m_pendingTransition) {
+    m_pendingTransition->captureOutgoing(renderer);
+  }
+  m_captureRequested = false;
+
+  if (m_activeTransition) {
+    m_activeTransition->render(renderer);
+  }
+}
+
 void ScriptRuntime::continueExecution() {
   if (m_state == RuntimeState::WaitingInput) {
     m_state = RuntimeState::Running;
@@ -233,6 +292,8 @@ void ScriptRuntime::resume() {
 void ScriptRuntime::stop() {
   m_state = RuntimeState::Halted;
   m_vm.reset();
+  m_activeTransition.reset();
+  resetPendingTransition();
 }
 
 RuntimeState ScriptRuntime::getState() const { return m_state; }
@@ -341,6 +402,7 @@ Result<void> ScriptRuntime::loadState(const RuntimeSaveState &state) {
   m_selectedChoice = state.selectedChoice;
   m_dialogueActive = state.inDialogue;
   m_skipMode = state.skipMode;
+  resetPendingTransition();
 
   if (!state.currentScene.empty()) {
     m_currentScene = state.currentScene;
@@ -363,6 +425,86 @@ void ScriptRuntime::setEventCallback(EventCallback callback) {
 
 VirtualMachine &ScriptRuntime::getVM() { return m_vm; }
 
+const PrefetchStats &ScriptRuntime::getPrefetchStats() const {
+  return m_prefetchStats;
+}
+
+void ScriptRuntime::resetPrefetchStats() { m_prefetchStats = {}; }
+
+void ScriptRuntime::schedulePrefetch() {
+  if (!m_resources || !m_config.prefetchEnabled) {
+    return;
+  }
+
+  const u32 ip = m_vm.getIP();
+  if (ip == m_lastPrefetchIp) {
+    return;
+  }
+  m_lastPrefetchIp = ip;
+
+  m_prefetchPlanner.setLookahead(m_config.prefetchLookahead);
+  auto assets = m_prefetchPlanner.plan(programView(), m_script.stringTable,
+                                       m_script.characters, ip);
+  ++m_prefetchStats.plansBuilt;
+
+  // The nearest quarter of the window is likely needed within a line or two
+  const u32 nearDistance = m_config.prefetchLookahead / 4;
+  for (const auto &asset : assets) {
+    const auto priority = asset.distance <= nearDistance
+                              ? resource::LoadPriority::Normal
+                              : resource::LoadPriority::Background;
+
+    if (asset.kind == PrefetchKind::Texture) {
+      m_prefetchedTextures.insert(asset.id);
+      if (m_resources->isTextureCached(asset.id)) {
+        continue;
+      }
+      const bool inFlight = m_resources->isTextureLoading(asset.id);
+      // Also raises the priority of a load that is already in flight
+      (void)m_resources->loadTextureAsync(asset.id, priority);
+      if (!inFlight) {
+        ++m_prefetchStats.requestsIssued;
+      }
+    } else {
+      auto &request = m_prefetchedAudio[asset.id];
+      if (request && request->getState() != resource::LoadState::Failed &&
+          request->getState() != resource::LoadState::Cancelled) {
+        continue;
+      }
+      request = m_resources->prefetchData(asset.id, priority);
+      ++m_prefetchStats.requestsIssued;
+    }
+  }
+}
+
+void ScriptRuntime::recordAssetUse(PrefetchKind kind, const std::string &id) {
+  if (!m_resources || !m_config.prefetchEnabled || id.empty()) {
+    return;
+  }
+
+  if (kind == PrefetchKind::Texture) {
+    if (m_resources->isTextureCached(id)) {
+      ++m_prefetchStats.hits;
+    } else if (m_prefetchedTextures.count(id) > 0) {
+      ++m_prefetchStats.lateHits;
+    } else {
+      ++m_prefetchStats.misses;
+    }
+    return;
+  }
+
+  auto it = m_prefetchedAudio.find(id);
+  if (it == m_prefetchedAudio.end() || !it->second) {
+    ++m_prefetchStats.misses;
+  } else if (it->second->getState() == resource::LoadState::Ready) {
+    ++m_prefetchStats.hits;
+  } else if (it->second->isDone()) {
+    ++m_prefetchStats.misses; // failed or cancelled
+  } else {
+    ++m_prefetchStats.lateHits;
+  }
+}
+
 // VM callback handlers
 
 void ScriptRuntime::onShowBackground(const std::vector<Value> &args) {
@@ -372,6 +514,7 @@ void ScriptRuntime::onShowBackground(const std::vector<Value> &args) {
 
   std::string bgName = asString(args[0]);
   m_currentBackground = bgName;
+  recordAssetUse(PrefetchKind::Texture, bgName);
 
   // The scene manager would load and display the background
   if (m_sceneManager) {
@@ -396,6 +539,9 @@ void ScriptRuntime::onShowCharacter(const std::vector<Value> &args) {
     m_visibleCharacters.push_back(charId);
   }
 
+  recordAssetUse(PrefetchKind::Texture,
+                 PrefetchPlanner::characterTexture(charId, m_script.characters));
+
   // Find character definition
   auto it = m_script.characters.find(charId);
   if (it == m_script.characters.end()) {
@@ -465,6 +611,7 @@ void ScriptRuntime::onSay(const std::vector<Value> &args) {
   }
 
   m_state = RuntimeState::WaitingInput;
+  schedulePrefetch();
   fireEvent(ScriptEventType::DialogueStart, speaker, Value{text});
 }
 
@@ -490,6 +637,7 @@ void ScriptRuntime::onChoice(const std::vector<Value> &args) {
   }
 
   m_state = RuntimeState::WaitingChoice;
+  schedulePrefetch();
   fireEvent(ScriptEventType::ChoiceStart);
 }
 
@@ -557,6 +705,7 @@ void ScriptRuntime::onPlaySound(const std::vector<Value> &args) {
   }
 
   std::string soundId = asString(args[0]);
+  recordAssetUse(PrefetchKind::Audio, soundId);
 
   if (m_audioManager) {
     m_audioManager->playSound(soundId);
@@ -571,6 +720,7 @@ void ScriptRuntime::onPlayMusic(const std::vector<Value> &args) {
   }
 
   std::string musicId = asString(args[0]);
+  recordAssetUse(PrefetchKind::Audio, musicId);
 
   if (m_audioManager) {
     m_audioManager->playMusic(musicId);
@@ -604,7 +754,11 @@ void ScriptRuntime::onTransition(const std::vector<Value> &args) {
   f32 duration;
   std::memcpy(&duration, &durBits, sizeof(f32));
 
-  m_activeTransition = createTransition(type, duration);
+  // The pending transition was created from this instruction by the
+  // lookahead and may already hold the outgoing frame
+  m_activeTransition = m_pendingTransition ? std::move(m_pendingTransition)
+                                           : createTransition(type, duration);
+  resetPendingTransition();
   if (m_activeTransition) {
     m_activeTransition->start(duration);
     m_state = RuntimeState::WaitingTransition;
@@ -749,6 +903,58 @@ void ScriptRuntime::updateTransition(f64 deltaTime) {
   }
 }
 
+bool ScriptRuntime::prepareOutgoingCapture() {
+  // Without a render() call there is no frame to capture
+  if (!m_rendering || m_pendingTransition) {
+    return false;
+  }
+
+  const auto program = programView();
+  const u32 ip = m_vm.getIP();
+  if (ip >= m_captureScanFrom && ip <= m_captureScanEnd) {
+    return false; // Already scanned up to the same stop without a transition
+  }
+
+  // Scene changes before a TRANSITION are plain instructions, so the frame
+  // is still the outgoing scene until the next wait or branch
+  for (u32 i = ip; i < program.size(); ++i) {
+    const Instruction &instr = program[i];
+    switch (instr.opcode) {
+    case OpCode::TRANSITION:
+      if (instr.operand < m_script.stringTable.size()) {
+        m_pendingTransition =
+            createTransition(m_script.stringTable[instr.operand],
+                             m_config.defaultTransitionDuration);
+      }
+      m_captureRequested = m_pendingTransition != nullptr;
+      return m_captureRequested;
+    case OpCode::HALT:
+    case OpCode::JUMP:
+    case OpCode::JUMP_IF:
+    case OpCode::JUMP_IF_NOT:
+    case OpCode::CALL:
+    case OpCode::RETURN:
+    case OpCode::SAY:
+    case OpCode::CHOICE:
+    case OpCode::WAIT:
+    case OpCode::GOTO_SCENE:
+      m_captureScanFrom = ip;
+      m_captureScanEnd = i;
+      return false;
+    default:
+      break;
+    }
+  }
+  return false;
+}
+
+void ScriptRuntime::resetPendingTransition() {
+  m_pendingTransition.reset();
+  m_captureRequested = false;
+  m_captureScanFrom = 1;
+  m_captureScanEnd = 0;
+}
+
 void ScriptRuntime::updateAnimation(f64 /*deltaTime*/) {
   if (m_animationManager) {
     // Check if any blocking animations are complete
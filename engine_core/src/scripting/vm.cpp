@@ -1,8 +1,10 @@
 #include "NovelMind/scripting/vm.hpp"
 #include "NovelMind/core/logger.hpp"
+#include "NovelMind/scripting/bytecode_file.hpp"
 #include "NovelMind/scripting/vm_debugger.hpp"
 #include <algorithm>
 #include <cstring>
+#include <functional>
 
 namespace NovelMind::scripting {
 
@@ -19,13 +21,332 @@ Result<void> VirtualMachine::load(const std::vector<Instruction> &program,
     return Result<void>::error("Empty program");
   }
 
-  m_program = program;
+  m_image.reset();
+  m_ownedProgram = program;
+  m_program = m_ownedProgram;
   m_stringTable = stringTable;
-  reset();
+  finishLoad();
 
   return Result<void>::ok();
 }
 
+Result<void> VirtualMachine::load(std::shared_ptr<const BytecodeImage> image) {
+  if (!image || image->instructions().empty()) {
+    return Result<void>::error("Empty program");
+  }
+
+  m_image = std::move(image);
+  m_ownedProgram.clear();
+  m_program = m_image->instructions();
+  m_stringTable = m_image->stringTable();
+  finishLoad();
+
+  return Result<void>::ok();
+}
+
+void VirtualMachine::finishLoad() {
+  rebuildStringPool();
+  linkProgram();
+  decodeProgram();
+  reset();
+}
+
+void VirtualMachine::rebuildStringPool() {
+  // Start each load from a fresh pool and carry over only the strings still
+  // held by variables. The stack is cleared by reset(), so nothing else can
+  // reference old handles.
+  std::vector<std::pair<usize, std::string>> liveStrings;
+  for (usize slot = 0; slot < m_variableValues.size(); ++slot) {
+    if (m_variableValues[slot].type == ValueType::String) {
+      liveStrings.emplace_back(slot, m_strings.get(m_variableValues[slot].str));
+    }
+  }
+
+  m_stack.clear();
+  m_strings.clear();
+  m_stringHandles.clear();
+  m_stringHandles.reserve(m_stringTable.size());
+  for (const auto &str : m_stringTable) {
+    m_stringHandles.push_back(m_strings.intern(str));
+  }
+  m_permanentStrings = m_strings.size();
+
+  for (const auto &[slot, str] : liveStrings) {
+    m_variableValues[slot] = VMValue::makeString(m_strings.intern(str));
+  }
+  m_collectThreshold = m_strings.size() + MIN_COLLECT_STRINGS;
+}
+
+void VirtualMachine::collectStrings() {
+  std::unordered_map<StringHandle, StringHandle> remap;
+  std::vector<std::pair<StringHandle, std::string>> live;
+  auto mark = [&](const VMValue &value) {
+    if (value.type == ValueType::String && value.str >= m_permanentStrings &&
+        remap.emplace(value.str, StringPool::EMPTY).second) {
+      live.emplace_back(value.str, m_strings.get(value.str));
+    }
+  };
+  for (const auto &value : m_stack) {
+    mark(value);
+  }
+  for (const auto &value : m_variableValues) {
+    mark(value);
+  }
+
+  m_strings.truncate(m_permanentStrings);
+  for (const auto &[handle, str] : live) {
+    remap[handle] = m_strings.intern(str);
+  }
+
+  auto relocate = [&](VMValue &value) {
+    if (value.type == ValueType::String && value.str >= m_permanentStrings) {
+      value.str = remap[value.str];
+    }
+  };
+  for (auto &value : m_stack) {
+    relocate(value);
+  }
+  for (auto &value : m_variableValues) {
+    relocate(value);
+  }
+
+  // Let the garbage grow with the live set so collection stays amortized
+  m_collectThreshold =
+      m_strings.size() + std::max(MIN_COLLECT_STRINGS, live.size());
+}
+
+void VirtualMachine::linkProgram() {
+  m_linkedSlots.assign(m_program.size(), INVALID_SLOT);
+
+  for (size_t i = 0; i < m_program.size(); ++i) {
+    const Instruction &instr = m_program[i];
+    if (instr.operand >= m_stringTable.size()) {
+      // Left unlinked; execution reports the bad index via getString()
+      continue;
+    }
+
+    switch (instr.opcode) {
+    case OpCode::LOAD_VAR:
+    case OpCode::STORE_VAR:
+    case OpCode::LOAD_GLOBAL:
+    case OpCode::STORE_GLOBAL:
+      m_linkedSlots[i] = resolveVariableSlot(m_stringTable[instr.operand]);
+      break;
+    case OpCode::SET_FLAG:
+    case OpCode::CHECK_FLAG:
+      m_linkedSlots[i] = resolveFlagSlot(m_stringTable[instr.operand]);
+      break;
+    default:
+      break;
+    }
+  }
+}
+
+u32 VirtualMachine::resolveVariableSlot(const std::string &name) {
+  auto it = m_variableSlots.find(name);
+  if (it != m_variableSlots.end()) {
+    return it->second;
+  }
+
+  const u32 slot = static_cast<u32>(m_variableValues.size());
+  m_variableSlots.emplace(name, slot);
+  m_variableNames.push_back(name);
+  m_variableValues.push_back(VMValue::null());
+  m_variableDefined.push_back(0);
+  return slot;
+}
+
+u32 VirtualMachine::resolveFlagSlot(const std::string &name) {
+  auto it = m_flagSlots.find(name);
+  if (it != m_flagSlots.end()) {
+    return it->second;
+  }
+
+  const u32 slot = static_cast<u32>(m_flagValues.size());
+  m_flagSlots.emplace(name, slot);
+  m_flagNames.push_back(name);
+  m_flagValues.push_back(0);
+  m_flagDefined.push_back(0);
+  return slot;
+}
+
+void VirtualMachine::decodeProgram() {
+  const usize size = m_program.size();
+  m_decoded.assign(size + 1, DecodedInstruction{});
+  m_threaded = false;
+
+  auto isJumpTarget = [size](u32 target) { return target < size; };
+  auto isStringIndex = [this](u32 index) {
+    return index < m_stringHandles.size();
+  };
+
+  for (usize i = 0; i < size; ++i) {
+    const Instruction &instr = m_program[i];
+    DecodedInstruction &d = m_decoded[i];
+    d.arg = instr.operand;
+
+    switch (instr.opcode) {
+    case OpCode::NOP:
+      d.op = FastOp::Nop;
+      break;
+    case OpCode::JUMP:
+      d.op = isJumpTarget(instr.operand) ? FastOp::Jump : FastOp::Slow;
+      break;
+    case OpCode::JUMP_IF:
+      d.op = isJumpTarget(instr.operand) ? FastOp::JumpIf : FastOp::Slow;
+      break;
+    case OpCode::JUMP_IF_NOT:
+      d.op = isJumpTarget(instr.operand) ? FastOp::JumpIfNot : FastOp::Slow;
+      break;
+    case OpCode::PUSH_INT:
+      d.op = FastOp::PushInt;
+      break;
+    case OpCode::PUSH_FLOAT:
+      d.op = FastOp::PushFloat;
+      break;
+    case OpCode::PUSH_STRING:
+      if (isStringIndex(instr.operand)) {
+        d.op = FastOp::PushString;
+        d.arg = m_stringHandles[instr.operand];
+      }
+      break;
+    case OpCode::PUSH_BOOL:
+      d.op = FastOp::PushBool;
+      break;
+    case OpCode::PUSH_NULL:
+      d.op = FastOp::PushNull;
+      break;
+    case OpCode::POP:
+      d.op = FastOp::Pop;
+      break;
+    case OpCode::DUP:
+      d.op = FastOp::Dup;
+      break;
+    case OpCode::LOAD_VAR:
+    case OpCode::LOAD_GLOBAL:
+    case OpCode::STORE_VAR:
+    case OpCode::STORE_GLOBAL:
+    case OpCode::SET_FLAG:
+    case OpCode::CHECK_FLAG:
+      if (m_linkedSlots[i] != INVALID_SLOT) {
+        d.arg = m_linkedSlots[i];
+        if (instr.opcode == OpCode::LOAD_VAR ||
+            instr.opcode == OpCode::LOAD_GLOBAL) {
+          d.op = FastOp::LoadVar;
+        } else if (instr.opcode == OpCode::STORE_VAR ||
+                   instr.opcode == OpCode::STORE_GLOBAL) {
+          d.op = FastOp::StoreVar;
+        } else if (instr.opcode == OpCode::SET_FLAG) {
+          d.op = FastOp::SetFlag;
+        } else {
+          d.op = FastOp::CheckFlag;
+        }
+      }
+      break;
+    case OpCode::ADD:
+      d.op = FastOp::Add;
+      break;
+    case OpCode::SUB:
+      d.op = FastOp::Sub;
+      break;
+    case OpCode::MUL:
+      d.op = FastOp::Mul;
+      break;
+    case OpCode::DIV:
+      d.op = FastOp::Div;
+      break;
+    case OpCode::MOD:
+      d.op = FastOp::Mod;
+      break;
+    case OpCode::NEG:
+      d.op = FastOp::Neg;
+      break;
+    case OpCode::EQ:
+      d.op = FastOp::Eq;
+      break;
+    case OpCode::NE:
+      d.op = FastOp::Ne;
+      break;
+    case OpCode::LT:
+      d.op = FastOp::Lt;
+      break;
+    case OpCode::LE:
+      d.op = FastOp::Le;
+      break;
+    case OpCode::GT:
+      d.op = FastOp::Gt;
+      break;
+    case OpCode::GE:
+      d.op = FastOp::Ge;
+      break;
+    case OpCode::AND:
+      d.op = FastOp::And;
+      break;
+    case OpCode::OR:
+      d.op = FastOp::Or;
+      break;
+    case OpCode::NOT:
+      d.op = FastOp::Not;
+      break;
+    default:
+      d.op = FastOp::Slow;
+      break;
+    }
+  }
+
+  fuseSuperinstructions();
+}
+
+void VirtualMachine::fuseSuperinstructions() {
+  const usize size = m_program.size();
+  if (size < 4) {
+    return;
+  }
+
+  for (usize i = 0; i + 3 < size; ++i) {
+    DecodedInstruction &head = m_decoded[i];
+    const DecodedInstruction &constant = m_decoded[i + 1];
+    if (head.op != FastOp::LoadVar || constant.op != FastOp::PushInt) {
+      continue;
+    }
+    const DecodedInstruction &third = m_decoded[i + 2];
+    const DecodedInstruction &fourth = m_decoded[i + 3];
+
+    // x = x + k
+    if (third.op == FastOp::Add && fourth.op == FastOp::StoreVar &&
+        fourth.arg == head.arg) {
+      head.op = FastOp::AddVarInt;
+      head.imm = constant.arg;
+      continue;
+    }
+
+    // if x <cmp> k
+    const OpCode cmp = m_program[i + 2].opcode;
+    const bool isCompare = cmp == OpCode::EQ || cmp == OpCode::NE ||
+                           cmp == OpCode::LT || cmp == OpCode::LE ||
+                           cmp == OpCode::GT || cmp == OpCode::GE;
+    if (isCompare && fourth.op == FastOp::JumpIfNot) {
+      head.op = FastOp::CompareVarIntBranch;
+      head.imm = constant.arg;
+      head.target = fourth.arg;
+      head.cmp = cmp;
+    }
+  }
+}
+
+void VirtualMachine::storeVariable(u32 slot, VMValue value) {
+  // Track variable changes for debugger
+  if (m_debugger) {
+    Value oldValue = m_variableDefined[slot]
+                         ? toValue(m_variableValues[slot], m_strings)
+                         : Value{std::monostate{}};
+    m_debugger->trackVariableChange(m_variableNames[slot], oldValue,
+                                    toValue(value, m_strings));
+  }
+  m_variableValues[slot] = value;
+  m_variableDefined[slot] = 1;
+}
+
 void VirtualMachine::reset() {
   m_ip = 0;
   m_stack.clear();
@@ -82,6 +403,12 @@ void VirtualMachine::run() {
   m_paused = false;
 
   while (m_running && !m_halted && !m_paused && !m_waiting) {
+    // Without a debugger, straight-line code runs in the threaded loop. It
+    // stops in front of anything it does not handle inline (VN commands,
+    // HALT, error paths), which then goes through step() as usual.
+    if (!m_debugger) {
+      runFast();
+    }
     step();
   }
 }
@@ -103,6 +430,422 @@ bool VirtualMachine::isWaiting() const { return m_waiting; }
 
 bool VirtualMachine::isHalted() const { return m_halted; }
 
+// The fast loop mirrors executeInstruction() for the opcodes it handles.
+// Anything that would warn, halt or call out (stack underflow/overflow,
+// division by zero, bad operands) leaves the loop *before* touching state so
+// step() replays the instruction with the full checks and diagnostics.
+#if defined(__GNUC__) || defined(__clang__)
+#define NOVELMIND_VM_THREADED 1
+#else
+#define NOVELMIND_VM_THREADED 0
+#endif
+
+#if NOVELMIND_VM_THREADED
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#define VM_CASE(name) op_##name:
+#define VM_DISPATCH() goto *code[ip].handler
+#else
+#define VM_CASE(name) case FastOp::name:
+#define VM_DISPATCH() continue
+#endif
+#define VM_NEXT()                                                              \
+  {                                                                            \
+    ++ip;                                                                      \
+    VM_DISPATCH();                                                             \
+  }
+#define VM_REQUIRE_STACK(n)                                                    \
+  if (stack.size() < (n))                                                      \
+  goto exit
+#define VM_REQUIRE_ROOM()                                                      \
+  if (stack.size() >= maxStack)                                                \
+  goto exit
+// Superinstructions push two values in the unfused sequence
+#define VM_REQUIRE_ROOM2()                                                     \
+  if (stack.size() + 2 > maxStack)                                             \
+  goto exit
+
+void VirtualMachine::runFast() {
+  if (m_ip >= m_program.size()) {
+    return;
+  }
+
+#if NOVELMIND_VM_THREADED
+  // Must list labels in FastOp order
+  static const void *const labels[] = {
+      &&op_Slow,     &&op_Nop,      &&op_Jump,    &&op_JumpIf,
+      &&op_JumpIfNot, &&op_PushInt, &&op_PushFloat, &&op_PushString,
+      &&op_PushBool, &&op_PushNull, &&op_Pop,     &&op_Dup,
+      &&op_LoadVar,  &&op_StoreVar, &&op_Add,     &&op_Sub,
+      &&op_Mul,      &&op_Div,      &&op_Mod,     &&op_Neg,
+      &&op_Eq,       &&op_Ne,       &&op_Lt,      &&op_Le,
+      &&op_Gt,       &&op_Ge,       &&op_And,     &&op_Or,
+      &&op_Not,      &&op_SetFlag,  &&op_CheckFlag, &&op_AddVarInt,
+      &&op_CompareVarIntBranch};
+  static_assert(sizeof(labels) / sizeof(labels[0]) ==
+                static_cast<usize>(FastOp::Count));
+
+  if (!m_threaded) {
+    for (auto &d : m_decoded) {
+      d.handler = labels[static_cast<usize>(d.op)];
+    }
+    m_threaded = true;
+  }
+#endif
+
+  const DecodedInstruction *code = m_decoded.data();
+  std::vector<VMValue> &stack = m_stack;
+  const usize maxStack = m_securityGuard.limits().maxStackSize;
+  u32 ip = m_ip;
+
+#if NOVELMIND_VM_THREADED
+  VM_DISPATCH();
+#else
+  for (;;) {
+    switch (code[ip].op) {
+#endif
+
+  VM_CASE(Slow)
+  goto exit;
+
+  VM_CASE(Nop)
+  VM_NEXT();
+
+  VM_CASE(Jump) {
+    ip = code[ip].arg;
+    VM_DISPATCH();
+  }
+
+  VM_CASE(JumpIf) {
+    VM_REQUIRE_STACK(1);
+    const bool cond = stack.back().asBool();
+    stack.pop_back();
+    ip = cond ? code[ip].arg : ip + 1;
+    VM_DISPATCH();
+  }
+
+  VM_CASE(JumpIfNot) {
+    VM_REQUIRE_STACK(1);
+    const bool cond = stack.back().asBool();
+    stack.pop_back();
+    ip = cond ? ip + 1 : code[ip].arg;
+    VM_DISPATCH();
+  }
+
+  VM_CASE(PushInt) {
+    VM_REQUIRE_ROOM();
+    stack.push_back(VMValue::makeInt(static_cast<i32>(code[ip].arg)));
+    VM_NEXT();
+  }
+
+  VM_CASE(PushFloat) {
+    VM_REQUIRE_ROOM();
+    f32 val;
+    std::memcpy(&val, &code[ip].arg, sizeof(f32));
+    stack.push_back(VMValue::makeFloat(val));
+    VM_NEXT();
+  }
+
+  VM_CASE(PushString) {
+    VM_REQUIRE_ROOM();
+    stack.push_back(VMValue::makeString(code[ip].arg));
+    VM_NEXT();
+  }
+
+  VM_CASE(PushBool) {
+    VM_REQUIRE_ROOM();
+    stack.push_back(VMValue::makeBool(code[ip].arg != 0));
+    VM_NEXT();
+  }
+
+  VM_CASE(PushNull) {
+    VM_REQUIRE_ROOM();
+    stack.push_back(VMValue::null());
+    VM_NEXT();
+  }
+
+  VM_CASE(Pop) {
+    VM_REQUIRE_STACK(1);
+    stack.pop_back();
+    VM_NEXT();
+  }
+
+  VM_CASE(Dup) {
+    VM_REQUIRE_STACK(1);
+    VM_REQUIRE_ROOM();
+    const VMValue top = stack.back();
+    stack.push_back(top);
+    VM_NEXT();
+  }
+
+  VM_CASE(LoadVar) {
+    VM_REQUIRE_ROOM();
+    stack.push_back(m_variableValues[code[ip].arg]);
+    VM_NEXT();
+  }
+
+  VM_CASE(StoreVar) {
+    VM_REQUIRE_STACK(1);
+    m_variableValues[code[ip].arg] = stack.back();
+    m_variableDefined[code[ip].arg] = 1;
+    stack.pop_back();
+    VM_NEXT();
+  }
+
+  VM_CASE(Add) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    VMValue &a = stack.back();
+    if (a.type == ValueType::Int && b.type == ValueType::Int) {
+      a.i += b.i;
+    } else {
+      a = addValues(a, b);
+    }
+    VM_NEXT();
+  }
+
+  VM_CASE(Sub) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    VMValue &a = stack.back();
+    if (a.type == ValueType::Int && b.type == ValueType::Int) {
+      a.i -= b.i;
+    } else {
+      a = subValues(a, b);
+    }
+    VM_NEXT();
+  }
+
+  VM_CASE(Mul) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    VMValue &a = stack.back();
+    if (a.type == ValueType::Int && b.type == ValueType::Int) {
+      a.i *= b.i;
+    } else {
+      a = mulValues(a, b);
+    }
+    VM_NEXT();
+  }
+
+  VM_CASE(Div) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    const VMValue a = stack[stack.size() - 2];
+    if (a.type == ValueType::Float || b.type == ValueType::Float) {
+      if (b.asFloat() == 0.0f) {
+        goto exit;
+      }
+      stack.pop_back();
+      stack.back() = VMValue::makeFloat(a.asFloat() / b.asFloat());
+    } else {
+      if (b.asInt() == 0) {
+        goto exit;
+      }
+      stack.pop_back();
+      stack.back() = VMValue::makeInt(a.asInt() / b.asInt());
+    }
+    VM_NEXT();
+  }
+
+  VM_CASE(Mod) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    if (b.asInt() == 0) {
+      goto exit;
+    }
+    stack.pop_back();
+    stack.back() = VMValue::makeInt(stack.back().asInt() % b.asInt());
+    VM_NEXT();
+  }
+
+  VM_CASE(Neg) {
+    VM_REQUIRE_STACK(1);
+    stack.back() = negateValue(stack.back());
+    VM_NEXT();
+  }
+
+  VM_CASE(Eq) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    stack.back() = VMValue::makeBool(equalValues(stack.back(), b));
+    VM_NEXT();
+  }
+
+  VM_CASE(Ne) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    stack.back() = VMValue::makeBool(!equalValues(stack.back(), b));
+    VM_NEXT();
+  }
+
+  VM_CASE(Lt) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    stack.back() =
+        VMValue::makeBool(orderValues(stack.back(), b, std::less<>{}));
+    VM_NEXT();
+  }
+
+  VM_CASE(Le) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    stack.back() =
+        VMValue::makeBool(orderValues(stack.back(), b, std::less_equal<>{}));
+    VM_NEXT();
+  }
+
+  VM_CASE(Gt) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    stack.back() =
+        VMValue::makeBool(orderValues(stack.back(), b, std::greater<>{}));
+    VM_NEXT();
+  }
+
+  VM_CASE(Ge) {
+    VM_REQUIRE_STACK(2);
+    const VMValue b = stack.back();
+    stack.pop_back();
+    stack.back() = VMValue::makeBool(
+        orderValues(stack.back(), b, std::greater_equal<>{}));
+    VM_NEXT();
+  }
+
+  VM_CASE(And) {
+    VM_REQUIRE_STACK(2);
+    const bool b = stack.back().asBool();
+    stack.pop_back();
+    stack.back() = VMValue::makeBool(stack.back().asBool() && b);
+    VM_NEXT();
+  }
+
+  VM_CASE(Or) {
+    VM_REQUIRE_STACK(2);
+    const bool b = stack.back().asBool();
+    stack.pop_back();
+    stack.back() = VMValue::makeBool(stack.back().asBool() || b);
+    VM_NEXT();
+  }
+
+  VM_CASE(Not) {
+    VM_REQUIRE_STACK(1);
+    stack.back() = VMValue::makeBool(!stack.back().asBool());
+    VM_NEXT();
+  }
+
+  VM_CASE(SetFlag) {
+    VM_REQUIRE_STACK(1);
+    m_flagValues[code[ip].arg] = stack.back().asBool() ? 1 : 0;
+    m_flagDefined[code[ip].arg] = 1;
+    stack.pop_back();
+    VM_NEXT();
+  }
+
+  VM_CASE(CheckFlag) {
+    VM_REQUIRE_ROOM();
+    stack.push_back(VMValue::makeBool(m_flagValues[code[ip].arg] != 0));
+    VM_NEXT();
+  }
+
+  VM_CASE(AddVarInt) {
+    VM_REQUIRE_ROOM2();
+    const DecodedInstruction &d = code[ip];
+    VMValue &var = m_variableValues[d.arg];
+    const VMValue k = VMValue::makeInt(static_cast<i32>(d.imm));
+    if (var.type == ValueType::Int) {
+      var.i += k.i;
+    } else {
+      var = addValues(var, k);
+    }
+    m_variableDefined[d.arg] = 1;
+    ip += 4;
+    VM_DISPATCH();
+  }
+
+  VM_CASE(CompareVarIntBranch) {
+    VM_REQUIRE_ROOM2();
+    const DecodedInstruction &d = code[ip];
+    const VMValue &var = m_variableValues[d.arg];
+    const VMValue k = VMValue::makeInt(static_cast<i32>(d.imm));
+    bool result = false;
+    if (var.type == ValueType::Int) {
+      switch (d.cmp) {
+      case OpCode::EQ:
+        result = var.i == k.i;
+        break;
+      case OpCode::NE:
+        result = var.i != k.i;
+        break;
+      case OpCode::LT:
+        result = var.i < k.i;
+        break;
+      case OpCode::LE:
+        result = var.i <= k.i;
+        break;
+      case OpCode::GT:
+        result = var.i > k.i;
+        break;
+      default:
+        result = var.i >= k.i;
+        break;
+      }
+    } else {
+      switch (d.cmp) {
+      case OpCode::EQ:
+        result = equalValues(var, k);
+        break;
+      case OpCode::NE:
+        result = !equalValues(var, k);
+        break;
+      case OpCode::LT:
+        result = orderValues(var, k, std::less<>{});
+        break;
+      case OpCode::LE:
+        result = orderValues(var, k, std::less_equal<>{});
+        break;
+      case OpCode::GT:
+        result = orderValues(var, k, std::greater<>{});
+        break;
+      default:
+        result = orderValues(var, k, std::greater_equal<>{});
+        break;
+      }
+    }
+    ip = result ? ip + 4 : d.target;
+    VM_DISPATCH();
+  }
+
+#if !NOVELMIND_VM_THREADED
+    case FastOp::Count:
+      goto exit;
+    }
+  }
+#endif
+
+exit:
+  m_ip = ip;
+}
+
+#undef VM_REQUIRE_ROOM2
+#undef VM_REQUIRE_ROOM
+#undef VM_REQUIRE_STACK
+#undef VM_NEXT
+#undef VM_DISPATCH
+#undef VM_CASE
+#if NOVELMIND_VM_THREADED
+#pragma GCC diagnostic pop
+#endif
+#undef NOVELMIND_VM_THREADED
+
 void VirtualMachine::setIP(u32 ip) {
   // Validate IP is within program bounds
   if (ip < m_program.size()) {
@@ -114,38 +857,60 @@ void VirtualMachine::setIP(u32 ip) {
 }
 
 void VirtualMachine::setVariable(const std::string &name, Value value) {
-  // Track variable changes for debugger
-  if (m_debugger) {
-    Value oldValue = getVariable(name);
-    m_debugger->trackVariableChange(name, oldValue, value);
-  }
-  m_variables[name] = std::move(value);
+  const u32 slot = resolveVariableSlot(name);
+  storeVariable(slot, fromValue(value, m_strings));
 }
 
 Value VirtualMachine::getVariable(const std::string &name) const {
-  auto it = m_variables.find(name);
-  if (it != m_variables.end()) {
-    return it->second;
+  auto it = m_variableSlots.find(name);
+  if (it != m_variableSlots.end() && m_variableDefined[it->second]) {
+    return toValue(m_variableValues[it->second], m_strings);
   }
   return std::monostate{};
 }
 
 bool VirtualMachine::hasVariable(const std::string &name) const {
-  return m_variables.find(name) != m_variables.end();
+  auto it = m_variableSlots.find(name);
+  return it != m_variableSlots.end() && m_variableDefined[it->second];
+}
+
+std::unordered_map<std::string, Value> VirtualMachine::getAllVariables() const {
+  std::unordered_map<std::string, Value> result;
+  result.reserve(m_variableValues.size());
+  for (size_t slot = 0; slot < m_variableValues.size(); ++slot) {
+    if (m_variableDefined[slot]) {
+      result.emplace(m_variableNames[slot],
+                     toValue(m_variableValues[slot], m_strings));
+    }
+  }
+  return result;
 }
 
 void VirtualMachine::setFlag(const std::string &name, bool value) {
-  m_flags[name] = value;
+  const u32 slot = resolveFlagSlot(name);
+  m_flagValues[slot] = value ? 1 : 0;
+  m_flagDefined[slot] = 1;
 }
 
 bool VirtualMachine::getFlag(const std::string &name) const {
-  auto it = m_flags.find(name);
-  if (it != m_flags.end()) {
-    return it->second;
+  auto it = m_flagSlots.find(name);
+  if (it != m_flagSlots.end()) {
+    return m_flagValues[it->second] != 0;
   }
   return false;
 }
 
+std::unordered_map<std::string, bool> VirtualMachine::getAllFlags() const {
+  std::unordered_map<std::string, bool> result;
+  result.reserve(m_flagValues.size());
+  for (size_t slot = 0; slot < m_flagValues.size(); ++slot) {
+    if (m_flagDefined[slot]) {
+      result.emplace(m_flagNames[slot], m_flagValues[slot] != 0);
+    }
+  }
+  return result;
+}
+
 void VirtualMachine::registerCallback(OpCode op, NativeCallback callback) {
   m_callbacks[op] = std::move(callback);
 }
@@ -196,7 +961,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
     break;
 
   case OpCode::JUMP_IF:
-    if (asBool(pop())) {
+    if (pop().asBool()) {
       // Validate jump target is within program bounds
       if (instr.operand >= m_program.size()) {
         NOVELMIND_LOG_ERROR("JUMP_IF operand out of bounds");
@@ -215,7 +980,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
     break;
 
   case OpCode::JUMP_IF_NOT:
-    if (!asBool(pop())) {
+    if (!pop().asBool()) {
       // Validate jump target is within program bounds
       if (instr.operand >= m_program.size()) {
         NOVELMIND_LOG_ERROR("JUMP_IF_NOT operand out of bounds");
@@ -245,7 +1010,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
   }
 
   case OpCode::PUSH_STRING:
-    push(getString(instr.operand));
+    push(VMValue::makeString(getStringHandle(instr.operand)));
     break;
 
   case OpCode::PUSH_BOOL:
@@ -253,7 +1018,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
     break;
 
   case OpCode::PUSH_NULL:
-    push(std::monostate{});
+    push(VMValue::null());
     break;
 
   case OpCode::POP:
@@ -266,259 +1031,166 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
     }
     break;
 
-  case OpCode::LOAD_VAR: {
-    const std::string &name = getString(instr.operand);
-    push(getVariable(name));
+  case OpCode::LOAD_VAR:
+  case OpCode::LOAD_GLOBAL: {
+    const u32 slot = m_linkedSlots[m_ip];
+    if (slot == INVALID_SLOT) {
+      (void)getString(instr.operand); // reports the bad index and halts
+      push(VMValue::null());
+      break;
+    }
+    push(m_variableValues[slot]);
     break;
   }
 
-  case OpCode::STORE_VAR: {
-    const std::string &name = getString(instr.operand);
-    setVariable(name, pop());
+  case OpCode::STORE_VAR:
+  case OpCode::STORE_GLOBAL: {
+    const u32 slot = m_linkedSlots[m_ip];
+    if (slot == INVALID_SLOT) {
+      (void)getString(instr.operand);
+      pop();
+      break;
+    }
+    storeVariable(slot, pop());
     break;
   }
 
   case OpCode::ADD: {
-    Value b = pop();
-    Value a = pop();
-    if (getValueType(a) == ValueType::String ||
-        getValueType(b) == ValueType::String) {
-      push(asString(a) + asString(b));
-    } else if (getValueType(a) == ValueType::Float ||
-               getValueType(b) == ValueType::Float) {
-      push(asFloat(a) + asFloat(b));
-    } else {
-      push(asInt(a) + asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(addValues(a, b));
     break;
   }
 
   case OpCode::SUB: {
-    Value b = pop();
-    Value a = pop();
-    if (getValueType(a) == ValueType::Float ||
-        getValueType(b) == ValueType::Float) {
-      push(asFloat(a) - asFloat(b));
-    } else {
-      push(asInt(a) - asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(subValues(a, b));
     break;
   }
 
   case OpCode::MUL: {
-    Value b = pop();
-    Value a = pop();
-    if (getValueType(a) == ValueType::Float ||
-        getValueType(b) == ValueType::Float) {
-      push(asFloat(a) * asFloat(b));
-    } else {
-      push(asInt(a) * asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(mulValues(a, b));
     break;
   }
 
   case OpCode::DIV: {
-    Value b = pop();
-    Value a = pop();
+    VMValue b = pop();
+    VMValue a = pop();
 
     // Check for division by zero before performing the operation
     // Handle both integer and float divisions
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
+    ValueType typeA = a.type;
+    ValueType typeB = b.type;
 
     if (typeA == ValueType::Float || typeB == ValueType::Float) {
       // Float division
-      f32 divisor = asFloat(b);
+      f32 divisor = b.asFloat();
       if (divisor == 0.0f) {
         NOVELMIND_LOG_ERROR("VM Runtime Error: Division by zero at instruction " +
                             std::to_string(m_ip));
         m_halted = true;
         return;
       }
-      push(asFloat(a) / divisor);
+      push(a.asFloat() / divisor);
     } else {
       // Integer division
-      i32 divisor = asInt(b);
+      i32 divisor = b.asInt();
       if (divisor == 0) {
         NOVELMIND_LOG_ERROR("VM Runtime Error: Division by zero at instruction " +
                             std::to_string(m_ip));
         m_halted = true;
         return;
       }
-      push(asInt(a) / divisor);
+      push(a.asInt() / divisor);
     }
     break;
   }
 
   case OpCode::EQ: {
-    Value b = pop();
-    Value a = pop();
-    // Type-aware equality comparison
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
-    if (typeA == ValueType::Null && typeB == ValueType::Null) {
-      push(true);
-    } else if (typeA == ValueType::Null || typeB == ValueType::Null) {
-      push(false);
-    } else if (typeA == ValueType::String || typeB == ValueType::String) {
-      push(asString(a) == asString(b));
-    } else if (typeA == ValueType::Bool && typeB == ValueType::Bool) {
-      push(asBool(a) == asBool(b));
-    } else if (typeA == ValueType::Float || typeB == ValueType::Float) {
-      push(asFloat(a) == asFloat(b));
-    } else {
-      push(asInt(a) == asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(equalValues(a, b));
     break;
   }
 
   case OpCode::NE: {
-    Value b = pop();
-    Value a = pop();
-    // Type-aware inequality comparison
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
-    if (typeA == ValueType::Null && typeB == ValueType::Null) {
-      push(false);
-    } else if (typeA == ValueType::Null || typeB == ValueType::Null) {
-      push(true);
-    } else if (typeA == ValueType::String || typeB == ValueType::String) {
-      push(asString(a) != asString(b));
-    } else if (typeA == ValueType::Bool && typeB == ValueType::Bool) {
-      push(asBool(a) != asBool(b));
-    } else if (typeA == ValueType::Float || typeB == ValueType::Float) {
-      push(asFloat(a) != asFloat(b));
-    } else {
-      push(asInt(a) != asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(!equalValues(a, b));
     break;
   }
 
   case OpCode::LT: {
-    Value b = pop();
-    Value a = pop();
-    // Type-aware less-than comparison
-    // Coercion rules:
-    // - String types: lexicographic comparison
-    // - Numeric types (Int/Float): numeric comparison (convert to Float if either is Float)
-    // - Bool: treated as Int (true=1, false=0)
-    // - Null: treated as 0 in numeric context
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
-    if (typeA == ValueType::String || typeB == ValueType::String) {
-      push(asString(a) < asString(b));
-    } else if (typeA == ValueType::Float || typeB == ValueType::Float) {
-      push(asFloat(a) < asFloat(b));
-    } else {
-      push(asInt(a) < asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(orderValues(a, b, std::less<>{}));
     break;
   }
 
   case OpCode::LE: {
-    Value b = pop();
-    Value a = pop();
-    // Type-aware less-than-or-equal comparison (same coercion rules as LT)
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
-    if (typeA == ValueType::String || typeB == ValueType::String) {
-      push(asString(a) <= asString(b));
-    } else if (typeA == ValueType::Float || typeB == ValueType::Float) {
-      push(asFloat(a) <= asFloat(b));
-    } else {
-      push(asInt(a) <= asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(orderValues(a, b, std::less_equal<>{}));
     break;
   }
 
   case OpCode::GT: {
-    Value b = pop();
-    Value a = pop();
-    // Type-aware greater-than comparison (same coercion rules as LT)
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
-    if (typeA == ValueType::String || typeB == ValueType::String) {
-      push(asString(a) > asString(b));
-    } else if (typeA == ValueType::Float || typeB == ValueType::Float) {
-      push(asFloat(a) > asFloat(b));
-    } else {
-      push(asInt(a) > asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(orderValues(a, b, std::greater<>{}));
     break;
   }
 
   case OpCode::GE: {
-    Value b = pop();
-    Value a = pop();
-    // Type-aware greater-than-or-equal comparison (same coercion rules as LT)
-    ValueType typeA = getValueType(a);
-    ValueType typeB = getValueType(b);
-    if (typeA == ValueType::String || typeB == ValueType::String) {
-      push(asString(a) >= asString(b));
-    } else if (typeA == ValueType::Float || typeB == ValueType::Float) {
-      push(asFloat(a) >= asFloat(b));
-    } else {
-      push(asInt(a) >= asInt(b));
-    }
+    VMValue b = pop();
+    VMValue a = pop();
+    push(orderValues(a, b, std::greater_equal<>{}));
     break;
   }
 
   case OpCode::AND: {
-    Value b = pop();
-    Value a = pop();
-    push(asBool(a) && asBool(b));
+    VMValue b = pop();
+    VMValue a = pop();
+    push(a.asBool() && b.asBool());
     break;
   }
 
   case OpCode::OR: {
-    Value b = pop();
-    Value a = pop();
-    push(asBool(a) || asBool(b));
+    VMValue b = pop();
+    VMValue a = pop();
+    push(a.asBool() || b.asBool());
     break;
   }
 
   case OpCode::NOT: {
-    Value a = pop();
-    push(!asBool(a));
+    VMValue a = pop();
+    push(!a.asBool());
     break;
   }
 
   case OpCode::MOD: {
-    Value b = pop();
-    Value a = pop();
+    VMValue b = pop();
+    VMValue a = pop();
 
     // Check for modulo by zero before performing the operation
     // Modulo is only defined for integers
-    i32 divisor = asInt(b);
+    i32 divisor = b.asInt();
     if (divisor == 0) {
       NOVELMIND_LOG_ERROR("VM Runtime Error: Modulo by zero at instruction " +
                           std::to_string(m_ip));
       m_halted = true;
       return;
     }
-    push(asInt(a) % divisor);
+    push(a.asInt() % divisor);
     break;
   }
 
   case OpCode::NEG: {
-    Value a = pop();
-    if (getValueType(a) == ValueType::Float) {
-      push(-asFloat(a));
-    } else {
-      push(-asInt(a));
-    }
-    break;
-  }
-
-  case OpCode::LOAD_GLOBAL: {
-    const std::string &name = getString(instr.operand);
-    push(getVariable(name));
-    break;
-  }
-
-  case OpCode::STORE_GLOBAL: {
-    const std::string &name = getString(instr.operand);
-    setVariable(name, pop());
+    VMValue a = pop();
+    push(negateValue(a));
     break;
   }
 
@@ -537,7 +1209,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
                          funcName);
     }
     // Push null as return value for unhandled functions
-    push(std::monostate{});
+    push(VMValue::null());
     break;
   }
 
@@ -549,15 +1221,25 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
   }
 
   case OpCode::SET_FLAG: {
-    bool value = asBool(pop());
-    const std::string &name = getString(instr.operand);
-    setFlag(name, value);
+    bool value = pop().asBool();
+    const u32 slot = m_linkedSlots[m_ip];
+    if (slot == INVALID_SLOT) {
+      (void)getString(instr.operand);
+      break;
+    }
+    m_flagValues[slot] = value ? 1 : 0;
+    m_flagDefined[slot] = 1;
     break;
   }
 
   case OpCode::CHECK_FLAG: {
-    const std::string &name = getString(instr.operand);
-    push(getFlag(name));
+    const u32 slot = m_linkedSlots[m_ip];
+    if (slot == INVALID_SLOT) {
+      (void)getString(instr.operand);
+      push(false);
+      break;
+    }
+    push(m_flagValues[slot] != 0);
     break;
   }
 
@@ -598,7 +1280,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
         if (m_stack.empty()) {
           return std::monostate{};
         }
-        Value val = std::move(m_stack.back());
+        Value val = toValue(m_stack.back(), m_strings);
         m_stack.pop_back();
         return val;
       };
@@ -742,7 +1424,7 @@ void VirtualMachine::executeInstruction(const Instruction &instr) {
   }
 }
 
-void VirtualMachine::push(Value value) {
+void VirtualMachine::push(VMValue value) {
   if (!m_securityGuard.checkStackPush(m_stack.size())) {
     NOVELMIND_LOG_ERROR("VM Error: Stack overflow - exceeded maximum stack size");
     m_halted = true;
@@ -751,16 +1433,114 @@ void VirtualMachine::push(Value value) {
   m_stack.push_back(std::move(value));
 }
 
-Value VirtualMachine::pop() {
+VMValue VirtualMachine::pop() {
   if (m_stack.empty()) {
     NOVELMIND_LOG_WARN("Stack underflow");
-    return std::monostate{};
+    return VMValue::null();
   }
-  Value val = std::move(m_stack.back());
+  VMValue val = m_stack.back();
   m_stack.pop_back();
   return val;
 }
 
+VMValue VirtualMachine::concat(const VMValue &a, const VMValue &b) {
+  // Reuse one buffer for the result so repeated concatenation only allocates
+  // when the pool sees a new string
+  m_concatBuffer.clear();
+  m_concatBuffer.append(stringOf(a, m_strings, m_scratchA));
+  m_concatBuffer.append(stringOf(b, m_strings, m_scratchB));
+  if (m_strings.size() >= m_collectThreshold) {
+    // The operands were copied into the buffer, so their handles may move
+    collectStrings();
+  }
+  return VMValue::makeString(m_strings.intern(m_concatBuffer));
+}
+
+int VirtualMachine::compareStrings(const VMValue &a, const VMValue &b) {
+  if (a.type == ValueType::String && b.type == ValueType::String &&
+      a.str == b.str) {
+    return 0; // interned: equal handles mean equal strings
+  }
+  return stringOf(a, m_strings, m_scratchA)
+      .compare(stringOf(b, m_strings, m_scratchB));
+}
+
+VMValue VirtualMachine::addValues(const VMValue &a, const VMValue &b) {
+  if (a.type == ValueType::String || b.type == ValueType::String) {
+    return concat(a, b);
+  }
+  if (a.type == ValueType::Float || b.type == ValueType::Float) {
+    return VMValue::makeFloat(a.asFloat() + b.asFloat());
+  }
+  return VMValue::makeInt(a.asInt() + b.asInt());
+}
+
+VMValue VirtualMachine::subValues(const VMValue &a, const VMValue &b) {
+  if (a.type == ValueType::Float || b.type == ValueType::Float) {
+    return VMValue::makeFloat(a.asFloat() - b.asFloat());
+  }
+  return VMValue::makeInt(a.asInt() - b.asInt());
+}
+
+VMValue VirtualMachine::mulValues(const VMValue &a, const VMValue &b) {
+  if (a.type == ValueType::Float || b.type == ValueType::Float) {
+    return VMValue::makeFloat(a.asFloat() * b.asFloat());
+  }
+  return VMValue::makeInt(a.asInt() * b.asInt());
+}
+
+VMValue VirtualMachine::negateValue(const VMValue &a) {
+  if (a.type == ValueType::Float) {
+    return VMValue::makeFloat(-a.asFloat());
+  }
+  return VMValue::makeInt(-a.asInt());
+}
+
+bool VirtualMachine::equalValues(const VMValue &a, const VMValue &b) {
+  // Type-aware equality comparison; NE is its exact negation
+  if (a.type == ValueType::Null && b.type == ValueType::Null) {
+    return true;
+  }
+  if (a.type == ValueType::Null || b.type == ValueType::Null) {
+    return false;
+  }
+  if (a.type == ValueType::String || b.type == ValueType::String) {
+    return compareStrings(a, b) == 0;
+  }
+  if (a.type == ValueType::Bool && b.type == ValueType::Bool) {
+    return a.b == b.b;
+  }
+  if (a.type == ValueType::Float || b.type == ValueType::Float) {
+    return a.asFloat() == b.asFloat();
+  }
+  return a.asInt() == b.asInt();
+}
+
+template <typename Compare>
+bool VirtualMachine::orderValues(const VMValue &a, const VMValue &b,
+                                 Compare cmp) {
+  // Coercion rules shared by LT/LE/GT/GE:
+  // - String types: lexicographic comparison
+  // - Numeric types (Int/Float): numeric comparison (convert to Float if either is Float)
+  // - Bool: treated as Int (true=1, false=0)
+  // - Null: treated as 0 in numeric context
+  if (a.type == ValueType::String || b.type == ValueType::String) {
+    return cmp(compareStrings(a, b), 0);
+  }
+  if (a.type == ValueType::Float || b.type == ValueType::Float) {
+    return cmp(a.asFloat(), b.asFloat());
+  }
+  return cmp(a.asInt(), b.asInt());
+}
+
+StringHandle VirtualMachine::getStringHandle(u32 index) const {
+  if (index < m_stringHandles.size()) {
+    return m_stringHandles[index];
+  }
+  (void)getString(index); // reports the bad index and halts
+  return StringPool::EMPTY;
+}
+
 const std::string &VirtualMachine::getString(u32 index) const {
   static const std::string empty;
   if (index < m_stringTable.size()) {
@@ -778,6 +1558,15 @@ const std::string &VirtualMachine::getString(u32 index) const {
 // Debugger Integration
 // =========================================================================
 
+std::vector<Value> VirtualMachine::getStack() const {
+  std::vector<Value> stack;
+  stack.reserve(m_stack.size());
+  for (const auto &value : m_stack) {
+    stack.push_back(toValue(value, m_strings));
+  }
+  return stack;
+}
+
 void VirtualMachine::attachDebugger(VMDebugger *debugger) {
   m_debugger = debugger;
   NOVELMIND_LOG_DEBUG("Debugger attached to VM");
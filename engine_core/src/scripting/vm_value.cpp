@@ -0,0 +1,86 @@
+#include "NovelMind/scripting/vm_value.hpp"
+
+namespace NovelMind::scripting {
+
+StringPool::StringPool() { clear(); }
+
+StringHandle StringPool::intern(std::string_view str) {
+  auto it = m_lookup.find(str);
+  if (it != m_lookup.end()) {
+    return it->second;
+  }
+
+  const auto handle = static_cast<StringHandle>(m_strings.size());
+  m_strings.emplace_back(str);
+  m_lookup.emplace(std::string_view(m_strings.back()), handle);
+  return handle;
+}
+
+const std::string &StringPool::get(StringHandle handle) const {
+  static const std::string empty;
+  if (handle < m_strings.size()) {
+    return m_strings[handle];
+  }
+  return empty;
+}
+
+void StringPool::truncate(usize count) {
+  while (m_strings.size() > count && m_strings.size() > 1) {
+    m_lookup.erase(std::string_view(m_strings.back()));
+    m_strings.pop_back();
+  }
+}
+
+void StringPool::clear() {
+  m_lookup.clear();
+  m_strings.clear();
+  m_strings.emplace_back();
+  m_lookup.emplace(std::string_view(m_strings.back()), EMPTY);
+}
+
+Value toValue(const VMValue &value, const StringPool &pool) {
+  switch (value.type) {
+  case ValueType::Int:
+    return value.i;
+  case ValueType::Float:
+    return value.f;
+  case ValueType::Bool:
+    return value.b;
+  case ValueType::String:
+    return pool.get(value.str);
+  default:
+    return std::monostate{};
+  }
+}
+
+VMValue fromValue(const Value &value, StringPool &pool) {
+  if (auto *p = std::get_if<i32>(&value))
+    return VMValue::makeInt(*p);
+  if (auto *p = std::get_if<f32>(&value))
+    return VMValue::makeFloat(*p);
+  if (auto *p = std::get_if<bool>(&value))
+    return VMValue::makeBool(*p);
+  if (auto *p = std::get_if<std::string>(&value))
+    return VMValue::makeString(pool.intern(*p));
+  return VMValue::null();
+}
+
+std::string_view stringOf(const VMValue &value, const StringPool &pool,
+                          std::string &scratch) {
+  switch (value.type) {
+  case ValueType::String:
+    return pool.view(value.str);
+  case ValueType::Int:
+    scratch = std::to_string(value.i);
+    return scratch;
+  case ValueType::Float:
+    scratch = std::to_string(value.f);
+    return scratch;
+  case ValueType::Bool:
+    return value.b ? "true" : "false";
+  default:
+    return "null";
+  }
+}
+
+} // namespace NovelMind::scripting
@@ -0,0 +1,216 @@
+#include "NovelMind/vfs/cache_policy.hpp"
+#include <algorithm>
+
+namespace NovelMind::VFS {
+
+std::unique_ptr<IEvictionPolicy> createEvictionPolicy(EvictionPolicy policy) {
+  switch (policy) {
+  case EvictionPolicy::SIEVE:
+    return std::make_unique<SievePolicy>();
+  case EvictionPolicy::GDSF:
+    return std::make_unique<GdsfPolicy>();
+  case EvictionPolicy::LRU:
+  default:
+    return std::make_unique<LruPolicy>();
+  }
+}
+
+// CacheEntryList
+
+void CacheEntryList::pushFront(CacheEntry &entry) {
+  entry.prev = nullptr;
+  entry.next = m_head;
+  if (m_head) {
+    m_head->prev = &entry;
+  }
+  m_head = &entry;
+  if (!m_tail) {
+    m_tail = &entry;
+  }
+}
+
+void CacheEntryList::unlink(CacheEntry &entry) {
+  if (entry.prev) {
+    entry.prev->next = entry.next;
+  } else {
+    m_head = entry.next;
+  }
+  if (entry.next) {
+    entry.next->prev = entry.prev;
+  } else {
+    m_tail = entry.prev;
+  }
+  entry.prev = nullptr;
+  entry.next = nullptr;
+}
+
+// LRU
+
+void LruPolicy::onInsert(CacheEntry &entry) { m_list.pushFront(entry); }
+
+void LruPolicy::onAccess(CacheEntry &entry) {
+  if (m_list.head() != &entry) {
+    m_list.unlink(entry);
+    m_list.pushFront(entry);
+  }
+}
+
+void LruPolicy::onRemove(CacheEntry &entry) { m_list.unlink(entry); }
+
+CacheEntry *LruPolicy::selectVictim(const Filter &accept) {
+  for (CacheEntry *entry = m_list.tail(); entry; entry = entry->prev) {
+    if (!accept || accept(*entry)) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+const CacheEntry *LruPolicy::peekVictim(const Filter &accept) const {
+  for (const CacheEntry *entry = m_list.tail(); entry; entry = entry->prev) {
+    if (!accept || accept(*entry)) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+f64 LruPolicy::evictionRank(const CacheEntry &entry) const {
+  return static_cast<f64>(entry.accessTick);
+}
+
+// SIEVE
+
+void SievePolicy::onInsert(CacheEntry &entry) {
+  entry.visited = false;
+  m_list.pushFront(entry);
+}
+
+void SievePolicy::onAccess(CacheEntry &entry) { entry.visited = true; }
+
+void SievePolicy::onRemove(CacheEntry &entry) {
+  if (m_hand == &entry) {
+    m_hand = entry.prev;
+  }
+  m_list.unlink(entry);
+}
+
+CacheEntry *SievePolicy::selectVictim(const Filter &accept) {
+  if (!m_list.tail()) {
+    return nullptr;
+  }
+
+  // Two passes always suffice: the first clears every visited bit it
+  // passes over, so the second finds an unvisited candidate if one exists
+  CacheEntry *hand = m_hand ? m_hand : m_list.tail();
+  const CacheEntry *start = hand;
+  bool wrapped = false;
+  while (true) {
+    if (!accept || accept(*hand)) {
+      if (!hand->visited) {
+        m_hand = hand->prev;
+        return hand;
+      }
+      hand->visited = false;
+    }
+
+    hand = hand->prev ? hand->prev : m_list.tail();
+    if (hand == start) {
+      if (wrapped) {
+        return nullptr;
+      }
+      wrapped = true;
+    }
+  }
+}
+
+const CacheEntry *SievePolicy::peekVictim(const Filter &accept) const {
+  // selectVictim() takes the first unvisited candidate from the hand; if
+  // every candidate is visited, it clears them all and takes the first
+  const CacheEntry *start = m_hand ? m_hand : m_list.tail();
+  const CacheEntry *first = nullptr;
+  const CacheEntry *hand = start;
+  while (hand) {
+    if (!accept || accept(*hand)) {
+      if (!hand->visited) {
+        return hand;
+      }
+      if (!first) {
+        first = hand;
+      }
+    }
+    hand = hand->prev ? hand->prev : m_list.tail();
+    if (hand == start) {
+      break;
+    }
+  }
+  return first;
+}
+
+f64 SievePolicy::evictionRank(const CacheEntry &entry) const {
+  // A visited entry is only offered once its whole shard is visited; it
+  // ranks as if reinserted at its last hit, which is its second chance
+  return static_cast<f64>(entry.visited ? entry.accessTick : entry.insertTick);
+}
+
+void SievePolicy::clear() {
+  m_list.clear();
+  m_hand = nullptr;
+}
+
+// GDSF
+
+f64 GdsfPolicy::computePriority(const CacheEntry &entry) const {
+  const f64 frequency = static_cast<f64>(std::max<usize>(entry.accessCount, 1));
+  const f64 size = static_cast<f64>(std::max<usize>(entry.size, 1));
+  return m_inflation + frequency / size;
+}
+
+void GdsfPolicy::onInsert(CacheEntry &entry) {
+  entry.priority = computePriority(entry);
+  m_queue.emplace(entry.priority, &entry);
+}
+
+void GdsfPolicy::onAccess(CacheEntry &entry) {
+  m_queue.erase({entry.priority, &entry});
+  entry.priority = computePriority(entry);
+  m_queue.emplace(entry.priority, &entry);
+}
+
+void GdsfPolicy::onRemove(CacheEntry &entry) {
+  m_queue.erase({entry.priority, &entry});
+}
+
+CacheEntry *GdsfPolicy::selectVictim(const Filter &accept) {
+  for (const auto &[priority, entry] : m_queue) {
+    if (!accept || accept(*entry)) {
+      m_inflation = std::max(m_inflation, priority);
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+const CacheEntry *GdsfPolicy::peekVictim(const Filter &accept) const {
+  for (const auto &[priority, entry] : m_queue) {
+    if (!accept || accept(*entry)) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+f64 GdsfPolicy::evictionRank(const CacheEntry &entry) const {
+  return entry.priority;
+}
+
+void GdsfPolicy::onEvicted(f64 rank) {
+  m_inflation = std::max(m_inflation, rank);
+}
+
+void GdsfPolicy::clear() {
+  m_queue.clear();
+  m_inflation = 0.0;
+}
+
+} // namespace NovelMind::VFS
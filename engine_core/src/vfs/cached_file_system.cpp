@@ -29,36 +29,87 @@ void CachedFileSystem::unmountAll() {
 
 Result<std::vector<u8>>
 CachedFileSystem::readFile(const std::string &resourceId) const {
-  auto it = m_cache.find(resourceId);
-  if (it != m_cache.end()) {
-    touch(resourceId);
-    return Result<std::vector<u8>>::ok(it->second.first.data);
+  auto view = readFileView(resourceId);
+  if (view.isError()) {
+    return Result<std::vector<u8>>::error(view.error());
+  }
+  return Result<std::vector<u8>>::ok(view.value().toVector());
+}
+
+Result<ResourceView>
+CachedFileSystem::readFileView(const std::string &resourceId) const {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_cache.find(resourceId);
+    if (it != m_cache.end()) {
+      touch(resourceId);
+      return Result<ResourceView>::ok(it->second.first.data);
+    }
   }
 
   if (!m_inner) {
-    return Result<std::vector<u8>>::error("CachedFileSystem has no inner FS");
+    return Result<ResourceView>::error("CachedFileSystem has no inner FS");
   }
 
-  auto result = m_inner->readFile(resourceId);
+  // Read outside the lock so a slow miss does not stall cache hits
+  auto result = m_inner->readFileView(resourceId);
   if (result.isError()) {
     return result;
   }
 
-  CacheEntry entry;
-  entry.data = result.value();
-  entry.size = entry.data.size();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  insert(resourceId, result.value());
+  return result;
+}
 
-  m_lru.push_front(resourceId);
-  m_cache[resourceId] = {entry, m_lru.begin()};
-  m_currentBytes += entry.size;
-  evictIfNeeded();
+std::vector<Result<std::vector<u8>>>
+CachedFileSystem::readFiles(const std::vector<std::string> &resourceIds) const {
+  std::vector<Result<std::vector<u8>>> results;
+  results.reserve(resourceIds.size());
+  std::vector<std::string> missIds;
+  std::vector<usize> missSlots;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (usize i = 0; i < resourceIds.size(); ++i) {
+      auto it = m_cache.find(resourceIds[i]);
+      if (it != m_cache.end()) {
+        touch(resourceIds[i]);
+        results.push_back(
+            Result<std::vector<u8>>::ok(it->second.first.data.toVector()));
+      } else {
+        results.push_back(
+            Result<std::vector<u8>>::error("CachedFileSystem has no inner FS"));
+        missIds.push_back(resourceIds[i]);
+        missSlots.push_back(i);
+      }
+    }
+  }
+
+  if (missIds.empty() || !m_inner) {
+    return results;
+  }
 
-  return Result<std::vector<u8>>::ok(std::move(entry.data));
+  auto fetched = m_inner->readFiles(missIds);
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (usize i = 0; i < fetched.size(); ++i) {
+    auto &result = results[missSlots[i]];
+    if (fetched[i].isError()) {
+      result = std::move(fetched[i]);
+      continue;
+    }
+    auto view = ResourceView::fromVector(std::move(fetched[i]).value());
+    result = Result<std::vector<u8>>::ok(view.toVector());
+    insert(missIds[i], view);
+  }
+  return results;
 }
 
 bool CachedFileSystem::exists(const std::string &resourceId) const {
-  if (m_cache.find(resourceId) != m_cache.end()) {
-    return true;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_cache.find(resourceId) != m_cache.end()) {
+      return true;
+    }
   }
   return m_inner ? m_inner->exists(resourceId) : false;
 }
@@ -80,11 +131,13 @@ CachedFileSystem::listResources(ResourceType type) const {
 }
 
 void CachedFileSystem::setMaxBytes(usize maxBytes) {
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_maxBytes = maxBytes;
   evictIfNeeded();
 }
 
 void CachedFileSystem::clearCache() {
+  std::lock_guard<std::mutex> lock(m_mutex);
   m_cache.clear();
   m_lru.clear();
   m_currentBytes = 0;
@@ -101,6 +154,22 @@ void CachedFileSystem::touch(const std::string &resourceId) const {
   it->second.second = m_lru.begin();
 }
 
+void CachedFileSystem::insert(const std::string &resourceId,
+                              const ResourceView &data) const {
+  if (m_cache.find(resourceId) != m_cache.end()) {
+    return; // another thread cached it meanwhile
+  }
+
+  CacheEntry entry;
+  entry.data = data;
+  entry.size = entry.data.size();
+
+  m_lru.push_front(resourceId);
+  m_cache[resourceId] = {entry, m_lru.begin()};
+  m_currentBytes += entry.size;
+  evictIfNeeded();
+}
+
 void CachedFileSystem::evictIfNeeded() const {
   if (m_maxBytes == 0) {
     return;
@@ -4,6 +4,37 @@
 
 namespace NovelMind::VFS {
 
+namespace {
+
+Result<usize> resolveSeek(i64 offset, SeekOrigin origin, usize position,
+                          usize size) {
+  i64 newPosition = 0;
+
+  switch (origin) {
+  case SeekOrigin::Begin:
+    newPosition = offset;
+    break;
+  case SeekOrigin::Current:
+    newPosition = static_cast<i64>(position) + offset;
+    break;
+  case SeekOrigin::End:
+    newPosition = static_cast<i64>(size) + offset;
+    break;
+  }
+
+  if (newPosition < 0) {
+    return Result<usize>::error("Seek position before beginning of file");
+  }
+
+  if (static_cast<usize>(newPosition) > size) {
+    return Result<usize>::error("Seek position past end of file");
+  }
+
+  return Result<usize>::ok(static_cast<usize>(newPosition));
+}
+
+} // namespace
+
 Result<std::vector<u8>> IFileHandle::readAll() {
   if (!isValid()) {
     return Result<std::vector<u8>>::error("Invalid file handle");
@@ -81,29 +112,117 @@ Result<void> MemoryFileHandle::seek(i64 offset, SeekOrigin origin) {
     return Result<void>::error("Invalid file handle");
   }
 
-  i64 newPosition = 0;
+  auto target = resolveSeek(offset, origin, m_position, m_data.size());
+  if (!target.isOk()) {
+    return Result<void>::error(target.error());
+  }
 
-  switch (origin) {
-  case SeekOrigin::Begin:
-    newPosition = offset;
-    break;
-  case SeekOrigin::Current:
-    newPosition = static_cast<i64>(m_position) + offset;
-    break;
-  case SeekOrigin::End:
-    newPosition = static_cast<i64>(m_data.size()) + offset;
-    break;
+  m_position = target.value();
+  return Result<void>::ok();
+}
+
+ViewFileHandle::ViewFileHandle(vfs::ResourceView view)
+    : m_view(std::move(view)) {}
+
+bool ViewFileHandle::isValid() const { return true; }
+
+usize ViewFileHandle::size() const { return m_view.size(); }
+
+usize ViewFileHandle::position() const { return m_position; }
+
+bool ViewFileHandle::isEof() const { return m_position >= m_view.size(); }
+
+Result<usize> ViewFileHandle::read(u8 *buffer, usize count) {
+  if (buffer == nullptr) {
+    return Result<usize>::error("Null buffer");
   }
 
-  if (newPosition < 0) {
-    return Result<void>::error("Seek position before beginning of file");
+  const usize toRead = std::min(count, m_view.size() - m_position);
+  if (toRead > 0) {
+    std::memcpy(buffer, m_view.data() + m_position, toRead);
+    m_position += toRead;
+  }
+
+  return Result<usize>::ok(toRead);
+}
+
+Result<void> ViewFileHandle::seek(i64 offset, SeekOrigin origin) {
+  auto target = resolveSeek(offset, origin, m_position, m_view.size());
+  if (!target.isOk()) {
+    return Result<void>::error(target.error());
+  }
+
+  m_position = target.value();
+  return Result<void>::ok();
+}
+
+DiskFileHandle::DiskFileHandle(const std::string &path)
+    : m_file(path, std::ios::binary | std::ios::ate) {
+  if (!m_file) {
+    return;
+  }
+
+  const auto end = m_file.tellg();
+  if (end < 0) {
+    return;
+  }
+
+  m_size = static_cast<usize>(end);
+  m_file.seekg(0, std::ios::beg);
+  m_valid = static_cast<bool>(m_file);
+}
+
+bool DiskFileHandle::isValid() const { return m_valid; }
+
+usize DiskFileHandle::size() const { return m_size; }
+
+usize DiskFileHandle::position() const { return m_position; }
+
+bool DiskFileHandle::isEof() const { return m_position >= m_size; }
+
+Result<usize> DiskFileHandle::read(u8 *buffer, usize count) {
+  if (!m_valid) {
+    return Result<usize>::error("Invalid file handle");
+  }
+
+  if (buffer == nullptr) {
+    return Result<usize>::error("Null buffer");
+  }
+
+  const usize toRead = std::min(count, m_size - m_position);
+  if (toRead == 0) {
+    return Result<usize>::ok(0);
+  }
+
+  m_file.read(reinterpret_cast<char *>(buffer),
+              static_cast<std::streamsize>(toRead));
+  const auto got = static_cast<usize>(m_file.gcount());
+  m_position += got;
+  if (got < toRead) {
+    // The file shrank underneath us; clear EOF so later seeks still work
+    m_file.clear();
+  }
+
+  return Result<usize>::ok(got);
+}
+
+Result<void> DiskFileHandle::seek(i64 offset, SeekOrigin origin) {
+  if (!m_valid) {
+    return Result<void>::error("Invalid file handle");
+  }
+
+  auto target = resolveSeek(offset, origin, m_position, m_size);
+  if (!target.isOk()) {
+    return Result<void>::error(target.error());
   }
 
-  if (static_cast<usize>(newPosition) > m_data.size()) {
-    return Result<void>::error("Seek position past end of file");
+  m_file.clear();
+  m_file.seekg(static_cast<std::streamoff>(target.value()), std::ios::beg);
+  if (!m_file) {
+    return Result<void>::error("Failed to seek file");
   }
 
-  m_position = static_cast<usize>(newPosition);
+  m_position = target.value();
   return Result<void>::ok();
 }
 
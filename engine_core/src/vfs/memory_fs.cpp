@@ -1,4 +1,5 @@
 #include "NovelMind/vfs/memory_fs.hpp"
+#include "NovelMind/core/checksum.hpp"
 
 namespace NovelMind::vfs {
 
@@ -86,15 +87,7 @@ void MemoryFileSystem::clear() {
 }
 
 u32 MemoryFileSystem::calculateChecksum(const std::vector<u8> &data) {
-  // Simple CRC32 implementation
-  u32 crc = 0xFFFFFFFF;
-  for (u8 byte : data) {
-    crc ^= byte;
-    for (int i = 0; i < 8; ++i) {
-      crc = (crc >> 1) ^ ((crc & 1u) ? 0xEDB88320u : 0u);
-    }
-  }
-  return ~crc;
+  return core::crc32(data.data(), data.size());
 }
 
 } // namespace NovelMind::vfs
@@ -5,6 +5,7 @@
 
 #include "NovelMind/vfs/multi_pack_manager.hpp"
 #include <algorithm>
+#include <cstring>
 #include <cstdlib>
 #include <filesystem>
 #include <fstream>
@@ -77,6 +78,48 @@ std::optional<std::vector<u8>> decodeHex(const std::string &hex) {
   return bytes;
 }
 
+i64 packModifiedTime(const std::string &path) {
+  std::error_code ec;
+  const auto time = fs::last_write_time(path, ec);
+  return ec ? 0 : static_cast<i64>(time.time_since_epoch().count());
+}
+
+// Index snapshot: "NMRI", version, paths (length + bytes), then per pack its
+// path, size, modification time and sorted PathIds. Native byte order, like
+// the other caches; a mismatch only costs a rebuild.
+constexpr char SNAPSHOT_MAGIC[4] = {'N', 'M', 'R', 'I'};
+constexpr u32 SNAPSHOT_VERSION = 1;
+
+class SnapshotReader {
+public:
+  explicit SnapshotReader(const std::vector<u8> &data) : m_data(data) {}
+
+  template <typename T> bool read(T &value) {
+    if (m_data.size() - m_pos < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, m_data.data() + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return true;
+  }
+
+  bool readBytes(usize size, std::string_view &out) {
+    if (m_data.size() - m_pos < size) {
+      return false;
+    }
+    out = std::string_view(reinterpret_cast<const char *>(m_data.data()) + m_pos,
+                           size);
+    m_pos += size;
+    return true;
+  }
+
+  [[nodiscard]] bool atEnd() const { return m_pos == m_data.size(); }
+
+private:
+  const std::vector<u8> &m_data;
+  usize m_pos = 0;
+};
+
 std::string getEnvValue(const char *name) {
 #if defined(_WIN32)
   char *value = nullptr;
@@ -121,7 +164,7 @@ Result<void> MultiPackManager::initialize() {
 
   m_packs.clear();
   m_packIdToIndex.clear();
-  m_resourceIndex.clear();
+  resetResourceIndex();
   m_modLoadOrder.clear();
 
   auto envResult = configureKeysFromEnvironment();
@@ -275,13 +318,38 @@ PackLoadResult MultiPackManager::loadPackInternal(const std::string &path,
   loadedPack->info = std::move(info);
   loadedPack->reader = std::move(reader);
   loadedPack->effectivePriority = calculateEffectivePriority(type, priority);
+  loadedPack->loadSequence = m_nextLoadSequence++;
+
+  // Collect provided resources, from the snapshot if the pack is unchanged
+  auto &provided = loadedPack->providedResources;
+  auto snapshot = m_snapshotPacks.find(path);
+  if (snapshot != m_snapshotPacks.end() &&
+      snapshot->second.fileSize == loadedPack->info.fileSize &&
+      snapshot->second.modifiedTime == packModifiedTime(path)) {
+    provided = std::move(snapshot->second.resources);
+  } else {
+    auto resources = loadedPack->reader->listResources();
+    m_resourceIndex.reserve(m_resourceIndex.pathCount() + resources.size());
+    provided.reserve(resources.size());
+    for (const auto &resId : resources) {
+      provided.push_back(m_resourceIndex.intern(resId));
+    }
+    std::sort(provided.begin(), provided.end());
+  }
+  if (snapshot != m_snapshotPacks.end()) {
+    m_snapshotPacks.erase(snapshot);
+  }
+  result.loadedResources = provided.size();
 
-  // Collect provided resources
-  auto resources = loadedPack->reader->listResources();
-  for (const auto &resId : resources) {
-    loadedPack->providedResources.insert(resId);
+  // Assign a stable slot for the index
+  auto freeSlot = std::find(m_packSlots.begin(), m_packSlots.end(), nullptr);
+  if (freeSlot != m_packSlots.end()) {
+    loadedPack->slot = static_cast<u32>(freeSlot - m_packSlots.begin());
+    *freeSlot = loadedPack.get();
+  } else {
+    loadedPack->slot = static_cast<u32>(m_packSlots.size());
+    m_packSlots.push_back(loadedPack.get());
   }
-  result.loadedResources = loadedPack->providedResources.size();
 
   // Add to packs list
   m_packIdToIndex[loadedPack->info.id] = m_packs.size();
@@ -292,8 +360,8 @@ PackLoadResult MultiPackManager::loadPackInternal(const std::string &path,
     m_modLoadOrder.push_back(result.packId);
   }
 
-  // Rebuild resource index
-  rebuildResourceIndex();
+  // Add its resources to the index
+  indexPack(*m_packs.back());
 
   result.success = true;
   firePackLoaded(m_packs.back()->info);
@@ -318,6 +386,12 @@ void MultiPackManager::unloadPack(const std::string &packId) {
       std::remove(m_modLoadOrder.begin(), m_modLoadOrder.end(), packId),
       m_modLoadOrder.end());
 
+  // Hand its resources to the next provider before it goes away
+  if (m_packs[index]->info.enabled) {
+    unindexPack(*m_packs[index]);
+  }
+  m_packSlots[m_packs[index]->slot] = nullptr;
+
   // Remove from packs list
   m_packs.erase(m_packs.begin() + static_cast<ptrdiff_t>(index));
 
@@ -327,7 +401,6 @@ void MultiPackManager::unloadPack(const std::string &packId) {
     m_packIdToIndex[m_packs[i]->info.id] = i;
   }
 
-  rebuildResourceIndex();
   firePackUnloaded(packId);
 }
 
@@ -356,7 +429,7 @@ void MultiPackManager::unloadAllPacks() {
 
   m_packs.clear();
   m_packIdToIndex.clear();
-  m_resourceIndex.clear();
+  resetResourceIndex();
   m_modLoadOrder.clear();
 }
 
@@ -379,9 +452,18 @@ PackLoadResult MultiPackManager::reloadPack(const std::string &packId) {
 
 void MultiPackManager::setPackEnabled(const std::string &packId, bool enabled) {
   auto it = m_packIdToIndex.find(packId);
-  if (it != m_packIdToIndex.end()) {
-    m_packs[it->second]->info.enabled = enabled;
-    rebuildResourceIndex();
+  if (it == m_packIdToIndex.end()) {
+    return;
+  }
+  LoadedPack &pack = *m_packs[it->second];
+  if (pack.info.enabled == enabled) {
+    return;
+  }
+  pack.info.enabled = enabled;
+  if (enabled) {
+    indexPack(pack);
+  } else {
+    unindexPack(pack);
   }
 }
 
@@ -519,12 +601,12 @@ bool MultiPackManager::isPackEnabled(const std::string &packId) const {
 
 Result<std::vector<u8>>
 MultiPackManager::readResource(const std::string &resourceId) {
-  auto it = m_resourceIndex.find(resourceId);
-  if (it == m_resourceIndex.end()) {
+  const u32 slot = m_resourceIndex.provider(resourceId);
+  if (slot == ResourceIndex::NO_PACK) {
     return Result<std::vector<u8>>::error("Resource not found: " + resourceId);
   }
 
-  auto &pack = m_packs[it->second];
+  const LoadedPack *pack = m_packSlots[slot];
   if (!pack->info.enabled) {
     return Result<std::vector<u8>>::error("Pack is disabled: " + pack->info.id);
   }
@@ -532,25 +614,61 @@ MultiPackManager::readResource(const std::string &resourceId) {
   return pack->reader->readFile(resourceId);
 }
 
+std::vector<Result<std::vector<u8>>>
+MultiPackManager::readResources(const std::vector<std::string> &resourceIds) {
+  std::vector<Result<std::vector<u8>>> results;
+  results.reserve(resourceIds.size());
+
+  // Per provider slot: the IDs it serves and where their results go
+  std::unordered_map<u32, std::pair<std::vector<std::string>, std::vector<usize>>>
+      batches;
+  for (usize i = 0; i < resourceIds.size(); ++i) {
+    const u32 slot = m_resourceIndex.provider(resourceIds[i]);
+    if (slot == ResourceIndex::NO_PACK) {
+      results.push_back(Result<std::vector<u8>>::error("Resource not found: " +
+                                                       resourceIds[i]));
+      continue;
+    }
+    const LoadedPack *pack = m_packSlots[slot];
+    if (!pack->info.enabled) {
+      results.push_back(
+          Result<std::vector<u8>>::error("Pack is disabled: " + pack->info.id));
+      continue;
+    }
+    results.push_back(Result<std::vector<u8>>::error("Resource not read"));
+    auto &batch = batches[slot];
+    batch.first.push_back(resourceIds[i]);
+    batch.second.push_back(i);
+  }
+
+  for (auto &[slot, batch] : batches) {
+    auto data = m_packSlots[slot]->reader->readFiles(batch.first);
+    for (usize i = 0; i < data.size(); ++i) {
+      results[batch.second[i]] = std::move(data[i]);
+    }
+  }
+  return results;
+}
+
 bool MultiPackManager::exists(const std::string &resourceId) const {
-  return m_resourceIndex.find(resourceId) != m_resourceIndex.end();
+  return m_resourceIndex.provider(resourceId) != ResourceIndex::NO_PACK;
 }
 
 std::optional<ResourceInfo>
 MultiPackManager::getResourceInfo(const std::string &resourceId) const {
-  auto it = m_resourceIndex.find(resourceId);
-  if (it == m_resourceIndex.end()) {
+  const u32 slot = m_resourceIndex.provider(resourceId);
+  if (slot == ResourceIndex::NO_PACK) {
     return std::nullopt;
   }
 
-  return m_packs[it->second]->reader->getInfo(resourceId);
+  return m_packSlots[slot]->reader->getInfo(resourceId);
 }
 
 std::string
 MultiPackManager::getResourcePack(const std::string &resourceId) const {
-  auto it = m_resourceIndex.find(resourceId);
-  if (it != m_resourceIndex.end()) {
-    return m_packs[it->second]->info.id;
+  const u32 slot = m_resourceIndex.provider(resourceId);
+  if (slot != ResourceIndex::NO_PACK) {
+    return m_packSlots[slot]->info.id;
   }
   return "";
 }
@@ -558,16 +676,21 @@ MultiPackManager::getResourcePack(const std::string &resourceId) const {
 std::vector<std::string>
 MultiPackManager::listResources(ResourceType type) const {
   std::vector<std::string> result;
+  result.reserve(m_resourceIndex.resolvedCount());
 
-  for (const auto &[resourceId, packIndex] : m_resourceIndex) {
-    if (type == ResourceType::Unknown) {
-      result.push_back(resourceId);
-    } else {
-      auto info = m_packs[packIndex]->reader->getInfo(resourceId);
-      if (info && info->type == type) {
-        result.push_back(resourceId);
+  for (ResourceIndex::PathId id = 0; id < m_resourceIndex.pathCount(); ++id) {
+    const u32 slot = m_resourceIndex.provider(id);
+    if (slot == ResourceIndex::NO_PACK) {
+      continue;
+    }
+    std::string resourceId(m_resourceIndex.path(id));
+    if (type != ResourceType::Unknown) {
+      auto info = m_packSlots[slot]->reader->getInfo(resourceId);
+      if (!info || info->type != type) {
+        continue;
       }
     }
+    result.push_back(std::move(resourceId));
   }
 
   return result;
@@ -576,41 +699,33 @@ MultiPackManager::listResources(ResourceType type) const {
 std::vector<ResourceOverride> MultiPackManager::getActiveOverrides() const {
   std::vector<ResourceOverride> overrides;
 
-  // Track first occurrence of each resource
-  std::unordered_map<std::string, std::pair<std::string, PackType>>
-      firstOccurrence;
-
-  // Process packs from lowest to highest priority
-  std::vector<size_t> sortedIndices;
-  for (size_t i = 0; i < m_packs.size(); ++i) {
-    sortedIndices.push_back(i);
+  // Process enabled packs from lowest to highest priority
+  std::vector<const LoadedPack *> sorted;
+  for (const auto &pack : m_packs) {
+    if (pack->info.enabled) {
+      sorted.push_back(pack.get());
+    }
   }
-  std::sort(
-      sortedIndices.begin(), sortedIndices.end(), [this](size_t a, size_t b) {
-        return m_packs[a]->effectivePriority < m_packs[b]->effectivePriority;
-      });
-
-  for (size_t idx : sortedIndices) {
-    const auto &pack = m_packs[idx];
-    if (!pack->info.enabled)
-      continue;
-
-    for (const auto &resourceId : pack->providedResources) {
-      auto it = firstOccurrence.find(resourceId);
-      if (it == firstOccurrence.end()) {
-        firstOccurrence[resourceId] = {pack->info.id, pack->info.type};
-      } else {
+  std::sort(sorted.begin(), sorted.end(),
+            [this](const LoadedPack *a, const LoadedPack *b) {
+              return outranks(*b, *a);
+            });
+
+  // Pack currently providing each path, as the walk goes up in priority
+  std::vector<const LoadedPack *> provider(m_resourceIndex.pathCount(),
+                                           nullptr);
+  for (const LoadedPack *pack : sorted) {
+    for (ResourceIndex::PathId id : pack->providedResources) {
+      if (provider[id]) {
         // This is an override
         ResourceOverride override;
-        override.resourceId = resourceId;
-        override.originalPackId = it->second.first;
+        override.resourceId = std::string(m_resourceIndex.path(id));
+        override.originalPackId = provider[id]->info.id;
         override.overridePackId = pack->info.id;
         override.overrideType = pack->info.type;
         overrides.push_back(override);
-
-        // Update first occurrence to current (since it's now the effective one)
-        it->second = {pack->info.id, pack->info.type};
       }
+      provider[id] = pack;
     }
   }
 
@@ -767,6 +882,124 @@ Result<void> MultiPackManager::loadModConfig(const std::string &path) {
   return {};
 }
 
+// =========================================================================
+// Index Snapshot
+// =========================================================================
+
+Result<void> MultiPackManager::saveIndexSnapshot(const std::string &path) const {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    return Result<void>::error("Failed to open file for writing: " + path);
+  }
+
+  auto write = [&file](const auto &value) {
+    file.write(reinterpret_cast<const char *>(&value), sizeof(value));
+  };
+  auto writeString = [&file, &write](std::string_view str) {
+    write(static_cast<u32>(str.size()));
+    file.write(str.data(), static_cast<std::streamsize>(str.size()));
+  };
+
+  file.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+  write(SNAPSHOT_VERSION);
+
+  write(static_cast<u32>(m_resourceIndex.pathCount()));
+  for (ResourceIndex::PathId id = 0; id < m_resourceIndex.pathCount(); ++id) {
+    writeString(m_resourceIndex.path(id));
+  }
+
+  write(static_cast<u32>(m_packs.size()));
+  for (const auto &pack : m_packs) {
+    writeString(pack->info.path);
+    write(pack->info.fileSize);
+    write(packModifiedTime(pack->info.path));
+    write(static_cast<u32>(pack->providedResources.size()));
+    file.write(reinterpret_cast<const char *>(pack->providedResources.data()),
+               static_cast<std::streamsize>(pack->providedResources.size() *
+                                            sizeof(ResourceIndex::PathId)));
+  }
+
+  if (!file) {
+    return Result<void>::error("Failed to write index snapshot: " + path);
+  }
+  return {};
+}
+
+Result<void> MultiPackManager::loadIndexSnapshot(const std::string &path) {
+  if (!m_packs.empty()) {
+    return Result<void>::error(
+        "Index snapshot must be loaded before mounting packs");
+  }
+
+  auto data = readBinaryFile(path);
+  if (data.isError()) {
+    return Result<void>::error(data.error());
+  }
+
+  m_resourceIndex.clear();
+  m_snapshotPacks.clear();
+
+  const auto corrupt = [this, &path]() {
+    m_resourceIndex.clear();
+    m_snapshotPacks.clear();
+    return Result<void>::error("Invalid index snapshot: " + path);
+  };
+
+  SnapshotReader reader(data.value());
+  std::string_view magic;
+  u32 version = 0;
+  if (!reader.readBytes(sizeof(SNAPSHOT_MAGIC), magic) ||
+      magic != std::string_view(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) ||
+      !reader.read(version) || version != SNAPSHOT_VERSION) {
+    return corrupt();
+  }
+
+  u32 pathCount = 0;
+  if (!reader.read(pathCount)) {
+    return corrupt();
+  }
+  m_resourceIndex.reserve(std::min<usize>(pathCount, data.value().size()));
+  for (u32 i = 0; i < pathCount; ++i) {
+    u32 length = 0;
+    std::string_view resourcePath;
+    if (!reader.read(length) || !reader.readBytes(length, resourcePath) ||
+        m_resourceIndex.intern(resourcePath) != i) {
+      return corrupt();
+    }
+  }
+
+  u32 packCount = 0;
+  if (!reader.read(packCount)) {
+    return corrupt();
+  }
+  for (u32 i = 0; i < packCount; ++i) {
+    u32 length = 0;
+    std::string_view packPath;
+    SnapshotPack pack;
+    u32 resourceCount = 0;
+    if (!reader.read(length) || !reader.readBytes(length, packPath) ||
+        !reader.read(pack.fileSize) || !reader.read(pack.modifiedTime) ||
+        !reader.read(resourceCount) || resourceCount > pathCount) {
+      return corrupt();
+    }
+    pack.resources.resize(resourceCount);
+    for (auto &id : pack.resources) {
+      if (!reader.read(id) || id >= pathCount) {
+        return corrupt();
+      }
+    }
+    if (!std::is_sorted(pack.resources.begin(), pack.resources.end())) {
+      return corrupt();
+    }
+    m_snapshotPacks[std::string(packPath)] = std::move(pack);
+  }
+
+  if (!reader.atEnd()) {
+    return corrupt();
+  }
+  return {};
+}
+
 // =========================================================================
 // Statistics
 // =========================================================================
@@ -774,7 +1007,7 @@ Result<void> MultiPackManager::loadModConfig(const std::string &path) {
 size_t MultiPackManager::getPackCount() const { return m_packs.size(); }
 
 size_t MultiPackManager::getResourceCount() const {
-  return m_resourceIndex.size();
+  return m_resourceIndex.resolvedCount();
 }
 
 size_t MultiPackManager::getOverrideCount() const {
@@ -831,27 +1064,63 @@ PackInfo MultiPackManager::readPackManifest(const std::string &path) {
 }
 
 void MultiPackManager::rebuildResourceIndex() {
-  m_resourceIndex.clear();
+  // Needed only when priorities change; mount, unmount and enable update
+  // the index incrementally
+  m_resourceIndex.clearProviders();
+  for (const auto &pack : m_packs) {
+    if (pack->info.enabled) {
+      indexPack(*pack);
+    }
+  }
+}
 
-  // Sort packs by effective priority (descending for override)
-  std::vector<std::pair<size_t, i32>> sorted;
-  for (size_t i = 0; i < m_packs.size(); ++i) {
-    if (m_packs[i]->info.enabled) {
-      sorted.emplace_back(i, m_packs[i]->effectivePriority);
+void MultiPackManager::resetResourceIndex() {
+  m_packSlots.clear();
+  if (m_snapshotPacks.empty()) {
+    m_resourceIndex.clear();
+  } else {
+    // Snapshot resource lists refer to the interned paths
+    m_resourceIndex.clearProviders();
+  }
+}
+
+bool MultiPackManager::outranks(const LoadedPack &a,
+                                const LoadedPack &b) const {
+  if (a.effectivePriority != b.effectivePriority) {
+    return a.effectivePriority > b.effectivePriority;
+  }
+  return a.loadSequence > b.loadSequence;
+}
+
+void MultiPackManager::indexPack(const LoadedPack &pack) {
+  for (ResourceIndex::PathId id : pack.providedResources) {
+    const u32 current = m_resourceIndex.provider(id);
+    if (current == ResourceIndex::NO_PACK ||
+        outranks(pack, *m_packSlots[current])) {
+      m_resourceIndex.setProvider(id, pack.slot);
     }
   }
+}
 
-  std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
-    return a.second > b.second; // Higher priority first
-  });
+void MultiPackManager::unindexPack(const LoadedPack &pack) {
+  for (ResourceIndex::PathId id : pack.providedResources) {
+    if (m_resourceIndex.provider(id) != pack.slot) {
+      continue;
+    }
 
-  // Build index (first occurrence wins due to descending sort)
-  for (const auto &[idx, priority] : sorted) {
-    for (const auto &resourceId : m_packs[idx]->providedResources) {
-      if (m_resourceIndex.find(resourceId) == m_resourceIndex.end()) {
-        m_resourceIndex[resourceId] = idx;
+    // Fall back to the best remaining enabled pack with this resource
+    const LoadedPack *best = nullptr;
+    for (const auto &other : m_packs) {
+      if (other.get() == &pack || !other->info.enabled ||
+          (best && !outranks(*other, *best))) {
+        continue;
+      }
+      if (std::binary_search(other->providedResources.begin(),
+                             other->providedResources.end(), id)) {
+        best = other.get();
       }
     }
+    m_resourceIndex.setProvider(id, best ? best->slot : ResourceIndex::NO_PACK);
   }
 }
 
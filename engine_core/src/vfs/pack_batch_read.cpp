@@ -0,0 +1,260 @@
+#include "pack_batch_read.hpp"
+#include "NovelMind/vfs/pack_reader.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <span>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#define NOVELMIND_PACK_PREADV 1
+#endif
+
+namespace NovelMind::vfs::detail {
+
+namespace {
+
+#ifdef IOV_MAX
+constexpr usize MAX_IOVECS = IOV_MAX;
+#else
+constexpr usize MAX_IOVECS = 16;
+#endif
+
+/// Cap on resources per span, keeping one span within a few preadv() calls
+constexpr usize MAX_BATCH_RANGES = 256;
+
+/**
+ * @brief Pack file opened once for a whole batch of reads
+ *
+ * With preadv() a span lands directly in the per-resource buffers in one
+ * system call; elsewhere the span is read front to back through a stream.
+ */
+class BatchFile {
+public:
+  explicit BatchFile(const std::string &path);
+  ~BatchFile();
+  BatchFile(const BatchFile &) = delete;
+  BatchFile &operator=(const BatchFile &) = delete;
+
+  [[nodiscard]] bool isOpen() const;
+  [[nodiscard]] u64 size() const { return m_size; }
+
+  /**
+   * @brief Tell the OS a span will be read soon so it can queue the I/O
+   */
+  void willNeed(u64 offset, u64 length);
+
+  /**
+   * @brief Read disjoint, ascending @p ranges in one pass
+   *
+   * Bytes between ranges are read into @p gapScratch and dropped, which is
+   * cheaper than a seek on spinning and network storage.
+   */
+  bool readSpan(std::span<const BatchRange> ranges,
+                std::vector<u8> &gapScratch);
+
+private:
+#ifdef NOVELMIND_PACK_PREADV
+  int m_fd = -1;
+#else
+  std::ifstream m_stream;
+#endif
+  u64 m_size = 0;
+};
+
+#ifdef NOVELMIND_PACK_PREADV
+
+BatchFile::BatchFile(const std::string &path) {
+  m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  struct stat info {};
+  if (m_fd >= 0 && ::fstat(m_fd, &info) == 0) {
+    m_size = static_cast<u64>(info.st_size);
+  }
+}
+
+BatchFile::~BatchFile() {
+  if (m_fd >= 0) {
+    ::close(m_fd);
+  }
+}
+
+bool BatchFile::isOpen() const { return m_fd >= 0; }
+
+void BatchFile::willNeed(u64 offset, u64 length) {
+#ifdef POSIX_FADV_WILLNEED
+  ::posix_fadvise(m_fd, static_cast<off_t>(offset), static_cast<off_t>(length),
+                  POSIX_FADV_WILLNEED);
+#else
+  (void)offset;
+  (void)length;
+#endif
+}
+
+bool BatchFile::readSpan(std::span<const BatchRange> ranges,
+                         std::vector<u8> &gapScratch) {
+  // Size the scratch for the largest gap up front: every gap reads into the
+  // same buffer, so it must not move once the iovecs point at it
+  usize largestGap = 0;
+  u64 cursor = ranges.front().offset;
+  for (const auto &range : ranges) {
+    if (range.offset > cursor) {
+      largestGap = std::max(largestGap, static_cast<usize>(range.offset - cursor));
+    }
+    cursor = range.offset + range.size;
+  }
+  if (gapScratch.size() < largestGap) {
+    gapScratch.resize(largestGap);
+  }
+
+  std::vector<iovec> iov;
+  iov.reserve(ranges.size() * 2);
+  cursor = ranges.front().offset;
+  for (const auto &range : ranges) {
+    if (range.offset > cursor) {
+      iov.push_back({gapScratch.data(), static_cast<usize>(range.offset - cursor)});
+    }
+    iov.push_back({range.dest, static_cast<usize>(range.size)});
+    cursor = range.offset + range.size;
+  }
+
+  // preadv() may stop short; resume from the first unfilled buffer
+  u64 position = ranges.front().offset;
+  usize first = 0;
+  while (first < iov.size()) {
+    const auto count =
+        static_cast<int>(std::min(iov.size() - first, MAX_IOVECS));
+    const ssize_t n =
+        ::preadv(m_fd, iov.data() + first, count, static_cast<off_t>(position));
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    position += static_cast<u64>(n);
+    auto remaining = static_cast<usize>(n);
+    while (first < iov.size() && remaining >= iov[first].iov_len) {
+      remaining -= iov[first].iov_len;
+      ++first;
+    }
+    if (remaining > 0) {
+      iov[first].iov_base = static_cast<u8 *>(iov[first].iov_base) + remaining;
+      iov[first].iov_len -= remaining;
+    }
+  }
+  return true;
+}
+
+#else
+
+BatchFile::BatchFile(const std::string &path)
+    : m_stream(path, std::ios::binary) {
+  if (m_stream.is_open()) {
+    m_stream.seekg(0, std::ios::end);
+    const auto end = m_stream.tellg();
+    m_size = end < 0 ? 0 : static_cast<u64>(end);
+  }
+}
+
+BatchFile::~BatchFile() = default;
+
+bool BatchFile::isOpen() const { return m_stream.is_open(); }
+
+void BatchFile::willNeed(u64, u64) {}
+
+bool BatchFile::readSpan(std::span<const BatchRange> ranges,
+                         std::vector<u8> &gapScratch) {
+  m_stream.clear();
+  m_stream.seekg(static_cast<std::streamoff>(ranges.front().offset));
+  u64 cursor = ranges.front().offset;
+  for (const auto &range : ranges) {
+    if (range.offset > cursor) {
+      const auto gap = static_cast<usize>(range.offset - cursor);
+      if (gapScratch.size() < gap) {
+        gapScratch.resize(gap);
+      }
+      m_stream.read(reinterpret_cast<char *>(gapScratch.data()),
+                    static_cast<std::streamsize>(gap));
+    }
+    m_stream.read(reinterpret_cast<char *>(range.dest),
+                  static_cast<std::streamsize>(range.size));
+    cursor = range.offset + range.size;
+  }
+  return static_cast<bool>(m_stream);
+}
+
+#endif
+
+} // namespace
+
+void readStreamedBatch(const std::string &packPath,
+                       std::vector<BatchRange> &ranges,
+                       std::vector<Result<std::vector<u8>>> &results) {
+  BatchFile file(packPath);
+  if (!file.isOpen()) {
+    for (const auto &range : ranges) {
+      results[range.index] =
+          Result<std::vector<u8>>::error("Failed to open pack file");
+    }
+    return;
+  }
+
+  // Drop ranges past the end of the file before building spans
+  std::erase_if(ranges, [&](const BatchRange &range) {
+    if (range.offset > file.size() ||
+        range.size > file.size() - range.offset) {
+      results[range.index] = Result<std::vector<u8>>::error(
+          "Resource data extends beyond pack file");
+      return true;
+    }
+    return range.size == 0; // Nothing to read
+  });
+
+  std::sort(ranges.begin(), ranges.end(),
+            [](const BatchRange &a, const BatchRange &b) {
+              return a.offset < b.offset;
+            });
+
+  // Coalesce neighbours into spans. Overlapping or repeated ranges start a
+  // new span so every span stays disjoint and ascending.
+  std::vector<std::pair<usize, usize>> spans;
+  usize spanBegin = 0;
+  for (usize i = 1; i <= ranges.size(); ++i) {
+    if (i < ranges.size()) {
+      const u64 spanStart = ranges[spanBegin].offset;
+      const u64 spanEnd = ranges[i - 1].offset + ranges[i - 1].size;
+      const auto &next = ranges[i];
+      if (next.offset >= spanEnd &&
+          next.offset - spanEnd <= PackReader::BATCH_MAX_GAP &&
+          next.offset + next.size - spanStart <= PackReader::BATCH_MAX_SPAN &&
+          i - spanBegin < MAX_BATCH_RANGES) {
+        continue;
+      }
+    }
+    spans.emplace_back(spanBegin, i);
+    spanBegin = i;
+  }
+
+  for (const auto &[begin, end] : spans) {
+    const u64 start = ranges[begin].offset;
+    file.willNeed(start, ranges[end - 1].offset + ranges[end - 1].size - start);
+  }
+
+  std::vector<u8> gapScratch;
+  for (const auto &[begin, end] : spans) {
+    std::span<const BatchRange> span(ranges.data() + begin, end - begin);
+    if (!file.readSpan(span, gapScratch)) {
+      for (const auto &range : span) {
+        results[range.index] =
+            Result<std::vector<u8>>::error("Failed to read resource data");
+      }
+    }
+  }
+}
+
+} // namespace NovelMind::vfs::detail
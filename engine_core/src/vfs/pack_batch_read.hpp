@@ -0,0 +1,29 @@
+#pragma once
+
+#include "NovelMind/core/result.hpp"
+#include "NovelMind/core/types.hpp"
+#include <string>
+#include <vector>
+
+namespace NovelMind::vfs::detail {
+
+/// One resource's destination inside a batched read
+struct BatchRange {
+  usize index = 0; ///< Position in the caller's result list
+  u64 offset = 0;  ///< Absolute offset in the pack file
+  u64 size = 0;
+  u8 *dest = nullptr;
+};
+
+/**
+ * @brief Read @p ranges of one streamed pack into their result slots
+ *
+ * Each slot in @p results already holds a buffer of the right size. Ranges
+ * are read in offset order, neighbours coalesced into spans (one preadv()
+ * per span where available); a failed range turns its slot into an error.
+ */
+void readStreamedBatch(const std::string &packPath,
+                       std::vector<BatchRange> &ranges,
+                       std::vector<Result<std::vector<u8>>> &results);
+
+} // namespace NovelMind::vfs::detail
@@ -1,4 +1,5 @@
 #include "NovelMind/vfs/pack_security.hpp"
+#include "NovelMind/core/checksum.hpp"
 
 #include "pack_security_detail.hpp"
 
@@ -364,8 +365,7 @@ PackIntegrityChecker::verifyPackSignatureStream(std::istream &stream,
 }
 
 u32 PackIntegrityChecker::calculateCrc32(const u8 *data, usize size) {
-  u32 crc = detail::updateCrc32(0xFFFFFFFF, data, size);
-  return ~crc;
+  return core::crc32(data, size);
 }
 
 std::array<u8, 32> PackIntegrityChecker::calculateSha256(const u8 *data,
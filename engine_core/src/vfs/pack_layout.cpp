@@ -0,0 +1,166 @@
+/**
+ * @file pack_layout.cpp
+ * @brief First-use pack ordering and locality scoring
+ */
+
+#include "NovelMind/vfs/pack_layout.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <unordered_map>
+
+namespace NovelMind::vfs {
+
+namespace {
+
+std::string toLower(std::string_view text) {
+  std::string lower(text);
+  std::transform(lower.begin(), lower.end(), lower.begin(),
+                 [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+  return lower;
+}
+
+std::string_view fileName(std::string_view path) {
+  const auto slash = path.find_last_of("/\\");
+  return slash == std::string_view::npos ? path : path.substr(slash + 1);
+}
+
+std::string_view stem(std::string_view path) {
+  const std::string_view name = fileName(path);
+  const auto dot = name.rfind('.');
+  return dot == std::string_view::npos || dot == 0 ? name : name.substr(0, dot);
+}
+
+} // namespace
+
+void PackLayoutPlanner::addAccess(std::string_view assetId) {
+  if (assetId.empty()) {
+    return;
+  }
+  std::string id(assetId);
+  if (m_seen.insert(id).second) {
+    m_accesses.push_back(std::move(id));
+  }
+}
+
+Result<usize> PackLayoutPlanner::loadTrace(const std::string &path) {
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    return Result<usize>::error("Cannot open layout trace: " + path);
+  }
+
+  const usize before = m_accesses.size();
+  std::string line;
+  while (std::getline(file, line)) {
+    const auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+    const auto last = line.find_last_not_of(" \t\r");
+    addAccess(std::string_view(line).substr(first, last - first + 1));
+  }
+  return Result<usize>::ok(m_accesses.size() - before);
+}
+
+void PackLayoutPlanner::clear() {
+  m_accesses.clear();
+  m_seen.clear();
+}
+
+std::vector<usize>
+PackLayoutPlanner::resolve(const std::vector<std::string> &resourceIds) const {
+  // The first resource with a given key wins, matching the original order
+  std::unordered_map<std::string, usize> byId;
+  std::unordered_map<std::string, usize> byName;
+  std::unordered_map<std::string, usize> byStem;
+  for (usize i = 0; i < resourceIds.size(); ++i) {
+    const std::string id = toLower(resourceIds[i]);
+    byId.emplace(id, i);
+    byName.emplace(std::string(fileName(id)), i);
+    byStem.emplace(std::string(stem(id)), i);
+  }
+
+  auto lookup = [](const std::unordered_map<std::string, usize> &keys,
+                   std::string_view key, usize &index) {
+    auto it = keys.find(std::string(key));
+    if (it == keys.end()) {
+      return false;
+    }
+    index = it->second;
+    return true;
+  };
+
+  std::vector<usize> resolved;
+  std::vector<bool> taken(resourceIds.size(), false);
+  for (const auto &access : m_accesses) {
+    const std::string id = toLower(access);
+    usize index = 0;
+    if (!lookup(byId, id, index) && !lookup(byName, fileName(id), index) &&
+        !lookup(byStem, stem(id), index)) {
+      continue;
+    }
+    if (!taken[index]) {
+      taken[index] = true;
+      resolved.push_back(index);
+    }
+  }
+  return resolved;
+}
+
+std::vector<usize>
+PackLayoutPlanner::order(const std::vector<std::string> &resourceIds,
+                         const std::vector<bool> &preload) const {
+  auto isPreload = [&preload](usize index) {
+    return index < preload.size() && preload[index];
+  };
+
+  const std::vector<usize> used = resolve(resourceIds);
+  std::vector<bool> placed(resourceIds.size(), false);
+  std::vector<usize> result;
+  result.reserve(resourceIds.size());
+
+  auto place = [&](usize index) {
+    placed[index] = true;
+    result.push_back(index);
+  };
+
+  for (usize index : used) {
+    if (isPreload(index)) {
+      place(index);
+    }
+  }
+  for (usize index = 0; index < resourceIds.size(); ++index) {
+    if (isPreload(index) && !placed[index]) {
+      place(index);
+    }
+  }
+  for (usize index : used) {
+    if (!placed[index]) {
+      place(index);
+    }
+  }
+  for (usize index = 0; index < resourceIds.size(); ++index) {
+    if (!placed[index]) {
+      place(index);
+    }
+  }
+  return result;
+}
+
+LayoutLocality PackLayoutPlanner::measure(std::span<const usize> accesses,
+                                          std::span<const u64> offsets,
+                                          std::span<const u64> sizes,
+                                          u64 maxGap) {
+  LayoutLocality locality;
+  for (usize i = 1; i < accesses.size(); ++i) {
+    const u64 previousEnd = offsets[accesses[i - 1]] + sizes[accesses[i - 1]];
+    const u64 start = offsets[accesses[i]];
+    ++locality.totalReads;
+    if (start >= previousEnd && start - previousEnd <= maxGap) {
+      ++locality.sequentialReads;
+    }
+  }
+  return locality;
+}
+
+} // namespace NovelMind::vfs
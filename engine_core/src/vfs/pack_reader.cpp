@@ -1,5 +1,9 @@
 #include "NovelMind/vfs/pack_reader.hpp"
 #include "NovelMind/core/logger.hpp"
+
+#include "pack_batch_read.hpp"
+
+#include <algorithm>
 #include <cstring>
 
 namespace NovelMind::vfs {
@@ -36,6 +40,18 @@ Result<void> PackReader::mount(const std::string &packPath) {
     return stringResult;
   }
 
+  if (m_useMapping) {
+    auto mapped = platform::MappedFile::open(packPath);
+    if (mapped.isOk()) {
+      pack.mapping = std::make_shared<const platform::MappedFile>(
+          std::move(mapped).value());
+    } else {
+      NOVELMIND_LOG_WARN("Pack " + packPath +
+                         " not memory-mapped, using stream reads: " +
+                         mapped.error());
+    }
+  }
+
   m_packs[packPath] = std::move(pack);
   NOVELMIND_LOG_INFO("Mounted pack: " + packPath);
 
@@ -54,30 +70,83 @@ void PackReader::unmountAll() {
   NOVELMIND_LOG_INFO("Unmounted all packs");
 }
 
+std::optional<PackReader::Location>
+PackReader::locate(const std::string &resourceId) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return locateLocked(resourceId);
+}
+
+std::optional<PackReader::Location>
+PackReader::locateLocked(const std::string &resourceId) const {
+  for (const auto &[path, pack] : m_packs) {
+    auto it = pack.entries.find(resourceId);
+    if (it != pack.entries.end()) {
+      Location location;
+      location.packPath = path;
+      location.packDataOffset = pack.header.dataOffset;
+      location.entry = it->second;
+      location.mapping = pack.mapping;
+      return location;
+    }
+  }
+  return std::nullopt;
+}
+
 Result<std::vector<u8>>
 PackReader::readFile(const std::string &resourceId) const {
-  // Find entry and copy data needed for reading
-  std::string packPath;
-  PackResourceEntry entry;
-  {
-    std::lock_guard<std::mutex> lock(m_mutex);
+  // Copy what is needed under the lock, read outside it
+  auto location = locate(resourceId);
+  if (!location) {
+    return Result<std::vector<u8>>::error("Resource not found: " + resourceId);
+  }
 
-    for (const auto &[path, pack] : m_packs) {
-      auto it = pack.entries.find(resourceId);
-      if (it != pack.entries.end()) {
-        packPath = path;
-        entry = it->second;
-        break;
-      }
+  if (location->mapping) {
+    auto bytes = mappedResourceBytes(*location);
+    if (bytes.isError()) {
+      return Result<std::vector<u8>>::error(bytes.error());
     }
+    return Result<std::vector<u8>>::ok(
+        std::vector<u8>(bytes.value().begin(), bytes.value().end()));
   }
 
-  // Read data outside lock to avoid holding mutex during I/O
-  if (!packPath.empty()) {
-    return readResourceData(packPath, entry);
+  return readResourceData(*location);
+}
+
+Result<ResourceView>
+PackReader::readFileView(const std::string &resourceId) const {
+  auto location = locate(resourceId);
+  if (!location) {
+    return Result<ResourceView>::error("Resource not found: " + resourceId);
   }
 
-  return Result<std::vector<u8>>::error("Resource not found: " + resourceId);
+  constexpr u32 transformedFlags = static_cast<u32>(PackFlags::Encrypted) |
+                                   static_cast<u32>(PackFlags::Compressed);
+  if (location->mapping && (location->entry.flags & transformedFlags) == 0) {
+    auto bytes = mappedResourceBytes(*location);
+    if (bytes.isError()) {
+      return Result<ResourceView>::error(bytes.error());
+    }
+    // The view shares ownership of the mapping, so it outlives unmount()
+    return Result<ResourceView>::ok(
+        ResourceView(bytes.value(), location->mapping));
+  }
+
+  auto data = readFile(resourceId);
+  if (data.isError()) {
+    return Result<ResourceView>::error(data.error());
+  }
+  return Result<ResourceView>::ok(
+      ResourceView::fromVector(std::move(data).value()));
+}
+
+void PackReader::setMemoryMappingEnabled(bool enabled) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_useMapping = enabled;
+}
+
+bool PackReader::isMemoryMappingEnabled() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_useMapping;
 }
 
 bool PackReader::exists(const std::string &resourceId) const {
@@ -245,30 +314,56 @@ Result<void> PackReader::readStringTable(std::ifstream &file,
   return Result<void>::ok();
 }
 
+namespace {
+
+// Security: Validate resource size to prevent excessive allocations
+constexpr u64 MAX_RESOURCE_SIZE = 512ULL * 1024 * 1024; // 512 MB max per resource
+
+} // namespace
+
+Result<std::span<const u8>>
+PackReader::mappedResourceBytes(const Location &location) {
+  const auto &entry = location.entry;
+  if (entry.compressedSize > MAX_RESOURCE_SIZE) {
+    return Result<std::span<const u8>>::error(
+        "Resource size exceeds maximum allowed");
+  }
+
+  // Security: Validate offset doesn't cause overflow
+  const u64 absoluteOffset = location.packDataOffset + entry.dataOffset;
+  if (absoluteOffset < location.packDataOffset) {
+    return Result<std::span<const u8>>::error(
+        "Invalid resource offset (overflow)");
+  }
+
+  const u64 fileSize = location.mapping->size();
+  if (absoluteOffset > fileSize ||
+      entry.compressedSize > fileSize - absoluteOffset) {
+    return Result<std::span<const u8>>::error(
+        "Resource data extends beyond pack file");
+  }
+
+  return Result<std::span<const u8>>::ok(std::span<const u8>(
+      location.mapping->data() + absoluteOffset,
+      static_cast<usize>(entry.compressedSize)));
+}
+
 Result<std::vector<u8>>
-PackReader::readResourceData(const std::string &packPath,
-                             const PackResourceEntry &entry) const {
-  // Security: Validate resource size to prevent excessive allocations
-  constexpr u64 MAX_RESOURCE_SIZE =
-      512ULL * 1024 * 1024; // 512 MB max per resource
+PackReader::readResourceData(const Location &location) const {
+  const auto &entry = location.entry;
   if (entry.compressedSize > MAX_RESOURCE_SIZE) {
     return Result<std::vector<u8>>::error(
         "Resource size exceeds maximum allowed");
   }
 
-  std::ifstream file(packPath, std::ios::binary);
+  std::ifstream file(location.packPath, std::ios::binary);
   if (!file.is_open()) {
     return Result<std::vector<u8>>::error("Failed to open pack file");
   }
 
-  auto it = m_packs.find(packPath);
-  if (it == m_packs.end()) {
-    return Result<std::vector<u8>>::error("Pack not mounted");
-  }
-
   // Security: Validate offset doesn't cause overflow
-  u64 absoluteOffset = it->second.header.dataOffset + entry.dataOffset;
-  if (absoluteOffset < it->second.header.dataOffset) {
+  u64 absoluteOffset = location.packDataOffset + entry.dataOffset;
+  if (absoluteOffset < location.packDataOffset) {
     return Result<std::vector<u8>>::error("Invalid resource offset (overflow)");
   }
 
@@ -304,4 +399,64 @@ PackReader::readResourceData(const std::string &packPath,
   return Result<std::vector<u8>>::ok(std::move(data));
 }
 
+std::vector<Result<std::vector<u8>>>
+PackReader::readFiles(const std::vector<std::string> &resourceIds) const {
+  std::vector<std::optional<Location>> locations;
+  locations.reserve(resourceIds.size());
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto &id : resourceIds) {
+      locations.push_back(locateLocked(id));
+    }
+  }
+
+  std::vector<Result<std::vector<u8>>> results;
+  results.reserve(resourceIds.size());
+  std::unordered_map<std::string, std::vector<detail::BatchRange>> streamed;
+
+  for (usize i = 0; i < resourceIds.size(); ++i) {
+    const auto &location = locations[i];
+    if (!location) {
+      results.push_back(Result<std::vector<u8>>::error(
+          "Resource not found: " + resourceIds[i]));
+      continue;
+    }
+
+    if (location->mapping) {
+      auto bytes = mappedResourceBytes(*location);
+      results.push_back(
+          bytes.isError()
+              ? Result<std::vector<u8>>::error(bytes.error())
+              : Result<std::vector<u8>>::ok(std::vector<u8>(
+                    bytes.value().begin(), bytes.value().end())));
+      continue;
+    }
+
+    const auto &entry = location->entry;
+    const u64 absoluteOffset = location->packDataOffset + entry.dataOffset;
+    if (entry.compressedSize > MAX_RESOURCE_SIZE) {
+      results.push_back(Result<std::vector<u8>>::error(
+          "Resource size exceeds maximum allowed"));
+      continue;
+    }
+    if (absoluteOffset < location->packDataOffset) {
+      results.push_back(Result<std::vector<u8>>::error(
+          "Invalid resource offset (overflow)"));
+      continue;
+    }
+
+    // The buffer is allocated in its result slot and filled in place
+    results.push_back(Result<std::vector<u8>>::ok(
+        std::vector<u8>(static_cast<usize>(entry.compressedSize))));
+    streamed[location->packPath].push_back(
+        {i, absoluteOffset, entry.compressedSize, results.back().value().data()});
+  }
+
+  for (auto &[packPath, ranges] : streamed) {
+    detail::readStreamedBatch(packPath, ranges, results);
+  }
+
+  return results;
+}
+
 } // namespace NovelMind::vfs
@@ -1,5 +1,7 @@
 #include "NovelMind/vfs/pack_security.hpp"
+#include "NovelMind/core/checksum.hpp"
 
+#include "pack_batch_read.hpp"
 #include "pack_security_detail.hpp"
 
 #include <algorithm>
@@ -158,8 +160,9 @@ Result<void> SecurePackReader::openPack(const std::string &path) {
   }
 
   const u64 stringDataSize = m_header.dataOffset - stringDataStartU64;
-  m_stringTable.clear();
-  m_stringTable.reserve(stringCount);
+  // Only needed to resolve entry IDs; the entry map keeps its own keys
+  std::vector<std::string> stringTable;
+  stringTable.reserve(stringCount);
 
   constexpr usize MAX_STRING_LENGTH = 1024 * 1024;
   for (u32 i = 0; i < stringCount; ++i) {
@@ -189,18 +192,18 @@ Result<void> SecurePackReader::openPack(const std::string &path) {
       return Result<void>::error("String table entry out of bounds");
     }
 
-    m_stringTable.push_back(std::move(str));
+    stringTable.push_back(std::move(str));
   }
 
   constexpr u64 MAX_RESOURCE_SIZE = 512ULL * 1024 * 1024;
   m_entries.clear();
   for (const auto &entry : entries) {
-    if (entry.idStringOffset >= m_stringTable.size()) {
+    if (entry.idStringOffset >= stringTable.size()) {
       m_lastResult = PackVerificationResult::CorruptedResourceTable;
       return Result<void>::error("Resource ID offset out of bounds");
     }
 
-    const std::string &resourceId = m_stringTable[entry.idStringOffset];
+    const std::string &resourceId = stringTable[entry.idStringOffset];
     if (resourceId.empty()) {
       m_lastResult = PackVerificationResult::CorruptedResourceTable;
       return Result<void>::error("Empty resource ID in string table");
@@ -243,7 +246,7 @@ Result<void> SecurePackReader::openPack(const std::string &path) {
   }
 
   file.seekg(0, std::ios::beg);
-  u32 crc = 0xFFFFFFFF;
+  u32 crc = 0;
   u64 remaining = m_header.dataOffset;
   std::vector<u8> buffer(64 * 1024);
   while (remaining > 0) {
@@ -256,11 +259,9 @@ Result<void> SecurePackReader::openPack(const std::string &path) {
       m_lastResult = PackVerificationResult::CorruptedHeader;
       return Result<void>::error("Failed to read pack for CRC verification");
     }
-    crc =
-        detail::updateCrc32(crc, buffer.data(), static_cast<usize>(readCount));
+    crc = core::crc32(buffer.data(), static_cast<usize>(readCount), crc);
     remaining -= static_cast<u64>(readCount);
   }
-  crc = ~crc;
 
   if (crc != m_footer.tablesCrc32) {
     m_lastResult = PackVerificationResult::ChecksumMismatch;
@@ -379,7 +380,6 @@ void SecurePackReader::closePack() {
   m_isOpen = false;
   m_packPath.clear();
   m_entries.clear();
-  m_stringTable.clear();
   m_fileSize = 0;
   m_lastResult = PackVerificationResult::Valid;
 }
@@ -416,6 +416,54 @@ SecurePackReader::readResource(const std::string &resourceId) {
     }
   }
 
+  return decodeResource(resourceId, entry, std::move(data));
+}
+
+std::vector<Result<std::vector<u8>>>
+SecurePackReader::readResources(const std::vector<std::string> &resourceIds) {
+  std::vector<Result<std::vector<u8>>> results;
+  results.reserve(resourceIds.size());
+  if (!m_isOpen) {
+    for (usize i = 0; i < resourceIds.size(); ++i) {
+      results.push_back(Result<std::vector<u8>>::error("Pack not open"));
+    }
+    return results;
+  }
+
+  // Raw bytes land in their result slots through one batched pass over the
+  // pack; each resource is then decrypted and verified on its own
+  std::vector<const PackResourceEntry *> entries(resourceIds.size(), nullptr);
+  std::vector<vfs::detail::BatchRange> ranges;
+  ranges.reserve(resourceIds.size());
+  for (usize i = 0; i < resourceIds.size(); ++i) {
+    const auto it = m_entries.find(resourceIds[i]);
+    if (it == m_entries.end()) {
+      results.push_back(Result<std::vector<u8>>::error("Resource not found: " +
+                                                       resourceIds[i]));
+      continue;
+    }
+    entries[i] = &it->second;
+    results.push_back(Result<std::vector<u8>>::ok(
+        std::vector<u8>(static_cast<usize>(it->second.compressedSize))));
+    ranges.push_back({i, m_header.dataOffset + it->second.dataOffset,
+                      it->second.compressedSize, results.back().value().data()});
+  }
+
+  vfs::detail::readStreamedBatch(m_packPath, ranges, results);
+
+  for (usize i = 0; i < resourceIds.size(); ++i) {
+    if (entries[i] && results[i].isOk()) {
+      results[i] = decodeResource(resourceIds[i], *entries[i],
+                                  std::move(results[i]).value());
+    }
+  }
+  return results;
+}
+
+Result<std::vector<u8>>
+SecurePackReader::decodeResource(const std::string &resourceId,
+                                 const PackResourceEntry &entry,
+                                 std::vector<u8> data) {
   const bool encrypted = (m_header.flags & detail::kPackFlagEncrypted) != 0;
   const bool compressed = (m_header.flags & detail::kPackFlagCompressed) != 0;
 
@@ -20,8 +20,6 @@ inline constexpr u32 kPackFlagSigned = 1u << 2;
 bool readFileToString(std::ifstream &file, std::string &out);
 bool readFileToBytes(std::ifstream &file, std::vector<u8> &out);
 
-u32 updateCrc32(u32 crc, const u8 *data, usize size);
-
 #ifndef NOVELMIND_HAS_OPENSSL
 struct Sha256Context {
   u8 data[64];
@@ -1,151 +1,234 @@
 #include "NovelMind/vfs/resource_cache.hpp"
+#include <algorithm>
 
 namespace NovelMind::VFS {
 
-ResourceCache::ResourceCache(usize maxSize) : m_maxSize(maxSize) {}
+ResourceCache::ResourceCache(usize maxSize, EvictionPolicy policy,
+                             usize shardCount)
+    : m_policy(policy), m_maxSize(maxSize) {
+  shardCount = std::max<usize>(shardCount, 1);
+  m_shards.reserve(shardCount);
+  for (usize i = 0; i < shardCount; ++i) {
+    auto shard = std::make_unique<Shard>();
+    shard->policy = createEvictionPolicy(policy);
+    m_shards.push_back(std::move(shard));
+  }
+}
 
 void ResourceCache::setMaxSize(usize maxSize) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_maxSize = maxSize;
-  evictIfNeeded(0);
+  m_maxSize.store(maxSize, std::memory_order_relaxed);
+  enforceBudgets(ResourceType::Unknown, nullptr);
+}
+
+void ResourceCache::setTypeBudget(ResourceType type, usize maxBytes) {
+  m_typeBudgets[typeIndex(type)].store(maxBytes, std::memory_order_relaxed);
+  enforceBudgets(type, nullptr);
 }
 
-std::optional<std::vector<u8>> ResourceCache::get(const ResourceId &id) {
-  std::lock_guard<std::mutex> lock(m_mutex);
+usize ResourceCache::typeBudget(ResourceType type) const {
+  return m_typeBudgets[typeIndex(type)].load(std::memory_order_relaxed);
+}
 
-  const auto it = m_cache.find(id);
-  if (it == m_cache.end()) {
-    ++m_stats.missCount;
-    return std::nullopt;
-  }
+usize ResourceCache::typeSize(ResourceType type) const {
+  return m_typeSizes[typeIndex(type)].load(std::memory_order_relaxed);
+}
+
+SharedBuffer ResourceCache::get(const ResourceId &id) {
+  Shard &shard = *m_shards[shardIndex(id)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
 
-  ++m_stats.hitCount;
-  it->second.lastAccess = std::chrono::steady_clock::now();
-  ++it->second.accessCount;
-  updateAccessOrder(id);
+  const auto it = shard.entries.find(id);
+  if (it == shard.entries.end()) {
+    m_missCount.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
 
-  return it->second.data;
+  m_hitCount.fetch_add(1, std::memory_order_relaxed);
+  CacheEntry &entry = it->second;
+  entry.lastAccess = std::chrono::steady_clock::now();
+  entry.accessTick = m_clock.fetch_add(1, std::memory_order_relaxed) + 1;
+  ++entry.accessCount;
+  shard.policy->onAccess(entry);
+  return entry.data;
 }
 
 void ResourceCache::put(const ResourceId &id, std::vector<u8> data) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
-  const usize dataSize = data.size();
+  put(id, std::make_shared<const std::vector<u8>>(std::move(data)));
+}
 
-  if (dataSize > m_maxSize) {
+void ResourceCache::put(const ResourceId &id, SharedBuffer data) {
+  if (!data) {
     return;
   }
 
-  const auto existingIt = m_cache.find(id);
-  if (existingIt != m_cache.end()) {
-    m_currentSize -= existingIt->second.data.size();
-    m_cache.erase(existingIt);
-    // Decrement entry count when removing existing entry
-    if (m_stats.entryCount > 0) {
-      --m_stats.entryCount;
-    }
-
-    const auto orderIt = m_orderIterators.find(id);
-    if (orderIt != m_orderIterators.end()) {
-      m_accessOrder.erase(orderIt->second);
-      m_orderIterators.erase(orderIt);
-    }
+  const usize dataSize = data->size();
+  const ResourceType type = id.type();
+  const usize budget = typeBudget(type);
+  if (dataSize > maxSize() || (budget > 0 && dataSize > budget)) {
+    return;
   }
 
-  evictIfNeeded(dataSize);
-
-  CacheEntry entry;
-  entry.data = std::move(data);
-  entry.lastAccess = std::chrono::steady_clock::now();
-  entry.accessCount = 1;
+  {
+    Shard &shard = *m_shards[shardIndex(id)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-  m_cache[id] = std::move(entry);
-  m_currentSize += dataSize;
+    const auto existing = shard.entries.find(id);
+    if (existing != shard.entries.end()) {
+      eraseLocked(shard, existing);
+    }
 
-  m_accessOrder.push_front(id);
-  m_orderIterators[id] = m_accessOrder.begin();
+    auto [it, inserted] = shard.entries.try_emplace(id);
+    (void)inserted;
+    CacheEntry &entry = it->second;
+    entry.id = id;
+    entry.data = std::move(data);
+    entry.size = dataSize;
+    entry.lastAccess = std::chrono::steady_clock::now();
+    entry.accessCount = 1;
+    entry.insertTick = m_clock.fetch_add(1, std::memory_order_relaxed) + 1;
+    entry.accessTick = entry.insertTick;
+    shard.policy->onInsert(entry);
+
+    m_currentSize.fetch_add(dataSize, std::memory_order_relaxed);
+    m_typeSizes[typeIndex(type)].fetch_add(dataSize,
+                                           std::memory_order_relaxed);
+    m_entryCount.fetch_add(1, std::memory_order_relaxed);
+  }
 
-  ++m_stats.entryCount;
+  enforceBudgets(type, &id);
 }
 
 void ResourceCache::remove(const ResourceId &id) {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
-  const auto it = m_cache.find(id);
-  if (it != m_cache.end()) {
-    m_currentSize -= it->second.data.size();
-    m_cache.erase(it);
-
-    const auto orderIt = m_orderIterators.find(id);
-    if (orderIt != m_orderIterators.end()) {
-      m_accessOrder.erase(orderIt->second);
-      m_orderIterators.erase(orderIt);
-    }
+  Shard &shard = *m_shards[shardIndex(id)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
 
-    --m_stats.entryCount;
+  const auto it = shard.entries.find(id);
+  if (it != shard.entries.end()) {
+    eraseLocked(shard, it);
   }
 }
 
 void ResourceCache::clear() {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_cache.clear();
-  m_accessOrder.clear();
-  m_orderIterators.clear();
-  m_currentSize = 0;
-  m_stats.entryCount = 0;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    while (!shard->entries.empty()) {
+      eraseLocked(*shard, shard->entries.begin());
+    }
+    shard->policy->clear();
+  }
 }
 
 bool ResourceCache::contains(const ResourceId &id) const {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  return m_cache.find(id) != m_cache.end();
+  Shard &shard = *m_shards[shardIndex(id)];
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return shard.entries.find(id) != shard.entries.end();
 }
 
 CacheStats ResourceCache::stats() const {
-  std::lock_guard<std::mutex> lock(m_mutex);
-
-  CacheStats result = m_stats;
-  result.totalSize = m_currentSize;
-  result.entryCount = m_cache.size();
+  CacheStats result;
+  result.totalSize = currentSize();
+  result.entryCount = entryCount();
+  result.hitCount = m_hitCount.load(std::memory_order_relaxed);
+  result.missCount = m_missCount.load(std::memory_order_relaxed);
+  result.evictionCount = m_evictionCount.load(std::memory_order_relaxed);
   return result;
 }
 
 void ResourceCache::resetStats() {
-  std::lock_guard<std::mutex> lock(m_mutex);
-  m_stats.hitCount = 0;
-  m_stats.missCount = 0;
-  m_stats.evictionCount = 0;
-}
-
-void ResourceCache::evictIfNeeded(usize requiredSpace) {
-  while (m_currentSize + requiredSpace > m_maxSize && !m_accessOrder.empty()) {
-    const ResourceId &lruId = m_accessOrder.back();
-    const auto it = m_cache.find(lruId);
-
-    if (it != m_cache.end()) {
-      m_currentSize -= it->second.data.size();
-      m_cache.erase(it);
-      ++m_stats.evictionCount;
-      // Decrement entry count when evicting
-      if (m_stats.entryCount > 0) {
-        --m_stats.entryCount;
+  m_hitCount.store(0, std::memory_order_relaxed);
+  m_missCount.store(0, std::memory_order_relaxed);
+  m_evictionCount.store(0, std::memory_order_relaxed);
+}
+
+usize ResourceCache::shardIndex(const ResourceId &id) const {
+  // ResourceId already carries a well-mixed FNV-1a hash
+  return static_cast<usize>(id.hash() % m_shards.size());
+}
+
+usize ResourceCache::typeIndex(ResourceType type) {
+  const auto index = static_cast<usize>(type);
+  return index < TYPE_COUNT ? index : 0;
+}
+
+void ResourceCache::eraseLocked(
+    Shard &shard, std::unordered_map<ResourceId, CacheEntry>::iterator it) {
+  CacheEntry &entry = it->second;
+  shard.policy->onRemove(entry);
+  m_currentSize.fetch_sub(entry.size, std::memory_order_relaxed);
+  m_typeSizes[typeIndex(entry.id.type())].fetch_sub(entry.size,
+                                                    std::memory_order_relaxed);
+  m_entryCount.fetch_sub(1, std::memory_order_relaxed);
+  shard.entries.erase(it);
+}
+
+void ResourceCache::enforceBudgets(ResourceType type,
+                                   const ResourceId *keep) {
+  const usize budget = typeBudget(type);
+  if (budget > 0) {
+    while (typeSize(type) > budget) {
+      const bool evicted =
+          evictOne([type, keep](const CacheEntry &entry) {
+            return entry.id.type() == type && (!keep || entry.id != *keep);
+          });
+      if (!evicted) {
+        break;
       }
     }
+  }
 
-    m_orderIterators.erase(lruId);
-    m_accessOrder.pop_back();
+  while (currentSize() > maxSize()) {
+    const bool evicted =
+        evictOne([keep](const CacheEntry &entry) {
+          return !keep || entry.id != *keep;
+        });
+    if (!evicted) {
+      break;
+    }
   }
 }
 
-void ResourceCache::updateAccessOrder(const ResourceId &id) {
-  const auto orderIt = m_orderIterators.find(id);
-  if (orderIt != m_orderIterators.end()) {
-    // Erase from list using the stored iterator (invalidates orderIt->second)
-    m_accessOrder.erase(orderIt->second);
-    // Add to front of list
-    m_accessOrder.push_front(id);
-    // Update map with new iterator (orderIt is still valid map iterator)
-    orderIt->second = m_accessOrder.begin();
+bool ResourceCache::evictOne(const IEvictionPolicy::Filter &accept) {
+  // Only one shard lock is held at a time, so concurrent writers cannot
+  // deadlock. A shard that changes between the scan and the eviction
+  // gives up its current victim instead of the one that was ranked.
+  Shard *best = nullptr;
+  f64 bestRank = 0.0;
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    const CacheEntry *candidate = shard->policy->peekVictim(accept);
+    if (!candidate) {
+      continue;
+    }
+    const f64 rank = shard->policy->evictionRank(*candidate);
+    if (!best || rank < bestRank) {
+      best = shard.get();
+      bestRank = rank;
+    }
+  }
+  if (!best) {
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(best->mutex);
+    CacheEntry *victim = best->policy->selectVictim(accept);
+    if (!victim) {
+      return true; // Emptied concurrently; the caller re-checks its budget
+    }
+    const auto it = best->entries.find(victim->id);
+    if (it == best->entries.end()) {
+      return true;
+    }
+    bestRank = best->policy->evictionRank(*victim);
+    eraseLocked(*best, it);
+    m_evictionCount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->policy->onEvicted(bestRank);
   }
+  return true;
 }
 
 } // namespace NovelMind::VFS
@@ -0,0 +1,123 @@
+/**
+ * @file resource_index.cpp
+ * @brief Interned resource path table with open addressing
+ */
+
+#include "NovelMind/vfs/resource_index.hpp"
+
+namespace NovelMind::vfs {
+
+u64 ResourceIndex::hashPath(std::string_view path) {
+  // FNV-1a
+  u64 hash = 14695981039346656037ull;
+  for (char c : path) {
+    hash ^= static_cast<u8>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+usize ResourceIndex::probe(u64 hash, std::string_view path) const {
+  const usize mask = m_slots.size() - 1;
+  usize slot = static_cast<usize>(hash) & mask;
+  while (true) {
+    const PathId id = m_slots[slot];
+    if (id == NO_PATH ||
+        (m_hashes[id] == hash && this->path(id) == path)) {
+      return slot;
+    }
+    slot = (slot + 1) & mask;
+  }
+}
+
+ResourceIndex::PathId ResourceIndex::find(std::string_view path) const {
+  if (m_slots.empty()) {
+    return NO_PATH;
+  }
+  return m_slots[probe(hashPath(path), path)];
+}
+
+ResourceIndex::PathId ResourceIndex::intern(std::string_view path) {
+  // Keep the load factor at or below 1/2
+  if ((m_hashes.size() + 1) * 2 > m_slots.size()) {
+    grow();
+  }
+
+  const u64 hash = hashPath(path);
+  const usize slot = probe(hash, path);
+  if (m_slots[slot] != NO_PATH) {
+    return m_slots[slot];
+  }
+
+  const auto id = static_cast<PathId>(m_hashes.size());
+  m_chars.insert(m_chars.end(), path.begin(), path.end());
+  m_offsets.push_back(static_cast<u32>(m_chars.size()));
+  m_hashes.push_back(hash);
+  m_providers.push_back(NO_PACK);
+  m_slots[slot] = id;
+  return id;
+}
+
+std::string_view ResourceIndex::path(PathId id) const {
+  return std::string_view(m_chars.data() + m_offsets[id],
+                          m_offsets[id + 1] - m_offsets[id]);
+}
+
+u32 ResourceIndex::provider(std::string_view path) const {
+  const PathId id = find(path);
+  return id == NO_PATH ? NO_PACK : m_providers[id];
+}
+
+void ResourceIndex::setProvider(PathId id, u32 packSlot) {
+  u32 &current = m_providers[id];
+  if (current == NO_PACK && packSlot != NO_PACK) {
+    ++m_resolvedCount;
+  } else if (current != NO_PACK && packSlot == NO_PACK) {
+    --m_resolvedCount;
+  }
+  current = packSlot;
+}
+
+void ResourceIndex::clearProviders() {
+  m_providers.assign(m_providers.size(), NO_PACK);
+  m_resolvedCount = 0;
+}
+
+void ResourceIndex::reserve(usize pathCount) {
+  m_hashes.reserve(pathCount);
+  m_providers.reserve(pathCount);
+  m_offsets.reserve(pathCount + 1);
+  usize slots = m_slots.empty() ? 64 : m_slots.size();
+  while (slots < pathCount * 2) {
+    slots *= 2;
+  }
+  if (slots > m_slots.size()) {
+    rehash(slots);
+  }
+}
+
+void ResourceIndex::grow() { rehash(m_slots.empty() ? 64 : m_slots.size() * 2); }
+
+void ResourceIndex::rehash(usize slotCount) {
+  // Hashes are stored per path, so no path is rehashed
+  m_slots.assign(slotCount, NO_PATH);
+  const usize mask = slotCount - 1;
+  for (PathId id = 0; id < m_hashes.size(); ++id) {
+    usize slot = static_cast<usize>(m_hashes[id]) & mask;
+    while (m_slots[slot] != NO_PATH) {
+      slot = (slot + 1) & mask;
+    }
+    m_slots[slot] = id;
+  }
+}
+
+void ResourceIndex::clear() {
+  m_chars.clear();
+  m_offsets.assign(1, 0);
+  m_hashes.clear();
+  m_providers.clear();
+  m_slots.clear();
+  m_resolvedCount = 0;
+}
+
+} // namespace NovelMind::vfs
@@ -90,6 +90,14 @@ SecurePackFileSystem::readFile(const std::string &resourceId) const {
   return m_reader->readResource(resourceId);
 }
 
+std::vector<Result<std::vector<u8>>>
+SecurePackFileSystem::readFiles(const std::vector<std::string> &resourceIds) const {
+  if (!m_reader || !m_reader->isOpen()) {
+    return IVirtualFileSystem::readFiles(resourceIds);
+  }
+  return m_reader->readResources(resourceIds);
+}
+
 bool SecurePackFileSystem::exists(const std::string &resourceId) const {
   return m_reader && m_reader->isOpen() && m_reader->exists(resourceId);
 }
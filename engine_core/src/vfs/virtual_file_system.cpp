@@ -10,12 +10,16 @@ std::mutex g_globalVFSMutex;
 
 VirtualFileSystem::VirtualFileSystem()
     : m_config(),
-      m_cache(std::make_unique<ResourceCache>(m_config.cacheMaxSize)) {}
+      m_cache(std::make_unique<ResourceCache>(m_config.cacheMaxSize,
+                                              m_config.cachePolicy,
+                                              m_config.cacheShardCount)) {}
 
 VirtualFileSystem::VirtualFileSystem(const VFSConfig &config)
     : m_config(config),
       m_cache(config.enableCaching
-                  ? std::make_unique<ResourceCache>(config.cacheMaxSize)
+                  ? std::make_unique<ResourceCache>(config.cacheMaxSize,
+                                                    config.cachePolicy,
+                                                    config.cacheShardCount)
                   : nullptr) {}
 
 VirtualFileSystem::~VirtualFileSystem() { shutdown(); }
@@ -105,28 +109,37 @@ VirtualFileSystem::openStream(const ResourceId &id) {
 }
 
 Result<std::vector<u8>> VirtualFileSystem::readAll(const ResourceId &id) {
+  auto shared = readShared(id);
+  if (!shared.isOk()) {
+    return Result<std::vector<u8>>::error(shared.error());
+  }
+  return Result<std::vector<u8>>::ok(*shared.value());
+}
+
+Result<SharedBuffer> VirtualFileSystem::readShared(const ResourceId &id) {
   if (m_config.enableCaching && m_cache) {
-    auto cached = m_cache->get(id);
-    if (cached.has_value()) {
-      return Result<std::vector<u8>>::ok(std::move(*cached));
+    if (auto cached = m_cache->get(id)) {
+      return Result<SharedBuffer>::ok(std::move(cached));
     }
   }
 
   auto handle = openStream(id);
   if (!handle || !handle->isValid()) {
-    return Result<std::vector<u8>>::error("Resource not found: " + id.id());
+    return Result<SharedBuffer>::error("Resource not found: " + id.id());
   }
 
   auto result = handle->readAll();
   if (!result.isOk()) {
-    return result;
+    return Result<SharedBuffer>::error(result.error());
   }
 
+  auto buffer =
+      std::make_shared<const std::vector<u8>>(std::move(result).value());
   if (m_config.enableCaching && m_cache) {
-    m_cache->put(id, result.value());
+    m_cache->put(id, buffer);
   }
 
-  return result;
+  return Result<SharedBuffer>::ok(std::move(buffer));
 }
 
 Result<std::vector<u8>> VirtualFileSystem::readAll(const std::string &id) {
@@ -191,6 +204,12 @@ void VirtualFileSystem::setCacheMaxSize(usize maxSize) {
   }
 }
 
+void VirtualFileSystem::setCacheTypeBudget(ResourceType type, usize maxBytes) {
+  if (m_cache) {
+    m_cache->setTypeBudget(type, maxBytes);
+  }
+}
+
 VFSStats VirtualFileSystem::stats() const {
   std::lock_guard<std::mutex> lock(m_mutex);
 
@@ -22,12 +22,14 @@
 #include "NovelMind/scripting/parser.hpp"
 #include "NovelMind/scripting/validator.hpp"
 #include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/bytecode_file.hpp"
 #include "NovelMind/scripting/script_runtime.hpp"
 #include "NovelMind/scripting/vm.hpp"
 #include "NovelMind/core/types.hpp"
 #include "NovelMind/core/logger.hpp"
 
 #include <iostream>
+#include <memory>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -165,35 +167,30 @@ public:
 
     void run(const NovelMind::scripting::CompiledScript& script,
              const std::string& startScene = "") {
-
-        m_script = script;
-        m_running = true;
-        m_currentScene = startScene.empty() ?
-            (script.sceneEntryPoints.empty() ? "" :
-             script.sceneEntryPoints.begin()->first) : startScene;
-
-        if (m_currentScene.empty()) {
-            printError("No scenes found in script");
+        auto loadResult = m_runtime.load(script);
+        if (!loadResult.isOk()) {
+            printError(loadResult.error());
             return;
         }
 
-        // Find start scene
-        auto it = m_script.sceneEntryPoints.find(m_currentScene);
-        if (it == m_script.sceneEntryPoints.end()) {
-            printError("Scene not found: " + m_currentScene);
-            return;
-        }
-
-        printHeader();
+        m_script = script;
+        m_instructionCount = script.instructions.size();
+        start(startScene);
+    }
 
-        // Main execution loop
-        while (m_running) {
-            // For now, we'll simulate the script execution
-            // In a full implementation, this would use the VM
-            simulateExecution();
+    void run(std::shared_ptr<const NovelMind::scripting::BytecodeImage> image,
+             const std::string& startScene = "") {
+        auto loadResult = m_runtime.load(image);
+        if (!loadResult.isOk()) {
+            printError(loadResult.error());
+            return;
         }
 
-        printFooter();
+        // The runtime executes the mapped instructions in place; only the
+        // scene and character tables are copied out for display
+        m_script = image->metadata();
+        m_instructionCount = image->instructions().size();
+        start(startScene);
     }
 
     void runDemo() {
@@ -535,7 +532,7 @@ private:
 
         printLine("");
         printLine("Compiled script statistics:");
-        std::cout << "  • " << m_script.instructions.size() << " instructions\n";
+        std::cout << "  • " << m_instructionCount << " instructions\n";
         std::cout << "  • " << m_script.stringTable.size() << " string literals\n";
         std::cout << "  • " << m_script.sceneEntryPoints.size() << " scenes\n";
         std::cout << "  • " << m_script.characters.size() << " characters\n";
@@ -543,7 +540,38 @@ private:
         m_running = false;
     }
 
+    void start(const std::string& startScene) {
+        m_running = true;
+        m_currentScene = startScene.empty() ?
+            (m_script.sceneEntryPoints.empty() ? "" :
+             m_script.sceneEntryPoints.begin()->first) : startScene;
+
+        if (m_currentScene.empty()) {
+            printError("No scenes found in script");
+            return;
+        }
+
+        auto gotoResult = m_runtime.gotoScene(m_currentScene);
+        if (!gotoResult.isOk()) {
+            printError(gotoResult.error());
+            return;
+        }
+
+        printHeader();
+
+        // Main execution loop
+        while (m_running) {
+            // For now, we'll simulate the script execution
+            // In a full implementation, this would use the VM
+            simulateExecution();
+        }
+
+        printFooter();
+    }
+
+    NovelMind::scripting::ScriptRuntime m_runtime;
     NovelMind::scripting::CompiledScript m_script;
+    size_t m_instructionCount = 0;
     bool m_useColor;
     bool m_typewriter;
     float m_typewriterSpeed;
@@ -611,94 +639,14 @@ NovelMind::scripting::CompiledScript compileScript(const std::string& source, bo
     return std::move(compileResult).value();
 }
 
-NovelMind::scripting::CompiledScript loadCompiledScript(const std::string& path) {
-    std::ifstream file(path, std::ios::binary);
-    if (!file.is_open()) {
-        throw std::runtime_error("Cannot open file: " + path);
-    }
-
-    NovelMind::scripting::CompiledScript script;
-
-    // Read and verify magic number
-    char magic[5] = {0};
-    file.read(magic, 4);
-    if (std::string(magic) != "NMC1") {
-        throw std::runtime_error("Invalid compiled script format");
-    }
-
-    // Read version
-    NovelMind::u32 version;
-    file.read(reinterpret_cast<char*>(&version), sizeof(version));
-
-    // Read instructions
-    NovelMind::u32 instrCount;
-    file.read(reinterpret_cast<char*>(&instrCount), sizeof(instrCount));
-
-    script.instructions.resize(instrCount);
-    for (NovelMind::u32 i = 0; i < instrCount; ++i) {
-        file.read(reinterpret_cast<char*>(&script.instructions[i].opcode),
-                  sizeof(script.instructions[i].opcode));
-        file.read(reinterpret_cast<char*>(&script.instructions[i].operand),
-                  sizeof(script.instructions[i].operand));
-    }
-
-    // Read string table
-    NovelMind::u32 strCount;
-    file.read(reinterpret_cast<char*>(&strCount), sizeof(strCount));
-
-    script.stringTable.resize(strCount);
-    for (NovelMind::u32 i = 0; i < strCount; ++i) {
-        NovelMind::u32 len;
-        file.read(reinterpret_cast<char*>(&len), sizeof(len));
-        script.stringTable[i].resize(len);
-        file.read(&script.stringTable[i][0], len);
-    }
-
-    // Read scene entry points
-    NovelMind::u32 sceneCount;
-    file.read(reinterpret_cast<char*>(&sceneCount), sizeof(sceneCount));
-
-    for (NovelMind::u32 i = 0; i < sceneCount; ++i) {
-        NovelMind::u32 nameLen;
-        file.read(reinterpret_cast<char*>(&nameLen), sizeof(nameLen));
-        std::string name(nameLen, '\0');
-        file.read(&name[0], nameLen);
-
-        NovelMind::u32 index;
-        file.read(reinterpret_cast<char*>(&index), sizeof(index));
-
-        script.sceneEntryPoints[name] = index;
+std::shared_ptr<const NovelMind::scripting::BytecodeImage>
+loadCompiledScript(const std::string& path) {
+    auto image = NovelMind::scripting::BytecodeImage::open(path);
+    if (image.isError()) {
+        throw std::runtime_error("Invalid compiled script: " + image.error());
     }
-
-    // Read characters
-    NovelMind::u32 charCount;
-    file.read(reinterpret_cast<char*>(&charCount), sizeof(charCount));
-
-    for (NovelMind::u32 i = 0; i < charCount; ++i) {
-        NovelMind::scripting::CharacterDecl ch;
-
-        // ID
-        NovelMind::u32 idLen;
-        file.read(reinterpret_cast<char*>(&idLen), sizeof(idLen));
-        ch.id.resize(idLen);
-        file.read(&ch.id[0], idLen);
-
-        // Display name
-        NovelMind::u32 nameLen;
-        file.read(reinterpret_cast<char*>(&nameLen), sizeof(nameLen));
-        ch.displayName.resize(nameLen);
-        file.read(&ch.displayName[0], nameLen);
-
-        // Color
-        NovelMind::u32 colorLen;
-        file.read(reinterpret_cast<char*>(&colorLen), sizeof(colorLen));
-        ch.color.resize(colorLen);
-        file.read(&ch.color[0], colorLen);
-
-        script.characters[ch.id] = ch;
-    }
-
-    return script;
+    return std::make_shared<const NovelMind::scripting::BytecodeImage>(
+        std::move(image).value());
 }
 
 int main(int argc, char* argv[]) {
@@ -742,34 +690,40 @@ int main(int argc, char* argv[]) {
         fs::path filePath(opts.scriptFile);
         std::string ext = filePath.extension().string();
 
-        NovelMind::scripting::CompiledScript script;
-
         if (ext == ".nmc") {
             // Load compiled script
             if (opts.verbose) {
                 std::cout << "Loading compiled script: " << opts.scriptFile << "\n";
             }
-            script = loadCompiledScript(opts.scriptFile);
+            auto image = loadCompiledScript(opts.scriptFile);
+
+            if (opts.verbose) {
+                std::cout << "Loaded " << image->sceneCount() << " scenes, "
+                          << image->characterCount() << " characters\n";
+            }
+
+            // Run the visual novel straight from the mapped image
+            runtime.run(std::move(image), opts.startScene);
         } else if (ext == ".nms") {
             // Compile from source
             if (opts.verbose) {
                 std::cout << "Compiling script: " << opts.scriptFile << "\n";
             }
             std::string source = readFile(opts.scriptFile);
-            script = compileScript(source, opts.verbose);
+            auto script = compileScript(source, opts.verbose);
+
+            if (opts.verbose) {
+                std::cout << "Loaded " << script.sceneEntryPoints.size() << " scenes, "
+                          << script.characters.size() << " characters\n";
+            }
+
+            // Run the visual novel
+            runtime.run(script, opts.startScene);
         } else {
             throw std::runtime_error("Unknown file type: " + ext +
                                    " (expected .nms or .nmc)");
         }
 
-        if (opts.verbose) {
-            std::cout << "Loaded " << script.sceneEntryPoints.size() << " scenes, "
-                      << script.characters.size() << " characters\n";
-        }
-
-        // Run the visual novel
-        runtime.run(script, opts.startScene);
-
         return 0;
 
     } catch (const std::exception& e) {
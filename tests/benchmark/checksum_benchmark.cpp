@@ -0,0 +1,60 @@
+/**
+ * @file checksum_benchmark.cpp
+ * @brief Measures CRC-32 throughput of every kernel this CPU supports
+ *
+ * Usage: checksum_benchmark [megabytes]   (default: 1024)
+ *
+ * Fills a buffer of the requested size with pseudo-random bytes, then runs
+ * each supported kernel over it and reports GB/s next to the bytewise
+ * reference. Not part of the ctest run; build the target and run it
+ * manually.
+ */
+
+#include "NovelMind/core/checksum.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::core;
+
+int main(int argc, char **argv) {
+  size_t megabytes = 1024;
+  if (argc > 1) {
+    megabytes = static_cast<size_t>(std::strtoull(argv[1], nullptr, 10));
+  }
+
+  std::vector<u8> data(megabytes * 1024 * 1024);
+  u32 seed = 0x12345678;
+  for (auto &byte : data) {
+    seed = seed * 1664525u + 1013904223u;
+    byte = static_cast<u8>(seed >> 24);
+  }
+  std::printf("Checksumming %zu MB, active kernel: %s\n", megabytes,
+              crc32KernelName(activeCrc32Kernel()));
+
+  bool ok = true;
+  u32 reference = 0;
+  bool haveReference = false;
+  for (auto kernel : {Crc32Kernel::Bytewise, Crc32Kernel::Slicing16, Crc32Kernel::Pclmul,
+                      Crc32Kernel::ArmCrc}) {
+    if (!isCrc32KernelSupported(kernel)) {
+      std::printf("%-14s unsupported\n", crc32KernelName(kernel));
+      continue;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    const u32 crc = crc32With(kernel, data.data(), data.size());
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (!haveReference) {
+      reference = crc;
+      haveReference = true;
+    }
+    ok &= crc == reference;
+    std::printf("%-14s %08x  %9.1f ms  %6.2f GB/s%s\n", crc32KernelName(kernel), crc, elapsed * 1000.0,
+                static_cast<double>(data.size()) / (elapsed * 1e9), crc == reference ? "" : "  MISMATCH");
+  }
+  return ok ? 0 : 1;
+}
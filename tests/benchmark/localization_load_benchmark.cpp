@@ -0,0 +1,177 @@
+/**
+ * @file localization_load_benchmark.cpp
+ * @brief Times loading a large synthetic string table in every format
+ *
+ * Usage: localization_benchmark [entries]   (default: 1000000)
+ *
+ * Writes JSON, CSV and PO tables with the requested number of entries to
+ * the temp directory, then loads each through LocalizationManager (which
+ * memory-maps the file) and reports the load time and throughput. Not part
+ * of the ctest run; build the target and run it manually.
+ *
+ * The JSON table is then compiled into a string bundle, which is timed for
+ * opening and for looking up every entry through LocalizationManager.
+ */
+
+#include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/localization/string_bundle.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace NovelMind::localization;
+
+namespace {
+
+std::string entryId(size_t i) { return "dialogue.chapter" + std::to_string(i % 40) + ".line" + std::to_string(i); }
+
+std::string entryText(size_t i) {
+  // Mix of plain text, escapes and interpolation like a real script
+  std::string text = "Line " + std::to_string(i) + ": {name} looks at the sky";
+  if (i % 7 == 0) {
+    text += " and says \"hello\"";
+  }
+  if (i % 11 == 0) {
+    text += "\nsecond line";
+  }
+  return text;
+}
+
+std::string escapeJson(const std::string &text) {
+  std::string out;
+  out.reserve(text.size() + 8);
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+std::string escapeCsv(const std::string &text) {
+  std::string out = "\"";
+  for (char c : text) {
+    if (c == '"') {
+      out += '"';
+    }
+    out += c;
+  }
+  return out + "\"";
+}
+
+void writeTables(size_t entries, const std::filesystem::path &dir) {
+  std::ofstream json(dir / "bench_strings.json", std::ios::binary);
+  std::ofstream csv(dir / "bench_strings.csv", std::ios::binary);
+  std::ofstream po(dir / "bench_strings.po", std::ios::binary);
+
+  json << "{\n";
+  csv << "ID,Text\n";
+  po << "# Benchmark table\n\n";
+  for (size_t i = 0; i < entries; ++i) {
+    const std::string id = entryId(i);
+    const std::string escaped = escapeJson(entryText(i));
+    json << "  \"" << id << "\": \"" << escaped << "\"" << (i + 1 < entries ? ",\n" : "\n");
+    csv << id << "," << escapeCsv(entryText(i)) << "\n";
+    po << "msgid \"" << id << "\"\nmsgstr \"" << escaped << "\"\n\n";
+  }
+  json << "}\n";
+}
+
+bool timeLoad(const char *name, const std::filesystem::path &path, LocalizationFormat format,
+              size_t expected) {
+  LocalizationManager manager;
+  const LocaleId locale("en");
+
+  const auto start = std::chrono::steady_clock::now();
+  auto result = manager.loadStrings(locale, path.string(), format);
+  const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  if (result.isError()) {
+    std::printf("%-5s failed: %s\n", name, result.error().c_str());
+    return false;
+  }
+
+  const auto *table = manager.getStringTable(locale);
+  const size_t loaded = table ? table->size() : 0;
+  const double megabytes = static_cast<double>(std::filesystem::file_size(path)) / (1024.0 * 1024.0);
+  std::printf("%-5s %9zu entries  %8.1f MB  %9.1f ms  %7.1f MB/s  %6.2f M entries/s\n", name,
+              loaded, megabytes, elapsed, megabytes / (elapsed / 1000.0),
+              static_cast<double>(loaded) / (elapsed * 1000.0));
+  return loaded == expected;
+}
+
+bool timeBundle(const std::filesystem::path &jsonPath, const std::filesystem::path &bundlePath,
+                size_t expected) {
+  LocalizationManager manager;
+  const LocaleId locale("en");
+  if (manager.loadStrings(locale, jsonPath.string(), LocalizationFormat::JSON).isError()) {
+    return false;
+  }
+  auto compiled = StringBundle::compileToFile(*manager.getStringTable(locale), bundlePath.string());
+  if (compiled.isError()) {
+    std::printf("Bundle compile failed: %s\n", compiled.error().c_str());
+    return false;
+  }
+  manager.clearAll();
+
+  auto start = std::chrono::steady_clock::now();
+  auto result = manager.loadBundle(locale, bundlePath.string());
+  const auto openMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  if (result.isError()) {
+    std::printf("Bundle open failed: %s\n", result.error().c_str());
+    return false;
+  }
+
+  std::vector<std::string> ids;
+  ids.reserve(expected);
+  for (size_t i = 0; i < expected; ++i) {
+    ids.push_back(entryId(i));
+  }
+  size_t found = 0;
+  start = std::chrono::steady_clock::now();
+  for (const auto &id : ids) {
+    if (manager.getView(id).data() != id.data()) {
+      ++found;
+    }
+  }
+  const auto lookupMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("NMLB  %9zu entries  %8.1f MB  %9.1f ms open  %6.1f ns/lookup\n", found,
+              static_cast<double>(std::filesystem::file_size(bundlePath)) / (1024.0 * 1024.0), openMs,
+              lookupMs * 1e6 / static_cast<double>(expected ? expected : size_t{1}));
+  return found == expected;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  size_t entries = 1000000;
+  if (argc > 1) {
+    entries = static_cast<size_t>(std::strtoull(argv[1], nullptr, 10));
+  }
+
+  const auto dir = std::filesystem::temp_directory_path();
+  std::printf("Generating %zu entries in %s\n", entries, dir.string().c_str());
+  writeTables(entries, dir);
+
+  bool ok = true;
+  ok &= timeLoad("JSON", dir / "bench_strings.json", LocalizationFormat::JSON, entries);
+  ok &= timeLoad("CSV", dir / "bench_strings.csv", LocalizationFormat::CSV, entries);
+  ok &= timeLoad("PO", dir / "bench_strings.po", LocalizationFormat::PO, entries);
+  ok &= timeBundle(dir / "bench_strings.json", dir / "bench_strings.nmlb", entries);
+
+  for (const char *file :
+       {"bench_strings.json", "bench_strings.csv", "bench_strings.po", "bench_strings.nmlb"}) {
+    std::filesystem::remove(dir / file);
+  }
+  return ok ? 0 : 1;
+}
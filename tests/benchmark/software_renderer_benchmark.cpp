@@ -0,0 +1,119 @@
+/**
+ * @file software_renderer_benchmark.cpp
+ * @brief Measures software renderer frame rate on a typical VN frame
+ *
+ * Usage: software_renderer_benchmark [frames] [output.png]   (default: 300)
+ *
+ * Renders a 1280x720 frame with an opaque background, two scaled
+ * character sprites, a translucent text box and three lines of text, and
+ * reports the average frame time. The last frame is written to the PNG
+ * path when one is given. Not part of the ctest run; build the target and
+ * run it manually.
+ */
+
+#include "NovelMind/renderer/software_renderer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+namespace {
+
+Texture makeTexture(i32 width, i32 height, bool character) {
+  std::vector<u8> pixels(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+  for (i32 y = 0; y < height; ++y) {
+    for (i32 x = 0; x < width; ++x) {
+      u8 *p = &pixels[(static_cast<size_t>(y) * static_cast<size_t>(width) +
+                       static_cast<size_t>(x)) *
+                      4];
+      p[0] = static_cast<u8>(x * 255 / width);
+      p[1] = static_cast<u8>(y * 255 / height);
+      p[2] = static_cast<u8>((x ^ y) & 0xFF);
+      // Characters: opaque body with a soft, partly transparent silhouette
+      const i32 dx = x - width / 2;
+      const i32 edge = width / 2 - (dx < 0 ? -dx : dx);
+      p[3] = character ? static_cast<u8>(edge >= 32 ? 255 : edge * 8) : 255;
+    }
+  }
+  Texture texture;
+  texture.loadFromRGBA(pixels.data(), width, height);
+  return texture;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  int frames = 300;
+  if (argc > 1) {
+    frames = std::atoi(argv[1]);
+  }
+
+  SoftwareRenderer renderer;
+  if (renderer.initialize(1280, 720).isError()) {
+    return 1;
+  }
+
+  const Texture background = makeTexture(1280, 720, false);
+  const Texture character = makeTexture(512, 1024, true);
+
+  Font font;
+  std::ifstream file("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf", std::ios::binary);
+  const std::vector<u8> fontData{std::istreambuf_iterator<char>(file),
+                                 std::istreambuf_iterator<char>()};
+  const bool haveFont = !fontData.empty() && font.loadFromMemory(fontData, 24).isOk();
+  if (!haveFont) {
+    std::printf("No system font, rendering without text\n");
+  }
+
+  Transform2D left;
+  left.x = 120.0f;
+  left.y = 40.0f;
+  left.scaleX = 0.7f;
+  left.scaleY = 0.7f;
+  Transform2D right = left;
+  right.x = 800.0f;
+
+  auto renderFrame = [&]() {
+    renderer.beginFrame();
+    renderer.drawSprite(background, Transform2D{});
+    renderer.drawSprite(character, left);
+    renderer.drawSprite(character, right);
+    renderer.fillRect(Rect{40, 500, 1200, 190}, Color(0, 0, 0, 160));
+    renderer.drawRect(Rect{40, 500, 1200, 190}, Color::White);
+    if (haveFont) {
+      renderer.drawText(font, "Alice", 60, 510, Color(255, 220, 120));
+      renderer.drawText(font, "The rain had not stopped for three days, and the old", 60, 550);
+      renderer.drawText(font, "lighthouse keeper was beginning to wonder whether it", 60, 590);
+      renderer.drawText(font, "ever would. \"Someone is coming,\" she said quietly.", 60, 630);
+    }
+    renderer.endFrame();
+  };
+
+  renderFrame(); // build the font atlas outside the timed loop
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < frames; ++i) {
+    renderFrame();
+  }
+  const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  const double frameMs = elapsed * 1000.0 / frames;
+  const BatchStats stats = renderer.getBatchStats();
+  std::printf("%d frames at 1280x720: %.2f ms/frame (%.0f fps), %u quads in %u draw calls\n", frames,
+              frameMs, 1000.0 / frameMs, stats.quads, stats.drawCalls);
+
+  if (argc > 2) {
+    auto saved = renderer.savePng(argv[2]);
+    if (saved.isError()) {
+      std::printf("Failed to save %s: %s\n", argv[2], saved.error().c_str());
+      return 1;
+    }
+    std::printf("Wrote %s\n", argv[2]);
+  }
+  return 0;
+}
@@ -0,0 +1,193 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/core/worker_pool.hpp"
+#include "NovelMind/resource/resource_manager.hpp"
+#include "NovelMind/vfs/memory_fs.hpp"
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::resource;
+
+namespace {
+
+/// Binary PPM; stb_image decodes it without any compressed payload
+std::vector<u8> makePpm(int width, int height)
+{
+    const std::string header =
+        "P6\n" + std::to_string(width) + " " + std::to_string(height) + "\n255\n";
+    std::vector<u8> data(header.begin(), header.end());
+    data.resize(data.size() + static_cast<size_t>(width * height * 3), 0x7F);
+    return data;
+}
+
+template <typename Request>
+bool waitForState(const Request &request, LoadState state)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (request->getState() != state) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("WorkerPool runs higher priority jobs first", "[core][worker_pool]")
+{
+    core::WorkerPool pool(1);
+    REQUIRE(pool.getThreadCount() == 1);
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    std::vector<int> order;
+
+    pool.submit([gateFuture] { gateFuture.wait(); }, 100);
+    // Wait for the blocker to occupy the only worker
+    while (pool.getQueuedCount() != 0) {
+        std::this_thread::yield();
+    }
+
+    pool.submit([&order] { order.push_back(1); }, 1);
+    auto low = pool.submit([&order] { order.push_back(0); }, 0);
+    pool.submit([&order] { order.push_back(3); }, 3);
+    auto dropped = pool.submit([&order] { order.push_back(-1); }, 2);
+
+    REQUIRE(pool.setPriority(low, 5));
+    REQUIRE(pool.cancel(dropped));
+    REQUIRE_FALSE(pool.cancel(dropped));
+
+    gate.set_value();
+    pool.waitIdle();
+
+    REQUIRE(order == std::vector<int>{0, 3, 1});
+}
+
+TEST_CASE("ResourceManager loads textures asynchronously", "[resource][async]")
+{
+    vfs::MemoryFileSystem fs;
+    fs.addResource("async/bg.ppm", makePpm(4, 2), vfs::ResourceType::Texture);
+
+    ResourceManager resources(&fs);
+    resources.setLoaderThreadCount(2);
+
+    auto request = resources.loadTextureAsync("async/bg.ppm");
+    REQUIRE(request);
+    REQUIRE(resources.getPendingLoadCount() == 1);
+
+    SECTION("GPU upload waits for processUploads")
+    {
+        REQUIRE(waitForState(request, LoadState::Uploading));
+        REQUIRE(resources.getTextureCount() == 0);
+
+        REQUIRE(resources.processUploads() == 1);
+        REQUIRE(request->getState() == LoadState::Ready);
+        const auto &result = request->future().get();
+        REQUIRE(result.isOk());
+        REQUIRE(result.value()->getWidth() == 4);
+        REQUIRE(result.value()->getHeight() == 2);
+        REQUIRE(resources.getTextureCount() == 1);
+        REQUIRE(resources.getPendingLoadCount() == 0);
+
+        // Cached textures complete immediately
+        auto again = resources.loadTextureAsync("async/bg.ppm");
+        REQUIRE(again->getState() == LoadState::Ready);
+        REQUIRE(again->future().get().value() == result.value());
+    }
+
+    SECTION("duplicate requests share one load")
+    {
+        auto duplicate = resources.loadTextureAsync("async/bg.ppm", LoadPriority::Critical);
+        REQUIRE(duplicate == request);
+        REQUIRE(request->getPriority() == LoadPriority::Critical);
+        resources.finishPendingLoads();
+        REQUIRE(request->getState() == LoadState::Ready);
+    }
+
+    SECTION("cancelled requests never reach the cache")
+    {
+        REQUIRE(request->cancel());
+        REQUIRE(request->isCancelled());
+        REQUIRE(request->future().get().isError());
+
+        resources.finishPendingLoads();
+        REQUIRE(resources.getTextureCount() == 0);
+        REQUIRE(resources.getPendingLoadCount() == 0);
+    }
+}
+
+TEST_CASE("ResourceManager async loads report failures", "[resource][async]")
+{
+    vfs::MemoryFileSystem fs;
+    fs.addResource("async/broken.png", {1, 2, 3, 4}, vfs::ResourceType::Texture);
+
+    ResourceManager resources(&fs);
+    auto missing = resources.loadTextureAsync("async/missing.png");
+    auto broken = resources.loadTextureAsync("async/broken.png");
+    auto empty = resources.loadTextureAsync("");
+    auto badFont = resources.loadFontAsync("async/missing.ttf", 16);
+
+    REQUIRE(empty->getState() == LoadState::Failed);
+
+    resources.finishPendingLoads();
+    REQUIRE(missing->getState() == LoadState::Failed);
+    REQUIRE(broken->getState() == LoadState::Failed);
+    REQUIRE(badFont->getState() == LoadState::Failed);
+    REQUIRE(missing->future().get().isError());
+    REQUIRE(resources.getTextureCount() == 0);
+    REQUIRE(resources.getPendingLoadCount() == 0);
+}
+
+TEST_CASE("ResourceManager upload queue honours budget and priority", "[resource][async]")
+{
+    vfs::MemoryFileSystem fs;
+    fs.addResource("async/a.ppm", makePpm(8, 8), vfs::ResourceType::Texture);
+    fs.addResource("async/b.ppm", makePpm(8, 8), vfs::ResourceType::Texture);
+    fs.addResource("async/c.ppm", makePpm(8, 8), vfs::ResourceType::Texture);
+
+    ResourceManager resources(&fs);
+    auto background = resources.loadTextureAsync("async/a.ppm", LoadPriority::Background);
+    auto normal = resources.loadTextureAsync("async/b.ppm", LoadPriority::Normal);
+    auto critical = resources.loadTextureAsync("async/c.ppm", LoadPriority::Critical);
+
+    REQUIRE(waitForState(background, LoadState::Uploading));
+    REQUIRE(waitForState(normal, LoadState::Uploading));
+    REQUIRE(waitForState(critical, LoadState::Uploading));
+
+    // 8x8 RGBA is 256 bytes, so a 300 byte budget admits one texture a frame
+    REQUIRE(resources.processUploads(300) == 1);
+    REQUIRE(critical->getState() == LoadState::Ready);
+    REQUIRE(normal->getState() == LoadState::Uploading);
+
+    REQUIRE(resources.processUploads(300) == 1);
+    REQUIRE(normal->getState() == LoadState::Ready);
+    REQUIRE(background->getState() == LoadState::Uploading);
+
+    REQUIRE(resources.processUploads(1024) == 1);
+    REQUIRE(background->getState() == LoadState::Ready);
+    REQUIRE(resources.processUploads() == 0);
+}
+
+TEST_CASE("ResourceManager cancels stale loads on scene change", "[resource][async]")
+{
+    vfs::MemoryFileSystem fs;
+    fs.addResource("async/old.ppm", makePpm(2, 2), vfs::ResourceType::Texture);
+    fs.addResource("async/new.ppm", makePpm(2, 2), vfs::ResourceType::Texture);
+
+    ResourceManager resources(&fs);
+    auto stale = resources.loadTextureAsync("async/old.ppm", LoadPriority::Background);
+    auto current = resources.loadTextureAsync("async/new.ppm", LoadPriority::Critical);
+
+    REQUIRE(resources.cancelPendingLoads(LoadPriority::High) == 1);
+    REQUIRE(stale->isCancelled());
+
+    resources.finishPendingLoads();
+    REQUIRE(current->getState() == LoadState::Ready);
+    REQUIRE(resources.getTextureCount() == 1);
+    REQUIRE(resources.getPendingLoadCount() == 0);
+}
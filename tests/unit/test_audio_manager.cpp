@@ -21,8 +21,11 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include "NovelMind/audio/audio_manager.hpp"
-#include <thread>
+#include <atomic>
 #include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
 
 using namespace NovelMind::audio;
 using namespace NovelMind;
@@ -554,6 +557,332 @@ TEST_CASE("AudioManager update", "[audio][manager]")
     REQUIRE(manager.getActiveSourceCount() >= 0);
 }
 
+// =============================================================================
+// Streaming Tests
+// =============================================================================
+
+namespace {
+
+/// Mono 16-bit PCM WAV of silence
+std::vector<u8> makeWav(u32 sampleRate, u32 seconds)
+{
+    const u32 dataSize = sampleRate * seconds * 2;
+    std::vector<u8> wav;
+    auto put = [&wav](const char *text) { wav.insert(wav.end(), text, text + 4); };
+    auto put32 = [&wav](u32 v) {
+        for (int i = 0; i < 4; ++i) {
+            wav.push_back(static_cast<u8>(v >> (8 * i)));
+        }
+    };
+    auto put16 = [&wav](u16 v) {
+        wav.push_back(static_cast<u8>(v));
+        wav.push_back(static_cast<u8>(v >> 8));
+    };
+
+    put("RIFF");
+    put32(36 + dataSize);
+    put("WAVE");
+    put("fmt ");
+    put32(16);
+    put16(1);
+    put16(1);
+    put32(sampleRate);
+    put32(sampleRate * 2);
+    put16(2);
+    put16(16);
+    put("data");
+    put32(dataSize);
+    wav.resize(wav.size() + dataSize, 0);
+    return wav;
+}
+
+/// Handle that records how many bytes the decoder actually pulled
+class CountingHandle : public VFS::MemoryFileHandle
+{
+public:
+    CountingHandle(std::vector<u8> data, std::atomic<usize> &counter)
+        : VFS::MemoryFileHandle(std::move(data)), m_counter(counter)
+    {
+    }
+
+    Result<usize> read(u8 *buffer, usize count) override
+    {
+        auto result = VFS::MemoryFileHandle::read(buffer, count);
+        if (result.isOk()) {
+            m_counter += result.value();
+        }
+        return result;
+    }
+
+private:
+    std::atomic<usize> &m_counter;
+};
+
+/// Pump update() until @p handle has loaded; false if the load failed
+bool waitForLoad(AudioManager &manager, AudioHandle handle)
+{
+    for (int i = 0; i < 300; ++i) {
+        auto *source = manager.getSource(handle);
+        if (!source || !source->isLoading()) {
+            // Failed sources are dropped by the next update
+            manager.update(0.0);
+            return manager.getSource(handle) != nullptr;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+bool waitForPool(AudioManager &manager, size_t count)
+{
+    for (int i = 0; i < 300 && manager.getPooledSoundCount() != count; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return manager.getPooledSoundCount() == count;
+}
+
+} // namespace
+
+TEST_CASE("ViewFileHandle reads and seeks within a view", "[audio][stream]")
+{
+    VFS::ViewFileHandle handle(vfs::ResourceView::fromVector({1, 2, 3, 4, 5}));
+    REQUIRE(handle.isValid());
+    REQUIRE(handle.size() == 5);
+
+    u8 buffer[4] = {};
+    auto first = handle.read(buffer, 3);
+    REQUIRE(first.isOk());
+    REQUIRE(first.value() == 3);
+    REQUIRE(buffer[2] == 3);
+
+    REQUIRE(handle.seek(-1, VFS::SeekOrigin::End).isOk());
+    auto tail = handle.read(buffer, 4);
+    REQUIRE(tail.value() == 1);
+    REQUIRE(buffer[0] == 5);
+    REQUIRE(handle.isEof());
+    REQUIRE(handle.read(buffer, 4).value() == 0);
+
+    REQUIRE(handle.seek(6, VFS::SeekOrigin::Begin).isError());
+    REQUIRE(handle.seek(-1, VFS::SeekOrigin::Begin).isError());
+}
+
+TEST_CASE("DiskFileHandle reads a file incrementally", "[audio][stream]")
+{
+    const auto path = std::filesystem::temp_directory_path() / "nm_disk_handle_test.bin";
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "streaming";
+    }
+
+    VFS::DiskFileHandle handle(path.string());
+    REQUIRE(handle.isValid());
+    REQUIRE(handle.size() == 9);
+
+    REQUIRE(handle.seek(4, VFS::SeekOrigin::Begin).isOk());
+    char buffer[16] = {};
+    auto read = handle.read(reinterpret_cast<u8 *>(buffer), sizeof(buffer));
+    REQUIRE(read.value() == 5);
+    REQUIRE(std::string(buffer, 5) == "aming");
+    REQUIRE(handle.position() == 9);
+
+    // Seeking after hitting the end must still work
+    REQUIRE(handle.seek(0, VFS::SeekOrigin::Begin).isOk());
+    REQUIRE(handle.read(reinterpret_cast<u8 *>(buffer), 3).value() == 3);
+    REQUIRE(std::string(buffer, 3) == "str");
+
+    std::filesystem::remove(path);
+    REQUIRE_FALSE(VFS::DiskFileHandle(path.string()).isValid());
+}
+
+TEST_CASE("AudioManager streams music through the stream provider", "[audio][manager][stream]")
+{
+    AudioManager manager;
+    auto initResult = manager.initialize();
+
+    if (initResult.isError()) {
+        SKIP("Audio hardware not available");
+    }
+
+    const auto wav = makeWav(44100, 20);
+    std::atomic<usize> bytesRead{0};
+    std::atomic<int> opens{0};
+    manager.setStreamProvider([&](const std::string &id) -> Result<std::unique_ptr<VFS::IFileHandle>> {
+        if (id != "music/theme.wav") {
+            return Result<std::unique_ptr<VFS::IFileHandle>>::error("missing");
+        }
+        ++opens;
+        return Result<std::unique_ptr<VFS::IFileHandle>>::ok(
+            std::make_unique<CountingHandle>(wav, bytesRead));
+    });
+
+    SECTION("Only the first pages are read before playback starts") {
+        auto handle = manager.playMusic("music/theme.wav");
+        REQUIRE(handle.isValid());
+        REQUIRE(waitForLoad(manager, handle));
+        REQUIRE(opens >= 1);
+        REQUIRE(bytesRead > 0);
+        REQUIRE(bytesRead < wav.size() / 4);
+    }
+
+    SECTION("Unknown tracks report an error and drop the source") {
+        std::atomic<int> errors{0};
+        manager.setEventCallback([&](const AudioEvent &event) {
+            if (event.type == AudioEvent::Type::Error) {
+                ++errors;
+            }
+        });
+
+        auto handle = manager.playMusic("music/missing.wav");
+        REQUIRE(handle.isValid());
+        REQUIRE_FALSE(waitForLoad(manager, handle));
+        REQUIRE(manager.getSource(handle) == nullptr);
+        REQUIRE(errors == 1);
+        REQUIRE(manager.getLatencyStats(AudioChannel::Music).failed == 1);
+    }
+
+    SECTION("Data provider is used when the stream provider has no track") {
+        manager.setDataProvider([&](const std::string &id) -> Result<std::vector<u8>> {
+            if (id != "sfx/click.wav") {
+                return Result<std::vector<u8>>::error("missing");
+            }
+            return Result<std::vector<u8>>::ok(makeWav(22050, 1));
+        });
+        auto handle = manager.playSound("sfx/click.wav");
+        REQUIRE(handle.isValid());
+        REQUIRE(waitForLoad(manager, handle));
+    }
+
+    manager.shutdown();
+}
+
+TEST_CASE("AudioManager creates sources without waiting for the track", "[audio][manager][stream]")
+{
+    AudioManager manager;
+    auto initResult = manager.initialize();
+
+    if (initResult.isError()) {
+        SKIP("Audio hardware not available");
+    }
+
+    // The provider runs on the manager's loader pool and is held back until
+    // the test has checked that playVoice() already returned
+    std::atomic<bool> released{false};
+    manager.setStreamProvider([&](const std::string &) -> Result<std::unique_ptr<VFS::IFileHandle>> {
+        for (int i = 0; i < 500 && !released; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        return Result<std::unique_ptr<VFS::IFileHandle>>::ok(
+            std::make_unique<VFS::MemoryFileHandle>(makeWav(44100, 2)));
+    });
+
+    auto handle = manager.playVoice("voice/line01.wav");
+    const bool loadingOnReturn = manager.getSource(handle) && manager.getSource(handle)->isLoading();
+    released = true;
+
+    REQUIRE(handle.isValid());
+    REQUIRE(loadingOnReturn);
+    REQUIRE(waitForLoad(manager, handle));
+
+    auto stats = manager.getLatencyStats(AudioChannel::Voice);
+    REQUIRE(stats.requests == 1);
+    REQUIRE(stats.ready == 1);
+    REQUIRE(stats.lastReadyMs >= stats.lastCallMs);
+    REQUIRE(stats.averageReadyMs() == Catch::Approx(stats.lastReadyMs));
+    REQUIRE(manager.getAudioPeriodMs() > 0.0);
+
+    manager.resetLatencyStats();
+    REQUIRE(manager.getLatencyStats(AudioChannel::Voice).requests == 0);
+
+    manager.shutdown();
+}
+
+TEST_CASE("AudioManager reuses decoded sound effects from the warm pool", "[audio][manager][stream]")
+{
+    AudioManager manager;
+    auto initResult = manager.initialize();
+
+    if (initResult.isError()) {
+        SKIP("Audio hardware not available");
+    }
+
+    std::atomic<int> opens{0};
+    manager.setDataProvider([&](const std::string &) -> Result<std::vector<u8>> {
+        ++opens;
+        return Result<std::vector<u8>>::ok(makeWav(22050, 1));
+    });
+
+    SECTION("Repeated plays decode the track once") {
+        auto first = manager.playSound("sfx/click.wav");
+        REQUIRE(waitForLoad(manager, first));
+        auto second = manager.playSound("sfx/click.wav");
+        REQUIRE(waitForLoad(manager, second));
+
+        REQUIRE(opens == 1);
+        REQUIRE(manager.getPooledSoundCount() == 1);
+        auto stats = manager.getLatencyStats(AudioChannel::Sound);
+        REQUIRE(stats.requests == 2);
+        REQUIRE(stats.pooledStarts == 1);
+    }
+
+    SECTION("Warmed sounds start from the pool") {
+        REQUIRE(manager.warmSound("sfx/door.wav").isOk());
+        REQUIRE(waitForPool(manager, 1));
+        auto handle = manager.playSound("sfx/door.wav");
+        REQUIRE(waitForLoad(manager, handle));
+        REQUIRE(opens == 1);
+        REQUIRE(manager.getLatencyStats(AudioChannel::Sound).pooledStarts == 1);
+    }
+
+    SECTION("The pool keeps only the most recently used effects") {
+        manager.setSoundPoolSize(2);
+        REQUIRE(manager.warmSound("sfx/a.wav").isOk());
+        REQUIRE(waitForPool(manager, 1));
+        REQUIRE(manager.warmSound("sfx/b.wav").isOk());
+        REQUIRE(waitForPool(manager, 2));
+        REQUIRE(waitForLoad(manager, manager.playSound("sfx/c.wav")));
+        REQUIRE(manager.getPooledSoundCount() == 2);
+
+        // b is still pooled; a was the least recently used and is decoded again
+        REQUIRE(waitForLoad(manager, manager.playSound("sfx/b.wav")));
+        REQUIRE(manager.getLatencyStats(AudioChannel::Sound).pooledStarts == 1);
+        REQUIRE(waitForLoad(manager, manager.playSound("sfx/a.wav")));
+        REQUIRE(manager.getLatencyStats(AudioChannel::Sound).pooledStarts == 1);
+        REQUIRE(opens == 4);
+
+        manager.setSoundPoolSize(0);
+        REQUIRE(manager.getPooledSoundCount() == 0);
+        REQUIRE(manager.warmSound("sfx/a.wav").isError());
+    }
+
+    SECTION("Concurrent loads survive evicting each other") {
+        // With room for one effect, two tracks loading at once on the loader
+        // pool keep evicting each other's entry before it can be copied
+        manager.setSoundPoolSize(1);
+        for (int round = 0; round < 20; ++round) {
+            std::vector<AudioHandle> handles(16);
+            auto play = [&](const std::string& id, usize first) {
+                for (usize i = first; i < handles.size(); i += 2) {
+                    handles[i] = manager.playSound(id);
+                }
+            };
+            std::thread x(play, "sfx/x.wav", 0);
+            std::thread y(play, "sfx/y.wav", 1);
+            x.join();
+            y.join();
+
+            for (const auto& handle : handles) {
+                REQUIRE(waitForLoad(manager, handle));
+            }
+            manager.stopAllSounds();
+            manager.update(0.0);
+        }
+        REQUIRE(manager.getLatencyStats(AudioChannel::Sound).failed == 0);
+        REQUIRE(manager.getPooledSoundCount() == 1);
+    }
+
+    manager.shutdown();
+}
+
 // =============================================================================
 // Error Path Tests
 // =============================================================================
@@ -5,9 +5,13 @@
  * Benchmarks:
  * - Scene rendering with many objects
  * - Resource loading simulation
- * - Script execution overhead
+ * - Script execution overhead (VM value representation)
  * - Memory usage patterns
  * - Search and filtering operations
+ * - Localized string formatting
+ * - Pack checksums (CRC-32 kernels)
+ * - Dialogue text layout and typewriter reveal
+ * - Software rasterizer frames
  *
  * Related to Issue #179 - Performance testing coverage
  *
@@ -16,9 +20,15 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
+#include "NovelMind/core/checksum.hpp"
 #include "NovelMind/scene/scene_graph.hpp"
 #include "NovelMind/vfs/memory_fs.hpp"
 #include "NovelMind/renderer/renderer.hpp"
+#include "NovelMind/renderer/software_renderer.hpp"
+#include "NovelMind/renderer/text_layout.hpp"
+#include "NovelMind/scripting/vm.hpp"
+#include "NovelMind/localization/localization_manager.hpp"
+#include <unordered_map>
 #include <vector>
 #include <random>
 
@@ -270,6 +280,22 @@ TEST_CASE("Benchmark: VFS resource operations", "[benchmark][vfs]")
     };
 }
 
+TEST_CASE("Benchmark: CRC-32 over a 16 MB pack", "[benchmark][vfs]")
+{
+    std::vector<u8> pack(16 * 1024 * 1024);
+    for (size_t i = 0; i < pack.size(); ++i) {
+        pack[i] = static_cast<u8>(i * 131 + (i >> 9));
+    }
+
+    BENCHMARK("Legacy bytewise table (16 MB)") {
+        return core::crc32With(core::Crc32Kernel::Bytewise, pack.data(), pack.size());
+    };
+
+    BENCHMARK("Dispatched kernel (16 MB)") {
+        return core::crc32(pack.data(), pack.size());
+    };
+}
+
 // =============================================================================
 // Character and Dialogue Benchmarks
 // =============================================================================
@@ -315,6 +341,344 @@ TEST_CASE("Benchmark: Dialogue typewriter simulation", "[benchmark][dialogue]")
     };
 }
 
+namespace {
+
+// What DialogueUIObject::render did per frame before the layout was cached:
+// resolve font and atlas, build a layout engine, copy the typed prefix and
+// lay it out, then measure every segment again to place it.
+void legacyDialogueFrame(resource::ResourceManager& resources, renderer::IRenderer& renderer,
+                         const std::string& fontId, const std::string& text, size_t typed)
+{
+    auto font = resources.loadFont(fontId, 18);
+    auto atlas = resources.loadFontAtlas(fontId, 18,
+                                         " !\"#$%&'()*+,-./0123456789:;<=>?"
+                                         "@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_"
+                                         "`abcdefghijklmnopqrstuvwxyz{|}~");
+    if (font.isError() || atlas.isError()) {
+        return;
+    }
+    renderer::TextLayoutEngine layout;
+    layout.setFont(font.value());
+    layout.setFontAtlas(atlas.value());
+    layout.setMaxWidth(800.0f - 40.0f);
+    renderer::TextStyle style;
+    style.size = 18.0f;
+    layout.setDefaultStyle(style);
+
+    const std::string visible = text.substr(0, typed);
+    const renderer::TextLayout textLayout = layout.layout(visible);
+    f32 y = 38.0f;
+    for (const auto& line : textLayout.lines) {
+        f32 x = 20.0f;
+        for (const auto& segment : line.segments) {
+            if (segment.isCommand()) {
+                continue;
+            }
+            renderer.drawText(*font.value(), segment.text, x, y, segment.style.color);
+            x += layout.measureText(segment.text).first;
+        }
+        y += line.height;
+    }
+}
+
+} // namespace
+
+TEST_CASE("Benchmark: Dialogue render with a 400-character line", "[benchmark][dialogue]")
+{
+#if defined(_WIN32)
+    const std::string fontId = "C:\\Windows\\Fonts\\segoeui.ttf";
+#elif defined(__APPLE__)
+    const std::string fontId = "/System/Library/Fonts/Supplemental/Arial.ttf";
+#else
+    const std::string fontId = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+#endif
+    resource::ResourceManager resources;
+    if (resources.loadFont(fontId, 18).isError()) {
+        WARN("System font unavailable, skipping dialogue render benchmark");
+        return;
+    }
+
+    std::string text;
+    while (text.size() < 400) {
+        text += "The rain kept falling on the old station roof as she waited. ";
+    }
+    text.resize(400);
+
+    BenchmarkRenderer renderer;
+    SceneGraph graph;
+    graph.setResourceManager(&resources);
+    auto owned = std::make_unique<DialogueUIObject>("dlg");
+    DialogueUIObject* dialogue = owned.get();
+    graph.addToLayer(LayerType::UI, std::move(owned));
+    dialogue->setProperty("fontId", fontId);
+    dialogue->setText(text);
+    dialogue->setTypewriterSpeed(200.0f);
+    dialogue->startTypewriter();
+    dialogue->update(1.0); // 200 of 400 glyphs typed
+
+    BENCHMARK("Legacy per-frame layout (half typed)") {
+        legacyDialogueFrame(resources, renderer, fontId, text, 200);
+    };
+
+    BENCHMARK("Cached layout (half typed)") {
+        dialogue->render(renderer);
+    };
+}
+
+TEST_CASE("Benchmark: Software renderer 1280x720 frame", "[benchmark][software]")
+{
+    auto makeTexture = [](i32 width, i32 height, u8 alpha) {
+        std::vector<u8> pixels(static_cast<size_t>(width) * static_cast<size_t>(height) * 4, alpha);
+        renderer::Texture texture;
+        texture.loadFromRGBA(pixels.data(), width, height);
+        return texture;
+    };
+    const auto background = makeTexture(1280, 720, 255);
+    const auto character = makeTexture(512, 1024, 200);
+
+    renderer::SoftwareRenderer software;
+    REQUIRE(software.initialize(1280, 720).isOk());
+
+    renderer::Transform2D left;
+    left.x = 120.0f;
+    left.y = 40.0f;
+    left.scaleX = 0.7f;
+    left.scaleY = 0.7f;
+    renderer::Transform2D right = left;
+    right.x = 800.0f;
+
+    BENCHMARK("Background, two scaled characters and a text box") {
+        software.beginFrame();
+        software.drawSprite(background, renderer::Transform2D{});
+        software.drawSprite(character, left);
+        software.drawSprite(character, right);
+        software.fillRect(renderer::Rect{40, 500, 1200, 190}, renderer::Color(0, 0, 0, 160));
+        software.endFrame();
+        return software.getPixel(640, 600).r;
+    };
+
+    BENCHMARK("Full-screen alpha fade") {
+        software.setFade(0.5f);
+        software.endFrame();
+        return software.getPixel(0, 0).r;
+    };
+}
+
+// =============================================================================
+// Script VM Benchmarks
+// =============================================================================
+
+namespace {
+
+// Dialogue-heavy straight-line bytecode: every line pushes, duplicates,
+// stores, reloads and compares long (non-SSO) strings.
+std::vector<scripting::Instruction> makeDialogueProgram(u32 lineCount,
+                                                        u32 textCount) {
+    using scripting::OpCode;
+    std::vector<scripting::Instruction> program;
+    for (u32 i = 0; i < lineCount; ++i) {
+        program.emplace_back(OpCode::PUSH_STRING, 2 + (i % textCount));
+        program.emplace_back(OpCode::DUP);
+        program.emplace_back(OpCode::STORE_VAR, 0);
+        program.emplace_back(OpCode::LOAD_VAR, 0);
+        program.emplace_back(OpCode::EQ);
+        program.emplace_back(OpCode::POP);
+        program.emplace_back(OpCode::PUSH_STRING, 1);
+        program.emplace_back(OpCode::STORE_VAR, 1);
+    }
+    program.emplace_back(OpCode::HALT);
+    return program;
+}
+
+std::vector<std::string> makeDialogueStrings(u32 textCount) {
+    std::vector<std::string> strings = {"last_line", "speaker"};
+    for (u32 i = 0; i < textCount; ++i) {
+        strings.push_back("Alice: I never thought the lighthouse would still be "
+                          "standing after all these years (" +
+                          std::to_string(i) + ")");
+    }
+    return strings;
+}
+
+// Reference interpreter using the public std::variant Value for its stack
+// and a name-keyed map, i.e. the representation the VM used to run on.
+void runLegacyValueStack(const std::vector<scripting::Instruction>& program,
+                         const std::vector<std::string>& strings,
+                         std::vector<scripting::Value>& stack,
+                         std::unordered_map<std::string, scripting::Value>& vars) {
+    using scripting::OpCode;
+    stack.clear();
+    for (const auto& instr : program) {
+        switch (instr.opcode) {
+        case OpCode::PUSH_STRING:
+            stack.emplace_back(strings[instr.operand]);
+            break;
+        case OpCode::DUP:
+            stack.push_back(stack.back());
+            break;
+        case OpCode::STORE_VAR:
+            vars[strings[instr.operand]] = std::move(stack.back());
+            stack.pop_back();
+            break;
+        case OpCode::LOAD_VAR:
+            stack.push_back(vars[strings[instr.operand]]);
+            break;
+        case OpCode::EQ: {
+            scripting::Value b = std::move(stack.back());
+            stack.pop_back();
+            scripting::Value a = std::move(stack.back());
+            stack.pop_back();
+            stack.emplace_back(scripting::asString(a) == scripting::asString(b));
+            break;
+        }
+        case OpCode::POP:
+            stack.pop_back();
+            break;
+        default:
+            return;
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("Benchmark: VM value representation on dialogue bytecode",
+          "[benchmark][vm]")
+{
+    const auto program = makeDialogueProgram(256, 16);
+    const auto strings = makeDialogueStrings(16);
+
+    std::vector<scripting::Value> legacyStack;
+    std::unordered_map<std::string, scripting::Value> legacyVars;
+
+    BENCHMARK("Legacy variant values (256 lines)") {
+        runLegacyValueStack(program, strings, legacyStack, legacyVars);
+        return legacyVars.size();
+    };
+
+    scripting::VirtualMachine vm;
+    REQUIRE(vm.load(program, strings).isOk());
+
+    BENCHMARK("Tagged values + interned strings (256 lines)") {
+        vm.setIP(0);
+        vm.run();
+        return vm.isHalted();
+    };
+
+    REQUIRE(scripting::asString(vm.getVariable("speaker")) == "speaker");
+}
+
+TEST_CASE("Benchmark: VM dispatch on pure arithmetic bytecode",
+          "[benchmark][vm]")
+{
+    using scripting::OpCode;
+
+    // acc = 0; for (i = 0; i < 1000; ++i) acc = (acc + i * 3) % 10007;
+    const std::vector<scripting::Instruction> program = {
+        {OpCode::PUSH_INT, 0},      {OpCode::STORE_VAR, 0},
+        {OpCode::PUSH_INT, 0},      {OpCode::STORE_VAR, 1},
+        {OpCode::LOAD_VAR, 0},      {OpCode::PUSH_INT, 1000},
+        {OpCode::LT},               {OpCode::JUMP_IF_NOT, 21},
+        {OpCode::LOAD_VAR, 1},      {OpCode::LOAD_VAR, 0},
+        {OpCode::PUSH_INT, 3},      {OpCode::MUL},
+        {OpCode::ADD},              {OpCode::PUSH_INT, 10007},
+        {OpCode::MOD},              {OpCode::STORE_VAR, 1},
+        {OpCode::LOAD_VAR, 0},      {OpCode::PUSH_INT, 1},
+        {OpCode::ADD},              {OpCode::STORE_VAR, 0},
+        {OpCode::JUMP, 4},          {OpCode::HALT},
+    };
+    const std::vector<std::string> strings = {"i", "acc"};
+
+    i32 expected = 0;
+    for (i32 i = 0; i < 1000; ++i) {
+        expected = (expected + i * 3) % 10007;
+    }
+
+    scripting::VirtualMachine vm;
+    REQUIRE(vm.load(program, strings).isOk());
+
+    BENCHMARK("step() per instruction (1000 iterations)") {
+        vm.setIP(0);
+        while (vm.step()) {
+        }
+        return vm.isHalted();
+    };
+    REQUIRE(std::get<i32>(vm.getVariable("acc")) == expected);
+
+    BENCHMARK("run() threaded dispatch (1000 iterations)") {
+        vm.setIP(0);
+        vm.run();
+        return vm.isHalted();
+    };
+    REQUIRE(std::get<i32>(vm.getVariable("acc")) == expected);
+}
+
+// =============================================================================
+// Localization Benchmarks
+// =============================================================================
+
+namespace {
+
+// Reference implementation: per-variable find-and-replace on a copy, i.e.
+// what LocalizationManager::interpolate did before templates.
+std::string legacyInterpolate(const std::string& text,
+                              const std::unordered_map<std::string, std::string>& variables) {
+    std::string result = text;
+    for (const auto& [name, value] : variables) {
+        std::string pattern = "{" + name + "}";
+        size_t pos = 0;
+        while ((pos = result.find(pattern, pos)) != std::string::npos) {
+            result.replace(pos, pattern.length(), value);
+            pos += value.length();
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Benchmark: Formatting 10k localized dialogue lines", "[benchmark][localization]")
+{
+    constexpr int lineCount = 10000;
+    localization::LocalizationManager manager;
+    const localization::LocaleId en("en");
+    std::vector<std::string> ids;
+    ids.reserve(lineCount);
+    for (int i = 0; i < lineCount; ++i) {
+        ids.push_back("chapter1.line" + std::to_string(i % 500));
+    }
+    for (int i = 0; i < 500; ++i) {
+        manager.setString(en, "chapter1.line" + std::to_string(i),
+                          "{name}: I found " + std::to_string(i) +
+                              " shells by the {place}, {friend}. Want {count}?");
+    }
+    const std::unordered_map<std::string, std::string> vars = {
+        {"name", "Alice"}, {"place", "lighthouse"}, {"friend", "Bob"}, {"count", "some"},
+        {"mood", "happy"}, {"time", "evening"}};
+
+    BENCHMARK("Legacy find-and-replace (10k lines)") {
+        usize total = 0;
+        for (const auto& id : ids) {
+            total += legacyInterpolate(manager.get(id), vars).size();
+        }
+        return total;
+    };
+
+    std::string line;
+    BENCHMARK("Cached templates into a reused buffer (10k lines)") {
+        usize total = 0;
+        for (const auto& id : ids) {
+            line.clear();
+            manager.format(line, id, vars);
+            total += line.size();
+        }
+        return total;
+    };
+
+    REQUIRE(manager.get(ids[7], vars) == legacyInterpolate(manager.get(ids[7]), vars));
+    REQUIRE(manager.getTemplateCacheSize() == 500);
+}
+
 // =============================================================================
 // Memory and Allocation Benchmarks
 // =============================================================================
@@ -1171,3 +1171,90 @@ TEST_CASE("signMacOSBundle validates entitlements file",
 
   cleanupTempDir(tempDir);
 }
+
+// =============================================================================
+// Incremental Build Cache Tests
+// =============================================================================
+
+TEST_CASE("BuildCache keys depend on input and settings",
+          "[build_system][cache]") {
+  std::vector<u8> a = {1, 2, 3};
+  std::vector<u8> b = {1, 2, 4};
+  auto digestA = BuildSystem::calculateSha256(a.data(), a.size());
+  auto digestB = BuildSystem::calculateSha256(b.data(), b.size());
+
+  std::string key = BuildCache::makeKey(digestA, "zlib|level=2");
+  REQUIRE(key.size() == 64);
+  REQUIRE(key == BuildCache::makeKey(digestA, "zlib|level=2"));
+  REQUIRE(key != BuildCache::makeKey(digestA, "zlib|level=3"));
+  REQUIRE(key != BuildCache::makeKey(digestB, "zlib|level=2"));
+}
+
+TEST_CASE("BuildCache stores and restores objects", "[build_system][cache]") {
+  std::string tempDir = createTempDir();
+  std::string cacheDir = tempDir + "/cache";
+
+  BuildCache cache;
+  REQUIRE_FALSE(cache.isOpen());
+  REQUIRE(cache.open(cacheDir).isOk());
+  REQUIRE(cache.isOpen());
+
+  std::vector<u8> payload = {'n', 'm', 'c', 0, 1, 2};
+  auto digest = BuildSystem::calculateSha256(payload.data(), payload.size());
+  std::string key = BuildCache::makeKey(digest, "test");
+
+  SECTION("Store, load and restore round trip") {
+    REQUIRE_FALSE(cache.contains(key));
+    REQUIRE(cache.store(key, payload).isOk());
+    REQUIRE(cache.contains(key));
+
+    auto loaded = cache.load(key);
+    REQUIRE(loaded.isOk());
+    REQUIRE(loaded.value() == payload);
+
+    std::string restored = tempDir + "/restored.bin";
+    REQUIRE(cache.restore(key, restored).isOk());
+    REQUIRE(fs::file_size(restored) == payload.size());
+  }
+
+  SECTION("Objects survive reopening the cache") {
+    REQUIRE(cache.store(key, payload).isOk());
+    REQUIRE(cache.close().isOk());
+    REQUIRE_FALSE(cache.contains(key));
+
+    REQUIRE(cache.open(cacheDir).isOk());
+    REQUIRE(cache.contains(key));
+  }
+
+  SECTION("File hashes match the file contents") {
+    std::string source = tempDir + "/asset.bin";
+    {
+      std::ofstream file(source, std::ios::binary);
+      file.write(reinterpret_cast<const char *>(payload.data()),
+                 static_cast<std::streamsize>(payload.size()));
+    }
+
+    auto hashed = cache.hashFile(source);
+    REQUIRE(hashed.isOk());
+    REQUIRE(hashed.value() == digest);
+    REQUIRE(cache.hashFile(tempDir + "/missing.bin").isError());
+  }
+
+  SECTION("Prune drops objects until the store fits") {
+    std::vector<u8> big(4096, 0xAB);
+    REQUIRE(cache.store(key, payload).isOk());
+    REQUIRE(cache.store(BuildCache::makeKey(digest, "big"), big).isOk());
+
+    auto removed = cache.prune(payload.size() + big.size());
+    REQUIRE(removed.isOk());
+    REQUIRE(removed.value() == 0);
+
+    removed = cache.prune(1);
+    REQUIRE(removed.isOk());
+    REQUIRE(removed.value() == payload.size() + big.size());
+    REQUIRE_FALSE(cache.contains(key));
+  }
+
+  REQUIRE(cache.close().isOk());
+  cleanupTempDir(tempDir);
+}
@@ -0,0 +1,179 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/scripting/bytecode_file.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include "NovelMind/scripting/vm.hpp"
+#include <cstring>
+#include <filesystem>
+
+using namespace NovelMind::scripting;
+namespace fs = std::filesystem;
+
+namespace {
+
+const char *BYTECODE_SCRIPT = R"(
+character hero(name="Alex", color="#ff0000")
+
+scene start {
+    set gold = 5 * 4
+    if gold > 10 {
+        set rich = true
+    }
+    hero "Hello"
+    goto finale
+}
+
+scene finale {
+    set ending = "good"
+}
+)";
+
+CompiledScript compileSource(const std::string &source)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+
+    Parser parser;
+    auto parsed = parser.parse(tokens.value());
+    REQUIRE(parsed.isOk());
+
+    Compiler compiler;
+    auto compiled = compiler.compile(parsed.value(), "story.nms");
+    REQUIRE(compiled.isOk());
+    return compiled.value();
+}
+
+} // namespace
+
+TEST_CASE("Bytecode image round-trips a compiled script", "[scripting][bytecode]")
+{
+    auto script = compileSource(BYTECODE_SCRIPT);
+    auto bytes = serializeBytecode(script);
+
+    REQUIRE(BytecodeImage::hasMagic(bytes));
+    auto image = BytecodeImage::fromMemory(bytes);
+    REQUIRE(image.isOk());
+    REQUIRE(image.value().hasDebugInfo());
+
+    auto loaded = image.value().toCompiledScript();
+    REQUIRE(loaded.instructions.size() == script.instructions.size());
+    for (size_t i = 0; i < script.instructions.size(); ++i) {
+        REQUIRE(loaded.instructions[i].opcode == script.instructions[i].opcode);
+        REQUIRE(loaded.instructions[i].operand == script.instructions[i].operand);
+    }
+    REQUIRE(loaded.stringTable == script.stringTable);
+    REQUIRE(loaded.sceneEntryPoints == script.sceneEntryPoints);
+    REQUIRE(loaded.characters.size() == 1);
+    REQUIRE(loaded.characters["hero"].displayName == "Alex");
+    REQUIRE(loaded.characters["hero"].color == "#ff0000");
+
+    REQUIRE(loaded.sourceMappings.size() == script.sourceMappings.size());
+    for (const auto &[ip, loc] : script.sourceMappings) {
+        REQUIRE(loaded.sourceMappings[ip].line == loc.line);
+        REQUIRE(loaded.sourceMappings[ip].filePath == loc.filePath);
+    }
+}
+
+TEST_CASE("Bytecode image can omit debug info", "[scripting][bytecode]")
+{
+    auto script = compileSource(BYTECODE_SCRIPT);
+    auto full = serializeBytecode(script, true);
+    auto stripped = serializeBytecode(script, false);
+
+    REQUIRE(stripped.size() < full.size());
+    auto image = BytecodeImage::fromMemory(stripped);
+    REQUIRE(image.isOk());
+    REQUIRE_FALSE(image.value().hasDebugInfo());
+    REQUIRE(image.value().metadata().sourceMappings.empty());
+}
+
+TEST_CASE("Bytecode image rejects malformed data", "[scripting][bytecode]")
+{
+    auto bytes = serializeBytecode(compileSource(BYTECODE_SCRIPT));
+
+    SECTION("bad magic")
+    {
+        auto corrupt = bytes;
+        corrupt[0] = 'X';
+        REQUIRE(BytecodeImage::fromMemory(corrupt).isError());
+    }
+
+    SECTION("truncated file")
+    {
+        std::vector<NovelMind::u8> truncated(bytes.begin(),
+                                             bytes.begin() + static_cast<long>(bytes.size() / 2));
+        REQUIRE(BytecodeImage::fromMemory(truncated).isError());
+    }
+
+    SECTION("unsupported version")
+    {
+        auto corrupt = bytes;
+        corrupt[4] = 0x7F;
+        REQUIRE(BytecodeImage::fromMemory(corrupt).isError());
+    }
+
+    SECTION("string reference out of bounds")
+    {
+        auto corrupt = bytes;
+        bytecode::FileHeader header;
+        std::memcpy(&header, corrupt.data(), sizeof(header));
+        REQUIRE(header.stringCount > 0);
+        bytecode::StringRef ref{0, 0xFFFFFF};
+        std::memcpy(corrupt.data() + header.stringOffset, &ref, sizeof(ref));
+        REQUIRE(BytecodeImage::fromMemory(corrupt).isError());
+    }
+
+    SECTION("empty buffer")
+    {
+        REQUIRE(BytecodeImage::fromMemory({}).isError());
+    }
+}
+
+TEST_CASE("VM executes a mapped bytecode file in place", "[scripting][bytecode]")
+{
+    auto script = compileSource(BYTECODE_SCRIPT);
+    const std::string path =
+        (fs::temp_directory_path() / "nm_bytecode_test.nmc").string();
+    REQUIRE(writeBytecodeFile(script, path).isOk());
+
+    auto opened = BytecodeImage::open(path);
+    REQUIRE(opened.isOk());
+    REQUIRE(opened.value().isMapped());
+    auto image = std::make_shared<const BytecodeImage>(std::move(opened).value());
+
+    // The VM's program must be the image's instruction stream, not a copy
+    REQUIRE(image->instructions().size() == script.instructions.size());
+
+    VirtualMachine fromImage;
+    REQUIRE(fromImage.load(image).isOk());
+    fromImage.setIP(image->metadata().sceneEntryPoints["finale"]);
+    fromImage.run();
+
+    VirtualMachine fromVector;
+    REQUIRE(fromVector.load(script.instructions, script.stringTable).isOk());
+    fromVector.setIP(script.sceneEntryPoints["finale"]);
+    fromVector.run();
+
+    REQUIRE(fromImage.isHalted());
+    REQUIRE(fromImage.getAllVariables() == fromVector.getAllVariables());
+    REQUIRE(std::get<std::string>(fromImage.getVariable("ending")) == "good");
+
+    SECTION("ScriptRuntime loads scenes and characters from the image")
+    {
+        ScriptRuntime runtime;
+        REQUIRE(runtime.load(image).isOk());
+        REQUIRE(runtime.gotoScene("finale").isOk());
+        REQUIRE(runtime.gotoScene("missing").isError());
+    }
+
+    fs::remove(path);
+}
+
+TEST_CASE("Bytecode image open reports missing files", "[scripting][bytecode]")
+{
+    auto image = BytecodeImage::open(
+        (fs::temp_directory_path() / "nm_bytecode_does_not_exist.nmc").string());
+    REQUIRE(image.isError());
+}
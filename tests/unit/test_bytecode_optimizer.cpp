@@ -0,0 +1,205 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/scripting/bytecode_optimizer.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/vm.hpp"
+
+using namespace NovelMind::scripting;
+
+namespace {
+
+CompiledScript makeScript(std::vector<Instruction> instructions)
+{
+    CompiledScript script;
+    script.instructions = std::move(instructions);
+    return script;
+}
+
+std::vector<OpCode> opcodesOf(const CompiledScript &script)
+{
+    std::vector<OpCode> ops;
+    for (const auto &instr : script.instructions) {
+        ops.push_back(instr.opcode);
+    }
+    return ops;
+}
+
+CompiledScript compileSource(const std::string &source, bool optimize)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+
+    Parser parser;
+    auto parsed = parser.parse(tokens.value());
+    REQUIRE(parsed.isOk());
+
+    Compiler compiler;
+    compiler.setOptimizationEnabled(optimize);
+    auto compiled = compiler.compile(parsed.value());
+    REQUIRE(compiled.isOk());
+    return compiled.value();
+}
+
+} // namespace
+
+TEST_CASE("Optimizer folds constant expressions", "[scripting][optimizer]")
+{
+    auto script = makeScript({
+        {OpCode::PUSH_INT, 2},
+        {OpCode::PUSH_INT, 3},
+        {OpCode::MUL, 0},
+        {OpCode::PUSH_INT, 4},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::HALT, 0}
+    });
+
+    BytecodeOptimizer optimizer;
+    auto stats = optimizer.optimize(script);
+
+    REQUIRE(opcodesOf(script) ==
+            std::vector<OpCode>{OpCode::PUSH_INT, OpCode::STORE_VAR, OpCode::HALT});
+    REQUIRE(script.instructions[0].operand == 10);
+    REQUIRE(stats.constantsFolded == 2);
+    REQUIRE(stats.instructionsBefore == 7);
+    REQUIRE(stats.instructionsAfter == 3);
+}
+
+TEST_CASE("Optimizer leaves runtime errors to the VM", "[scripting][optimizer]")
+{
+    auto script = makeScript({
+        {OpCode::PUSH_INT, 1},
+        {OpCode::PUSH_INT, 0},
+        {OpCode::DIV, 0},
+        {OpCode::PUSH_INT, 0x7FFFFFFF},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::ADD, 0},
+        {OpCode::HALT, 0}
+    });
+
+    BytecodeOptimizer optimizer;
+    auto stats = optimizer.optimize(script);
+
+    REQUIRE(script.instructions.size() == 7);
+    REQUIRE(stats.constantsFolded == 0);
+}
+
+TEST_CASE("Optimizer inverts negated branches", "[scripting][optimizer]")
+{
+    auto script = makeScript({
+        {OpCode::LOAD_VAR, 0},
+        {OpCode::NOT, 0},
+        {OpCode::JUMP_IF, 5},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::STORE_VAR, 1},
+        {OpCode::HALT, 0}
+    });
+
+    BytecodeOptimizer optimizer;
+    optimizer.optimize(script);
+
+    REQUIRE(script.instructions.size() == 5);
+    REQUIRE(script.instructions[1].opcode == OpCode::JUMP_IF_NOT);
+    REQUIRE(script.instructions[1].operand == 4);
+    REQUIRE(script.instructions[4].opcode == OpCode::HALT);
+}
+
+TEST_CASE("Optimizer threads jumps and drops unreachable code",
+          "[scripting][optimizer]")
+{
+    auto script = makeScript({
+        {OpCode::JUMP, 2},
+        {OpCode::PUSH_INT, 9},
+        {OpCode::JUMP, 4},
+        {OpCode::NOP, 0},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::HALT, 0}
+    });
+
+    BytecodeOptimizer optimizer;
+    auto stats = optimizer.optimize(script);
+
+    REQUIRE(opcodesOf(script) ==
+            std::vector<OpCode>{OpCode::PUSH_INT, OpCode::STORE_VAR, OpCode::HALT});
+    REQUIRE(stats.jumpsThreaded >= 1);
+    REQUIRE(stats.deadInstructionsRemoved >= 1);
+}
+
+TEST_CASE("Optimizer remaps scenes, scene jumps and source mappings",
+          "[scripting][optimizer]")
+{
+    auto script = makeScript({
+        {OpCode::PUSH_INT, 1},
+        {OpCode::PUSH_INT, 2},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::GOTO_SCENE, 6},
+        {OpCode::HALT, 0},
+        {OpCode::PUSH_INT, 5},
+        {OpCode::HALT, 0}
+    });
+    script.sceneEntryPoints["start"] = 0;
+    script.sceneEntryPoints["second"] = 6;
+    script.sourceMappings[0] = DebugSourceLocation("a.nms", 1, 1);
+    script.sourceMappings[2] = DebugSourceLocation("a.nms", 1, 9);
+    script.sourceMappings[4] = DebugSourceLocation("a.nms", 2, 1);
+    script.sourceMappings[6] = DebugSourceLocation("a.nms", 5, 1);
+
+    BytecodeOptimizer optimizer;
+    optimizer.optimize(script);
+
+    REQUIRE(script.instructions.size() == 6);
+    REQUIRE(script.instructions[0].operand == 3);
+    REQUIRE(script.instructions[2].opcode == OpCode::GOTO_SCENE);
+    REQUIRE(script.instructions[2].operand == 4);
+    REQUIRE(script.sceneEntryPoints["start"] == 0);
+    REQUIRE(script.sceneEntryPoints["second"] == 4);
+
+    REQUIRE(script.sourceMappings.size() == 3);
+    REQUIRE(script.sourceMappings[0].line == 1);
+    REQUIRE(script.sourceMappings[0].column == 1);
+    REQUIRE(script.sourceMappings[2].line == 2);
+    REQUIRE(script.sourceMappings[4].line == 5);
+}
+
+TEST_CASE("Optimized scripts behave like unoptimized ones",
+          "[scripting][optimizer]")
+{
+    const std::string source = R"(
+scene start {
+    set x = 2 * 3 + 1
+    set y = 0
+    if x > 5 {
+        set y = 1
+    }
+    if not false {
+        set z = 10 - 4
+    }
+    set i = 0
+    set i = i + 1
+    set i = i + 1
+    if i == 2 {
+        set total = i * 10
+    }
+}
+)";
+
+    auto plain = compileSource(source, false);
+    auto optimized = compileSource(source, true);
+    REQUIRE(optimized.instructions.size() < plain.instructions.size());
+
+    VirtualMachine a;
+    REQUIRE(a.load(plain.instructions, plain.stringTable).isOk());
+    a.run();
+
+    VirtualMachine b;
+    REQUIRE(b.load(optimized.instructions, optimized.stringTable).isOk());
+    b.run();
+
+    REQUIRE(a.isHalted());
+    REQUIRE(b.isHalted());
+    REQUIRE(a.getAllVariables() == b.getAllVariables());
+    REQUIRE(std::get<NovelMind::i32>(b.getVariable("z")) == 6);
+}
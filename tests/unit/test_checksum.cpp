@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/core/checksum.hpp"
+#include <cstring>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::core;
+
+namespace
+{
+
+const Crc32Kernel ALL_KERNELS[] = {Crc32Kernel::Bytewise, Crc32Kernel::Slicing16,
+                                   Crc32Kernel::Pclmul, Crc32Kernel::ArmCrc};
+
+std::vector<u8> testData(usize size)
+{
+    std::vector<u8> data(size);
+    u32 seed = 0xC0FFEE;
+    for (auto& byte : data) {
+        seed = seed * 1664525u + 1013904223u;
+        byte = static_cast<u8>(seed >> 24);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("crc32 matches the standard check values", "[checksum]")
+{
+    const char* check = "123456789";
+    REQUIRE(crc32(check, std::strlen(check)) == 0xCBF43926u);
+    REQUIRE(crc32(nullptr, 0) == 0u);
+
+    const char* fox = "The quick brown fox jumps over the lazy dog";
+    REQUIRE(crc32(fox, std::strlen(fox)) == 0x414FA339u);
+
+    for (auto kernel : ALL_KERNELS) {
+        INFO(crc32KernelName(kernel));
+        REQUIRE(crc32With(kernel, check, std::strlen(check)) == 0xCBF43926u);
+    }
+}
+
+TEST_CASE("crc32 kernels agree on every length and alignment", "[checksum]")
+{
+    const auto data = testData(4096 + 64);
+
+    for (auto kernel : ALL_KERNELS) {
+        if (!isCrc32KernelSupported(kernel)) {
+            continue;
+        }
+        INFO(crc32KernelName(kernel));
+        for (usize offset = 0; offset < 16; offset += 3) {
+            for (usize size : {usize{0}, usize{1}, usize{15}, usize{16}, usize{63}, usize{64},
+                               usize{65}, usize{127}, usize{200}, usize{1000}, usize{4096}}) {
+                INFO("offset " << offset << " size " << size);
+                REQUIRE(crc32With(kernel, data.data() + offset, size) ==
+                        crc32With(Crc32Kernel::Bytewise, data.data() + offset, size));
+            }
+        }
+    }
+}
+
+TEST_CASE("crc32 chains across split buffers", "[checksum]")
+{
+    const auto data = testData(10000);
+    const u32 whole = crc32(data.data(), data.size());
+
+    for (usize split : {usize{0}, usize{7}, usize{64}, usize{4099}, data.size()}) {
+        const u32 first = crc32(data.data(), split);
+        REQUIRE(crc32(data.data() + split, data.size() - split, first) == whole);
+    }
+}
+
+TEST_CASE("crc32 dispatches to a supported kernel", "[checksum]")
+{
+    REQUIRE(isCrc32KernelSupported(Crc32Kernel::Bytewise));
+    REQUIRE(isCrc32KernelSupported(Crc32Kernel::Slicing16));
+    REQUIRE(isCrc32KernelSupported(activeCrc32Kernel()));
+    REQUIRE(activeCrc32Kernel() != Crc32Kernel::Bytewise);
+    REQUIRE(std::strcmp(crc32KernelName(Crc32Kernel::Slicing16), "slicing-by-16") == 0);
+}
@@ -0,0 +1,241 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/renderer/glyph_cache.hpp"
+#include "NovelMind/renderer/software_renderer.hpp"
+#include "NovelMind/renderer/text_layout.hpp"
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+namespace
+{
+
+std::shared_ptr<Font> loadSystemFont(i32 size)
+{
+#if defined(_WIN32)
+    const std::string fontPath = "C:\\Windows\\Fonts\\segoeui.ttf";
+#elif defined(__APPLE__)
+    const std::string fontPath = "/System/Library/Fonts/Supplemental/Arial.ttf";
+#else
+    const std::string fontPath = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+#endif
+    std::ifstream file(fontPath, std::ios::binary);
+    const std::vector<u8> data{std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+    auto font = std::make_shared<Font>();
+    if (data.empty() || font->loadFromMemory(data, size).isError() ||
+        !font->getNativeHandle()) {
+        return nullptr;
+    }
+    return font;
+}
+
+} // namespace
+
+TEST_CASE("UTF-8 text decodes one code point at a time", "[renderer][glyph_cache]")
+{
+    const std::string text = "A\xD0\x96\xE6\xBC\xA2\xF0\x9F\x98\x80"; // A Ж 漢 😀
+    usize pos = 0;
+    REQUIRE(nextCodepoint(text, pos) == U'A');
+    REQUIRE(nextCodepoint(text, pos) == U'\u0416');
+    REQUIRE(nextCodepoint(text, pos) == U'\u6F22');
+    REQUIRE(nextCodepoint(text, pos) == U'\U0001F600');
+    REQUIRE(pos == text.size());
+    REQUIRE(countCodepoints(text) == 4);
+
+    SECTION("Malformed bytes decode to the replacement character")
+    {
+        const std::string bad = "\xFF\xD0"         // invalid lead, truncated
+                                "\xC0\xAF"         // overlong '/'
+                                "\xED\xA0\x80";    // surrogate
+        pos = 0;
+        REQUIRE(nextCodepoint(bad, pos) == 0xFFFD);
+        REQUIRE(pos == 1);
+        REQUIRE(nextCodepoint(bad, pos) == 0xFFFD);
+        REQUIRE(pos == 2);
+        REQUIRE(nextCodepoint(bad, pos) == 0xFFFD);
+        REQUIRE(nextCodepoint(bad, pos) == 0xFFFD);
+        REQUIRE(pos == bad.size());
+    }
+}
+
+TEST_CASE("Glyph cache rasterizes glyphs on first draw", "[renderer][glyph_cache]")
+{
+    auto font = loadSystemFont(24);
+    if (!font) {
+        WARN("System font unavailable, skipping glyph cache checks");
+        return;
+    }
+
+    GlyphCache cache(256);
+
+    SECTION("Metrics do not touch the pages")
+    {
+        const GlyphInfo* metrics = cache.getMetrics(*font, U'\u0416');
+        REQUIRE(metrics != nullptr);
+        REQUIRE(metrics->advanceX > 0.0f);
+        REQUIRE(cache.getStats().rasterized == 0);
+        REQUIRE(cache.getStats().pages == 0);
+        REQUIRE(cache.getLineHeight(*font) > 0.0f);
+    }
+
+    SECTION("Drawn glyphs are packed once and uploaded once")
+    {
+        const CachedGlyph* zhe = cache.getGlyph(*font, U'\u0416');
+        REQUIRE(zhe != nullptr);
+        REQUIRE(zhe->page != nullptr);
+        REQUIRE(zhe->info.width > 0.0f);
+        REQUIRE(zhe->info.uv.width > 0.0f);
+
+        const CachedGlyph* space = cache.getGlyph(*font, U' ');
+        REQUIRE(space != nullptr);
+        REQUIRE(space->page == nullptr);
+        REQUIRE(space->info.advanceX > 0.0f);
+
+        REQUIRE(cache.getGlyph(*font, U'\u0416') == zhe);
+        REQUIRE(cache.getGlyph(*font, U'A')->page == zhe->page);
+        GlyphCacheStats stats = cache.getStats();
+        REQUIRE(stats.pages == 1);
+        REQUIRE(stats.residentGlyphs == 2);
+        REQUIRE(stats.rasterized == 3);
+        REQUIRE(stats.uploads == 0);
+
+        cache.flushUploads();
+        cache.flushUploads();
+        REQUIRE(cache.getStats().uploads == 1);
+
+        // The uploaded region carries the coverage in the alpha channel
+        const auto pixels = zhe->page->getPixels();
+        REQUIRE(pixels.size() == 256u * 256u * 4u);
+        const usize px = static_cast<usize>(zhe->info.uv.x * 256.0f);
+        const usize py = static_cast<usize>(zhe->info.uv.y * 256.0f);
+        u32 coverage = 0;
+        for (usize y = py; y < py + static_cast<usize>(zhe->info.height); ++y) {
+            for (usize x = px; x < px + static_cast<usize>(zhe->info.width); ++x) {
+                coverage += pixels[(y * 256 + x) * 4 + 3];
+            }
+        }
+        REQUIRE(coverage > 0);
+    }
+
+    SECTION("Unloaded fonts are forgotten")
+    {
+        REQUIRE(cache.getGlyph(*font, U'B') != nullptr);
+        cache.releaseFont(*font);
+        REQUIRE(cache.getStats().residentGlyphs == 0);
+    }
+}
+
+TEST_CASE("Glyph cache evicts the least recently used page", "[renderer][glyph_cache]")
+{
+    auto font = loadSystemFont(40);
+    if (!font) {
+        WARN("System font unavailable, skipping glyph cache checks");
+        return;
+    }
+
+    // One 64x64 page holds only a few 40px glyphs
+    GlyphCache cache(64, 64 * 64 * 4);
+    const std::u32string alphabet = U"\u0410\u0411\u0412\u0413\u0414\u0415\u0416\u0417"
+                                    U"\u0418\u0419\u041A\u041B\u041C\u041D\u041E\u041F";
+
+    SECTION("Pages from earlier frames are recycled")
+    {
+        for (char32_t c : alphabet) {
+            REQUIRE(cache.getGlyph(*font, c) != nullptr);
+            cache.flushUploads();
+            cache.endFrame();
+        }
+        const GlyphCacheStats stats = cache.getStats();
+        REQUIRE(stats.pages == 1);
+        REQUIRE(stats.evictedPages > 0);
+        REQUIRE(cache.getMemoryUsage() <= cache.getMemoryBudget());
+
+        // The evicted glyph comes back when drawn again
+        const CachedGlyph* first = cache.getGlyph(*font, alphabet[0]);
+        REQUIRE(first->page != nullptr);
+        REQUIRE(cache.getStats().rasterized == stats.rasterized + 1);
+    }
+
+    SECTION("Pages in use this frame are kept until the frame ends")
+    {
+        std::vector<const Texture*> pages;
+        for (char32_t c : alphabet) {
+            const CachedGlyph* glyph = cache.getGlyph(*font, c);
+            REQUIRE(glyph->page != nullptr);
+            pages.push_back(glyph->page);
+        }
+        REQUIRE(cache.getStats().pages > 1);
+        REQUIRE(cache.getStats().evictedPages == 0);
+        REQUIRE(cache.getStats().residentGlyphs == alphabet.size());
+
+        cache.endFrame();
+        REQUIRE(cache.getStats().pages == 1);
+    }
+}
+
+TEST_CASE("Text layout measures UTF-8 through the glyph cache", "[renderer][glyph_cache]")
+{
+    TextStyle style;
+    style.size = 10.0f;
+
+    SECTION("Ideographs wrap without spaces")
+    {
+        TextLayoutEngine engine;
+        engine.setMaxWidth(35.0f);
+        engine.setDefaultStyle(style);
+        const TextLayout layout =
+            engine.layout("\xE6\xBC\xA2\xE5\xAD\x97\xE6\xBC\xA2\xE5\xAD\x97\xE6\xBC\xA2\xE5\xAD\x97");
+        REQUIRE(layout.totalCharacters == 6);
+        REQUIRE(layout.lines.size() == 2);
+        REQUIRE(layout.lines[0].width == 30.0f);
+    }
+
+    auto font = loadSystemFont(24);
+    if (!font) {
+        WARN("System font unavailable, skipping glyph cache checks");
+        return;
+    }
+
+    SECTION("Cyrillic words use the cached advances")
+    {
+        auto cache = std::make_shared<GlyphCache>(256);
+        TextLayoutEngine engine;
+        engine.setFont(font);
+        engine.setGlyphCache(cache);
+        engine.setDefaultStyle(style);
+
+        const TextLayout layout = engine.layout("\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82"); // Привет
+        REQUIRE(layout.totalCharacters == 6);
+        REQUIRE(layout.lines.size() == 1);
+
+        f32 expected = 0.0f;
+        for (char32_t c : std::u32string(U"\u041F\u0440\u0438\u0432\u0435\u0442")) {
+            expected += cache->getMetrics(*font, c)->advanceX;
+        }
+        REQUIRE(layout.totalWidth == expected);
+        REQUIRE(cache->getStats().rasterized == 0);
+    }
+
+    SECTION("The software renderer draws glyphs outside the ASCII range")
+    {
+        SoftwareRenderer renderer;
+        REQUIRE(renderer.initialize(64, 48).isOk());
+        renderer.clear(Color::Black);
+        renderer.drawText(*font, "\xD0\x96", 8, 4, Color(0, 255, 0)); // Ж
+        renderer.endFrame();
+
+        int lit = 0;
+        for (i32 y = 0; y < 48; ++y) {
+            for (i32 x = 0; x < 64; ++x) {
+                lit += renderer.getPixel(x, y).g > 0 ? 1 : 0;
+            }
+        }
+        REQUIRE(lit > 20);
+        REQUIRE(renderer.getGlyphCache()->getStats().uploads == 1);
+        REQUIRE(renderer.getBatchStats().drawCalls == 1);
+    }
+}
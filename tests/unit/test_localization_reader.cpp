@@ -0,0 +1,167 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/localization/localization_reader.hpp"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace NovelMind::localization;
+
+TEST_CASE("readJSON loads flat, nested and plural strings", "[localization]")
+{
+    StringTable table(LocaleId("en"));
+    const std::string json = R"({
+        "greeting": "Hello!",
+        "quote": "She said \"hi\"\nand left",
+        "unicode": "café 😀",
+        "menu": { "start": "Start", "load": { "title": "Load game" } },
+        "apples": { "one": "{count} apple", "other": "{count} apples" },
+        "version": 3, "enabled": true, "unused": null, "list": ["a", {"b": "c"}]
+    })";
+
+    REQUIRE(readJSON(json, table).isOk());
+    REQUIRE(table.getString("greeting") == "Hello!");
+    REQUIRE(table.getString("quote") == "She said \"hi\"\nand left");
+    REQUIRE(table.getString("unicode") == "caf\xC3\xA9 \xF0\x9F\x98\x80");
+    REQUIRE(table.getString("menu.start") == "Start");
+    REQUIRE(table.getString("menu.load.title") == "Load game");
+    REQUIRE(table.getPluralString("apples", 1) == "{count} apple");
+    REQUIRE(table.getPluralString("apples", 5) == "{count} apples");
+    REQUIRE_FALSE(table.hasString("version"));
+    REQUIRE_FALSE(table.hasString("b"));
+    REQUIRE(table.size() == 6);
+}
+
+TEST_CASE("readJSON reports malformed input with a line number", "[localization]")
+{
+    StringTable table;
+
+    auto result = readJSON("{\n  \"a\": \"1\",\n  \"b\" \"2\"\n}", table);
+    REQUIRE(result.isError());
+    REQUIRE(result.error().find("line 3") != std::string::npos);
+
+    REQUIRE(readJSON("[\"not an object\"]", table).isError());
+    REQUIRE(readJSON("{\"a\": \"unterminated}", table).isError());
+    REQUIRE(readJSON("{\"a\": \"bad \\q escape\"}", table).isError());
+
+    std::string deep;
+    for (int i = 0; i < 100; ++i) {
+        deep += "{\"a\": ";
+    }
+    deep += "\"x\"" + std::string(100, '}');
+    REQUIRE(readJSON(deep, table).isError());
+}
+
+TEST_CASE("readJSON reads a top-level strings object without a prefix", "[localization]")
+{
+    StringTable table;
+    const std::string json = R"({
+        "language": "en",
+        "strings": {
+            "menu.start": "Start",
+            "dialog": { "continue": "Click to continue..." }
+        }
+    })";
+
+    REQUIRE(readJSON(json, table).isOk());
+    REQUIRE(table.getString("menu.start") == "Start");
+    REQUIRE(table.getString("dialog.continue") == "Click to continue...");
+    REQUIRE_FALSE(table.hasString("strings.menu.start"));
+}
+
+TEST_CASE("readCSV handles quoting and line endings", "[localization]")
+{
+    StringTable table;
+    const std::string csv = "\xEF\xBB\xBFID,Text,Notes\r\n"
+                            "plain,Hello,ignored\r\n"
+                            "\"quoted\",\"Hello, \"\"world\"\"\"\r\n"
+                            "\n"
+                            "multiline,\"first\nsecond\"\n"
+                            "last,no newline";
+
+    REQUIRE(readCSV(csv, table).isOk());
+    REQUIRE(table.size() == 4);
+    REQUIRE(table.getString("plain") == "Hello");
+    REQUIRE(table.getString("quoted") == "Hello, \"world\"");
+    REQUIRE(table.getString("multiline") == "first\nsecond");
+    REQUIRE(table.getString("last") == "no newline");
+
+    REQUIRE(readCSV("ID,Text\nbroken,\"never closed\n", table).isError());
+}
+
+TEST_CASE("readCSV keeps commas in unquoted two-column text", "[localization]")
+{
+    StringTable table;
+    REQUIRE(readCSV("ID,Text\n"
+                    "greeting,Hello, world\r\n"
+                    "quoted,\"Hi, there\"\n",
+                    table)
+                .isOk());
+    REQUIRE(table.getString("greeting") == "Hello, world");
+    REQUIRE(table.getString("quoted") == "Hi, there");
+
+    // Extra columns are only split off when the header declares them
+    StringTable withNotes;
+    REQUIRE(readCSV("ID,Text,Notes\ngreeting,Hello, world\n", withNotes).isOk());
+    REQUIRE(withNotes.getString("greeting") == "Hello");
+}
+
+TEST_CASE("readPO handles continuations, escapes and contexts", "[localization]")
+{
+    StringTable table;
+    const std::string po = "# Header\n"
+                           "msgid \"\"\n"
+                           "msgstr \"Content-Type: text/plain; charset=UTF-8\\n\"\n"
+                           "\n"
+                           "msgid \"greeting\"\n"
+                           "msgstr \"Hello, \"\n"
+                           "\"\\\"friend\\\"\"\n"
+                           "\n"
+                           "msgctxt \"menu\"\n"
+                           "msgid \"start\"\n"
+                           "msgstr \"Start\\tgame\"\n"
+                           "\n"
+                           "msgid \"apple\"\n"
+                           "msgid_plural \"apples\"\n"
+                           "msgstr[0] \"one apple\"\n"
+                           "msgstr[1] \"many apples\"\n"
+                           "\n"
+                           "msgid \"untranslated\"\n"
+                           "msgstr \"\"\n";
+
+    REQUIRE(readPO(po, table).isOk());
+    REQUIRE(table.size() == 3);
+    REQUIRE(table.getString("greeting") == "Hello, \"friend\"");
+    REQUIRE(table.getString("start") == "Start\tgame");
+    REQUIRE(table.getString("apple") == "one apple");
+    REQUIRE_FALSE(table.hasString("untranslated"));
+
+    REQUIRE(readPO("msgid \"a\"\nmsgstr unquoted\n", table).isError());
+}
+
+TEST_CASE("LocalizationManager loads mapped files", "[localization]")
+{
+    const auto path =
+        (std::filesystem::temp_directory_path() / "novelmind_loc_test.json").string();
+    {
+        std::ofstream file(path);
+        file << R"({"title": "NovelMind", "menu": {"quit": "Quit"}})";
+    }
+
+    LocalizationManager manager;
+    REQUIRE(manager.loadStrings(LocaleId("en"), path, LocalizationFormat::JSON).isOk());
+    REQUIRE(manager.get("title") == "NovelMind");
+    REQUIRE(manager.get("menu.quit") == "Quit");
+
+    // Merging keeps existing strings
+    {
+        std::ofstream file(path);
+        file << R"({"extra": "More"})";
+    }
+    REQUIRE(manager.mergeStrings(LocaleId("en"), path, LocalizationFormat::JSON).isOk());
+    REQUIRE(manager.get("title") == "NovelMind");
+    REQUIRE(manager.get("extra") == "More");
+
+    std::filesystem::remove(path);
+    REQUIRE(manager.loadStrings(LocaleId("en"), path, LocalizationFormat::JSON).isError());
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/core/logger.hpp"
+#include "NovelMind/core/types.hpp"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NovelMind::core;
+using NovelMind::usize;
+
+namespace {
+
+/// Silences the console and restores the logger defaults afterwards
+struct LoggerGuard {
+    LoggerGuard()
+    {
+        Logger::instance().setConsoleOutput(false);
+    }
+
+    ~LoggerGuard()
+    {
+        auto &logger = Logger::instance();
+        logger.flush();
+        logger.clearLogCallbacks();
+        logger.setConsoleOutput(true);
+        logger.setLevel(LogLevel::Info);
+    }
+};
+
+} // namespace
+
+TEST_CASE("Logger macros skip arguments of filtered levels", "[logger]")
+{
+    LoggerGuard guard;
+    auto &logger = Logger::instance();
+    logger.setLevel(LogLevel::Warning);
+
+    int evaluated = 0;
+    auto message = [&evaluated]() {
+        ++evaluated;
+        return std::string("logger test message");
+    };
+
+    NOVELMIND_LOG_DEBUG(message());
+    NOVELMIND_LOG_INFO(message());
+    REQUIRE(evaluated == 0);
+
+    NOVELMIND_LOG_WARN(message());
+    REQUIRE(evaluated == 1);
+
+    logger.setLevel(LogLevel::Off);
+    NOVELMIND_LOG_FATAL(message());
+    REQUIRE(evaluated == 1);
+    REQUIRE_FALSE(logger.isEnabled(LogLevel::Fatal));
+}
+
+TEST_CASE("Logger delivers queued messages from every thread", "[logger]")
+{
+    LoggerGuard guard;
+    auto &logger = Logger::instance();
+    logger.setLevel(LogLevel::Trace);
+
+    std::mutex mutex;
+    std::vector<std::string> received;
+    logger.addLogCallback([&](LogLevel, const std::string &message) {
+        std::lock_guard<std::mutex> lock(mutex);
+        received.push_back(message);
+    });
+
+    // More messages than one ring holds, so producers must wait for the writer
+    constexpr usize THREADS = 4;
+    constexpr usize MESSAGES = 1500;
+    std::vector<std::thread> threads;
+    for (usize t = 0; t < THREADS; ++t) {
+        threads.emplace_back([t] {
+            for (usize i = 0; i < MESSAGES; ++i) {
+                NOVELMIND_LOG_TRACE("t" + std::to_string(t) + ":" + std::to_string(i));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    REQUIRE(received.size() == THREADS * MESSAGES);
+
+    // Messages of one thread keep their order
+    std::vector<usize> next(THREADS, 0);
+    bool ordered = true;
+    for (const auto &message : received) {
+        const auto colon = message.find(':');
+        const usize t = std::stoul(message.substr(1, colon - 1));
+        const usize i = std::stoul(message.substr(colon + 1));
+        ordered = ordered && i == next[t];
+        next[t] = i + 1;
+    }
+    REQUIRE(ordered);
+}
+
+TEST_CASE("Logger flushes fatal messages before returning", "[logger]")
+{
+    LoggerGuard guard;
+    auto &logger = Logger::instance();
+
+    std::atomic<int> fatals{0};
+    logger.addLogCallback([&fatals](LogLevel level, const std::string &) {
+        if (level == LogLevel::Fatal) {
+            ++fatals;
+        }
+    });
+
+    NOVELMIND_LOG_FATAL("logger test fatal");
+    REQUIRE(fatals == 1);
+}
+
+TEST_CASE("Logger writes batches to the output file", "[logger]")
+{
+    LoggerGuard guard;
+    auto &logger = Logger::instance();
+    const auto path =
+        (std::filesystem::temp_directory_path() / "novelmind_logger_test.log").string();
+    std::filesystem::remove(path);
+
+    logger.setOutputFile(path);
+    logger.info("first {}", 1);
+    logger.warning("second");
+    logger.closeOutputFile();
+
+    std::ifstream file(path);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text = buffer.str();
+
+    const auto first = text.find("[INFO ] first 1");
+    const auto second = text.find("[WARN ] second");
+    REQUIRE(first != std::string::npos);
+    REQUIRE(second != std::string::npos);
+    REQUIRE(first < second);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,288 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/multi_pack_manager.hpp"
+#include "NovelMind/vfs/pack_security.hpp"
+#include "NovelMind/vfs/resource_index.hpp"
+#include "NovelMind/vfs/secure_pack_reader.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+namespace
+{
+
+// Writes an unencrypted, uncompressed, unsigned pack in the format
+// SecurePackReader expects.
+void writeTestPack(const std::string& path,
+                   const std::vector<std::pair<std::string, std::string>>& resources)
+{
+    constexpr u64 headerSize = 64;
+    constexpr u64 entrySize = 48;
+
+    std::vector<u8> strings;
+    std::vector<u32> stringOffsets;
+    for (const auto& [id, data] : resources) {
+        stringOffsets.push_back(static_cast<u32>(strings.size()));
+        strings.insert(strings.end(), id.begin(), id.end());
+        strings.push_back(0);
+    }
+
+    const u64 tableOffset = headerSize;
+    const u64 stringTableOffset = tableOffset + entrySize * resources.size();
+    const u64 dataOffset =
+        stringTableOffset + sizeof(u32) + sizeof(u32) * stringOffsets.size() + strings.size();
+
+    std::vector<u8> file(dataOffset);
+    auto put = [&file](u64 offset, const auto& value) {
+        std::memcpy(file.data() + offset, &value, sizeof(value));
+    };
+
+    put(0, u32{0x53524D4E}); // "NMRS"
+    put(4, u16{1});
+    put(6, u16{0});
+    put(8, u32{0});
+    put(12, static_cast<u32>(resources.size()));
+    put(16, tableOffset);
+    put(24, stringTableOffset);
+    put(32, dataOffset);
+
+    u64 dataCursor = 0;
+    for (size_t i = 0; i < resources.size(); ++i) {
+        const std::string& data = resources[i].second;
+        const u64 entry = tableOffset + entrySize * i;
+        put(entry + 0, static_cast<u32>(i));
+        put(entry + 4, u32{0});
+        put(entry + 8, dataCursor);
+        put(entry + 16, static_cast<u64>(data.size()));
+        put(entry + 24, static_cast<u64>(data.size()));
+        put(entry + 32, u32{0});
+        put(entry + 36, NovelMind::VFS::PackIntegrityChecker::calculateCrc32(
+                            reinterpret_cast<const u8*>(data.data()), data.size()));
+        dataCursor += data.size();
+    }
+
+    put(stringTableOffset, static_cast<u32>(stringOffsets.size()));
+    for (size_t i = 0; i < stringOffsets.size(); ++i) {
+        put(stringTableOffset + sizeof(u32) * (i + 1), stringOffsets[i]);
+    }
+    std::memcpy(file.data() + dataOffset - strings.size(), strings.data(), strings.size());
+
+    const u32 tablesCrc = NovelMind::VFS::PackIntegrityChecker::calculateCrc32(file.data(), file.size());
+    for (const auto& [id, data] : resources) {
+        file.insert(file.end(), data.begin(), data.end());
+    }
+
+    std::vector<u8> footer(32, 0);
+    const u32 footerMagic = 0x46524D4E; // "NMRF"
+    std::memcpy(footer.data(), &footerMagic, sizeof(footerMagic));
+    std::memcpy(footer.data() + 4, &tablesCrc, sizeof(tablesCrc));
+    file.insert(file.end(), footer.begin(), footer.end());
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+}
+
+std::string readText(MultiPackManager& manager, const std::string& id)
+{
+    auto data = manager.readResource(id);
+    REQUIRE(data.isOk());
+    return std::string(data.value().begin(), data.value().end());
+}
+
+struct TestPacks
+{
+    std::filesystem::path dir =
+        std::filesystem::temp_directory_path() / "novelmind_multipack_test";
+
+    TestPacks()
+    {
+        std::filesystem::create_directories(dir);
+        writeTestPack(path("base_game"), {{"ui/logo.png", "base logo"},
+                                          {"scripts/main.nmbc", "base script"},
+                                          {"locales/en.json", "base en"}});
+        writeTestPack(path("patch_1"), {{"scripts/main.nmbc", "patched script"}});
+        writeTestPack(path("mod_a"), {{"ui/logo.png", "mod a logo"}, {"mod/a.txt", "a"}});
+        writeTestPack(path("mod_b"), {{"ui/logo.png", "mod b logo"}});
+    }
+
+    ~TestPacks() { std::filesystem::remove_all(dir); }
+
+    [[nodiscard]] std::string path(const std::string& name) const
+    {
+        return (dir / (name + ".nmres")).string();
+    }
+};
+
+} // namespace
+
+TEST_CASE("ResourceIndex interns paths and tracks providers", "[vfs][multipack]")
+{
+    ResourceIndex index;
+    REQUIRE(index.find("a") == ResourceIndex::NO_PATH);
+
+    std::vector<ResourceIndex::PathId> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ids.push_back(index.intern("sprites/frame_" + std::to_string(i) + ".png"));
+    }
+    REQUIRE(index.pathCount() == 1000);
+    REQUIRE(index.intern("sprites/frame_7.png") == ids[7]);
+    REQUIRE(index.find("sprites/frame_999.png") == ids[999]);
+    REQUIRE(index.path(ids[42]) == "sprites/frame_42.png");
+    REQUIRE(index.find("sprites/frame_1000.png") == ResourceIndex::NO_PATH);
+
+    REQUIRE(index.provider("sprites/frame_1.png") == ResourceIndex::NO_PACK);
+    index.setProvider(ids[1], 3);
+    index.setProvider(ids[2], 4);
+    index.setProvider(ids[2], 5);
+    REQUIRE(index.provider("sprites/frame_1.png") == 3);
+    REQUIRE(index.provider(ids[2]) == 5);
+    REQUIRE(index.resolvedCount() == 2);
+    index.setProvider(ids[1], ResourceIndex::NO_PACK);
+    REQUIRE(index.resolvedCount() == 1);
+
+    index.clearProviders();
+    REQUIRE(index.resolvedCount() == 0);
+    REQUIRE(index.pathCount() == 1000);
+
+    index.clear();
+    REQUIRE(index.find("sprites/frame_7.png") == ResourceIndex::NO_PATH);
+}
+
+TEST_CASE("SecurePackFileSystem batches reads and verifies each resource", "[vfs][multipack]")
+{
+    TestPacks packs;
+    SecurePackFileSystem fs;
+    REQUIRE(fs.readFiles({"ui/logo.png"})[0].isError());
+    REQUIRE(fs.mount(packs.path("base_game")).isOk());
+
+    const std::vector<std::string> ids = {"locales/en.json", "missing", "ui/logo.png",
+                                          "scripts/main.nmbc", "ui/logo.png"};
+    auto results = fs.readFiles(ids);
+    REQUIRE(results.size() == ids.size());
+    REQUIRE(results[1].isError());
+    for (size_t i : {0u, 2u, 3u, 4u}) {
+        REQUIRE(results[i].isOk());
+        REQUIRE(results[i].value() == fs.readFile(ids[i]).value());
+    }
+    REQUIRE(fs.readFiles({}).empty());
+}
+
+TEST_CASE("MultiPackManager resolves overrides incrementally", "[vfs][multipack]")
+{
+    TestPacks packs;
+    MultiPackManager manager;
+    REQUIRE(manager.initialize().isOk());
+
+    REQUIRE(manager.loadBasePack(packs.path("base_game")).success);
+    REQUIRE(manager.loadPack(packs.path("patch_1"), PackType::Patch).success);
+    REQUIRE(manager.loadPack(packs.path("mod_a"), PackType::Mod, 1).success);
+    REQUIRE(manager.loadPack(packs.path("mod_b"), PackType::Mod, 0).success);
+
+    REQUIRE(manager.getResourceCount() == 4);
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_a");
+    REQUIRE(readText(manager, "ui/logo.png") == "mod a logo");
+    REQUIRE(readText(manager, "scripts/main.nmbc") == "patched script");
+    REQUIRE(readText(manager, "locales/en.json") == "base en");
+    REQUIRE_FALSE(manager.exists("missing.png"));
+    REQUIRE(manager.getOverrideCount() == 3);
+
+    // Batched reads resolve each ID to its provider and keep request order
+    auto batch = manager.readResources({"locales/en.json", "missing.png", "ui/logo.png"});
+    REQUIRE(batch.size() == 3);
+    REQUIRE(std::string(batch[0].value().begin(), batch[0].value().end()) == "base en");
+    REQUIRE(batch[1].isError());
+    REQUIRE(std::string(batch[2].value().begin(), batch[2].value().end()) == "mod a logo");
+
+    // Disabling or unloading hands resources to the next provider
+    manager.setPackEnabled("mod_a", false);
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_b");
+    REQUIRE_FALSE(manager.exists("mod/a.txt"));
+    REQUIRE(manager.getResourceCount() == 3);
+
+    manager.setPackEnabled("mod_a", true);
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_a");
+    REQUIRE(manager.exists("mod/a.txt"));
+
+    manager.unloadPack("mod_a");
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_b");
+    manager.unloadPack("patch_1");
+    REQUIRE(readText(manager, "scripts/main.nmbc") == "base script");
+    manager.unloadPack("mod_b");
+    REQUIRE(readText(manager, "ui/logo.png") == "base logo");
+    REQUIRE(manager.getResourceCount() == 3);
+
+    // Reloading reuses the freed slots
+    REQUIRE(manager.loadPack(packs.path("mod_b"), PackType::Mod).success);
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_b");
+    REQUIRE(manager.listResources().size() == 3);
+
+    manager.unloadAllPacks();
+    REQUIRE(manager.getResourceCount() == 0);
+    REQUIRE_FALSE(manager.exists("ui/logo.png"));
+}
+
+TEST_CASE("MultiPackManager reorders mods", "[vfs][multipack]")
+{
+    TestPacks packs;
+    MultiPackManager manager;
+    REQUIRE(manager.initialize().isOk());
+    REQUIRE(manager.loadBasePack(packs.path("base_game")).success);
+    REQUIRE(manager.loadPack(packs.path("mod_a"), PackType::Mod).success);
+    REQUIRE(manager.loadPack(packs.path("mod_b"), PackType::Mod).success);
+
+    // Equal priority: the later mount wins
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_b");
+
+    manager.setModLoadOrder({"mod_b", "mod_a"});
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_a");
+    manager.moveModUp("mod_a");
+    REQUIRE(manager.getResourcePack("ui/logo.png") == "mod_b");
+}
+
+TEST_CASE("MultiPackManager index snapshots survive a relaunch", "[vfs][multipack]")
+{
+    TestPacks packs;
+    const std::string snapshot = (packs.dir / "index.nmri").string();
+
+    {
+        MultiPackManager manager;
+        REQUIRE(manager.initialize().isOk());
+        REQUIRE(manager.loadBasePack(packs.path("base_game")).success);
+        REQUIRE(manager.loadPack(packs.path("mod_a"), PackType::Mod).success);
+        REQUIRE(manager.saveIndexSnapshot(snapshot).isOk());
+        REQUIRE(manager.loadIndexSnapshot(snapshot).isError()); // Packs mounted
+    }
+
+    // Change one pack so it is re-enumerated instead of taken from the snapshot
+    writeTestPack(packs.path("mod_a"), {{"ui/logo.png", "mod a logo v2"}, {"mod/new.txt", "new"}});
+
+    MultiPackManager manager;
+    REQUIRE(manager.initialize().isOk());
+    REQUIRE(manager.loadIndexSnapshot(snapshot).isOk());
+    auto base = manager.loadBasePack(packs.path("base_game"));
+    REQUIRE(base.success);
+    REQUIRE(base.loadedResources == 3);
+    REQUIRE(manager.loadPack(packs.path("mod_a"), PackType::Mod).success);
+
+    REQUIRE(readText(manager, "ui/logo.png") == "mod a logo v2");
+    REQUIRE(readText(manager, "scripts/main.nmbc") == "base script");
+    REQUIRE(manager.exists("mod/new.txt"));
+    REQUIRE_FALSE(manager.exists("mod/a.txt"));
+    REQUIRE(manager.getResourceCount() == 4);
+
+    // Damaged snapshots are rejected
+    {
+        std::ofstream out(snapshot, std::ios::binary | std::ios::trunc);
+        out << "NMRI garbage";
+    }
+    MultiPackManager fresh;
+    REQUIRE(fresh.initialize().isOk());
+    REQUIRE(fresh.loadIndexSnapshot(snapshot).isError());
+    REQUIRE(fresh.loadBasePack(packs.path("base_game")).success);
+    REQUIRE(fresh.getResourceCount() == 3);
+}
@@ -0,0 +1,83 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/pack_layout.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::vfs;
+
+TEST_CASE("PackLayoutPlanner orders resources by first use", "[vfs][layout]")
+{
+    const std::vector<std::string> ids = {"menu.png", "Forest.png", "theme.ogg",
+                                          "castle.png", "unused.bin", "font.ttf"};
+
+    PackLayoutPlanner planner;
+    planner.addAccess("bg/castle");      // Matches by stem
+    planner.addAccess("theme.ogg");      // Matches by file name
+    planner.addAccess("castle");         // Same resource, placed already
+    planner.addAccess("forest.PNG");     // Case is ignored
+    planner.addAccess("missing_asset");  // No resource, skipped
+    REQUIRE(planner.accesses().size() == 5);
+    planner.addAccess("theme.ogg");
+    REQUIRE(planner.accesses().size() == 5);
+
+    REQUIRE(planner.resolve(ids) == std::vector<usize>{3, 2, 1});
+
+    // Used resources first, then the rest in file order
+    REQUIRE(planner.order(ids) == std::vector<usize>{3, 2, 1, 0, 4, 5});
+
+    // Preloaded resources lead, used ones in first-use order
+    const std::vector<bool> preload = {true, true, false, false, false, true};
+    REQUIRE(planner.order(ids, preload) == std::vector<usize>{1, 0, 5, 3, 2, 4});
+
+    planner.clear();
+    REQUIRE(planner.empty());
+    REQUIRE(planner.order(ids) == std::vector<usize>{0, 1, 2, 3, 4, 5});
+}
+
+TEST_CASE("PackLayoutPlanner scores layouts and reads traces", "[vfs][layout]")
+{
+    // Three 100-byte resources written back to back
+    const std::vector<u64> sizes = {100, 100, 100};
+    const std::vector<u64> offsets = {0, 100, 200};
+
+    const std::vector<usize> forward = {0, 1, 2};
+    auto sequential = PackLayoutPlanner::measure(forward, offsets, sizes, 0);
+    REQUIRE(sequential.totalReads == 2);
+    REQUIRE(sequential.score() == 1.0);
+
+    const std::vector<usize> backward = {2, 1, 0};
+    REQUIRE(PackLayoutPlanner::measure(backward, offsets, sizes, 0).score() == 0.0);
+
+    // Skipping a resource is sequential only within the allowed gap
+    const std::vector<usize> skip = {0, 2};
+    REQUIRE(PackLayoutPlanner::measure(skip, offsets, sizes, 0).score() == 0.0);
+    REQUIRE(PackLayoutPlanner::measure(skip, offsets, sizes, 100).score() == 1.0);
+
+    LayoutLocality total;
+    total += sequential;
+    total += PackLayoutPlanner::measure(backward, offsets, sizes, 0);
+    REQUIRE(total.score() == 0.5);
+    REQUIRE(LayoutLocality{}.score() == 1.0);
+
+    const auto trace =
+        (std::filesystem::temp_directory_path() / "novelmind_layout_trace.txt").string();
+    {
+        std::ofstream out(trace);
+        out << "# recorded play trace\n"
+            << "intro.png\n"
+            << "\n"
+            << "  theme.ogg  \n"
+            << "intro.png\n";
+    }
+    PackLayoutPlanner planner;
+    auto loaded = planner.loadTrace(trace);
+    REQUIRE(loaded.isOk());
+    REQUIRE(loaded.value() == 2);
+    REQUIRE(planner.accesses() == std::vector<std::string>{"intro.png", "theme.ogg"});
+    REQUIRE(planner.loadTrace(trace + ".missing").isError());
+    std::remove(trace.c_str());
+}
@@ -516,3 +516,244 @@ TEST_CASE("PackReader memory safety", "[vfs][pack][safety]")
 // Note: Full pack file format tests would require creating complete valid pack files
 // with various configurations (compressed, encrypted, etc.). This would be better
 // suited for integration tests with actual pack creation tools.
+
+// =============================================================================
+// Memory-mapped reads
+// =============================================================================
+
+namespace {
+
+// Writes a pack the reader can actually resolve: header, resource table,
+// string table (count, offsets, NUL-terminated ids) and the data block.
+void createReadablePack(const std::string& path,
+                        const std::vector<std::pair<std::string, std::vector<u8>>>& resources,
+                        u32 entryFlags = 0) {
+    const auto count = static_cast<u32>(resources.size());
+
+    PackHeader header{};
+    header.magic = PACK_MAGIC;
+    header.versionMajor = PACK_VERSION_MAJOR;
+    header.versionMinor = PACK_VERSION_MINOR;
+    header.resourceCount = count;
+    header.resourceTableOffset = sizeof(PackHeader);
+    header.stringTableOffset =
+        header.resourceTableOffset + count * sizeof(PackResourceEntry);
+
+    std::vector<u32> stringOffsets;
+    std::string stringData;
+    for (const auto& [id, bytes] : resources) {
+        stringOffsets.push_back(static_cast<u32>(stringData.size()));
+        stringData += id;
+        stringData += '\0';
+    }
+    header.dataOffset = header.stringTableOffset + sizeof(u32) +
+                        count * sizeof(u32) + stringData.size();
+
+    std::vector<PackResourceEntry> entries;
+    u64 dataCursor = 0;
+    for (u32 i = 0; i < count; ++i) {
+        PackResourceEntry entry{};
+        entry.idStringOffset = i;
+        entry.type = static_cast<u32>(ResourceType::Data);
+        entry.dataOffset = dataCursor;
+        entry.compressedSize = resources[i].second.size();
+        entry.uncompressedSize = resources[i].second.size();
+        entry.flags = entryFlags;
+        entries.push_back(entry);
+        dataCursor += resources[i].second.size();
+    }
+    header.totalSize = header.dataOffset + dataCursor;
+
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.data()),
+               static_cast<std::streamsize>(entries.size() * sizeof(PackResourceEntry)));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(stringOffsets.data()),
+               static_cast<std::streamsize>(stringOffsets.size() * sizeof(u32)));
+    file.write(stringData.data(), static_cast<std::streamsize>(stringData.size()));
+    for (const auto& [id, bytes] : resources) {
+        file.write(reinterpret_cast<const char*>(bytes.data()),
+                   static_cast<std::streamsize>(bytes.size()));
+    }
+}
+
+} // namespace
+
+TEST_CASE("PackReader serves mapped resources without copying", "[vfs][pack][mmap]")
+{
+    const std::string path = "mapped_test.pack";
+    createReadablePack(path, {{"hello", {'h', 'e', 'l', 'l', 'o'}},
+                              {"numbers", {1, 2, 3, 4, 5, 6, 7, 8}}});
+
+    PackReader reader;
+    REQUIRE(reader.isMemoryMappingEnabled());
+    REQUIRE(reader.mount(path).isOk());
+
+    auto first = reader.readFileView("numbers");
+    REQUIRE(first.isOk());
+    REQUIRE(first.value().toVector() == std::vector<u8>{1, 2, 3, 4, 5, 6, 7, 8});
+
+    // Both views alias the same mapped bytes
+    auto second = reader.readFileView("numbers");
+    REQUIRE(second.isOk());
+    REQUIRE(first.value().data() == second.value().data());
+
+    // The compatibility path still returns an independent copy
+    auto copy = reader.readFile("hello");
+    REQUIRE(copy.isOk());
+    REQUIRE(copy.value() == std::vector<u8>{'h', 'e', 'l', 'l', 'o'});
+
+    SECTION("views outlive unmount") {
+        reader.unmountAll();
+        REQUIRE_FALSE(reader.exists("numbers"));
+        REQUIRE(first.value().size() == 8);
+        REQUIRE(first.value().bytes()[7] == 8);
+    }
+
+    SECTION("missing resources are reported") {
+        REQUIRE(reader.readFileView("absent").isError());
+    }
+
+    reader.unmountAll();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("PackReader stream mode matches mapped mode", "[vfs][pack][mmap]")
+{
+    const std::string path = "stream_test.pack";
+    createReadablePack(path, {{"a", {9, 8, 7}}, {"b", {42}}});
+
+    PackReader mapped;
+    REQUIRE(mapped.mount(path).isOk());
+
+    PackReader streamed;
+    streamed.setMemoryMappingEnabled(false);
+    REQUIRE(streamed.mount(path).isOk());
+
+    for (const char* id : {"a", "b"}) {
+        auto fromMap = mapped.readFileView(id);
+        auto fromStream = streamed.readFileView(id);
+        REQUIRE(fromMap.isOk());
+        REQUIRE(fromStream.isOk());
+        REQUIRE(fromMap.value().toVector() == fromStream.value().toVector());
+        REQUIRE(streamed.readFile(id).value() == mapped.readFile(id).value());
+    }
+
+    mapped.unmountAll();
+    streamed.unmountAll();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("PackReader copies flagged entries", "[vfs][pack][mmap]")
+{
+    const std::string path = "flagged_test.pack";
+    createReadablePack(path, {{"packed", {5, 5, 5}}},
+                       static_cast<u32>(PackFlags::Compressed));
+
+    PackReader reader;
+    REQUIRE(reader.mount(path).isOk());
+
+    auto a = reader.readFileView("packed");
+    auto b = reader.readFileView("packed");
+    REQUIRE(a.isOk());
+    REQUIRE(b.isOk());
+    REQUIRE(a.value().toVector() == std::vector<u8>{5, 5, 5});
+    REQUIRE(a.value().data() != b.value().data());
+
+    reader.unmountAll();
+    std::remove(path.c_str());
+}
+
+TEST_CASE("MemoryFileSystem readFileView falls back to a copy", "[vfs][pack][mmap]")
+{
+    MemoryFileSystem memFs;
+    memFs.addResource("blob", {1, 2, 3}, ResourceType::Data);
+
+    auto view = memFs.readFileView("blob");
+    REQUIRE(view.isOk());
+    REQUIRE(view.value().toVector() == std::vector<u8>{1, 2, 3});
+    REQUIRE(memFs.readFileView("missing").isError());
+}
+
+// =============================================================================
+// Batched reads
+// =============================================================================
+
+TEST_CASE("PackReader readFiles batches resources in request order", "[vfs][pack][batch]")
+{
+    const std::string path = "batch_test.pack";
+    // The filler puts "far" outside the coalescing gap of the others
+    std::vector<u8> filler(static_cast<usize>(PackReader::BATCH_MAX_GAP) + 1024, 0xEE);
+    createReadablePack(path, {{"first", {1, 2, 3}},
+                              {"second", {4, 5}},
+                              {"empty", {}},
+                              {"third", {6, 7, 8, 9}},
+                              {"filler", filler},
+                              {"far", {10, 11}}});
+
+    const std::vector<std::string> ids = {"far", "third", "missing", "first",
+                                          "second", "empty", "first"};
+
+    for (bool mapping : {true, false}) {
+        PackReader reader;
+        reader.setMemoryMappingEnabled(mapping);
+        REQUIRE(reader.mount(path).isOk());
+
+        auto results = reader.readFiles(ids);
+        REQUIRE(results.size() == ids.size());
+        REQUIRE(results[0].value() == std::vector<u8>{10, 11});
+        REQUIRE(results[1].value() == std::vector<u8>{6, 7, 8, 9});
+        REQUIRE(results[2].isError());
+        REQUIRE(results[3].value() == std::vector<u8>{1, 2, 3});
+        REQUIRE(results[4].value() == std::vector<u8>{4, 5});
+        REQUIRE(results[5].value().empty());
+        REQUIRE(results[6].value() == std::vector<u8>{1, 2, 3});
+
+        // Batched reads agree with single reads
+        for (const char* id : {"first", "third", "filler"}) {
+            REQUIRE(reader.readFiles({id})[0].value() == reader.readFile(id).value());
+        }
+        REQUIRE(reader.readFiles({}).empty());
+        reader.unmountAll();
+    }
+
+    // The default implementation loops over readFile()
+    MemoryFileSystem memFs;
+    memFs.addResource("blob", {1, 2, 3}, ResourceType::Data);
+    auto memResults = memFs.readFiles({"missing", "blob"});
+    REQUIRE(memResults[0].isError());
+    REQUIRE(memResults[1].value() == std::vector<u8>{1, 2, 3});
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("PackReader readFiles handles growing gaps within one span", "[vfs][pack][batch]")
+{
+    const std::string path = "batch_gap_test.pack";
+    // Unrequested padding makes each gap larger than the one before it, so the
+    // gap scratch would have to grow while a span is being assembled
+    std::vector<u8> a(64, 0x11);
+    std::vector<u8> b(96, 0x22);
+    std::vector<u8> c(128, 0x33);
+    createReadablePack(path, {{"a", a},
+                              {"smallGap", std::vector<u8>(200, 0xAA)},
+                              {"b", b},
+                              {"largeGap", std::vector<u8>(5000, 0xBB)},
+                              {"c", c}});
+
+    for (bool mapping : {true, false}) {
+        PackReader reader;
+        reader.setMemoryMappingEnabled(mapping);
+        REQUIRE(reader.mount(path).isOk());
+
+        auto results = reader.readFiles({"a", "b", "c"});
+        REQUIRE(results.size() == 3);
+        REQUIRE(results[0].value() == a);
+        REQUIRE(results[1].value() == b);
+        REQUIRE(results[2].value() == c);
+        reader.unmountAll();
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,209 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/resource/resource_manager.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/prefetch_planner.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include "NovelMind/vfs/memory_fs.hpp"
+#include <algorithm>
+#include <string>
+
+using namespace NovelMind;
+using namespace NovelMind::scripting;
+
+namespace {
+
+const char *PREFETCH_SCRIPT = R"(
+character Hero(name="Hero", sprite="hero_smile")
+
+// Scenes fall through to the next one, so the unreachable scene comes first
+scene prologue {
+    show background "bg_unreachable"
+}
+
+scene start {
+    show background "bg_intro"
+    say "Where to?"
+    choice {
+        "Forest" -> {
+            show background "bg_forest"
+            say "Trees everywhere"
+        }
+        "Town" -> town
+    }
+}
+
+scene town {
+    play music "town_theme"
+    show Hero at center
+    say "Welcome"
+}
+)";
+
+CompiledScript compileSource(const std::string &source)
+{
+    Lexer lexer;
+    auto tokens = lexer.tokenize(source);
+    REQUIRE(tokens.isOk());
+
+    Parser parser;
+    auto parsed = parser.parse(tokens.value());
+    REQUIRE(parsed.isOk());
+
+    Compiler compiler;
+    auto compiled = compiler.compile(parsed.value());
+    REQUIRE(compiled.isOk());
+    return compiled.value();
+}
+
+const PrefetchAsset *findAsset(const std::vector<PrefetchAsset> &assets, const std::string &id)
+{
+    auto it = std::find_if(assets.begin(), assets.end(),
+                           [&](const PrefetchAsset &asset) { return asset.id == id; });
+    return it == assets.end() ? nullptr : &*it;
+}
+
+std::vector<u8> makePpm()
+{
+    const std::string header = "P6\n1 1\n255\n";
+    std::vector<u8> data(header.begin(), header.end());
+    data.insert(data.end(), {0x10, 0x20, 0x30});
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("PrefetchPlanner follows every branch of a choice", "[scripting][prefetch]")
+{
+    auto script = compileSource(PREFETCH_SCRIPT);
+    PrefetchPlanner planner;
+
+    auto assets = planner.plan(script.instructions, script.stringTable, script.characters,
+                               script.sceneEntryPoints["start"]);
+
+    const auto *intro = findAsset(assets, "bg_intro");
+    const auto *forest = findAsset(assets, "bg_forest");
+    const auto *hero = findAsset(assets, "hero_smile");
+    const auto *music = findAsset(assets, "town_theme");
+
+    REQUIRE(intro != nullptr);
+    REQUIRE(forest != nullptr);
+    REQUIRE(hero != nullptr);
+    REQUIRE(music != nullptr);
+    REQUIRE(intro->kind == PrefetchKind::Texture);
+    REQUIRE(hero->kind == PrefetchKind::Texture);
+    REQUIRE(music->kind == PrefetchKind::Audio);
+    REQUIRE(intro->distance == 0);
+
+    // Code that start can never reach is not prefetched
+    REQUIRE(findAsset(assets, "bg_unreachable") == nullptr);
+
+    REQUIRE(std::is_sorted(assets.begin(), assets.end(),
+                           [](const PrefetchAsset &a, const PrefetchAsset &b) {
+                               return a.distance < b.distance;
+                           }));
+}
+
+TEST_CASE("PrefetchPlanner respects the look-ahead window", "[scripting][prefetch]")
+{
+    auto script = compileSource(PREFETCH_SCRIPT);
+    PrefetchPlanner planner;
+    const u32 entry = script.sceneEntryPoints["start"];
+
+    planner.setLookahead(1);
+    auto nearOnly = planner.plan(script.instructions, script.stringTable, script.characters, entry);
+    REQUIRE(nearOnly.size() == 1);
+    REQUIRE(nearOnly[0].id == "bg_intro");
+
+    planner.setLookahead(0);
+    REQUIRE(planner.plan(script.instructions, script.stringTable, script.characters, entry).empty());
+
+    planner.setLookahead(PrefetchPlanner::DEFAULT_LOOKAHEAD);
+    REQUIRE(planner
+                .plan(script.instructions, script.stringTable, script.characters,
+                      static_cast<u32>(script.instructions.size()))
+                .empty());
+}
+
+TEST_CASE("ScriptRuntime prefetches upcoming assets", "[scripting][prefetch]")
+{
+    vfs::MemoryFileSystem fs;
+    fs.addResource("bg_intro", makePpm(), vfs::ResourceType::Texture);
+    fs.addResource("bg_forest", makePpm(), vfs::ResourceType::Texture);
+    fs.addResource("hero_smile", makePpm(), vfs::ResourceType::Texture);
+    fs.addResource("town_theme", {1, 2, 3, 4}, vfs::ResourceType::Audio);
+
+    resource::ResourceManager resources(&fs);
+    ScriptRuntime runtime;
+    runtime.setResourceManager(&resources);
+    REQUIRE(runtime.load(compileSource(PREFETCH_SCRIPT)).isOk());
+
+    auto runUntilInput = [&] {
+        for (int i = 0; i < 50 && runtime.getState() != RuntimeState::WaitingInput; ++i) {
+            runtime.update(0.016);
+        }
+        REQUIRE(runtime.getState() == RuntimeState::WaitingInput);
+    };
+
+    SECTION("assets are resident before they are shown")
+    {
+        REQUIRE(runtime.gotoScene("start").isOk());
+        REQUIRE(runtime.getPrefetchStats().plansBuilt == 1);
+        REQUIRE(runtime.getPrefetchStats().requestsIssued == 4);
+
+        resources.finishPendingLoads();
+        REQUIRE(resources.isTextureCached("bg_intro"));
+        REQUIRE(resources.isTextureCached("hero_smile"));
+
+        runUntilInput();
+        const auto &stats = runtime.getPrefetchStats();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 0);
+        REQUIRE(stats.hitRate() == 1.0);
+
+        // Assets already resident or in flight are not requested again
+        REQUIRE(stats.requestsIssued == 4);
+    }
+
+    SECTION("uses before the upload completes count as late")
+    {
+        REQUIRE(runtime.gotoScene("start").isOk());
+        runUntilInput();
+        REQUIRE(runtime.getPrefetchStats().lateHits == 1);
+        REQUIRE(runtime.getPrefetchStats().hits == 0);
+        resources.finishPendingLoads();
+    }
+
+    SECTION("assets outside the window are misses")
+    {
+        RuntimeConfig config;
+        config.prefetchLookahead = 0;
+        runtime.setConfig(config);
+
+        REQUIRE(runtime.gotoScene("town").isOk());
+        runUntilInput();
+        const auto &stats = runtime.getPrefetchStats();
+        REQUIRE(stats.requestsIssued == 0);
+        REQUIRE(stats.misses == 2);
+        REQUIRE(stats.hitRate() == 0.0);
+
+        runtime.resetPrefetchStats();
+        REQUIRE(runtime.getPrefetchStats().misses == 0);
+    }
+    SECTION("a scene change forgets the previous scene's requests")
+    {
+        REQUIRE(runtime.gotoScene("start").isOk());
+        resources.finishPendingLoads();
+
+        RuntimeConfig config;
+        config.prefetchLookahead = 0;
+        runtime.setConfig(config);
+        REQUIRE(runtime.gotoScene("town").isOk());
+        runUntilInput();
+
+        // The resident sprite is a hit; the music request belonged to "start"
+        const auto &stats = runtime.getPrefetchStats();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 1);
+    }
+}
@@ -0,0 +1,220 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/renderer/software_renderer.hpp"
+#include "NovelMind/save/save_manager.hpp"
+#include "NovelMind/scene/transition.hpp"
+#include "NovelMind/scripting/compiler.hpp"
+#include "NovelMind/scripting/lexer.hpp"
+#include "NovelMind/scripting/parser.hpp"
+#include "NovelMind/scripting/script_runtime.hpp"
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+TEST_CASE("Renderers snapshot the frame drawn so far", "[renderer][snapshot]")
+{
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(32, 16).isOk());
+    renderer.clear(Color::Black);
+    renderer.fillRect(Rect{0, 0, 8, 16}, Color::Red);
+
+    SECTION("Reading pixels flushes pending draws")
+    {
+        auto pixels = renderer.readPixels();
+        REQUIRE(pixels.isOk());
+        REQUIRE(pixels.value().width == 32);
+        REQUIRE(pixels.value().height == 16);
+        REQUIRE(renderer.getPixel(4, 4) == Color::Red);
+        REQUIRE(pixels.value().pixels == renderer.getPixels());
+    }
+
+    SECTION("A snapshot texture redraws the captured frame")
+    {
+        Texture frame;
+        REQUIRE(renderer.snapshot(frame).isOk());
+        REQUIRE(frame.getWidth() == 32);
+        REQUIRE(frame.getHeight() == 16);
+
+        renderer.clear(Color::Blue);
+        renderer.drawSprite(frame, Transform2D{});
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(4, 4) == Color::Red);
+        REQUIRE(renderer.getPixel(20, 4) == Color::Black);
+    }
+
+    SECTION("Render targets capture their draws and restore the screen")
+    {
+        Texture target;
+        REQUIRE(renderer.beginRenderTarget(target).isOk());
+        REQUIRE(renderer.beginRenderTarget(target).isError());
+        renderer.fillRect(Rect{16, 0, 8, 8}, Color::Green);
+        REQUIRE(renderer.endRenderTarget().isOk());
+        REQUIRE(renderer.endRenderTarget().isError());
+        renderer.endFrame();
+
+        REQUIRE(renderer.getPixel(4, 4) == Color::Red);
+        REQUIRE(renderer.getPixel(20, 4) == Color::Black);
+
+        const auto pixels = target.getPixels();
+        REQUIRE(pixels.size() == 32 * 16 * 4);
+        const usize inside = (4 * 32 + 20) * 4;
+        const usize outside = (4 * 32 + 4) * 4;
+        REQUIRE(pixels[inside + 1] == 255);
+        REQUIRE(pixels[outside + 0] == 0);
+        REQUIRE(pixels[outside + 3] == 0);
+    }
+}
+
+TEST_CASE("Renderers without read-back refuse snapshots", "[renderer][snapshot]")
+{
+    auto renderer = createNullRenderer();
+    Texture target;
+    REQUIRE(renderer->snapshot(target).isError());
+    REQUIRE(renderer->readPixels().isError());
+    REQUIRE(renderer->beginRenderTarget(target).isError());
+    REQUIRE_FALSE(target.isValid());
+}
+
+TEST_CASE("Transitions composite the captured outgoing frame", "[renderer][snapshot][transition]")
+{
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(64, 8).isOk());
+    renderer.clear(Color::Red);
+
+    SECTION("Dissolve fades the old frame out over the new scene")
+    {
+        Scene::DissolveTransition dissolve;
+        dissolve.captureOutgoing(renderer);
+        dissolve.start(1.0f);
+        dissolve.update(0.5);
+
+        renderer.clear(Color::Black);
+        dissolve.render(renderer);
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(10, 4) == Color(127, 0, 0));
+
+        dissolve.update(0.5);
+        renderer.clear(Color::Black);
+        dissolve.render(renderer);
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(10, 4) == Color::Black);
+    }
+
+    SECTION("Slide moves the old frame off screen")
+    {
+        Scene::SlideTransition slide(Scene::SlideTransition::Direction::Left);
+        slide.captureOutgoing(renderer);
+        slide.start(1.0f);
+        slide.update(0.5); // Eased: an eighth of the screen left to go
+
+        renderer.clear(Color::Black);
+        slide.render(renderer);
+        renderer.endFrame();
+        REQUIRE(slide.getOffset() == 8.0f);
+        REQUIRE(renderer.getPixel(7, 4) == Color::Red);
+        REQUIRE(renderer.getPixel(8, 4) == Color::Black);
+    }
+
+    SECTION("Without a snapshot the dissolve draws nothing")
+    {
+        Scene::DissolveTransition dissolve;
+        dissolve.start(1.0f);
+        renderer.clear(Color::Black);
+        dissolve.render(renderer);
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(10, 4) == Color::Black);
+    }
+}
+
+TEST_CASE("Script transitions dissolve from the frame before the scene change",
+          "[renderer][snapshot][transition][scripting]")
+{
+    scripting::Lexer lexer;
+    auto tokens = lexer.tokenize(R"(
+scene intro {
+    say "Before"
+    show background "night"
+    transition dissolve 1.0
+    say "After"
+}
+)");
+    REQUIRE(tokens.isOk());
+    scripting::Parser parser;
+    auto program = parser.parse(tokens.value());
+    REQUIRE(program.isOk());
+    scripting::Compiler compiler;
+    auto compiled = compiler.compile(program.value());
+    REQUIRE(compiled.isOk());
+
+    scripting::ScriptRuntime runtime;
+    REQUIRE(runtime.load(compiled.value()).isOk());
+    REQUIRE(runtime.gotoScene("intro").isOk());
+
+    // The host draws the day scene in red and the night scene in black
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(64, 8).isOk());
+    auto frame = [&](f64 deltaTime) {
+        runtime.update(deltaTime);
+        renderer.clear(runtime.getCurrentBackground() == "night" ? Color::Black : Color::Red);
+        runtime.render(renderer);
+        renderer.endFrame();
+    };
+
+    for (int i = 0; i < 20 && !runtime.isWaitingForInput(); ++i) {
+        frame(0.0);
+    }
+    REQUIRE(runtime.getCurrentDialogue() == "Before");
+    runtime.continueExecution();
+
+    for (int i = 0; i < 20 && runtime.getState() != scripting::RuntimeState::WaitingTransition;
+         ++i) {
+        frame(0.0);
+    }
+    REQUIRE(runtime.getState() == scripting::RuntimeState::WaitingTransition);
+    REQUIRE(runtime.getCurrentBackground() == "night");
+
+    frame(0.5);
+    REQUIRE(renderer.getPixel(10, 4) == Color(127, 0, 0));
+
+    frame(0.5);
+    REQUIRE(renderer.getPixel(10, 4) == Color::Black);
+    for (int i = 0; i < 20 && !runtime.isWaitingForInput(); ++i) {
+        frame(0.0);
+    }
+    REQUIRE(runtime.getCurrentDialogue() == "After");
+}
+
+TEST_CASE("Save thumbnails are box-filtered frames", "[renderer][snapshot][save]")
+{
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(64, 32).isOk());
+    renderer.clear(Color::Black);
+    // Alternating white and black columns average to mid gray
+    for (int x = 0; x < 32; x += 2) {
+        renderer.fillRect(Rect{static_cast<f32>(x), 0, 1, 32}, Color::White);
+    }
+    renderer.fillRect(Rect{32, 0, 32, 32}, Color::Blue);
+    auto frame = renderer.readPixels();
+    REQUIRE(frame.isOk());
+
+    save::SaveData data;
+    save::setThumbnail(data, frame.value().pixels.data(), 64, 32, 16, 16);
+    REQUIRE(data.thumbnailWidth == 16);
+    REQUIRE(data.thumbnailHeight == 8);
+    REQUIRE(data.thumbnailData.size() == 16 * 8 * 4);
+    REQUIRE(data.thumbnailData[0] == 128);
+    REQUIRE(data.thumbnailData[3] == 255);
+    const usize right = (3 * 16 + 12) * 4;
+    REQUIRE(data.thumbnailData[right + 0] == 0);
+    REQUIRE(data.thumbnailData[right + 2] == 255);
+
+    // Small frames are stored as they are
+    save::setThumbnail(data, frame.value().pixels.data(), 64, 32);
+    REQUIRE(data.thumbnailWidth == 64);
+    REQUIRE(data.thumbnailHeight == 32);
+    REQUIRE(data.thumbnailData == frame.value().pixels);
+
+    save::setThumbnail(data, nullptr, 64, 32);
+    REQUIRE(data.thumbnailData.empty());
+    REQUIRE(data.thumbnailWidth == 0);
+}
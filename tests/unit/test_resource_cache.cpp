@@ -0,0 +1,238 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/vfs/resource_cache.hpp"
+#include "NovelMind/vfs/virtual_file_system.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::VFS;
+
+namespace {
+
+std::vector<u8> bytes(usize size, u8 fill = 0xAB)
+{
+    return std::vector<u8>(size, fill);
+}
+
+ResourceId texture(const std::string &name)
+{
+    return ResourceId(name, ResourceType::Texture);
+}
+
+} // namespace
+
+TEST_CASE("ResourceCache hands out shared buffers", "[vfs][cache]")
+{
+    ResourceCache cache(1024);
+    cache.put(texture("a"), bytes(100));
+
+    auto first = cache.get(texture("a"));
+    auto second = cache.get(texture("a"));
+    REQUIRE(first);
+    REQUIRE(first.get() == second.get());
+    REQUIRE(first->size() == 100);
+
+    // Readers keep their buffer after the entry is dropped
+    cache.remove(texture("a"));
+    REQUIRE_FALSE(cache.contains(texture("a")));
+    REQUIRE(first->size() == 100);
+    REQUIRE(cache.get(texture("a")) == nullptr);
+
+    auto stats = cache.stats();
+    REQUIRE(stats.hitCount == 2);
+    REQUIRE(stats.missCount == 1);
+    REQUIRE(stats.entryCount == 0);
+    REQUIRE(stats.totalSize == 0);
+}
+
+TEST_CASE("ResourceCache LRU evicts the least recently used entry", "[vfs][cache]")
+{
+    ResourceCache cache(300, EvictionPolicy::LRU, 1);
+    cache.put(texture("a"), bytes(100));
+    cache.put(texture("b"), bytes(100));
+    cache.put(texture("c"), bytes(100));
+
+    REQUIRE(cache.get(texture("a")));
+    cache.put(texture("d"), bytes(100));
+
+    REQUIRE(cache.contains(texture("a")));
+    REQUIRE_FALSE(cache.contains(texture("b")));
+    REQUIRE(cache.contains(texture("c")));
+    REQUIRE(cache.contains(texture("d")));
+    REQUIRE(cache.stats().evictionCount == 1);
+    REQUIRE(cache.currentSize() == 300);
+}
+
+TEST_CASE("ResourceCache SIEVE gives visited entries a second chance", "[vfs][cache]")
+{
+    ResourceCache cache(300, EvictionPolicy::SIEVE, 1);
+    cache.put(texture("a"), bytes(100));
+    cache.put(texture("b"), bytes(100));
+    cache.put(texture("c"), bytes(100));
+
+    REQUIRE(cache.get(texture("a")));
+    REQUIRE(cache.get(texture("b")));
+
+    cache.put(texture("d"), bytes(100));
+    REQUIRE(cache.contains(texture("a")));
+    REQUIRE(cache.contains(texture("b")));
+    REQUIRE_FALSE(cache.contains(texture("c")));
+
+    // The hand keeps moving towards newer entries instead of restarting at
+    // the tail, so unvisited d goes before the cleared a and b
+    cache.put(texture("e"), bytes(100));
+    REQUIRE(cache.entryCount() == 3);
+    REQUIRE(cache.contains(texture("a")));
+    REQUIRE(cache.contains(texture("b")));
+    REQUIRE_FALSE(cache.contains(texture("d")));
+}
+
+TEST_CASE("ResourceCache evicts in policy order across shards", "[vfs][cache]")
+{
+    // With many shards, consecutive entries land in different shards, so
+    // the victim must be chosen over all of them, not from the one written
+    const std::vector<std::string> names = {"a", "b", "c", "d", "e", "f", "g", "h"};
+
+    SECTION("LRU")
+    {
+        ResourceCache cache(800, EvictionPolicy::LRU, 16);
+        for (const auto& name : names) {
+            cache.put(texture(name), bytes(100));
+        }
+        REQUIRE(cache.get(texture("a")));
+        REQUIRE(cache.get(texture("b")));
+
+        for (usize i = 0; i < 4; ++i) {
+            cache.put(texture("new" + std::to_string(i)), bytes(100));
+        }
+
+        REQUIRE(cache.contains(texture("a")));
+        REQUIRE(cache.contains(texture("b")));
+        for (const char* evicted : {"c", "d", "e", "f"}) {
+            REQUIRE_FALSE(cache.contains(texture(evicted)));
+        }
+        REQUIRE(cache.contains(texture("g")));
+        REQUIRE(cache.contains(texture("h")));
+        REQUIRE(cache.stats().evictionCount == 4);
+    }
+
+    SECTION("SIEVE")
+    {
+        ResourceCache cache(800, EvictionPolicy::SIEVE, 16);
+        for (const auto& name : names) {
+            cache.put(texture(name), bytes(100));
+        }
+        REQUIRE(cache.get(texture("a")));
+
+        for (usize i = 0; i < 3; ++i) {
+            cache.put(texture("new" + std::to_string(i)), bytes(100));
+        }
+
+        REQUIRE(cache.contains(texture("a")));
+        for (const char* evicted : {"b", "c", "d"}) {
+            REQUIRE_FALSE(cache.contains(texture(evicted)));
+        }
+        REQUIRE(cache.contains(texture("e")));
+    }
+}
+
+TEST_CASE("ResourceCache GDSF prefers evicting large, cold entries", "[vfs][cache]")
+{
+    ResourceCache cache(1000, EvictionPolicy::GDSF, 1);
+    cache.put(texture("big"), bytes(600));
+    cache.put(texture("small"), bytes(100));
+    cache.put(texture("warm"), bytes(200));
+    REQUIRE(cache.get(texture("warm")));
+
+    cache.put(texture("new"), bytes(300));
+
+    REQUIRE_FALSE(cache.contains(texture("big")));
+    REQUIRE(cache.contains(texture("small")));
+    REQUIRE(cache.contains(texture("warm")));
+    REQUIRE(cache.contains(texture("new")));
+}
+
+TEST_CASE("ResourceCache enforces per-type budgets", "[vfs][cache]")
+{
+    ResourceCache cache(10000);
+    cache.setTypeBudget(ResourceType::Texture, 250);
+
+    cache.put(texture("t1"), bytes(100));
+    cache.put(texture("t2"), bytes(100));
+    cache.put(ResourceId("theme", ResourceType::Audio), bytes(1000));
+    cache.put(texture("t3"), bytes(100));
+
+    REQUIRE(cache.typeSize(ResourceType::Texture) <= 250);
+    REQUIRE(cache.typeSize(ResourceType::Audio) == 1000);
+    REQUIRE(cache.contains(texture("t3")));
+    REQUIRE(cache.contains(ResourceId("theme", ResourceType::Audio)));
+
+    // Entries larger than their type budget are not cached at all
+    cache.put(texture("huge"), bytes(400));
+    REQUIRE_FALSE(cache.contains(texture("huge")));
+
+    // Tightening a budget evicts immediately
+    cache.setTypeBudget(ResourceType::Texture, 100);
+    REQUIRE(cache.typeSize(ResourceType::Texture) <= 100);
+}
+
+TEST_CASE("ResourceCache stays consistent under concurrent access", "[vfs][cache]")
+{
+    ResourceCache cache(64 * 1024, EvictionPolicy::SIEVE);
+    constexpr int THREADS = 4;
+    constexpr int ITERATIONS = 2000;
+
+    // Catch assertions are not thread-safe; collect failures instead
+    std::atomic<int> badReads{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&cache, &badReads, t] {
+            for (int i = 0; i < ITERATIONS; ++i) {
+                const auto id = texture("res" + std::to_string((i * 7 + t) % 200));
+                if (auto data = cache.get(id)) {
+                    if (data->size() != 1024) {
+                        ++badReads;
+                    }
+                } else {
+                    cache.put(id, bytes(1024));
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(badReads == 0);
+    auto stats = cache.stats();
+    REQUIRE(stats.totalSize <= cache.maxSize());
+    REQUIRE(stats.totalSize == stats.entryCount * 1024);
+    REQUIRE(stats.hitCount + stats.missCount == THREADS * ITERATIONS);
+}
+
+TEST_CASE("VirtualFileSystem shares cached buffers", "[vfs][cache]")
+{
+    VFSConfig config;
+    config.cachePolicy = EvictionPolicy::GDSF;
+    VirtualFileSystem vfs(config);
+
+    auto backend = std::make_unique<MemoryBackend>();
+    backend->addResource("images/bg.png", bytes(64), ResourceType::Texture);
+    vfs.registerBackend(std::move(backend));
+    REQUIRE(vfs.initialize().isOk());
+
+    auto first = vfs.readShared(ResourceId("images/bg.png"));
+    auto second = vfs.readShared(ResourceId("images/bg.png"));
+    REQUIRE(first.isOk());
+    REQUIRE(second.isOk());
+    REQUIRE(first.value().get() == second.value().get());
+
+    auto copy = vfs.readAll("images/bg.png");
+    REQUIRE(copy.isOk());
+    REQUIRE(copy.value() == *first.value());
+
+    REQUIRE(vfs.stats().cacheStats.hitCount == 2);
+    REQUIRE(vfs.readShared(ResourceId("missing.png")).isError());
+}
@@ -21,6 +21,8 @@
 #include "NovelMind/scene/scene_graph.hpp"
 #include "NovelMind/renderer/renderer.hpp"
 #include <memory>
+#include <string>
+#include <vector>
 
 using namespace NovelMind::scene;
 using namespace NovelMind;
@@ -480,6 +482,134 @@ TEST_CASE("DialogueUIObject update with typewriter", "[scene_graph][dialogue][ty
     REQUIRE(dialogue.isTypewriterComplete());
 }
 
+namespace
+{
+
+class TextRecordingRenderer : public MockRenderer {
+public:
+    struct DrawnText
+    {
+        std::string text;
+        f32 x;
+    };
+
+    void drawText([[maybe_unused]] const renderer::Font& font, const std::string& text, f32 x,
+                  [[maybe_unused]] f32 y,
+                  [[maybe_unused]] const renderer::Color& color) override
+    {
+        drawn.push_back({text, x});
+    }
+
+    std::string joined() const
+    {
+        std::string out;
+        for (const auto& item : drawn) {
+            out += item.text;
+        }
+        return out;
+    }
+
+    std::vector<DrawnText> drawn;
+};
+
+} // namespace
+
+TEST_CASE("DialogueUIObject reveals typed glyphs from its cached layout",
+          "[scene_graph][dialogue][typewriter]")
+{
+#if defined(_WIN32)
+    const std::string fontPath = "C:\\Windows\\Fonts\\segoeui.ttf";
+#elif defined(__APPLE__)
+    const std::string fontPath = "/System/Library/Fonts/Supplemental/Arial.ttf";
+#else
+    const std::string fontPath = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+#endif
+    resource::ResourceManager resources;
+    if (resources.loadFontAtlas(fontPath, 18, "abc").isError()) {
+        WARN("System font unavailable, skipping dialogue layout checks");
+        return;
+    }
+
+    SceneGraph graph;
+    graph.setResourceManager(&resources);
+    auto owned = std::make_unique<DialogueUIObject>("dlg");
+    DialogueUIObject* dialogue = owned.get();
+    graph.addToLayer(LayerType::UI, std::move(owned));
+
+    dialogue->setProperty("fontId", fontPath);
+    dialogue->setText("Hello brave new world");
+    dialogue->setTypewriterSpeed(10.0f);
+    dialogue->startTypewriter();
+
+    TextRecordingRenderer renderer;
+    dialogue->update(0.75); // 7 glyphs
+    dialogue->render(renderer);
+    REQUIRE(renderer.joined() == "Hello b");
+    const f32 partialX = renderer.drawn.back().x;
+
+    // Completing a word does not move it: the layout is for the whole line
+    renderer.drawn.clear();
+    dialogue->skipTypewriter();
+    dialogue->render(renderer);
+    REQUIRE(renderer.joined() == "Hello brave new world");
+    REQUIRE(renderer.drawn[2].text == "brave");
+    REQUIRE(renderer.drawn[2].x == partialX);
+
+    // New text and property changes rebuild the layout
+    renderer.drawn.clear();
+    dialogue->setText("Bye");
+    dialogue->skipTypewriter();
+    dialogue->render(renderer);
+    REQUIRE(renderer.joined() == "Bye");
+
+    const f32 leftX = renderer.drawn.back().x;
+    renderer.drawn.clear();
+    dialogue->setProperty("padding", "40");
+    dialogue->render(renderer);
+    REQUIRE(renderer.drawn.back().x > leftX);
+}
+
+TEST_CASE("DialogueUIObject types UTF-8 text one code point at a time",
+          "[scene_graph][dialogue][typewriter]")
+{
+#if defined(_WIN32)
+    const std::string fontPath = "C:\\Windows\\Fonts\\segoeui.ttf";
+#elif defined(__APPLE__)
+    const std::string fontPath = "/System/Library/Fonts/Supplemental/Arial.ttf";
+#else
+    const std::string fontPath = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+#endif
+    resource::ResourceManager resources;
+    if (resources.loadFont(fontPath, 18).isError()) {
+        WARN("System font unavailable, skipping dialogue layout checks");
+        return;
+    }
+
+    SceneGraph graph;
+    graph.setResourceManager(&resources);
+    auto owned = std::make_unique<DialogueUIObject>("dlg");
+    DialogueUIObject* dialogue = owned.get();
+    graph.addToLayer(LayerType::UI, std::move(owned));
+
+    dialogue->setProperty("fontId", fontPath);
+    dialogue->setText("\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xD0\xBC\xD0\xB8\xD1\x80"); // Привет мир
+    dialogue->setTypewriterSpeed(10.0f);
+    dialogue->startTypewriter();
+
+    TextRecordingRenderer renderer;
+    dialogue->update(0.35); // 3 glyphs
+    dialogue->render(renderer);
+    REQUIRE(renderer.joined() == "\xD0\x9F\xD1\x80\xD0\xB8");
+    REQUIRE(resources.getGlyphCache()->getStats().pages == 0);
+
+    // Completion is counted in glyphs, not bytes
+    dialogue->update(0.7);
+    REQUIRE(dialogue->isTypewriterComplete());
+    renderer.drawn.clear();
+    dialogue->render(renderer);
+    REQUIRE(renderer.joined() == dialogue->getText());
+}
+
 // =============================================================================
 // ChoiceUIObject Tests
 // =============================================================================
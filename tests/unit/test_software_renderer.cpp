@@ -0,0 +1,216 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/renderer/software_renderer.hpp"
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+namespace
+{
+
+Transform2D at(f32 x, f32 y)
+{
+    Transform2D transform;
+    transform.x = x;
+    transform.y = y;
+    return transform;
+}
+
+/// Texture whose texel (x, y) has red = 100 * x and green = 100 * y
+Texture gradientTexture(i32 width, i32 height)
+{
+    std::vector<u8> pixels;
+    for (i32 y = 0; y < height; ++y) {
+        for (i32 x = 0; x < width; ++x) {
+            pixels.insert(pixels.end(),
+                          {static_cast<u8>(100 * x), static_cast<u8>(100 * y), 7, 255});
+        }
+    }
+    Texture texture;
+    REQUIRE(texture.loadFromRGBA(pixels.data(), width, height).isOk());
+    return texture;
+}
+
+} // namespace
+
+TEST_CASE("Software renderer fills and blends rectangles", "[renderer][software]")
+{
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(64, 32).isOk());
+    REQUIRE(renderer.getPixels().size() == 64 * 32 * 4);
+
+    SECTION("Frames start from the GL renderer's clear color")
+    {
+        renderer.beginFrame();
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(0, 0) == Color(13, 13, 15));
+        REQUIRE(renderer.getPixel(64, 0) == Color::Transparent);
+    }
+
+    SECTION("Alpha blending is identical on vector and scalar pixels")
+    {
+        renderer.clear(Color::Black);
+        // Seven pixels wide: four go through the vector path, three do not
+        renderer.fillRect(Rect{2, 2, 7, 3}, Color(255, 0, 0, 128));
+        renderer.endFrame();
+
+        for (i32 x = 2; x < 9; ++x) {
+            INFO("x " << x);
+            REQUIRE(renderer.getPixel(x, 3) == Color(128, 0, 0, 255));
+        }
+        REQUIRE(renderer.getPixel(1, 3) == Color::Black);
+        REQUIRE(renderer.getPixel(9, 3) == Color::Black);
+        REQUIRE(renderer.getPixel(4, 5) == Color::Black);
+    }
+
+    SECTION("Each blend mode matches its GL blend function")
+    {
+        renderer.clear(Color(100, 100, 100));
+        renderer.setBlendMode(BlendMode::Additive);
+        renderer.fillRect(Rect{0, 0, 8, 1}, Color(100, 50, 0, 128));
+        renderer.setBlendMode(BlendMode::Multiply);
+        renderer.fillRect(Rect{0, 1, 8, 1}, Color(128, 255, 0, 255));
+        renderer.setBlendMode(BlendMode::None);
+        renderer.fillRect(Rect{0, 2, 8, 1}, Color(1, 2, 3, 4));
+        renderer.endFrame();
+
+        for (i32 x = 0; x < 8; ++x) {
+            INFO("x " << x);
+            REQUIRE(renderer.getPixel(x, 0) == Color(150, 125, 100, 255));
+            REQUIRE(renderer.getPixel(x, 1) == Color(50, 100, 0, 255));
+            REQUIRE(renderer.getPixel(x, 2) == Color(1, 2, 3, 4));
+        }
+    }
+
+    SECTION("Fade covers the whole frame")
+    {
+        renderer.clear(Color::White);
+        renderer.setFade(0.5f);
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(0, 0) == Color(128, 128, 128, 255));
+        REQUIRE(renderer.getPixel(63, 31) == Color(128, 128, 128, 255));
+    }
+
+    SECTION("Outlines leave the interior untouched")
+    {
+        renderer.clear(Color::Black);
+        renderer.drawRect(Rect{4, 4, 10, 10}, Color::White);
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(4, 8) == Color::White);
+        REQUIRE(renderer.getPixel(13, 13) == Color::White);
+        REQUIRE(renderer.getPixel(8, 8) == Color::Black);
+    }
+}
+
+TEST_CASE("Software renderer samples textured quads", "[renderer][software]")
+{
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(64, 32).isOk());
+    const Texture texture = gradientTexture(3, 2);
+    REQUIRE(texture.getPixels().size() == 3 * 2 * 4);
+
+    renderer.clear(Color::Black);
+
+    SECTION("Whole-pixel positions copy texels exactly")
+    {
+        renderer.drawSprite(texture, at(10, 10));
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(10, 10) == Color(0, 0, 7));
+        REQUIRE(renderer.getPixel(12, 11) == Color(200, 100, 7));
+        REQUIRE(renderer.getPixel(13, 10) == Color::Black);
+        REQUIRE(renderer.getPixel(10, 12) == Color::Black);
+    }
+
+    SECTION("Half-pixel positions filter bilinearly")
+    {
+        renderer.drawSprite(texture, at(10.5f, 10.0f));
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(11, 10) == Color(50, 0, 7));
+        REQUIRE(renderer.getPixel(12, 10) == Color(150, 0, 7));
+    }
+
+    SECTION("Rotation and scale follow the transform")
+    {
+        const Texture strip = gradientTexture(2, 1);
+        Transform2D transform = at(10, 10);
+        transform.rotation = 90.0f;
+        transform.scaleX = 2.0f;
+        renderer.drawSprite(strip, transform);
+        renderer.endFrame();
+
+        // The sprite's x axis now points down the screen, two pixels per texel
+        REQUIRE(renderer.getPixel(9, 10) == Color(0, 0, 7));
+        REQUIRE(renderer.getPixel(9, 13) == Color(100, 0, 7));
+        REQUIRE(renderer.getPixel(10, 10) == Color::Black);
+        REQUIRE(renderer.getPixel(9, 14) == Color::Black);
+    }
+
+    SECTION("Tinting modulates every channel")
+    {
+        renderer.drawSprite(texture, at(0, 0), Color(255, 255, 255, 0));
+        renderer.drawSprite(texture, at(20, 0), Color(128, 255, 255, 255));
+        renderer.endFrame();
+        REQUIRE(renderer.getPixel(2, 0) == Color::Black);
+        REQUIRE(renderer.getPixel(22, 0) == Color(100, 0, 7));
+    }
+}
+
+TEST_CASE("Software renderer draws glyphs from the font atlas", "[renderer][software]")
+{
+#if defined(_WIN32)
+    const std::string fontPath = "C:\\Windows\\Fonts\\segoeui.ttf";
+#elif defined(__APPLE__)
+    const std::string fontPath = "/System/Library/Fonts/Supplemental/Arial.ttf";
+#else
+    const std::string fontPath = "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf";
+#endif
+    std::ifstream file(fontPath, std::ios::binary);
+    const std::vector<u8> data{std::istreambuf_iterator<char>(file),
+                               std::istreambuf_iterator<char>()};
+    Font font;
+    if (data.empty() || font.loadFromMemory(data, 24).isError()) {
+        WARN("System font unavailable, skipping glyph rendering checks");
+        return;
+    }
+
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(128, 64).isOk());
+    renderer.clear(Color::Black);
+    renderer.drawText(font, "HH", 8, 8, Color(0, 255, 0));
+    renderer.endFrame();
+
+    int lit = 0;
+    for (i32 y = 0; y < 64; ++y) {
+        for (i32 x = 0; x < 128; ++x) {
+            const Color pixel = renderer.getPixel(x, y);
+            REQUIRE(pixel.r == 0);
+            if (pixel.g > 0) {
+                ++lit;
+                REQUIRE(x >= 8);
+                REQUIRE(y >= 8);
+            }
+        }
+    }
+    REQUIRE(lit > 40);
+}
+
+TEST_CASE("Software renderer frames round-trip through PNG", "[renderer][software]")
+{
+    SoftwareRenderer renderer;
+    REQUIRE(renderer.initialize(37, 19).isOk());
+    renderer.clear(Color(10, 20, 30, 255));
+    renderer.fillRect(Rect{3, 3, 20, 10}, Color(200, 100, 50, 128));
+    renderer.endFrame();
+
+    auto png = encodePng(renderer.getPixels().data(), renderer.getWidth(), renderer.getHeight());
+    REQUIRE(png.isOk());
+    auto decoded = Texture::decode(png.value());
+    REQUIRE(decoded.isOk());
+    REQUIRE(decoded.value().width == 37);
+    REQUIRE(decoded.value().height == 19);
+    REQUIRE(decoded.value().pixels == renderer.getPixels());
+
+    REQUIRE(encodePng(nullptr, 1, 1).isError());
+}
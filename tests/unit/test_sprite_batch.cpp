@@ -0,0 +1,172 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include "NovelMind/platform/window.hpp"
+#include "NovelMind/renderer/renderer.hpp"
+#include "NovelMind/renderer/sprite_batch.hpp"
+#include <vector>
+
+using namespace NovelMind;
+using namespace NovelMind::renderer;
+
+namespace
+{
+
+class HeadlessWindow : public platform::IWindow {
+public:
+    Result<void> create([[maybe_unused]] const platform::WindowConfig& config) override
+    {
+        return Result<void>::ok();
+    }
+    void destroy() override {}
+    void setTitle([[maybe_unused]] const std::string& title) override {}
+    void setSize([[maybe_unused]] i32 width, [[maybe_unused]] i32 height) override {}
+    void setFullscreen([[maybe_unused]] bool fullscreen) override {}
+    [[nodiscard]] i32 getWidth() const override { return 1280; }
+    [[nodiscard]] i32 getHeight() const override { return 720; }
+    [[nodiscard]] bool isFullscreen() const override { return false; }
+    [[nodiscard]] bool shouldClose() const override { return false; }
+    void pollEvents() override {}
+    void swapBuffers() override {}
+    [[nodiscard]] void* getNativeHandle() const override { return nullptr; }
+};
+
+// Two distinct texture identities; the batch never dereferences them
+int TEXTURE_A = 0;
+int TEXTURE_B = 0;
+
+Transform2D at(f32 x, f32 y)
+{
+    Transform2D transform;
+    transform.x = x;
+    transform.y = y;
+    return transform;
+}
+
+void addTile(SpriteBatch& batch, const void* texture, f32 x, f32 y)
+{
+    batch.addSprite(texture, 64.0f, 64.0f, Rect{0, 0, 32, 32}, at(x, y), Color::White);
+}
+
+} // namespace
+
+TEST_CASE("SpriteBatch merges quads that share texture and blend mode", "[renderer][batch]")
+{
+    SpriteBatch batch;
+
+    SECTION("Interleaved textures that do not overlap collapse to two batches")
+    {
+        for (int i = 0; i < 10; ++i) {
+            addTile(batch, i % 2 == 0 ? &TEXTURE_A : &TEXTURE_B, static_cast<f32>(i) * 40.0f, 0.0f);
+        }
+        batch.build();
+        REQUIRE(batch.batches().size() == 2);
+        REQUIRE(batch.stats().drawCalls == 2);
+        REQUIRE(batch.stats().quads == 10);
+        REQUIRE(batch.stats().vertices == 40);
+        REQUIRE(batch.stats().textureSwitches == 2);
+
+        // Vertices are grouped by batch, each batch in recording order
+        REQUIRE(batch.batches()[0].texture == &TEXTURE_A);
+        REQUIRE(batch.batches()[0].firstVertex == 0);
+        REQUIRE(batch.batches()[1].firstVertex == 20);
+        REQUIRE(batch.vertices()[4].x == Catch::Approx(80.0f));
+        REQUIRE(batch.vertices()[20].x == Catch::Approx(40.0f));
+    }
+
+    SECTION("Overlapping quads keep their painter's order")
+    {
+        addTile(batch, &TEXTURE_A, 0.0f, 0.0f);
+        addTile(batch, &TEXTURE_B, 16.0f, 16.0f);
+        addTile(batch, &TEXTURE_A, 8.0f, 8.0f);
+        batch.build();
+        REQUIRE(batch.batches().size() == 3);
+        REQUIRE(batch.stats().textureSwitches == 3);
+    }
+
+    SECTION("Blend mode changes split batches")
+    {
+        addTile(batch, &TEXTURE_A, 0.0f, 0.0f);
+        batch.setBlendMode(BlendMode::Additive);
+        addTile(batch, &TEXTURE_A, 0.0f, 0.0f);
+        batch.setBlendMode(BlendMode::Alpha);
+        addTile(batch, &TEXTURE_A, 100.0f, 0.0f);
+        batch.build();
+        REQUIRE(batch.batches().size() == 2);
+        REQUIRE(batch.batches()[1].blend == BlendMode::Additive);
+        REQUIRE(batch.stats().blendSwitches == 2);
+        REQUIRE(batch.stats().textureSwitches == 1);
+    }
+
+    SECTION("Sprites are transformed like the immediate-mode path")
+    {
+        Transform2D transform = at(100.0f, 50.0f);
+        transform.scaleX = 2.0f;
+        transform.rotation = 90.0f;
+        batch.addSprite(&TEXTURE_A, 64.0f, 64.0f, Rect{32, 0, 32, 16}, transform,
+                        Color(255, 0, 0, 128));
+        batch.build();
+
+        const auto& v = batch.vertices();
+        REQUIRE(v.size() == 4);
+        REQUIRE(v[0].x == Catch::Approx(100.0f));
+        REQUIRE(v[0].y == Catch::Approx(50.0f));
+        REQUIRE(v[1].x == Catch::Approx(100.0f).margin(1e-4));
+        REQUIRE(v[1].y == Catch::Approx(114.0f));
+        REQUIRE(v[2].x == Catch::Approx(84.0f));
+        REQUIRE(v[0].u == Catch::Approx(0.5f));
+        REQUIRE(v[2].u == Catch::Approx(1.0f));
+        REQUIRE(v[2].v == Catch::Approx(0.25f));
+        REQUIRE(v[3].color == Color(255, 0, 0, 128));
+    }
+
+    SECTION("Clearing keeps the blend mode and drops the quads")
+    {
+        batch.setBlendMode(BlendMode::Multiply);
+        addTile(batch, &TEXTURE_A, 0.0f, 0.0f);
+        batch.clear();
+        REQUIRE(batch.empty());
+        REQUIRE(batch.getBlendMode() == BlendMode::Multiply);
+    }
+}
+
+TEST_CASE("Null renderer reports batch statistics per frame", "[renderer][batch]")
+{
+    HeadlessWindow window;
+    auto renderer = createNullRenderer();
+    REQUIRE(renderer->initialize(window).isOk());
+
+    Texture atlasA;
+    Texture atlasB;
+    const std::vector<u8> pixels(16 * 16 * 4, 255);
+    REQUIRE(atlasA.loadFromRGBA(pixels.data(), 16, 16).isOk());
+    REQUIRE(atlasB.loadFromRGBA(pixels.data(), 16, 16).isOk());
+
+    renderer->beginFrame();
+    renderer->fillRect(Rect{0, 0, 1280, 720}, Color(10, 10, 10));
+    // Alternate textures, A sprites on the left and B sprites on the right
+    for (int i = 0; i < 100; ++i) {
+        const int cell = i / 2;
+        const f32 x = static_cast<f32>(cell % 10) * 20.0f + (i % 2 == 0 ? 0.0f : 700.0f);
+        const f32 y = 100.0f + static_cast<f32>(cell / 10) * 20.0f;
+        renderer->drawSprite(i % 2 == 0 ? atlasA : atlasB, at(x, y));
+    }
+    renderer->drawRect(Rect{10, 10, 200, 40}, Color::White);
+    renderer->setFade(0.5f);
+    renderer->endFrame();
+
+    const BatchStats stats = renderer->getBatchStats();
+    REQUIRE(stats.quads == 1 + 100 + 4 + 1);
+    REQUIRE(stats.vertices == stats.quads * 4);
+    // Background with the outline, one batch per sprite texture, the fade on top
+    REQUIRE(stats.drawCalls == 4);
+    REQUIRE(stats.textureSwitches == 4);
+
+    // Draws before a clear are dropped; stats cover one frame only
+    renderer->beginFrame();
+    renderer->drawSprite(atlasA, at(0, 0));
+    renderer->clear(Color::Black);
+    renderer->drawSprite(atlasB, at(0, 0));
+    renderer->endFrame();
+    REQUIRE(renderer->getBatchStats().quads == 1);
+    REQUIRE(renderer->getBatchStats().drawCalls == 1);
+}
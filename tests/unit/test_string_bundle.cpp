@@ -0,0 +1,164 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/localization/string_bundle.hpp"
+#include <filesystem>
+#include <string>
+
+using namespace NovelMind;
+using namespace NovelMind::localization;
+
+namespace
+{
+
+StringTable makeTable(const std::string& locale, const std::string& prefix)
+{
+    StringTable table(LocaleId::fromString(locale));
+    table.addString("greeting", prefix + "hello");
+    table.addString("menu.start", prefix + "start");
+    table.addString("empty", "");
+    table.addPluralString("apples", {{PluralCategory::One, prefix + "{count} apple"},
+                                     {PluralCategory::Other, prefix + "{count} apples"}});
+    table.addPluralString("few_only", {{PluralCategory::Few, prefix + "few"}});
+    return table;
+}
+
+StringBundle compileBundle(const StringTable& table)
+{
+    auto bytes = StringBundle::compile(table);
+    REQUIRE(bytes.isOk());
+    auto bundle = StringBundle::fromMemory(std::move(bytes).value());
+    REQUIRE(bundle.isOk());
+    return std::move(bundle).value();
+}
+
+} // namespace
+
+TEST_CASE("StringBundle round-trips strings and plural forms", "[localization]")
+{
+    const StringTable table = makeTable("en_US", "");
+    const StringBundle bundle = compileBundle(table);
+
+    REQUIRE(bundle.size() == 5);
+    REQUIRE(bundle.getLocale().toString() == "en_US");
+    REQUIRE(bundle.find("greeting") == "hello");
+    REQUIRE(bundle.find("menu.start") == "start");
+    REQUIRE(bundle.find("empty") == "");
+    REQUIRE(bundle.find("apples") == "{count} apples");
+    REQUIRE(bundle.find("apples", PluralCategory::One) == "{count} apple");
+    REQUIRE(bundle.find("apples", PluralCategory::Many) == "{count} apples");
+    REQUIRE(bundle.find("few_only") == "few");
+    REQUIRE(bundle.find("few_only", PluralCategory::One) == "few");
+
+    REQUIRE_FALSE(bundle.find("missing").has_value());
+    REQUIRE_FALSE(bundle.find("greeting.extra").has_value());
+    REQUIRE_FALSE(bundle.contains(""));
+
+    // Expanding and recompiling gives identical bytes
+    auto first = StringBundle::compile(table);
+    auto second = StringBundle::compile(bundle.toStringTable());
+    REQUIRE(first.isOk());
+    REQUIRE(second.isOk());
+    REQUIRE(first.value() == second.value());
+}
+
+TEST_CASE("StringBundle finds every key of a large table", "[localization]")
+{
+    StringTable table(LocaleId("en"));
+    constexpr int count = 50000;
+    for (int i = 0; i < count; ++i) {
+        table.addString("dialogue.line" + std::to_string(i), "Text " + std::to_string(i));
+    }
+
+    const StringBundle bundle = compileBundle(table);
+    REQUIRE(bundle.size() == static_cast<usize>(count));
+
+    int found = 0;
+    for (int i = 0; i < count; ++i) {
+        auto text = bundle.find("dialogue.line" + std::to_string(i));
+        if (text && *text == "Text " + std::to_string(i)) {
+            ++found;
+        }
+    }
+    REQUIRE(found == count);
+    REQUIRE_FALSE(bundle.contains("dialogue.line" + std::to_string(count)));
+
+    const StringBundle emptyBundle = compileBundle(StringTable(LocaleId("en")));
+    REQUIRE(emptyBundle.empty());
+    REQUIRE_FALSE(emptyBundle.find("anything").has_value());
+}
+
+TEST_CASE("StringBundle rejects corrupt data", "[localization]")
+{
+    auto bytes = StringBundle::compile(makeTable("en", ""));
+    REQUIRE(bytes.isOk());
+    const std::vector<u8> valid = bytes.value();
+
+    REQUIRE(StringBundle::fromMemory({}).isError());
+
+    std::vector<u8> badMagic = valid;
+    badMagic[0] = 'X';
+    REQUIRE(StringBundle::fromMemory(badMagic).isError());
+
+    for (usize size : {usize{8}, usize{44}, valid.size() / 2, valid.size() - 1}) {
+        std::vector<u8> truncated(valid.begin(), valid.begin() + static_cast<std::ptrdiff_t>(size));
+        REQUIRE(StringBundle::fromMemory(truncated).isError());
+    }
+
+    REQUIRE(StringBundle::open("/nonexistent/strings.nmlb").isError());
+}
+
+TEST_CASE("StringBundle opens compiled files", "[localization]")
+{
+    const auto path = (std::filesystem::temp_directory_path() / "novelmind_bundle_test.nmlb").string();
+    REQUIRE(StringBundle::compileToFile(makeTable("ru", "ru:"), path).isOk());
+
+    {
+        auto bundle = StringBundle::open(path);
+        REQUIRE(bundle.isOk());
+        REQUIRE(bundle.value().find("greeting") == "ru:hello");
+        REQUIRE(bundle.value().getLocale().language == "ru");
+    }
+
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("LocalizationManager serves bundle strings without copies", "[localization]")
+{
+    LocalizationManager manager;
+    auto en = StringBundle::compile(makeTable("en", "en:"));
+    auto ru = StringBundle::compile(makeTable("ru", "ru:"));
+    REQUIRE(en.isOk());
+    REQUIRE(ru.isOk());
+    REQUIRE(manager.loadBundleFromMemory(LocaleId("en"), std::move(en).value()).isOk());
+    REQUIRE(manager.loadBundleFromMemory(LocaleId("ru"), std::move(ru).value()).isOk());
+
+    REQUIRE(manager.isLocaleAvailable(LocaleId("ru")));
+    REQUIRE(manager.getAvailableLocales().size() == 2);
+    REQUIRE(manager.getView("greeting") == "en:hello");
+    REQUIRE(manager.get("menu.start") == "en:start");
+    REQUIRE(manager.getPlural("apples", 1) == "en:{count} apple");
+
+    // Views point into the bundle, and switching needs no reload
+    const std::string_view enView = manager.getView("greeting");
+    REQUIRE(manager.getView("greeting").data() == enView.data());
+    manager.setCurrentLocale(LocaleId("ru"));
+    REQUIRE(manager.getView("greeting") == "ru:hello");
+    REQUIRE(manager.getPluralView("apples", 3) == "ru:{count} apples");
+    REQUIRE(manager.getForLocale(LocaleId("en"), "greeting") == "en:hello");
+
+    // Table strings override the bundle; missing strings fall back to the default locale
+    manager.setString(LocaleId("ru"), "greeting", "override");
+    manager.setString(LocaleId("en"), "only_en", "english only");
+    std::vector<std::string> missing;
+    manager.setOnStringMissing(
+        [&missing](const std::string& id, const LocaleId&) { missing.push_back(id); });
+    REQUIRE(manager.getView("greeting") == "override");
+    REQUIRE(manager.getView("menu.start") == "ru:start");
+    REQUIRE(manager.getView("only_en") == "english only");
+    REQUIRE(manager.getView("nope") == "nope");
+    REQUIRE(missing == std::vector<std::string>{"only_en", "nope"});
+
+    manager.unloadLocale(LocaleId("ru"));
+    REQUIRE_FALSE(manager.isLocaleAvailable(LocaleId("ru")));
+    REQUIRE(manager.getView("menu.start") == "en:start");
+}
@@ -0,0 +1,113 @@
+#include <catch2/catch_test_macros.hpp>
+#include "NovelMind/localization/localization_manager.hpp"
+#include "NovelMind/localization/string_template.hpp"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace NovelMind::localization;
+
+TEST_CASE("StringTemplate substitutes placeholders in one pass", "[localization]")
+{
+    const std::unordered_map<std::string, std::string> vars = {
+        {"name", "Alice"}, {"count", "3"}, {"other", "{name}"}};
+
+    REQUIRE(StringTemplate("Hello, {name}!").format(vars) == "Hello, Alice!");
+    REQUIRE(StringTemplate("{name}{name} has {count}").format(vars) == "AliceAlice has 3");
+    REQUIRE(StringTemplate("plain text").format(vars) == "plain text");
+    REQUIRE(StringTemplate("").format(vars).empty());
+
+    // Unknown placeholders and stray braces are kept as written
+    REQUIRE(StringTemplate("{unknown} {name}").format(vars) == "{unknown} Alice");
+    REQUIRE(StringTemplate("{} { {{name}} {name").format(vars) == "{} { {Alice} {name");
+    REQUIRE(StringTemplate("a}b{name}}").format(vars) == "a}bAlice}");
+
+    // Values are not scanned for placeholders again
+    REQUIRE(StringTemplate("{other}").format(vars) == "{name}");
+
+    const StringTemplate parsed("Hi {name}");
+    REQUIRE(parsed.hasPlaceholders());
+    REQUIRE_FALSE(StringTemplate("Hi").hasPlaceholders());
+
+    // formatTo appends, and the uncached form agrees with the template
+    std::string out = "> ";
+    parsed.formatTo(out, vars);
+    StringTemplate::formatTo(out, " / Hi {name}", vars);
+    REQUIRE(out == "> Hi Alice / Hi Alice");
+}
+
+TEST_CASE("LocalizationManager caches templates per string id", "[localization]")
+{
+    LocalizationManager manager;
+    const LocaleId en("en");
+    manager.setString(en, "greet", "Hello, {name}!");
+    manager.getStringTableMutable(en)->addPluralString(
+        "items", {{PluralCategory::One, "{name} has one item"},
+                  {PluralCategory::Other, "{name} has {count} items"}});
+
+    std::unordered_map<std::string, std::string> vars = {{"name", "Bob"}, {"count", "5"}};
+
+    std::string line;
+    manager.format(line, "greet", vars);
+    REQUIRE(line == "Hello, Bob!");
+    line.clear();
+    manager.format(line, "greet", vars);
+    REQUIRE(line == "Hello, Bob!");
+    REQUIRE(manager.getTemplateCacheSize() == 1);
+
+    REQUIRE(manager.getPlural("items", 1, vars) == "Bob has one item");
+    REQUIRE(manager.getPlural("items", 5, vars) == "Bob has 5 items");
+    REQUIRE(manager.getPlural("items", 1, vars) == "Bob has one item");
+    REQUIRE(manager.getTemplateCacheSize() == 3);
+
+    // Edits are picked up even though the id is cached
+    manager.setString(en, "greet", "Hi {name}");
+    REQUIRE(manager.get("greet", vars) == "Hi Bob");
+
+    // Missing strings format as their id
+    line.clear();
+    manager.format(line, "missing.{name}", vars);
+    REQUIRE(line == "missing.Bob");
+
+    // Switching locale drops the cache
+    manager.setCurrentLocale(LocaleId("de"));
+    REQUIRE(manager.getTemplateCacheSize() == 0);
+    REQUIRE(manager.get("greet", vars) == "Hi Bob");
+
+    REQUIRE(manager.interpolate("{name} and {name}", vars) == "Bob and Bob");
+}
+
+TEST_CASE("LocalizationManager formats from several threads", "[localization]")
+{
+    LocalizationManager manager;
+    const LocaleId en("en");
+    for (int i = 0; i < 32; ++i) {
+        manager.setString(en, "line." + std::to_string(i), "{name} says " + std::to_string(i));
+    }
+
+    const std::unordered_map<std::string, std::string> vars = {{"name", "Eve"}};
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            std::string line;
+            for (int round = 0; round < 200; ++round) {
+                for (int i = 0; i < 32; ++i) {
+                    line.clear();
+                    manager.format(line, "line." + std::to_string(i), vars);
+                    if (line != "Eve says " + std::to_string(i)) {
+                        mismatches.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(mismatches.load() == 0);
+    REQUIRE(manager.getTemplateCacheSize() == 32);
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "NovelMind/renderer/texture.hpp"
+#include <string>
 
 using namespace NovelMind;
 using namespace NovelMind::renderer;
@@ -42,3 +43,21 @@ TEST_CASE("Texture::loadFromMemory decodes PNG data", "[texture][.requires_graph
     SUCCEED("Test skipped - no graphics context");
   }
 }
+
+TEST_CASE("Texture::decode produces RGBA pixels without a GPU", "[texture]") {
+  // 2x1 binary PPM: red, green
+  const std::string ppm = std::string("P6\n2 1\n255\n") +
+                          std::string("\xFF\x00\x00\x00\xFF\x00", 6);
+  std::vector<u8> data(ppm.begin(), ppm.end());
+
+  auto decoded = Texture::decode(data);
+  REQUIRE(decoded.isOk());
+  CHECK(decoded.value().width == 2);
+  CHECK(decoded.value().height == 1);
+  CHECK(decoded.value().pixels ==
+        std::vector<u8>{0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF});
+
+  CHECK(Texture::decode({}).isError());
+  std::vector<u8> garbage = {1, 2, 3, 4};
+  CHECK(Texture::decode(garbage).isError());
+}
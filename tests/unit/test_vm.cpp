@@ -1045,3 +1045,210 @@ TEST_CASE("test_vm_division_normal_operations", "[scripting][division]")
         REQUIRE(std::get<NovelMind::i32>(result) == 1);
     }
 }
+
+TEST_CASE("VM linked variable slots", "[scripting][vm]")
+{
+    VirtualMachine vm;
+
+    SECTION("Variables set by name before load are visible to bytecode") {
+        vm.setVariable("counter", NovelMind::i32{41});
+
+        std::vector<Instruction> program = {
+            {OpCode::LOAD_VAR, 0},
+            {OpCode::PUSH_INT, 1},
+            {OpCode::ADD, 0},
+            {OpCode::STORE_VAR, 0},
+            {OpCode::HALT, 0}
+        };
+
+        vm.load(program, {"counter"});
+        vm.run();
+
+        REQUIRE(std::get<NovelMind::i32>(vm.getVariable("counter")) == 42);
+    }
+
+    SECTION("Variables persist across reloads") {
+        std::vector<Instruction> store = {
+            {OpCode::PUSH_INT, 7},
+            {OpCode::STORE_VAR, 0},
+            {OpCode::HALT, 0}
+        };
+        vm.load(store, {"x"});
+        vm.run();
+
+        // Second program uses a different string table layout
+        std::vector<Instruction> load = {
+            {OpCode::LOAD_VAR, 1},
+            {OpCode::STORE_GLOBAL, 0},
+            {OpCode::HALT, 0}
+        };
+        vm.load(load, {"y", "x"});
+        vm.run();
+
+        REQUIRE(std::get<NovelMind::i32>(vm.getVariable("y")) == 7);
+    }
+
+    SECTION("Referenced but unassigned names stay undefined") {
+        std::vector<Instruction> program = {
+            {OpCode::LOAD_VAR, 0},
+            {OpCode::POP, 0},
+            {OpCode::CHECK_FLAG, 1},
+            {OpCode::POP, 0},
+            {OpCode::HALT, 0}
+        };
+        vm.load(program, {"unset", "unset_flag"});
+        vm.run();
+
+        REQUIRE_FALSE(vm.hasVariable("unset"));
+        REQUIRE(vm.getAllVariables().empty());
+        REQUIRE(vm.getAllFlags().empty());
+    }
+
+    SECTION("Flags written by bytecode are visible by name") {
+        std::vector<Instruction> program = {
+            {OpCode::PUSH_BOOL, 1},
+            {OpCode::SET_FLAG, 0},
+            {OpCode::HALT, 0}
+        };
+        vm.load(program, {"met_alice"});
+        vm.run();
+
+        REQUIRE(vm.getFlag("met_alice"));
+        auto flags = vm.getAllFlags();
+        REQUIRE(flags.size() == 1);
+        REQUIRE(flags["met_alice"]);
+    }
+
+    SECTION("Invalid variable operand halts") {
+        std::vector<Instruction> program = {
+            {OpCode::LOAD_VAR, 5},
+            {OpCode::HALT, 0}
+        };
+        vm.load(program, {"only"});
+        vm.run();
+
+        REQUIRE(vm.isHalted());
+    }
+}
+
+TEST_CASE("VM fast dispatch matches single-stepping", "[scripting][vm]")
+{
+    std::vector<Instruction> program = {
+        {OpCode::PUSH_STRING, 1},   // "a"
+        {OpCode::PUSH_INT, 2},
+        {OpCode::ADD, 0},           // "a2"
+        {OpCode::STORE_VAR, 0},
+        {OpCode::PUSH_INT, 7},
+        {OpCode::PUSH_INT, 2},
+        {OpCode::MOD, 0},
+        {OpCode::PUSH_BOOL, 1},
+        {OpCode::SET_FLAG, 2},
+        {OpCode::CHECK_FLAG, 2},
+        {OpCode::JUMP_IF_NOT, 0},
+        {OpCode::PUSH_INT, 0},
+        {OpCode::DIV, 0},           // 1 / 0 -> runtime error
+        {OpCode::HALT, 0}
+    };
+    std::vector<std::string> strings = {"text", "a", "seen"};
+
+    VirtualMachine fast;
+    fast.load(program, strings);
+    fast.run();
+
+    VirtualMachine stepped;
+    stepped.load(program, strings);
+    while (stepped.step()) {
+    }
+
+    REQUIRE(fast.isHalted());
+    REQUIRE(stepped.isHalted());
+    REQUIRE(fast.getIP() == stepped.getIP());
+    REQUIRE(std::get<std::string>(fast.getVariable("text")) == "a2");
+    REQUIRE(fast.getFlag("seen"));
+    REQUIRE(fast.getStack().size() == stepped.getStack().size());
+}
+
+TEST_CASE("VM superinstructions match single-stepping", "[scripting][vm]")
+{
+    // i = start; while (i < 100) i = i + 1;
+    std::vector<Instruction> program = {
+        {OpCode::LOAD_VAR, 0},
+        {OpCode::PUSH_INT, 100},
+        {OpCode::LT, 0},
+        {OpCode::JUMP_IF_NOT, 9},
+        {OpCode::LOAD_VAR, 0},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 0},
+        {OpCode::JUMP, 0},
+        {OpCode::HALT, 0}
+    };
+    std::vector<std::string> strings = {"i"};
+
+    SECTION("integer variable")
+    {
+        VirtualMachine fast;
+        fast.load(program, strings);
+        fast.setVariable("i", 0);
+        fast.run();
+
+        VirtualMachine stepped;
+        stepped.load(program, strings);
+        stepped.setVariable("i", 0);
+        while (stepped.step()) {
+        }
+
+        REQUIRE(fast.isHalted());
+        REQUIRE(std::get<NovelMind::i32>(fast.getVariable("i")) == 100);
+        REQUIRE(fast.getVariable("i") == stepped.getVariable("i"));
+        REQUIRE(fast.getStack().empty());
+    }
+
+    SECTION("float variable takes the generic path")
+    {
+        VirtualMachine fast;
+        fast.load(program, strings);
+        fast.setVariable("i", 97.5f);
+        fast.run();
+
+        REQUIRE(fast.isHalted());
+        REQUIRE(std::get<NovelMind::f32>(fast.getVariable("i")) == 100.5f);
+    }
+}
+
+TEST_CASE("VM reclaims concatenated strings nothing references", "[scripting][vm]")
+{
+    // kept = "k" + "ept"; for (i = 0; i < 5000; i = i + 1) s = "x" + i;
+    std::vector<Instruction> program = {
+        {OpCode::PUSH_STRING, 4},   // "k"
+        {OpCode::PUSH_STRING, 5},   // "ept"
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 3},     // kept
+        {OpCode::PUSH_INT, 0},
+        {OpCode::STORE_VAR, 1},     // i
+        {OpCode::LOAD_VAR, 1},
+        {OpCode::PUSH_INT, 5000},
+        {OpCode::LT, 0},
+        {OpCode::JUMP_IF_NOT, 19},
+        {OpCode::PUSH_STRING, 2},   // "x"
+        {OpCode::LOAD_VAR, 1},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 0},     // s
+        {OpCode::LOAD_VAR, 1},
+        {OpCode::PUSH_INT, 1},
+        {OpCode::ADD, 0},
+        {OpCode::STORE_VAR, 1},
+        {OpCode::JUMP, 6},
+        {OpCode::HALT, 0}
+    };
+    std::vector<std::string> strings = {"s", "i", "x", "kept", "k", "ept"};
+
+    VirtualMachine vm;
+    REQUIRE(vm.load(program, strings).isOk());
+    vm.run();
+
+    REQUIRE(vm.isHalted());
+    REQUIRE(std::get<std::string>(vm.getVariable("s")) == "x4999");
+    REQUIRE(std::get<std::string>(vm.getVariable("kept")) == "kept");
+    REQUIRE(vm.getInternedStringCount() < 2500);
+}